@@ -1,11 +1,20 @@
+#include <algorithm>
 #include <memory>
+#include <random>
+#include <thread>
 #include <vector>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -28,4 +37,87 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Aggregate)(benchmark::State& state) {
   }
 }
 
+// Generates a table with the columns customer_id, day, and amount. The rows are uniformly distributed over the
+// customers and days.
+static std::shared_ptr<Table> generate_order_table(const size_t row_count, const int32_t customer_count,
+                                                   const int32_t day_count) {
+  auto generator = std::mt19937{42};
+  auto customer_distribution = std::uniform_int_distribution<int32_t>{0, customer_count - 1};
+  auto day_distribution = std::uniform_int_distribution<int32_t>{0, day_count - 1};
+  auto amount_distribution = std::uniform_int_distribution<int32_t>{1, 1'000};
+
+  const auto column_definitions = TableColumnDefinitions{
+      {"customer_id", DataType::Int, false}, {"day", DataType::Int, false}, {"amount", DataType::Int, false}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_count; chunk_begin += Chunk::DEFAULT_SIZE) {
+    const auto chunk_size = std::min(row_count - chunk_begin, static_cast<size_t>(Chunk::DEFAULT_SIZE));
+    auto customer_ids = pmr_vector<int32_t>(chunk_size);
+    auto days = pmr_vector<int32_t>(chunk_size);
+    auto amounts = pmr_vector<int32_t>(chunk_size);
+    for (auto chunk_offset = size_t{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      customer_ids[chunk_offset] = customer_distribution(generator);
+      days[chunk_offset] = day_distribution(generator);
+      amounts[chunk_offset] = amount_distribution(generator);
+    }
+
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(customer_ids)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(days)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(amounts))});
+  }
+
+  return table;
+}
+
+// Scaling study of the parallel pre-aggregation and partitioned merge of AggregateHash for
+// SELECT customer_id, day, SUM(amount), COUNT(*) FROM orders GROUP BY customer_id, day.
+// state.range(0) is the number of workers, state.range(1) the number of customers. With 10'000 customers, most of the
+// 3.65 million groups have one row, so that hardly anything is pre-aggregated and the merge dominates. With 10
+// customers, the 3'650 groups fit into the caches.
+static void BM_AggregateHashScaling(benchmark::State& state) {  // NOLINT
+  const auto worker_count = static_cast<uint32_t>(state.range(0));
+  const auto customer_count = static_cast<int32_t>(state.range(1));
+  constexpr auto ROW_COUNT = size_t{4'000'000};
+  constexpr auto DAY_COUNT = int32_t{365};
+
+  Hyrise::get().topology.use_default_topology(worker_count);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(generate_order_table(ROW_COUNT, customer_count, DAY_COUNT));
+  table_wrapper->execute();
+
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::static_pointer_cast<AggregateExpression>(sum_(pqp_column_(ColumnID{2}, DataType::Int, false, "amount"))),
+      std::static_pointer_cast<AggregateExpression>(
+          count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0} /* customer_id */, ColumnID{1} /* day */};
+
+  for (auto _ : state) {
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    aggregate->execute();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+// Doubles the number of workers up to the number of available cores
+static void aggregate_scaling_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_worker_count = static_cast<int64_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  for (const auto customer_count : {int64_t{10}, int64_t{10'000}}) {
+    for (auto worker_count = int64_t{1}; worker_count < max_worker_count; worker_count *= 2) {
+      benchmark->Args({worker_count, customer_count});
+    }
+    benchmark->Args({max_worker_count, customer_count});
+  }
+}
+
+BENCHMARK(BM_AggregateHashScaling)
+    ->ArgNames({"workers", "customers"})
+    ->Apply(aggregate_scaling_arguments)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
 }  // namespace opossum
@@ -16,17 +16,14 @@
 namespace opossum {
 
 static std::shared_ptr<Table> generate_custom_table(const size_t row_count, const DataType data_type = DataType::Int,
-                                                    const float null_ratio = 0.0f) {
+                                                    const float null_ratio = 0.0f, const size_t column_count = 2) {
   const auto table_generator = std::make_shared<SyntheticTableGenerator>();
 
-  constexpr auto NUM_COLUMNS = 2;
   constexpr auto LARGEST_VALUE = 10'000;
 
-  const std::vector<DataType> column_data_types = {NUM_COLUMNS, data_type};
-
   std::vector<ColumnSpecification> column_specifications =
-      std::vector(NUM_COLUMNS, ColumnSpecification(ColumnDataDistribution::make_uniform_config(0.0, LARGEST_VALUE),
-                                                   data_type, {EncodingType::Unencoded}, std::nullopt, null_ratio));
+      std::vector(column_count, ColumnSpecification(ColumnDataDistribution::make_uniform_config(0.0, LARGEST_VALUE),
+                                                    data_type, {EncodingType::Unencoded}, std::nullopt, null_ratio));
 
   return table_generator->generate_table(column_specifications, row_count);
 }
@@ -59,6 +56,44 @@ static void BM_Sort(benchmark::State& state, const size_t row_count = 40'000, co
   }
 }
 
+// Sorts by the first state.range(0) columns of a table with four columns, alternating between ascending and
+// descending order. state.range(1) selects the SortMode.
+static void BM_SortWithKeyColumns(benchmark::State& state, const DataType data_type) {
+  micro_benchmark_clear_cache();
+
+  constexpr auto ROW_COUNT = size_t{1'000'000};
+  constexpr auto COLUMN_COUNT = size_t{4};
+
+  const auto key_column_count = static_cast<size_t>(state.range(0));
+  const auto sort_mode = static_cast<SortMode>(state.range(1));
+
+  const auto input_table = generate_custom_table(ROW_COUNT, data_type, 0.1f, COLUMN_COUNT);
+  const auto input_operator = std::make_shared<TableWrapper>(input_table);
+  input_operator->execute();
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  for (auto column_id = ColumnID{0}; column_id < key_column_count; ++column_id) {
+    sort_definitions.emplace_back(column_id, column_id % 2 == 0 ? OrderByMode::Ascending : OrderByMode::Descending);
+  }
+
+  for (auto _ : state) {
+    auto sort = std::make_shared<Sort>(input_operator, sort_definitions, Chunk::DEFAULT_SIZE, sort_mode);
+    sort->execute();
+  }
+}
+
+static void key_column_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto sort_mode : {SortMode::Iterative, SortMode::NormalizedKey}) {
+    for (auto key_column_count = int64_t{1}; key_column_count <= 4; ++key_column_count) {
+      benchmark->Args({key_column_count, static_cast<int64_t>(sort_mode)});
+    }
+  }
+}
+
+static void BM_SortIntWithKeyColumns(benchmark::State& state) { BM_SortWithKeyColumns(state, DataType::Int); }
+
+static void BM_SortStringWithKeyColumns(benchmark::State& state) { BM_SortWithKeyColumns(state, DataType::String); }
+
 static void BM_SortWithVaryingRowCount(benchmark::State& state) {
   const size_t row_count = state.range(0);
   BM_Sort(state, row_count);
@@ -95,5 +130,7 @@ BENCHMARK(BM_SortWithNullValues)->RangeMultiplier(7)->Range(10, 1'000'000);
 BENCHMARK(BM_SortWithReferenceSegments)->RangeMultiplier(7)->Range(10, 1'000'000);
 BENCHMARK(BM_SortWithReferenceSegmentsTwoColumns)->RangeMultiplier(7)->Range(10, 1'000'000);
 BENCHMARK(BM_SortWithStrings)->RangeMultiplier(7)->Range(10, 1'000'000);
+BENCHMARK(BM_SortIntWithKeyColumns)->Apply(key_column_arguments);
+BENCHMARK(BM_SortStringWithKeyColumns)->Apply(key_column_arguments);
 
 }  // namespace opossum
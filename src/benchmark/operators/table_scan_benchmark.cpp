@@ -1,11 +1,15 @@
 #include <memory>
+#include <random>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/load_table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -83,4 +87,87 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& sta
   }
 }
 
+namespace {
+
+// Generates a dictionary-encoded table with a single integer column, whose values are uniformly distributed in
+// [0, distinct_value_count). The number of distinct values determines the width of the attribute vector. If
+// `as_reference_table` is set, a reference table that points to all rows of the data table is returned. Scanning it
+// iterates the attribute vectors via the position filter instead of using the SIMD kernels, which serves as a baseline.
+std::shared_ptr<TableWrapper> create_dictionary_table_wrapper(const int32_t distinct_value_count,
+                                                              const VectorCompressionType vector_compression_type,
+                                                              const bool as_reference_table) {
+  constexpr auto ROW_COUNT = size_t{10'000'000};
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+
+  auto random_engine = std::mt19937{};
+  auto value_distribution = std::uniform_int_distribution<int32_t>{0, distinct_value_count - 1};
+
+  auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE);
+  for (auto chunk_begin = size_t{0}; chunk_begin < ROW_COUNT; chunk_begin += Chunk::DEFAULT_SIZE) {
+    auto values = pmr_vector<int32_t>(std::min(size_t{Chunk::DEFAULT_SIZE}, ROW_COUNT - chunk_begin));
+    for (auto& value : values) {
+      value = value_distribution(random_engine);
+    }
+    data_table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+  }
+  ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{EncodingType::Dictionary, vector_compression_type});
+
+  auto table = data_table;
+  if (as_reference_table) {
+    table = std::make_shared<Table>(column_definitions, TableType::References);
+    const auto chunk_count = data_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk_size = data_table->get_chunk(chunk_id)->size();
+      auto pos_list = std::make_shared<RowIDPosList>(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
+      pos_list->guarantee_single_chunk();
+      table->append_chunk(Segments{std::make_shared<ReferenceSegment>(data_table, ColumnID{0}, pos_list)});
+    }
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+}  // namespace
+
+// Scans dictionary-encoded columns with varying attribute vector widths (state.range(0) is the number of distinct
+// values: 200 for 1-byte, 50,000 for 2-byte, and 1,000,000 for 4-byte value IDs), vector compressions
+// (state.range(1)), and selectivities (state.range(2) in per mille). state.range(3) selects whether the scan uses the
+// SIMD kernels on the data table (0) or the element-wise iteration on a reference table (1).
+static void BM_TableScan_DictionarySelectivity(benchmark::State& state) {
+  const auto distinct_value_count = static_cast<int32_t>(state.range(0));
+  const auto vector_compression_type = static_cast<VectorCompressionType>(state.range(1));
+  const auto selectivity_per_mille = state.range(2);
+  const auto as_reference_table = state.range(3) == 1;
+
+  const auto table_wrapper =
+      create_dictionary_table_wrapper(distinct_value_count, vector_compression_type, as_reference_table);
+  const auto search_value = static_cast<int32_t>(distinct_value_count * selectivity_per_mille / 1000);
+
+  micro_benchmark_clear_cache();
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::LessThan, search_value);
+}
+
+static void dictionary_selectivity_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto distinct_value_count : {int64_t{200}, int64_t{50'000}, int64_t{1'000'000}}) {
+    for (const auto vector_compression_type :
+         {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128}) {
+      for (const auto selectivity_per_mille : {int64_t{1}, int64_t{10}, int64_t{100}, int64_t{500}, int64_t{900}}) {
+        for (const auto as_reference_table : {int64_t{0}, int64_t{1}}) {
+          benchmark->Args({distinct_value_count, static_cast<int64_t>(vector_compression_type), selectivity_per_mille,
+                           as_reference_table});
+        }
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_TableScan_DictionarySelectivity)
+    ->ArgNames({"distinct_values", "vector_compression", "selectivity_per_mille", "reference_input"})
+    ->Apply(dictionary_selectivity_arguments);
+
 }  // namespace opossum
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "cache/sharded_clock_cache.hpp"
+#include "logical_query_plan/dummy_table_node.hpp"
+#include "sql/sql_plan_cache.hpp"
+
+namespace opossum {
+
+// Throughput of cache hits in an SQLLogicalPlanCache that is shared by state.range(1) threads, which is what the
+// server does for its sessions. state.range(0) selects the cache implementation: 0 is the default GDFS cache, where
+// every hit takes the cache's exclusive lock, and 1 is the ShardedClockCache.
+static void BM_PlanCacheHits(benchmark::State& state) {  // NOLINT
+  const auto use_sharded_cache = state.range(0) == 1;
+  const auto thread_count = static_cast<size_t>(state.range(1));
+  constexpr auto QUERY_COUNT = size_t{512};
+  constexpr auto LOOKUPS_PER_THREAD = size_t{100'000};
+
+  auto cache = SQLLogicalPlanCache{};
+  if (use_sharded_cache) {
+    cache.replace_cache_impl<ShardedClockCache<std::string, std::shared_ptr<AbstractLQPNode>>>(DefaultCacheCapacity);
+  }
+
+  auto queries = std::vector<std::string>{};
+  for (auto query_id = size_t{0}; query_id < QUERY_COUNT; ++query_id) {
+    queries.emplace_back("SELECT * FROM orders WHERE o_id = " + std::to_string(query_id));
+    cache.set(queries.back(), DummyTableNode::make());
+  }
+
+  for (auto _ : state) {
+    auto threads = std::vector<std::thread>{};
+    auto hit_count = std::atomic<size_t>{0};
+    for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+      threads.emplace_back([&, thread_id]() {
+        auto generator = std::mt19937{static_cast<uint32_t>(thread_id)};
+        auto query_distribution = std::uniform_int_distribution<size_t>{0, QUERY_COUNT - 1};
+
+        auto local_hit_count = size_t{0};
+        for (auto lookup = size_t{0}; lookup < LOOKUPS_PER_THREAD; ++lookup) {
+          if (cache.try_get(queries[query_distribution(generator)])) ++local_hit_count;
+        }
+        hit_count += local_hit_count;
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    benchmark::DoNotOptimize(hit_count.load());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * thread_count * LOOKUPS_PER_THREAD));
+}
+
+// Doubles the number of threads up to the number of available cores
+static void plan_cache_hits_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_thread_count = static_cast<int64_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  for (const auto use_sharded_cache : {int64_t{0}, int64_t{1}}) {
+    for (auto thread_count = int64_t{1}; thread_count < max_thread_count; thread_count *= 2) {
+      benchmark->Args({use_sharded_cache, thread_count});
+    }
+    benchmark->Args({use_sharded_cache, max_thread_count});
+  }
+}
+
+BENCHMARK(BM_PlanCacheHits)
+    ->ArgNames({"sharded", "threads"})
+    ->Apply(plan_cache_hits_arguments)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "hyrise.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace opossum {
+
+// Number of "operators" that run concurrently, each of which splits its work into many small JobTasks, similar to
+// TableScan or Validate processing one chunk per job.
+constexpr auto CONCURRENT_OPERATOR_COUNT = size_t{64};
+constexpr auto JOBS_PER_OPERATOR = size_t{256};
+
+static void BM_Scheduler(benchmark::State& state, const TaskQueueMode task_queue_mode) {  // NOLINT
+  const auto worker_count = static_cast<uint32_t>(state.range(0));
+  const auto values_per_job = static_cast<size_t>(state.range(1));
+
+  Hyrise::get().topology.use_default_topology(worker_count);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(task_queue_mode));
+
+  auto values = std::vector<int32_t>(JOBS_PER_OPERATOR * values_per_job);
+  std::iota(values.begin(), values.end(), 0);
+
+  for (auto _ : state) {
+    auto sum = std::atomic<int64_t>{0};
+
+    auto operator_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    operator_tasks.reserve(CONCURRENT_OPERATOR_COUNT);
+    for (auto operator_index = size_t{0}; operator_index < CONCURRENT_OPERATOR_COUNT; ++operator_index) {
+      operator_tasks.emplace_back(std::make_shared<JobTask>([&]() {
+        auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+        jobs.reserve(JOBS_PER_OPERATOR);
+        for (auto job_index = size_t{0}; job_index < JOBS_PER_OPERATOR; ++job_index) {
+          jobs.emplace_back(std::make_shared<JobTask>([&, job_index]() {
+            const auto begin = values.begin() + job_index * values_per_job;
+            sum += std::accumulate(begin, begin + values_per_job, int64_t{0});
+          }));
+        }
+        Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(operator_tasks);
+
+    benchmark::DoNotOptimize(sum.load());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * CONCURRENT_OPERATOR_COUNT * JOBS_PER_OPERATOR));
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+// Doubles the number of workers up to the number of available cores. Each job either does hardly any work or sums up
+// a few thousand values, so that both the scheduling overhead and the scheduling of realistic jobs are measured.
+static void worker_count_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_worker_count = static_cast<int64_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  for (const auto values_per_job : {int64_t{16}, int64_t{4'096}}) {
+    for (auto worker_count = int64_t{1}; worker_count < max_worker_count; worker_count *= 2) {
+      benchmark->Args({worker_count, values_per_job});
+    }
+    benchmark->Args({max_worker_count, values_per_job});
+  }
+}
+
+BENCHMARK_CAPTURE(BM_Scheduler, NodeQueues, TaskQueueMode::NodeQueues)
+    ->ArgNames({"workers", "values_per_job"})
+    ->Apply(worker_count_arguments)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scheduler, WorkStealingDeques, TaskQueueMode::WorkStealingDeques)
+    ->ArgNames({"workers", "values_per_job"})
+    ->Apply(worker_count_arguments)
+    ->UseRealTime();
+
+}  // namespace opossum
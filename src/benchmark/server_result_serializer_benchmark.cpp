@@ -0,0 +1,75 @@
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "benchmark/benchmark.h"
+
+#include "server/postgres_protocol_handler.hpp"
+#include "server/result_serializer.hpp"
+#include "synthetic_table_generator.hpp"
+
+namespace opossum {
+
+constexpr auto RESULT_ROW_COUNT = size_t{10'000'000};
+
+// A result as it might be requested by a BI tool: two integral columns, a floating-point column, and a string column,
+// dictionary-encoded as it would be when read from a stored table.
+static std::shared_ptr<Table> result_table() {
+  static const auto table = [] {
+    const auto distribution = ColumnDataDistribution::make_uniform_config(0.0, 1'000'000.0);
+    const auto encoding = SegmentEncodingSpec{EncodingType::Dictionary};
+    const auto column_specifications = std::vector<ColumnSpecification>{
+        ColumnSpecification(distribution, DataType::Int, encoding, "id"),
+        ColumnSpecification(distribution, DataType::Long, encoding, "quantity"),
+        ColumnSpecification(distribution, DataType::Double, encoding, "price", 0.1f),
+        ColumnSpecification(distribution, DataType::String, encoding, "comment")};
+    return SyntheticTableGenerator::generate_table(column_specifications, RESULT_ROW_COUNT);
+  }();
+  return table;
+}
+
+// Streams the result through a local TCP connection, i.e., the same path that the data takes from a Session to a
+// client on the same machine. The client only counts the bytes that it receives.
+static void BM_ResultSerializer(benchmark::State& state, const FormatCode format_code) {  // NOLINT
+  const auto table = result_table();
+
+  auto io_service = boost::asio::io_service{};
+  const auto endpoint = boost::asio::ip::tcp::endpoint{boost::asio::ip::address_v4::loopback(), 0};
+  auto acceptor = boost::asio::ip::tcp::acceptor{io_service, endpoint};
+  auto client_socket = boost::asio::ip::tcp::socket{io_service};
+  client_socket.connect(acceptor.local_endpoint());
+  const auto server_socket = std::make_shared<Socket>(io_service);
+  acceptor.accept(*server_socket);
+
+  auto received_bytes = size_t{0};
+  auto client = std::thread([&]() {
+    auto buffer = std::array<char, 1 << 16>{};
+    auto error_code = boost::system::error_code{};
+    while (!error_code) {
+      received_bytes += client_socket.read_some(boost::asio::buffer(buffer), error_code);
+    }
+  });
+
+  const auto postgres_protocol_handler = std::make_shared<PostgresProtocolHandler<Socket>>(server_socket);
+  for (auto _ : state) {
+    ResultSerializer::send_table_description(table, postgres_protocol_handler, {format_code});
+    ResultSerializer::send_query_response(table, postgres_protocol_handler, {format_code});
+    postgres_protocol_handler->send_command_complete(
+        ResultSerializer::build_command_complete_message(OperatorType::Projection, RESULT_ROW_COUNT));
+    postgres_protocol_handler->force_flush();
+  }
+
+  server_socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both);
+  client.join();
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * RESULT_ROW_COUNT));
+  state.SetBytesProcessed(static_cast<int64_t>(received_bytes));
+}
+
+BENCHMARK_CAPTURE(BM_ResultSerializer, TextFormat, FormatCode::Text)->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK_CAPTURE(BM_ResultSerializer, BinaryFormat, FormatCode::Binary)->Unit(benchmark::kMillisecond)->Iterations(3);
+
+}  // namespace opossum
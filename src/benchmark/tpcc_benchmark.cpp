@@ -1,10 +1,13 @@
 #include "tpcc/tpcc_table_generator.hpp"
 
 #include <algorithm>
+#include <cstdio>
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
 
@@ -19,7 +22,11 @@ using namespace opossum;  // NOLINT
  * Other limitations (that may be removed in the future):
  *  - No primary / foreign keys are used as they are currently unsupported
  *  - Values that are "retrieved" by the terminal are just selected, but not necessarily materialized
- *  - Data is not persisted as logging is currently unsupported; this means that the durability tests are not executed
+ *  - Data is only persisted if a write-ahead log is given (--wal_file); even then, the durability tests are not
+ *    executed. Comparing runs with and without --wal_file shows the cost of logging and group commit.
+ *  - The procedures do not use prepared statements, but send SQL strings with the values inlined, as an ORM would.
+ *    Comparing runs with and without --parameterized_plan_cache shows how much of the parsing, translation, and
+ *    optimization costs are saved by caching plans for statements that only differ in their literals.
  *  - As decimals are not supported, we use floats instead
  *  - The delivery transaction is not executed in a "deferred" mode; as such, no delivery result file is written
  *  - We do not execute the isolation tests, as we consider our MVCC tests to be sufficient
@@ -41,12 +48,16 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("wal_file", "Log committed transactions to the given write-ahead log file, which is overwritten", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("parameterized_plan_cache", "Cache the optimized plans of statements that only differ in their literals", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> config;
   size_t num_warehouses;
   bool consistency_checks;
+  std::string wal_file;
+  bool parameterized_plan_cache;
 
   // Parse command line args
   const auto cli_parse_result = cli_options.parse(argc, argv);
@@ -55,6 +66,8 @@ int main(int argc, char* argv[]) {
 
   num_warehouses = cli_parse_result["scale"].as<size_t>();
   consistency_checks = cli_parse_result["consistency_checks"].as<bool>();
+  wal_file = cli_parse_result["wal_file"].as<std::string>();
+  parameterized_plan_cache = cli_parse_result["parameterized_plan_cache"].as<bool>();
 
   config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
@@ -68,12 +81,40 @@ int main(int argc, char* argv[]) {
 
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
+  context.emplace("wal_file", wal_file);
+  context.emplace("parameterized_plan_cache", parameterized_plan_cache);
 
-  // Run the benchmark
+  // Run the benchmark. The tables are generated when the BenchmarkRunner is created, so logging is only enabled
+  // afterwards. Otherwise, the initial data would be logged as well.
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
-  BenchmarkRunner(*config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config),
-                  context)
-      .run();
+  auto benchmark_runner = BenchmarkRunner{*config, std::move(item_runner),
+                                          std::make_unique<TPCCTableGenerator>(num_warehouses, config), context};
+
+  // The BenchmarkRunner sets up the default plan caches, so the parameterized plan cache is added afterwards
+  if (parameterized_plan_cache) {
+    std::cout << "- Caching plans of statements that only differ in their literals" << std::endl;
+    Hyrise::get().default_parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
+  }
+
+  auto& log_manager = Hyrise::get().log_manager;
+  if (!wal_file.empty()) {
+    std::cout << "- Logging committed transactions to " << wal_file << std::endl;
+    std::remove(wal_file.c_str());
+    log_manager.enable(wal_file);
+  }
+
+  benchmark_runner.run();
+
+  if (!wal_file.empty()) {
+    log_manager.disable();
+
+    const auto entry_count = log_manager.written_entry_count();
+    const auto sync_count = log_manager.sync_count();
+    std::cout << "- Wrote " << entry_count << " log entries (" << log_manager.written_byte_count() << " bytes) with "
+              << sync_count << " syncs, i.e., "
+              << (sync_count > 0 ? static_cast<double>(entry_count) / static_cast<double>(sync_count) : 0.0)
+              << " commits per group" << std::endl;
+  }
 
   if (consistency_checks || config->verify) {
     std::cout << "- Running consistency checks at the end of the benchmark" << std::endl;
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <thread>
+
 #include "benchmark/benchmark.h"
 
 #include "hyrise.hpp"
@@ -7,15 +10,32 @@ namespace opossum {
 
 /**
  * This benchmark can only be use as a starting point for investigating TPCHTableGenerator performance, since secondary
- * invocations of 'TPCHTableGenerator(scale_factor, 1000).generate();' will profit from cached data in tpch-dbgen
+ * invocations of 'TPCHTableGenerator(scale_factor, 1000).generate();' will profit from cached data in tpch-dbgen.
+ * state.range(0) is the number of processes that generate the tables. With a single process, the tables are generated
+ * serially in the benchmark process.
  * @param state
  */
 static void BM_TPCHTableGenerator(benchmark::State& state) {  // NOLINT
+  const auto process_count = static_cast<uint32_t>(state.range(0));
   for (auto _ : state) {
-    TPCHTableGenerator(0.5f, 1000).generate_and_store();
+    TPCHTableGenerator(0.5f, 1000, process_count).generate_and_store();
     Hyrise::reset();
   }
 }
-BENCHMARK(BM_TPCHTableGenerator);
+
+// Doubles the number of processes up to the number of available cores
+static void tpch_table_generator_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_process_count = static_cast<int64_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  for (auto process_count = int64_t{1}; process_count < max_process_count; process_count *= 2) {
+    benchmark->Arg(process_count);
+  }
+  benchmark->Arg(max_process_count);
+}
+
+BENCHMARK(BM_TPCHTableGenerator)
+    ->ArgName("processes")
+    ->Apply(tpch_table_generator_arguments)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
 
 }  // namespace opossum
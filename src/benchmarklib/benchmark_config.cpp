@@ -10,7 +10,8 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
                                  const bool init_enable_scheduler, const uint32_t init_cores,
                                  const uint32_t init_clients, const bool init_enable_visualization,
                                  const bool init_verify, const bool init_cache_binary_tables,
-                                 const bool init_sql_metrics)
+                                 const bool init_sql_metrics, const ExecutionMode init_execution_mode,
+                                 const bool init_parallel_table_generation)
     : benchmark_mode(init_benchmark_mode),
       chunk_size(init_chunk_size),
       encoding_config(init_encoding_config),
@@ -25,7 +26,9 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
       enable_visualization(init_enable_visualization),
       verify(init_verify),
       cache_binary_tables(init_cache_binary_tables),
-      sql_metrics(init_sql_metrics) {}
+      sql_metrics(init_sql_metrics),
+      execution_mode(init_execution_mode),
+      parallel_table_generation(init_parallel_table_generation) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() { return BenchmarkConfig(); }
 
@@ -23,7 +23,8 @@ class BenchmarkConfig {
                   const Duration& max_duration, const Duration& warmup_duration,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables, const bool sql_metrics);
+                  const bool cache_binary_tables, const bool sql_metrics, const ExecutionMode execution_mode,
+                  const bool parallel_table_generation);
 
   static BenchmarkConfig get_default_config();
 
@@ -42,6 +43,8 @@ class BenchmarkConfig {
   bool verify = false;
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool sql_metrics = false;
+  ExecutionMode execution_mode = ExecutionMode::Materializing;
+  bool parallel_table_generation = false;  // Generate tables in one process per core (see --cores), TPC-H only
 
  private:
   BenchmarkConfig() = default;
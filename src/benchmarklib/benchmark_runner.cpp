@@ -418,12 +418,14 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("compression", "Specify vector compression as a string. Options: " + compression_strings_option, cxxopts::value<std::string>()->default_value(""))  // NOLINT
     ("indexes", "Create indexes (where defined by benchmark)", cxxopts::value<bool>()->default_value("false"))  // NOLINT
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint32_t>()->default_value("0")) // NOLINT
+    ("cores", "Specify the number of cores used by the scheduler (if active) and for generating tables (see --parallel_table_generation). 0 means all available cores", cxxopts::value<uint32_t>()->default_value("0")) // NOLINT
     ("clients", "Specify how many items should run in parallel if the scheduler is active", cxxopts::value<uint32_t>()->default_value("1")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query, do not properly run the benchmark", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value(default_dont_cache_binary_tables)) // NOLINT
-    ("sql_metrics", "Track SQL metrics (parse time etc.) for each SQL query and add it to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("sql_metrics", "Track SQL metrics (parse time etc.) for each SQL query and add it to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("pipelined", "Execute chains of operators that process their input chunk by chunk morsel-wise (see OperatorPipeline)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("parallel_table_generation", "Generate the tables in one forked process per core (see --cores). Only supported by TPC-H", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -462,6 +464,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
+      {"execution_mode", config.execution_mode == ExecutionMode::Pipelined ? "Pipelined" : "Materializing"},
+      {"parallel_table_generation", config.parallel_table_generation},
       {"time_unit", "ns"},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
@@ -8,10 +8,12 @@
 
 namespace opossum {
 BenchmarkSQLExecutor::BenchmarkSQLExecutor(const std::shared_ptr<SQLiteWrapper>& sqlite_wrapper,
-                                           const std::optional<std::string>& visualize_prefix)
+                                           const std::optional<std::string>& visualize_prefix,
+                                           const ExecutionMode execution_mode)
     : _sqlite_connection(sqlite_wrapper ? std::optional<SQLiteWrapper::Connection>{sqlite_wrapper->new_connection()}
                                         : std::optional<SQLiteWrapper::Connection>{}),
-      _visualize_prefix(visualize_prefix) {
+      _visualize_prefix(visualize_prefix),
+      _execution_mode(execution_mode) {
   if (_sqlite_connection) {
     _sqlite_connection->raw_execute_query("BEGIN TRANSACTION");
     _sqlite_transaction_open = true;
@@ -21,6 +23,7 @@ BenchmarkSQLExecutor::BenchmarkSQLExecutor(const std::shared_ptr<SQLiteWrapper>&
 std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> BenchmarkSQLExecutor::execute(
     const std::string& sql, const std::shared_ptr<const Table>& expected_result_table) {
   auto pipeline_builder = SQLPipelineBuilder{sql};
+  pipeline_builder.with_execution_mode(_execution_mode);
   if (transaction_context) pipeline_builder.with_transaction_context(transaction_context);
 
   auto pipeline = pipeline_builder.create_pipeline();
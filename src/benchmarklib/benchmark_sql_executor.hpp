@@ -14,8 +14,10 @@ class BenchmarkSQLExecutor {
  public:
   // @param visualize_prefix    Prefix for the filename of the generated query plans (e.g., "TPC-H_6-").
   //                            The suffix will be "LQP/PQP-<statement_idx>.<extension>"
+  // @param execution_mode      How the operators of the queries are executed, see ExecutionMode
   BenchmarkSQLExecutor(const std::shared_ptr<SQLiteWrapper>& sqlite_wrapper,
-                       const std::optional<std::string>& visualize_prefix);
+                       const std::optional<std::string>& visualize_prefix,
+                       const ExecutionMode execution_mode = ExecutionMode::Materializing);
 
   ~BenchmarkSQLExecutor();
 
@@ -48,6 +50,7 @@ class BenchmarkSQLExecutor {
   bool _sqlite_transaction_open{false};
 
   const std::optional<std::string> _visualize_prefix;
+  const ExecutionMode _execution_mode;
   uint64_t _num_visualized_plans{0};
 };
 
@@ -32,7 +32,13 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
   const auto clients = parse_result["clients"].as<uint32_t>();
   std::cout << "- " + std::to_string(clients) + " simulated clients are scheduling items in parallel" << std::endl;
 
-  if (cores != default_config.cores || clients != default_config.clients) {
+  const auto parallel_table_generation = parse_result["parallel_table_generation"].as<bool>();
+  if (parallel_table_generation) {
+    std::cout << "- Generating tables in " << number_of_cores_str << " processes (if supported by the benchmark)"
+              << std::endl;
+  }
+
+  if ((cores != default_config.cores && !parallel_table_generation) || clients != default_config.clients) {
     if (!enable_scheduler) {
       PerformanceWarning("'--cores' or '--clients' specified but ignored, because '--scheduler' is false");
     }
@@ -129,10 +135,31 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL metrics" << std::endl;
   }
 
-  return BenchmarkConfig{
-      benchmark_mode,  chunk_size,          *encoding_config, indexes, max_runs, timeout_duration,
-      warmup_duration, output_file_path,    enable_scheduler, cores,   clients,  enable_visualization,
-      verify,          cache_binary_tables, sql_metrics};
+  const auto execution_mode =
+      parse_result["pipelined"].as<bool>() ? ExecutionMode::Pipelined : ExecutionMode::Materializing;
+  if (execution_mode == ExecutionMode::Pipelined) {
+    std::cout << "- Executing chains of pipelineable operators morsel-wise" << std::endl;
+  } else {
+    std::cout << "- Executing operators one after another" << std::endl;
+  }
+
+  return BenchmarkConfig{benchmark_mode,
+                         chunk_size,
+                         *encoding_config,
+                         indexes,
+                         max_runs,
+                         timeout_duration,
+                         warmup_duration,
+                         output_file_path,
+                         enable_scheduler,
+                         cores,
+                         clients,
+                         enable_visualization,
+                         verify,
+                         cache_binary_tables,
+                         sql_metrics,
+                         execution_mode,
+                         parallel_table_generation};
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
@@ -529,6 +529,31 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCCTableGenerator::generate
                                                               {"NEW_ORDER", BenchmarkTableInfo{new_order_table}}});
 }
 
+void TPCCTableGenerator::_add_constraints(
+    std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const {
+  const auto add_primary_key = [&](const std::string& table_name, const std::vector<std::string>& column_names,
+                                   const bool create_index) {
+    const auto& table = table_info_by_name.at(table_name).table;
+    auto column_ids = std::vector<ColumnID>{};
+    for (const auto& column_name : column_names) {
+      column_ids.emplace_back(table->column_id_by_name(column_name));
+    }
+    table->add_soft_unique_constraint(column_ids, IsPrimaryKey::Yes);
+    if (create_index) table->create_primary_key_index();
+  };
+
+  // Primary keys as per TPC-C Specification, paragraph 1.3. NEW_ORDER and ORDER_LINE are only accessed by ranges of
+  // their primary keys (e.g., all order lines of an order), which the PrimaryKeyIndex does not support.
+  add_primary_key("WAREHOUSE", {"W_ID"}, true);
+  add_primary_key("DISTRICT", {"D_W_ID", "D_ID"}, true);
+  add_primary_key("CUSTOMER", {"C_W_ID", "C_D_ID", "C_ID"}, true);
+  add_primary_key("NEW_ORDER", {"NO_W_ID", "NO_D_ID", "NO_O_ID"}, false);
+  add_primary_key("ORDER", {"O_W_ID", "O_D_ID", "O_ID"}, true);
+  add_primary_key("ORDER_LINE", {"OL_W_ID", "OL_D_ID", "OL_O_ID", "OL_NUMBER"}, false);
+  add_primary_key("ITEM", {"I_ID"}, true);
+  add_primary_key("STOCK", {"S_W_ID", "S_I_ID"}, true);
+}
+
 thread_local TPCCRandomGenerator TPCCTableGenerator::_random_gen;  // NOLINT
 
 }  // namespace opossum
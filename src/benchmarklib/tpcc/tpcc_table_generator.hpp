@@ -55,6 +55,10 @@ class TPCCTableGenerator : public AbstractTableGenerator {
   const time_t _current_date = std::time(nullptr);
 
  protected:
+  // Adds the primary keys of all tables (except for HISTORY, which has none) and creates a PrimaryKeyIndex for those
+  // whose rows the transactions look up by their entire primary key
+  void _add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const override;
+
   template <typename T>
   std::vector<std::optional<T>> _generate_inner_order_line_column(
       std::vector<size_t> indices, OrderLineCounts order_line_counts,
@@ -6,11 +6,23 @@ extern "C" {
 #include <rnd.h>
 }
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
 #include <filesystem>
+#include <thread>
 #include <utility>
 
 #include "benchmark_config.hpp"
+#include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk.hpp"
 #include "table_builder.hpp"
 #include "utils/list_directory.hpp"
@@ -19,6 +31,16 @@ extern "C" {
 extern char** asc_date;
 extern seed_t seed[];  // NOLINT
 
+// Advance the random number streams of a table by skip_count rows, defined in speed_seed.c
+extern "C" {
+long sd_cust(int child, DSS_HUGE skip_count);   // NOLINT
+long sd_line(int child, DSS_HUGE skip_count);   // NOLINT
+long sd_order(int child, DSS_HUGE skip_count);  // NOLINT
+long sd_part(int child, DSS_HUGE skip_count);   // NOLINT
+long sd_psupp(int child, DSS_HUGE skip_count);  // NOLINT
+long sd_supp(int child, DSS_HUGE skip_count);   // NOLINT
+}
+
 #pragma clang diagnostic ignored "-Wshorten-64-to-32"
 #pragma clang diagnostic ignored "-Wfloat-conversion"
 
@@ -105,6 +127,217 @@ void dbgen_cleanup() {
   asc_date = nullptr;
 }
 
+// Rows [first_row, first_row + row_count) of the customer, orders, part, or supplier table. The ranges of the orders
+// and part tables include the lineitems and partsupps of their rows.
+struct RowRange {
+  TPCHTable table;
+  size_t first_row;
+  size_t row_count;
+};
+
+/**
+ * Generates the rows of a RowRange. tpch-dbgen's random number streams are reset and advanced past the preceding rows
+ * of the table, in the same way as dbgen does it for its child processes (see set_state() in bm_utils.c). Thus, the
+ * rows are the same as if all preceding rows had been generated before.
+ *
+ * Returns one table, or two for the orders and part tables (i.e., orders and lineitem, part and partsupp).
+ */
+std::vector<std::shared_ptr<Table>> generate_row_range(const RowRange& row_range, const ChunkOffset chunk_size) {
+  dbgen_reset_seeds();
+
+  const auto first_row = static_cast<DSS_HUGE>(row_range.first_row);
+  const auto row_count = static_cast<ChunkOffset>(row_range.row_count);
+
+  switch (row_range.table) {
+    case TPCHTable::Customer: {
+      sd_cust(0, first_row);
+
+      TableBuilder customer_builder{chunk_size, customer_column_types, customer_column_names, row_count};
+      for (auto row_idx = row_range.first_row; row_idx < row_range.first_row + row_range.row_count; ++row_idx) {
+        auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TPCHTable::Customer);
+        customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code,
+                                    customer.phone, convert_money(customer.acctbal), customer.mktsegment,
+                                    customer.comment);
+      }
+
+      return {customer_builder.finish_table()};
+    }
+
+    case TPCHTable::Orders: {
+      sd_order(0, first_row);
+      sd_line(0, first_row);
+
+      // The `* 4` part is defined in the TPC-H specification.
+      TableBuilder order_builder{chunk_size, order_column_types, order_column_names, row_count};
+      TableBuilder lineitem_builder{chunk_size, lineitem_column_types, lineitem_column_names, row_count * 4};
+      for (auto order_idx = row_range.first_row; order_idx < row_range.first_row + row_range.row_count; ++order_idx) {
+        const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TPCHTable::Orders, 0l);
+
+        order_builder.append_row(order.okey, order.custkey, pmr_string(1, order.orderstatus),
+                                 convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
+                                 order.spriority, order.comment);
+
+        for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
+          const auto& lineitem = order.l[line_idx];
+
+          lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt,
+                                      lineitem.quantity, convert_money(lineitem.eprice),
+                                      convert_money(lineitem.discount), convert_money(lineitem.tax),
+                                      pmr_string(1, lineitem.rflag[0]), pmr_string(1, lineitem.lstatus[0]),
+                                      lineitem.sdate, lineitem.cdate, lineitem.rdate, lineitem.shipinstruct,
+                                      lineitem.shipmode, lineitem.comment);
+        }
+      }
+
+      return {order_builder.finish_table(), lineitem_builder.finish_table()};
+    }
+
+    case TPCHTable::Part: {
+      sd_part(0, first_row);
+      sd_psupp(0, first_row);
+
+      TableBuilder part_builder{chunk_size, part_column_types, part_column_names, row_count};
+      TableBuilder partsupp_builder{chunk_size, partsupp_column_types, partsupp_column_names, row_count * 4};
+      for (auto part_idx = row_range.first_row; part_idx < row_range.first_row + row_range.row_count; ++part_idx) {
+        const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TPCHTable::Part);
+
+        part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
+                                convert_money(part.retailprice), part.comment);
+
+        // Some scale factors (e.g., 0.05) are not supported by tpch-dbgen as they produce non-unique partkey/suppkey
+        // combinations. The reason is probably somewhere in the magic in PART_SUPP_BRIDGE. As the partkey is
+        // ascending, those are easy to identify:
+
+        DSS_HUGE last_partkey = {};
+        auto suppkeys = std::vector<DSS_HUGE>{};
+
+        for (const auto& partsupp : part.s) {
+          {
+            // Make sure we do not generate non-unique combinations (see above)
+            if (partsupp.partkey != last_partkey) {
+              Assert(partsupp.partkey > last_partkey, "Expected partkey to be generated in ascending order");
+              last_partkey = partsupp.partkey;
+              suppkeys.clear();
+            }
+            Assert(std::find(suppkeys.begin(), suppkeys.end(), partsupp.suppkey) == suppkeys.end(),
+                   "Scale factor unsupported by tpch-dbgen. Consider choosing a \"round\" number.");
+            suppkeys.emplace_back(partsupp.suppkey);
+          }
+
+          partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
+                                      partsupp.comment);
+        }
+      }
+
+      return {part_builder.finish_table(), partsupp_builder.finish_table()};
+    }
+
+    case TPCHTable::Supplier: {
+      sd_supp(0, first_row);
+
+      TableBuilder supplier_builder{chunk_size, supplier_column_types, supplier_column_names, row_count};
+      for (auto supplier_idx = row_range.first_row; supplier_idx < row_range.first_row + row_range.row_count;
+           ++supplier_idx) {
+        const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TPCHTable::Supplier);
+
+        supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code,
+                                    supplier.phone, convert_money(supplier.acctbal), supplier.comment);
+      }
+
+      return {supplier_builder.finish_table()};
+    }
+
+    default:
+      Fail("Row ranges are only generated for the customer, orders, part, and supplier tables");
+  }
+}
+
+/**
+ * Generates the row ranges in up to process_count forked processes at a time. As tpch-dbgen keeps its state in global
+ * variables, we cannot use threads here. Each process writes the generated tables to a temporary binary file, which is
+ * read back once the process has exited.
+ *
+ * fork() only duplicates the calling thread. If another thread held a lock (e.g., a worker of the NodeQueueScheduler
+ * holding the lock of its queue) at that moment, the lock would never be released in the child process. Thus, the
+ * workers of an active NodeQueueScheduler are stopped while the processes run and are restarted afterwards.
+ */
+std::vector<std::vector<std::shared_ptr<Table>>> generate_row_ranges_in_processes(
+    const std::vector<RowRange>& row_ranges, const ChunkOffset chunk_size, const size_t process_count) {
+  const auto directory =
+      std::filesystem::temp_directory_path() / ("hyrise_tpch_table_generator_" + std::to_string(getpid()));
+  std::filesystem::create_directories(directory);
+
+  const auto file_path = [&](const size_t range_idx, const size_t table_idx) {
+    return (directory / (std::to_string(range_idx) + "_" + std::to_string(table_idx) + ".bin")).string();
+  };
+
+  const auto restart_scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler()) != nullptr;
+  if (restart_scheduler) {
+    Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  }
+
+  // Otherwise, buffered output would be written by the parent and the child processes
+  std::cout.flush();
+  std::cerr.flush();
+
+  // The processes are waited for in the order in which they were started. As the ranges of a table have the same
+  // size, they should finish in about that order anyway.
+  auto running_processes = std::deque<pid_t>{};
+  auto next_range_idx = size_t{0};
+  while (next_range_idx < row_ranges.size() || !running_processes.empty()) {
+    if (next_range_idx < row_ranges.size() && running_processes.size() < process_count) {
+      const auto pid = fork();
+      Assert(pid != -1, std::string{"Could not fork table generation process: "} + std::strerror(errno));
+
+      if (pid == 0) {
+        auto exit_code = EXIT_SUCCESS;
+        try {
+          const auto tables = generate_row_range(row_ranges[next_range_idx], chunk_size);
+          for (auto table_idx = size_t{0}; table_idx < tables.size(); ++table_idx) {
+            BinaryWriter::write(*tables[table_idx], file_path(next_range_idx, table_idx));
+          }
+        } catch (const std::exception& exception) {
+          std::cerr << exception.what() << std::endl;
+          exit_code = EXIT_FAILURE;
+        }
+
+        // Exit without running the destructors of the static objects that were copied from the parent process
+        _exit(exit_code);
+      }
+
+      running_processes.emplace_back(pid);
+      ++next_range_idx;
+      continue;
+    }
+
+    auto status = int{0};
+    const auto pid = waitpid(running_processes.front(), &status, 0);
+    Assert(pid == running_processes.front(), std::string{"Could not wait for table generation process: "} +
+                                                 std::strerror(errno));
+    Assert(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS, "Table generation process failed");
+    running_processes.pop_front();
+  }
+
+  if (restart_scheduler) {
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  }
+
+  auto tables_by_row_range = std::vector<std::vector<std::shared_ptr<Table>>>(row_ranges.size());
+  for (auto range_idx = size_t{0}; range_idx < row_ranges.size(); ++range_idx) {
+    const auto table_count = row_ranges[range_idx].table == TPCHTable::Orders ||
+                                     row_ranges[range_idx].table == TPCHTable::Part
+                                 ? size_t{2}
+                                 : size_t{1};
+    for (auto table_idx = size_t{0}; table_idx < table_count; ++table_idx) {
+      tables_by_row_range[range_idx].emplace_back(BinaryParser::parse(file_path(range_idx, table_idx)));
+    }
+  }
+
+  std::filesystem::remove_all(directory);
+
+  return tables_by_row_range;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -114,11 +347,22 @@ std::unordered_map<TPCHTable, std::string> tpch_table_names = {
     {TPCHTable::Customer, "customer"}, {TPCHTable::Orders, "orders"},     {TPCHTable::LineItem, "lineitem"},
     {TPCHTable::Nation, "nation"},     {TPCHTable::Region, "region"}};
 
-TPCHTableGenerator::TPCHTableGenerator(float scale_factor, uint32_t chunk_size)
-    : AbstractTableGenerator(create_benchmark_config_with_chunk_size(chunk_size)), _scale_factor(scale_factor) {}
+TPCHTableGenerator::TPCHTableGenerator(float scale_factor, uint32_t chunk_size, uint32_t process_count)
+    : AbstractTableGenerator(create_benchmark_config_with_chunk_size(chunk_size)),
+      _scale_factor(scale_factor),
+      _process_count(process_count) {
+  Assert(_process_count > 0, "Tables have to be generated by at least one process");
+}
 
 TPCHTableGenerator::TPCHTableGenerator(float scale_factor, const std::shared_ptr<BenchmarkConfig>& benchmark_config)
-    : AbstractTableGenerator(benchmark_config), _scale_factor(scale_factor) {}
+    : AbstractTableGenerator(benchmark_config), _scale_factor(scale_factor) {
+  // As the generation in forked processes interrupts the scheduler (see generate_row_ranges_in_processes), it has to
+  // be requested explicitly. It then uses as many processes as the benchmark uses cores.
+  if (_benchmark_config->parallel_table_generation) {
+    _process_count = _benchmark_config->cores != 0 ? _benchmark_config->cores
+                                                    : std::max(std::thread::hardware_concurrency(), 1u);
+  }
+}
 
 std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate() {
   Assert(_scale_factor < 1.0f || std::round(_scale_factor) == _scale_factor,
@@ -148,109 +392,51 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
   dbgen_reset_seeds();
   dbgen_init_scale_factor(_scale_factor);
 
-  const auto customer_count = static_cast<ChunkOffset>(tdefs[CUST].base * scale);
-  const auto order_count = static_cast<ChunkOffset>(tdefs[ORDER].base * scale);
-  const auto part_count = static_cast<ChunkOffset>(tdefs[PART].base * scale);
-  const auto supplier_count = static_cast<ChunkOffset>(tdefs[SUPP].base * scale);
+  const auto customer_count = static_cast<size_t>(tdefs[CUST].base * scale);
+  const auto order_count = static_cast<size_t>(tdefs[ORDER].base * scale);
+  const auto part_count = static_cast<size_t>(tdefs[PART].base * scale);
+  const auto supplier_count = static_cast<size_t>(tdefs[SUPP].base * scale);
   const auto nation_count = static_cast<ChunkOffset>(tdefs[NATION].base);
   const auto region_count = static_cast<ChunkOffset>(tdefs[REGION].base);
 
-  // The `* 4` part is defined in the TPC-H specification.
-  TableBuilder customer_builder{_benchmark_config->chunk_size, customer_column_types, customer_column_names,
-                                customer_count};
-  TableBuilder order_builder{_benchmark_config->chunk_size, order_column_types, order_column_names, order_count};
-  TableBuilder lineitem_builder{_benchmark_config->chunk_size, lineitem_column_types, lineitem_column_names,
-                                order_count * 4};
-  TableBuilder part_builder{_benchmark_config->chunk_size, part_column_types, part_column_names, part_count};
-  TableBuilder partsupp_builder{_benchmark_config->chunk_size, partsupp_column_types, partsupp_column_names,
-                                part_count * 4};
-  TableBuilder supplier_builder{_benchmark_config->chunk_size, supplier_column_types, supplier_column_names,
-                                supplier_count};
-  TableBuilder nation_builder{_benchmark_config->chunk_size, nation_column_types, nation_column_names, nation_count};
-  TableBuilder region_builder{_benchmark_config->chunk_size, region_column_types, region_column_names, region_count};
-
-  /**
-   * CUSTOMER
-   */
-
-  for (size_t row_idx = 0; row_idx < customer_count; row_idx++) {
-    auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TPCHTable::Customer);
-    customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
-                                convert_money(customer.acctbal), customer.mktsegment, customer.comment);
-  }
+  const auto chunk_size = _benchmark_config->chunk_size;
+  const auto process_count = size_t{_process_count};
 
   /**
-   * ORDER and LINEITEM
+   * CUSTOMER, ORDER and LINEITEM, PART and PARTSUPP, SUPPLIER
+   *
+   * Each table is split into up to process_count row ranges. The ranges cover full chunks, so that only the last
+   * chunk of a range is not full. Orders are generated first, as they take the longest.
    */
 
-  for (size_t order_idx = 0; order_idx < order_count; ++order_idx) {
-    const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TPCHTable::Orders, 0l);
-
-    order_builder.append_row(order.okey, order.custkey, pmr_string(1, order.orderstatus),
-                             convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
-                             order.spriority, order.comment);
-
-    for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
-      const auto& lineitem = order.l[line_idx];
-
-      lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
-                                  convert_money(lineitem.eprice), convert_money(lineitem.discount),
-                                  convert_money(lineitem.tax), pmr_string(1, lineitem.rflag[0]),
-                                  pmr_string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
-                                  lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
+  const auto row_counts = std::vector<std::pair<TPCHTable, size_t>>{{TPCHTable::Orders, order_count},
+                                                                    {TPCHTable::Part, part_count},
+                                                                    {TPCHTable::Customer, customer_count},
+                                                                    {TPCHTable::Supplier, supplier_count}};
+
+  auto row_ranges = std::vector<RowRange>{};
+  for (const auto& [table, row_count] : row_counts) {
+    const auto chunk_count = (row_count + chunk_size - 1) / chunk_size;
+    const auto rows_per_range = (chunk_count + process_count - 1) / process_count * chunk_size;
+    for (auto first_row = size_t{0}; first_row < row_count; first_row += rows_per_range) {
+      row_ranges.push_back({table, first_row, std::min(rows_per_range, row_count - first_row)});
     }
   }
 
-  /**
-   * PART and PARTSUPP
-   */
-
-  for (size_t part_idx = 0; part_idx < part_count; ++part_idx) {
-    const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TPCHTable::Part);
-
-    part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
-                            convert_money(part.retailprice), part.comment);
-
-    // Some scale factors (e.g., 0.05) are not supported by tpch-dbgen as they produce non-unique partkey/suppkey
-    // combinations. The reason is probably somewhere in the magic in PART_SUPP_BRIDGE. As the partkey is
-    // ascending, those are easy to identify:
-
-    DSS_HUGE last_partkey = {};
-    auto suppkeys = std::vector<DSS_HUGE>{};
-
-    for (const auto& partsupp : part.s) {
-      {
-        // Make sure we do not generate non-unique combinations (see above)
-        if (partsupp.partkey != last_partkey) {
-          Assert(partsupp.partkey > last_partkey, "Expected partkey to be generated in ascending order");
-          last_partkey = partsupp.partkey;
-          suppkeys.clear();
-        }
-        Assert(std::find(suppkeys.begin(), suppkeys.end(), partsupp.suppkey) == suppkeys.end(),
-               "Scale factor unsupported by tpch-dbgen. Consider choosing a \"round\" number.");
-        suppkeys.emplace_back(partsupp.suppkey);
-      }
-
-      partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
-                                  partsupp.comment);
+  auto tables_by_row_range = std::vector<std::vector<std::shared_ptr<Table>>>{};
+  if (process_count == 1) {
+    for (const auto& row_range : row_ranges) {
+      tables_by_row_range.emplace_back(generate_row_range(row_range, chunk_size));
     }
-  }
-
-  /**
-   * SUPPLIER
-   */
-
-  for (size_t supplier_idx = 0; supplier_idx < supplier_count; ++supplier_idx) {
-    const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TPCHTable::Supplier);
-
-    supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
-                                convert_money(supplier.acctbal), supplier.comment);
+  } else {
+    tables_by_row_range = generate_row_ranges_in_processes(row_ranges, chunk_size, process_count);
   }
 
   /**
    * NATION
    */
 
+  TableBuilder nation_builder{chunk_size, nation_column_types, nation_column_names, nation_count};
   for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
     const auto nation = call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, TPCHTable::Nation);
     nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
@@ -260,6 +446,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
    * REGION
    */
 
+  TableBuilder region_builder{chunk_size, region_column_types, region_column_names, region_count};
   for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
     const auto region = call_dbgen_mk<code_t>(region_idx + 1, mk_region, TPCHTable::Region);
     region_builder.append_row(region.code, region.text, region.comment);
@@ -275,29 +462,39 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
    */
   std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
 
-  auto customer_table = customer_builder.finish_table();
-  table_info_by_name["customer"].table = customer_table;
-
-  auto orders_table = order_builder.finish_table();
-  table_info_by_name["orders"].table = orders_table;
-
-  auto lineitem_table = lineitem_builder.finish_table();
-  table_info_by_name["lineitem"].table = lineitem_table;
-
-  auto part_table = part_builder.finish_table();
-  table_info_by_name["part"].table = part_table;
-
-  auto partsupp_table = partsupp_builder.finish_table();
-  table_info_by_name["partsupp"].table = partsupp_table;
+  // Concatenates the chunks of the row ranges of a table in the order of the ranges
+  const auto concatenate_row_ranges = [&](const TPCHTable table, const size_t table_idx) {
+    auto concatenated_table = std::shared_ptr<Table>{};
+    for (auto range_idx = size_t{0}; range_idx < row_ranges.size(); ++range_idx) {
+      if (row_ranges[range_idx].table != table) continue;
 
-  auto supplier_table = supplier_builder.finish_table();
-  table_info_by_name["supplier"].table = supplier_table;
+      const auto& range_table = tables_by_row_range[range_idx][table_idx];
+      if (!concatenated_table) {
+        concatenated_table = std::make_shared<Table>(range_table->column_definitions(), TableType::Data, chunk_size,
+                                                     UseMvcc::Yes);
+      }
 
-  auto nation_table = nation_builder.finish_table();
-  table_info_by_name["nation"].table = nation_table;
+      const auto chunk_count = range_table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto& chunk = range_table->get_chunk(chunk_id);
+        auto segments = Segments{};
+        for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+          segments.emplace_back(chunk->get_segment(column_id));
+        }
+        concatenated_table->append_chunk(segments, std::make_shared<MvccData>(chunk->size(), CommitID{0}));
+      }
+    }
+    return concatenated_table;
+  };
 
-  auto region_table = region_builder.finish_table();
-  table_info_by_name["region"].table = region_table;
+  table_info_by_name["customer"].table = concatenate_row_ranges(TPCHTable::Customer, 0);
+  table_info_by_name["orders"].table = concatenate_row_ranges(TPCHTable::Orders, 0);
+  table_info_by_name["lineitem"].table = concatenate_row_ranges(TPCHTable::Orders, 1);
+  table_info_by_name["part"].table = concatenate_row_ranges(TPCHTable::Part, 0);
+  table_info_by_name["partsupp"].table = concatenate_row_ranges(TPCHTable::Part, 1);
+  table_info_by_name["supplier"].table = concatenate_row_ranges(TPCHTable::Supplier, 0);
+  table_info_by_name["nation"].table = nation_builder.finish_table();
+  table_info_by_name["region"].table = region_builder.finish_table();
 
   if (_benchmark_config->cache_binary_tables) {
     std::filesystem::create_directories(cache_directory);
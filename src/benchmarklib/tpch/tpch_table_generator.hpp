@@ -25,14 +25,22 @@ extern std::unordered_map<opossum::TPCHTable, std::string> tpch_table_names;
  * Wrapper around the official tpch-dbgen tool, making it directly generate opossum::Table instances without having
  * to generate and then load .tbl files.
  *
- * NOT thread safe because the underlying tpch-dbgen is not (since it has global data and malloc races).
+ * NOT thread safe because the underlying tpch-dbgen is not (since it has global data and malloc races). For the same
+ * reason, the tables are generated in parallel by forked processes instead of threads: The rows of the customer,
+ * orders, part, and supplier tables (together with their lineitems and partsupps) are split into row ranges. Each
+ * process seeds tpch-dbgen for the first row of its range, generates the range, and hands the resulting chunks back
+ * to the calling process through a temporary binary file. The generated data is the same as with a single process.
+ * Generation in multiple processes is opt-in (see the constructors).
  */
 class TPCHTableGenerator final : public AbstractTableGenerator {
  public:
-  // Convenience constructor for creating a TPCHTableGenerator without a benchmarking context
-  explicit TPCHTableGenerator(float scale_factor, uint32_t chunk_size = Chunk::DEFAULT_SIZE);
+  // Convenience constructor for creating a TPCHTableGenerator without a benchmarking context. By default, all tables
+  // are generated in the calling process. A process_count greater than 1 generates them in forked processes.
+  explicit TPCHTableGenerator(float scale_factor, uint32_t chunk_size = Chunk::DEFAULT_SIZE,
+                              uint32_t process_count = 1);
 
-  // Constructor for creating a TPCHTableGenerator in a benchmark
+  // Constructor for creating a TPCHTableGenerator in a benchmark. The tables are only generated in forked processes
+  // if BenchmarkConfig::parallel_table_generation is set.
   explicit TPCHTableGenerator(float scale_factor, const std::shared_ptr<BenchmarkConfig>& benchmark_config);
 
   std::unordered_map<std::string, BenchmarkTableInfo> generate() override;
@@ -44,5 +52,6 @@ class TPCHTableGenerator final : public AbstractTableGenerator {
 
  private:
   float _scale_factor;
+  uint32_t _process_count{1};
 };
 }  // namespace opossum
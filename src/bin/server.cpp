@@ -1,6 +1,13 @@
+#include <chrono>
+#include <filesystem>
+#include <memory>
+
 #include "cxxopts.hpp"
 
+#include "hyrise.hpp"
+#include "logging/checkpointer.hpp"
 #include "server/server.hpp"
+#include "utils/pausable_loop_thread.hpp"
 
 cxxopts::Options get_server_cli_options() {
   cxxopts::Options cli_options("./hyriseServer", "Starts Hyrise server in order to accept network requests.");
@@ -11,6 +18,10 @@ cxxopts::Options get_server_cli_options() {
     ("address", "Specify the address to run on", cxxopts::value<std::string>()->default_value("0.0.0.0"))  // NOLINT
     ("p,port", "Specify the port number. 0 means randomly select an available one. If no port is specified, the the server will start on PostgreSQL's official port", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("io_threads", "Number of threads that wait for connections and requests. Requests are executed by the scheduler", cxxopts::value<uint32_t>()->default_value(std::to_string(opossum::Server::DEFAULT_IO_THREAD_COUNT))) // NOLINT
+    ("wal_file", "Replay the given write-ahead log on startup and log all committed changes to it", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("checkpoint_directory", "Restore the tables from the checkpoint in this directory on startup and write checkpoints to it", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("checkpoint_interval", "Seconds between two checkpoints (0: do not write checkpoints)", cxxopts::value<uint32_t>()->default_value("0")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -35,7 +46,39 @@ int main(int argc, char* argv[]) {
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
-  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
+  const auto wal_file = parsed_options["wal_file"].as<std::string>();
+  const auto checkpoint_directory = parsed_options["checkpoint_directory"].as<std::string>();
+  Assert(wal_file.empty() || checkpoint_directory.empty(),
+         "The write-ahead log cannot be replayed on top of a checkpoint, choose either of them");
+
+  auto checkpointer = std::unique_ptr<opossum::Checkpointer>{};
+  auto checkpoint_thread = std::unique_ptr<opossum::PausableLoopThread>{};
+  if (!checkpoint_directory.empty()) {
+    checkpointer = std::make_unique<opossum::Checkpointer>(checkpoint_directory);
+    if (checkpointer->has_checkpoint()) {
+      const auto table_count = checkpointer->restore();
+      std::cout << "Restored " << table_count << " tables from " << checkpoint_directory << std::endl;
+    }
+
+    const auto checkpoint_interval = std::chrono::seconds{parsed_options["checkpoint_interval"].as<uint32_t>()};
+    if (checkpoint_interval.count() > 0) {
+      checkpoint_thread = std::make_unique<opossum::PausableLoopThread>(
+          checkpoint_interval, [&](size_t) { checkpointer->checkpoint(); });
+    }
+  }
+
+  if (!wal_file.empty()) {
+    auto& log_manager = opossum::Hyrise::get().log_manager;
+    if (std::filesystem::exists(wal_file)) {
+      const auto entry_count = log_manager.recover(wal_file);
+      std::cout << "Replayed " << entry_count << " entries from " << wal_file << std::endl;
+    }
+    log_manager.enable(wal_file);
+  }
+
+  const auto io_thread_count = parsed_options["io_threads"].as<uint32_t>();
+  auto server =
+      opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info), io_thread_count};
   server.run();
 
   return 0;
@@ -0,0 +1,188 @@
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "cxxopts.hpp"
+
+#include "utils/assert.hpp"
+
+// Load test for the Hyrise server: Opens a large number of connections, which are kept open (as by the connection pool
+// of an application server), and sends simple queries over all of them. Reports how long it takes to establish the
+// connections and the latency of the queries. To keep the client lightweight, it speaks the PostgreSQL protocol
+// directly instead of using libpq.
+
+namespace {
+
+using Socket = boost::asio::ip::tcp::socket;
+using Clock = std::chrono::steady_clock;
+
+cxxopts::Options get_load_client_cli_options() {
+  cxxopts::Options cli_options("./hyriseServerLoadClient", "Opens many connections to a server and sends queries.");
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("address", "Address of the server", cxxopts::value<std::string>()->default_value("127.0.0.1"))  // NOLINT
+    ("p,port", "Port of the server", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
+    ("c,connections", "Number of connections", cxxopts::value<uint32_t>()->default_value("10000"))  // NOLINT
+    ("t,threads", "Number of client threads, each of which uses its share of the connections one after another", cxxopts::value<uint32_t>()->default_value("8"))  // NOLINT
+    ("q,queries", "Number of queries sent over each connection", cxxopts::value<uint32_t>()->default_value("10"))  // NOLINT
+    ("query", "Query that is sent", cxxopts::value<std::string>()->default_value("SELECT 1;"))  // NOLINT
+    ;  // NOLINT
+  // clang-format on
+
+  return cli_options;
+}
+
+void append_network_value(std::string& message, const size_t value) {
+  const auto network_value = htonl(static_cast<uint32_t>(value));
+  message.append(reinterpret_cast<const char*>(&network_value), sizeof(uint32_t));
+}
+
+void send_startup_packet(Socket& socket) {
+  // Protocol version 3.0, followed by the user name. The length field includes itself.
+  constexpr auto PROTOCOL_VERSION = uint32_t{196608};
+  const auto parameters = std::string{"user\0hyrise\0\0", 13};
+
+  auto message = std::string{};
+  append_network_value(message, 2 * sizeof(uint32_t) + parameters.size());
+  append_network_value(message, PROTOCOL_VERSION);
+  message += parameters;
+  boost::asio::write(socket, boost::asio::buffer(message));
+}
+
+void send_query(Socket& socket, const std::string& query) {
+  auto message = std::string{"Q"};
+  append_network_value(message, sizeof(uint32_t) + query.size() + 1);
+  message += query;
+  message += '\0';
+  boost::asio::write(socket, boost::asio::buffer(message));
+}
+
+// Reads all messages until the server reports that it is ready for the next query. Returns false if the server sent
+// an error.
+bool read_until_ready_for_query(Socket& socket, std::vector<char>& buffer) {
+  auto success = true;
+  while (true) {
+    auto header = std::array<char, 1 + sizeof(uint32_t)>{};
+    boost::asio::read(socket, boost::asio::buffer(header));
+
+    auto network_length = uint32_t{};
+    std::copy_n(header.begin() + 1, sizeof(uint32_t), reinterpret_cast<char*>(&network_length));
+    buffer.resize(ntohl(network_length) - sizeof(uint32_t));
+    boost::asio::read(socket, boost::asio::buffer(buffer));
+
+    if (header[0] == 'E') success = false;
+    if (header[0] == 'Z') return success;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = get_load_client_cli_options();
+  const auto parsed_options = cli_options.parse(argc, argv);
+
+  if (parsed_options.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>());
+  const auto endpoint = boost::asio::ip::tcp::endpoint{address, parsed_options["port"].as<uint16_t>()};
+  const auto connection_count = parsed_options["connections"].as<uint32_t>();
+  const auto thread_count = std::min(parsed_options["threads"].as<uint32_t>(), connection_count);
+  const auto queries_per_connection = parsed_options["queries"].as<uint32_t>();
+  const auto query = parsed_options["query"].as<std::string>();
+  Assert(thread_count > 0, "At least one connection and one thread are required");
+
+  // Each connection requires a file descriptor. Raise the limit as far as allowed, as the default (often 1024) is too
+  // low. The server might require the same.
+  auto file_limit = rlimit{};
+  if (getrlimit(RLIMIT_NOFILE, &file_limit) == 0 && file_limit.rlim_cur < file_limit.rlim_max) {
+    file_limit.rlim_cur = file_limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &file_limit);
+  }
+
+  auto io_service = boost::asio::io_service{};
+  auto connections = std::vector<std::unique_ptr<Socket>>(connection_count);
+
+  // Runs `function(connection_id)` for all connections, distributed over the client threads
+  const auto for_each_connection = [&](const auto& function) {
+    auto threads = std::vector<std::thread>{};
+    for (auto thread_id = uint32_t{0}; thread_id < thread_count; ++thread_id) {
+      threads.emplace_back([&, thread_id]() {
+        for (auto connection_id = thread_id; connection_id < connection_count; connection_id += thread_count) {
+          function(connection_id);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  std::cout << "- Opening " << connection_count << " connections to " << endpoint << std::endl;
+  const auto connect_begin = Clock::now();
+  for_each_connection([&](const uint32_t connection_id) {
+    auto buffer = std::vector<char>{};
+    auto& connection = connections[connection_id];
+    connection = std::make_unique<Socket>(io_service);
+    connection->connect(endpoint);
+    connection->set_option(boost::asio::ip::tcp::no_delay(true));
+    send_startup_packet(*connection);
+    Assert(read_until_ready_for_query(*connection, buffer), "Server refused connection");
+  });
+  const auto connect_duration = std::chrono::duration<double>(Clock::now() - connect_begin).count();
+  std::cout << "- Established all connections in " << connect_duration << " s" << std::endl;
+
+  std::cout << "- Sending " << queries_per_connection << " queries over each connection using " << thread_count
+            << " threads" << std::endl;
+  auto latencies = std::vector<std::vector<double>>(connection_count);
+  auto failed_query_count = std::atomic<uint64_t>{0};
+  const auto query_begin = Clock::now();
+  for (auto round = uint32_t{0}; round < queries_per_connection; ++round) {
+    for_each_connection([&](const uint32_t connection_id) {
+      auto buffer = std::vector<char>{};
+      const auto begin = Clock::now();
+      send_query(*connections[connection_id], query);
+      if (!read_until_ready_for_query(*connections[connection_id], buffer)) ++failed_query_count;
+      latencies[connection_id].emplace_back(std::chrono::duration<double, std::milli>(Clock::now() - begin).count());
+    });
+  }
+  const auto query_duration = std::chrono::duration<double>(Clock::now() - query_begin).count();
+
+  auto all_latencies = std::vector<double>{};
+  for (const auto& connection_latencies : latencies) {
+    all_latencies.insert(all_latencies.end(), connection_latencies.begin(), connection_latencies.end());
+  }
+  std::sort(all_latencies.begin(), all_latencies.end());
+
+  const auto query_count = all_latencies.size();
+  std::cout << "- Sent " << query_count << " queries in " << query_duration << " s ("
+            << static_cast<double>(query_count) / query_duration << " queries/s, " << failed_query_count
+            << " failed)" << std::endl;
+  if (query_count > 0) {
+    std::cout << "- Latency: median " << all_latencies[query_count / 2] << " ms, 99th percentile "
+              << all_latencies[query_count * 99 / 100] << " ms, max " << all_latencies.back() << " ms" << std::endl;
+  }
+
+  // Terminate the sessions
+  for (auto& connection : connections) {
+    auto message = std::string{"X"};
+    append_network_value(message, sizeof(uint32_t));
+    boost::asio::write(*connection, boost::asio::buffer(message));
+  }
+
+  return 0;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <utility>
 
 #include <boost/iterator/iterator_facade.hpp>
@@ -52,6 +53,12 @@ class AbstractCacheImpl {
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
+  // Get a copy of the cached value at the given key, if there is one.
+  virtual std::optional<Value> try_get(const Key& key) {
+    if (!has(key)) return std::nullopt;
+    return get(key);
+  }
+
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
@@ -67,6 +74,10 @@ class AbstractCacheImpl {
   // Return the capacity of the cache.
   size_t capacity() const { return _capacity; }
 
+  // Returns true if set(), get(), try_get(), has(), and size() may be called concurrently. The Cache wrapper then only
+  // takes a shared lock for them, so that they are not serialized.
+  virtual bool is_thread_safe() const { return false; }
+
  protected:
   // Remove an element from the cache according to the cache algorithm's strategy
   virtual void _evict() = 0;
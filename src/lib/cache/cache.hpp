@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <shared_mutex>
@@ -9,6 +10,7 @@
 
 #include "gdfs_cache.hpp"
 
+#include "utils/assert.hpp"
 #include "utils/singleton.hpp"
 
 namespace opossum {
@@ -26,25 +28,22 @@ class Cache {
 
   // Adds or refreshes the cache entry [query, value].
   void set(const Key& query, const Value& value) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
-
-    if (_impl->capacity() == 0) return;
+    _access([&]() {
+      if (_impl->capacity() == 0) return;
 
-    _impl->set(query, value);
+      _impl->set(query, value);
+    });
   }
 
   // Tries to fetch the cache entry for the query into the result object. Returns true if the entry was found, false
-  // otherwise. This needs a write lock to be acquired as most implementation update some type of access count when
-  // retrieving an entry.
+  // otherwise. Unless the implementation is thread-safe, this needs a write lock to be acquired as most
+  // implementations update some type of access count when retrieving an entry.
   std::optional<Value> try_get(const Key& query) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
+    return _access([&]() -> std::optional<Value> {
+      if (_impl->capacity() == 0) return {};
 
-    if (_impl->capacity() == 0) return {};
-
-    if (!_impl->has(query)) {
-      return {};
-    }
-    return _impl->get(query);
+      return _impl->try_get(query);
+    });
   }
 
   // Checks whether an entry for the query exists.
@@ -54,11 +53,14 @@ class Cache {
   }
 
   // Returns and refreshes the cache entry for the given query. Causes undefined behavior if the query is not in the
-  // cache. This needs a write lock to be acquired as most implementation update some type of access count when
-  // retrieving an entry.
+  // cache. Unless the implementation is thread-safe, this needs a write lock to be acquired as most implementations
+  // update some type of access count when retrieving an entry.
   Value get_entry(const Key& query) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
-    return _impl->get(query);
+    return _access([&]() {
+      auto value = _impl->try_get(query);
+      DebugAssert(value, "Query is not in the cache");
+      return std::move(*value);
+    });
   }
 
   // Purges all entries from the cache.
@@ -82,6 +84,7 @@ class Cache {
   void replace_cache_impl(size_t capacity) {
     std::unique_lock<std::shared_mutex> lock(_mutex);
     _impl = std::make_unique<cache_t>(capacity);
+    _impl_is_thread_safe = _impl->is_thread_safe();
   }
 
   // These methods are named "unsafe_" (similar to tbb's naming) because iterator does not hold a mutex. As such,
@@ -95,8 +98,23 @@ class Cache {
   const AbstractCacheImpl<Key, Value>& unsafe_cache() const { return *_impl; }
 
  protected:
+  // Runs the functor under a shared lock if the underlying cache is thread-safe, so that it only has to be protected
+  // from being replaced, and under a unique lock otherwise. As the implementation might be replaced concurrently,
+  // _impl_is_thread_safe is only a hint and is checked again once the shared lock is acquired.
+  template <typename Functor>
+  auto _access(const Functor& functor) {
+    if (_impl_is_thread_safe) {
+      std::shared_lock<std::shared_mutex> lock(_mutex);
+      if (_impl->is_thread_safe()) return functor();
+    }
+
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    return functor();
+  }
+
   // Underlying cache eviction strategy.
   std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
+  std::atomic_bool _impl_is_thread_safe{false};
 
   mutable std::shared_mutex _mutex;
 };
@@ -0,0 +1,299 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_cache_impl.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Generic cache implementation for caches that are accessed by many threads, such as the plan caches of the server.
+// The entries are distributed over up to MAX_SHARD_COUNT shards by the hash of their key. Each shard has its own lock
+// and evicts its entries using the CLOCK policy: Every entry has a small access count. Hits only take a shared lock on
+// the shard and increment the count with a relaxed atomic store, so that concurrent hits do not block each other. Lost
+// increments are tolerated, as the count is only an approximation of the access frequency. Once the count is
+// saturated, hits do not write to it anymore. To find an entry to evict, the clock hand sweeps over the entries of the
+// shard and decrements their access counts until it finds an entry that was not accessed since the last sweep.
+//
+// As the capacity is split among the shards, an entry may be evicted while other shards still have room. Caches with a
+// capacity below 2 * MIN_SHARD_CAPACITY have a single shard.
+// Note: set(), get(), try_get(), has(), and size() are thread-safe. clear(), resize(), and the iterators are not.
+template <typename Key, typename Value>
+class ShardedClockCache : public AbstractCacheImpl<Key, Value> {
+ public:
+  using typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+  using typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+  using typename AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+  static constexpr auto MAX_SHARD_COUNT = size_t{16};
+  static constexpr auto MIN_SHARD_CAPACITY = size_t{64};
+
+  // Number of sweeps of the clock hand that an entry survives without being accessed
+  static constexpr auto MAX_ACCESS_COUNT = uint8_t{3};
+
+ protected:
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    size_t capacity{0};
+
+    std::vector<KeyValuePair> entries;
+    std::unordered_map<Key, size_t> offsets;
+
+    // Per entry, in the same order as the entries. The insertion ids are only used to keep the most recently inserted
+    // entries when the cache is resized.
+    std::unique_ptr<std::atomic<uint8_t>[]> access_counts;
+    std::vector<uint64_t> insertion_ids;
+
+    size_t clock_hand{0};
+  };
+
+ public:
+  class Iterator : public AbstractIterator {
+   public:
+    Iterator(const std::vector<std::unique_ptr<Shard>>& shards, const size_t shard_idx)
+        : _shards(shards), _shard_idx(shard_idx) {
+      _skip_empty_shards();
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+    friend class AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+    const std::vector<std::unique_ptr<Shard>>& _shards;
+    size_t _shard_idx;
+    size_t _entry_idx{0};
+
+    void _skip_empty_shards() {
+      while (_shard_idx < _shards.size() && _entry_idx == _shards[_shard_idx]->entries.size()) {
+        ++_shard_idx;
+        _entry_idx = 0;
+      }
+    }
+
+    void increment() {
+      ++_entry_idx;
+      _skip_empty_shards();
+    }
+
+    bool equal(const AbstractIterator& other) const {
+      const auto& other_iterator = static_cast<const Iterator&>(other);
+      return _shard_idx == other_iterator._shard_idx && _entry_idx == other_iterator._entry_idx;
+    }
+
+    const KeyValuePair& dereference() const { return _shards[_shard_idx]->entries[_entry_idx]; }
+  };
+
+  explicit ShardedClockCache(size_t capacity) : AbstractCacheImpl<Key, Value>(capacity) { _create_shards(capacity); }
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    auto& shard = *_shards[_shard_idx(key)];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    if (shard.capacity == 0) return;
+
+    // Override old element at that key, if it exists.
+    const auto offset_iter = shard.offsets.find(key);
+    if (offset_iter != shard.offsets.end()) {
+      shard.entries[offset_iter->second].second = value;
+      _record_access(shard, offset_iter->second);
+      return;
+    }
+
+    auto offset = shard.entries.size();
+    const auto insertion_id = _insertion_count.fetch_add(1, std::memory_order_relaxed);
+    if (offset < shard.capacity) {
+      shard.entries.emplace_back(key, value);
+      shard.insertion_ids.emplace_back(insertion_id);
+    } else {
+      // Replace the evicted entry. As the clock hand has just passed it, the new entry is the last one to be visited.
+      offset = _sweep(shard);
+      shard.offsets.erase(shard.entries[offset].first);
+      shard.entries[offset] = KeyValuePair{key, value};
+      shard.insertion_ids[offset] = insertion_id;
+    }
+
+    shard.access_counts[offset].store(0, std::memory_order_relaxed);
+    shard.offsets.emplace(key, offset);
+  }
+
+  // Retrieves the value cached at the key.
+  // Causes undefined behavior if the key is not in the cache. As the returned reference is invalidated when the entry
+  // is evicted by a concurrent set(), try_get() should be used by concurrent readers.
+  Value& get(const Key& key) {
+    auto& shard = *_shards[_shard_idx(key)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    const auto offset_iter = shard.offsets.find(key);
+    DebugAssert(offset_iter != shard.offsets.end(), "key not present");
+    _record_access(shard, offset_iter->second);
+    return shard.entries[offset_iter->second].second;
+  }
+
+  std::optional<Value> try_get(const Key& key) {
+    const auto& shard = *_shards[_shard_idx(key)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    const auto offset_iter = shard.offsets.find(key);
+    if (offset_iter == shard.offsets.end()) return std::nullopt;
+
+    _record_access(shard, offset_iter->second);
+    return shard.entries[offset_iter->second].second;
+  }
+
+  bool has(const Key& key) const {
+    const auto& shard = *_shards[_shard_idx(key)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.offsets.find(key) != shard.offsets.end();
+  }
+
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard->mutex);
+      size += shard->entries.size();
+    }
+    return size;
+  }
+
+  void clear() {
+    for (const auto& shard : _shards) {
+      shard->entries.clear();
+      shard->offsets.clear();
+      shard->insertion_ids.clear();
+      shard->clock_hand = 0;
+    }
+  }
+
+  void resize(size_t capacity) {
+    // The number of shards depends on the capacity, so all entries are redistributed. Those that were accessed most
+    // often and, among them, those that were inserted last are kept.
+    struct Candidate {
+      KeyValuePair entry;
+      uint8_t access_count;
+      uint64_t insertion_id;
+    };
+
+    auto candidates = std::vector<Candidate>{};
+    candidates.reserve(size());
+    for (const auto& shard : _shards) {
+      for (auto offset = size_t{0}; offset < shard->entries.size(); ++offset) {
+        candidates.push_back({std::move(shard->entries[offset]), shard->access_counts[offset].load(),
+                              shard->insertion_ids[offset]});
+      }
+    }
+
+    this->_capacity = capacity;
+    _create_shards(capacity);
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+      return std::tie(lhs.access_count, lhs.insertion_id) > std::tie(rhs.access_count, rhs.insertion_id);
+    });
+
+    auto shard_sizes = std::vector<size_t>(_shards.size());
+    auto kept_candidates = std::vector<Candidate>{};
+    for (auto& candidate : candidates) {
+      const auto shard_idx = _shard_idx(candidate.entry.first);
+      if (shard_sizes[shard_idx] == _shards[shard_idx]->capacity) continue;
+
+      ++shard_sizes[shard_idx];
+      kept_candidates.emplace_back(std::move(candidate));
+    }
+
+    // Insert the entries from the oldest to the newest one, so that the clock hand visits the oldest ones first
+    std::sort(kept_candidates.begin(), kept_candidates.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.insertion_id < rhs.insertion_id; });
+    for (auto& candidate : kept_candidates) {
+      auto& shard = *_shards[_shard_idx(candidate.entry.first)];
+      const auto offset = shard.entries.size();
+      shard.offsets.emplace(candidate.entry.first, offset);
+      shard.entries.emplace_back(std::move(candidate.entry));
+      shard.insertion_ids.emplace_back(candidate.insertion_id);
+      shard.access_counts[offset].store(candidate.access_count);
+    }
+  }
+
+  ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(_shards, 0)}; }
+
+  ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(_shards, _shards.size())}; }
+
+  bool is_thread_safe() const { return true; }
+
+ protected:
+  std::vector<std::unique_ptr<Shard>> _shards;
+
+  std::atomic<uint64_t> _insertion_count{0};
+
+  void _create_shards(const size_t capacity) {
+    const auto shard_count = std::clamp(capacity / MIN_SHARD_CAPACITY, size_t{1}, MAX_SHARD_COUNT);
+
+    _shards.clear();
+    for (auto shard_idx = size_t{0}; shard_idx < shard_count; ++shard_idx) {
+      auto shard = std::make_unique<Shard>();
+      shard->capacity = capacity / shard_count + (shard_idx < capacity % shard_count ? 1 : 0);
+      shard->access_counts = std::make_unique<std::atomic<uint8_t>[]>(shard->capacity);
+      _shards.emplace_back(std::move(shard));
+    }
+  }
+
+  size_t _shard_idx(const Key& key) const {
+    if (_shards.size() == 1) return 0;
+
+    // Spread the hash (which is the identity for integers) over the upper bits
+    const auto hash = static_cast<uint64_t>(std::hash<Key>{}(key)) * 0x9E3779B97F4A7C15ull;
+    return (hash >> 32) % _shards.size();
+  }
+
+  static void _record_access(const Shard& shard, const size_t offset) {
+    auto& access_count = shard.access_counts[offset];
+    const auto count = access_count.load(std::memory_order_relaxed);
+    if (count < MAX_ACCESS_COUNT) access_count.store(count + 1, std::memory_order_relaxed);
+  }
+
+  // Returns the offset of the entry to be evicted from the full shard and advances the clock hand past it. Requires a
+  // unique lock on the shard.
+  static size_t _sweep(Shard& shard) {
+    while (true) {
+      const auto offset = shard.clock_hand;
+      shard.clock_hand = (shard.clock_hand + 1) % shard.entries.size();
+
+      auto& access_count = shard.access_counts[offset];
+      const auto count = access_count.load(std::memory_order_relaxed);
+      if (count == 0) return offset;
+      access_count.store(count - 1, std::memory_order_relaxed);
+    }
+  }
+
+  void _evict() {
+    // Evicts an entry from the largest shard
+    auto& shard = **std::max_element(_shards.begin(), _shards.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs->entries.size() < rhs->entries.size();
+    });
+    if (shard.entries.empty()) return;
+
+    // Move the last entry into the evicted entry's place
+    const auto offset = _sweep(shard);
+    const auto last_offset = shard.entries.size() - 1;
+    shard.offsets.erase(shard.entries[offset].first);
+    if (offset != last_offset) {
+      shard.entries[offset] = std::move(shard.entries[last_offset]);
+      shard.insertion_ids[offset] = shard.insertion_ids[last_offset];
+      shard.access_counts[offset].store(shard.access_counts[last_offset].load());
+      shard.offsets[shard.entries[offset].first] = offset;
+    }
+    shard.entries.pop_back();
+    shard.insertion_ids.pop_back();
+    shard.clock_hand = shard.entries.empty() ? 0 : shard.clock_hand % shard.entries.size();
+  }
+};
+
+}  // namespace opossum
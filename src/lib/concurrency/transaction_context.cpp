@@ -2,9 +2,12 @@
 
 #include <future>
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include "commit_context.hpp"
 #include "hyrise.hpp"
+#include "logging/log_manager.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "utils/assert.hpp"
 
@@ -83,11 +86,30 @@ void TransactionContext::rollback() {
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
   _prepare_commit();
 
+  // With logging enabled, the changes have to be serialized before commit_records, which releases the row locks
+  auto& log_manager = Hyrise::get().log_manager;
+  auto log_entry = std::optional<LogEntryWriter>{};
+  if (log_manager.is_enabled()) {
+    log_entry.emplace(commit_id());
+    for (const auto& op : _read_write_operators) {
+      op->log_records(*log_entry);
+    }
+  }
+
   for (const auto& op : _read_write_operators) {
     op->commit_records(commit_id());
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  if (!log_entry || log_entry->record_count() == 0) {
+    _mark_as_pending_and_try_commit(callback);
+    return;
+  }
+
+  // The transaction only becomes visible once its log entry is durable. Until then, the commit IDs of all following
+  // transactions are not made visible either (see TransactionManager::_try_increment_last_commit_id).
+  log_manager.append(std::move(*log_entry), [context = shared_from_this(), callback]() {
+    context->_mark_as_pending_and_try_commit(callback);
+  });
 }
 
 void TransactionContext::commit() {
@@ -16,12 +16,15 @@ Hyrise::Hyrise() {
   plugin_manager = PluginManager{};
   storage_manager = StorageManager{};
   transaction_manager = TransactionManager{};
+  log_manager = LogManager{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
   topology = Topology{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
+Hyrise::~Hyrise() { plugin_manager._clean_up(); }
+
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
   get() = Hyrise{};
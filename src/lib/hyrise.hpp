@@ -2,6 +2,7 @@
 
 #include "boost/container/pmr/memory_resource.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "logging/log_manager.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -27,6 +28,12 @@ class Hyrise : public Singleton<Hyrise> {
   // You should be very sure that this is what you want.
   static void reset();
 
+  // Stops the plugins before the other members are destroyed, as plugins may access them (e.g., the SettingsManager)
+  // when they are stopped.
+  ~Hyrise();
+
+  Hyrise& operator=(Hyrise&& other) = default;
+
   const std::shared_ptr<AbstractScheduler>& scheduler() const;
 
   void set_scheduler(const std::shared_ptr<AbstractScheduler>& new_scheduler);
@@ -34,6 +41,9 @@ class Hyrise : public Singleton<Hyrise> {
   PluginManager plugin_manager;
   StorageManager storage_manager;
   TransactionManager transaction_manager;
+  // Declared after the TransactionManager so that pending log entries (which commit transactions once they are
+  // durable) are written before the TransactionManager is destroyed
+  LogManager log_manager;
   MetaTableManager meta_table_manager;
   SettingsManager settings_manager;
   Topology topology;
@@ -43,6 +53,10 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Used by the SQLPipelineBuilder if with_parameterized_plan_cache() is not used. nullptr (the default) disables the
+  // caching of plans for statements that only differ in their literals.
+  std::shared_ptr<SQLParameterizedPlanCache> default_parameterized_plan_cache;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
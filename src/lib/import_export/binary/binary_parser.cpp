@@ -1,7 +1,13 @@
 #include "binary_parser.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
 #include <cstdint>
-#include <fstream>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -21,10 +27,77 @@
 
 namespace opossum {
 
-std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+class BinaryParser::MappedFile : public Noncopyable {
+ public:
+  MappedFile(const std::string& filename, const LoadMode load_mode) : _load_mode(load_mode) {
+    const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+    Assert(file_descriptor >= 0, "Could not open '" + filename + "': " + std::strerror(errno));
+
+    struct stat file_status {};
+    const auto stat_result = fstat(file_descriptor, &file_status);
+    Assert(stat_result == 0, "Could not stat '" + filename + "': " + std::strerror(errno));
+    const auto size = static_cast<size_t>(file_status.st_size);
+
+    auto* data = static_cast<char*>(nullptr);
+    if (size > 0) {
+      auto* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+      Assert(address != MAP_FAILED, "Could not map '" + filename + "': " + std::strerror(errno));
+      data = static_cast<char*>(address);
+
+      // When the values are copied, the file is read once from front to back
+      if (load_mode == LoadMode::Copy) madvise(address, size, MADV_SEQUENTIAL);
+    }
+
+    // The mapping remains valid after the file is closed
+    close(file_descriptor);
+
+    // Segments that refer to the mapped file keep the mapping alive
+    _mapping = std::shared_ptr<const char>(data, [size](const char* mapped_data) {
+      if (mapped_data) munmap(const_cast<char*>(mapped_data), size);
+    });
+    _size = size;
+  }
+
+  void read(char* destination, const size_t byte_count) { std::memcpy(destination, read(byte_count), byte_count); }
+
+  // Returns a pointer to the next byte_count bytes in the mapping
+  const char* read(const size_t byte_count) {
+    Assert(_offset + byte_count <= _size, "Unexpected end of binary file");
+    const auto* data = _mapping.get() + _offset;
+    _offset += byte_count;
+    return data;
+  }
+
+  // Skips the padding that BinaryWriter inserts in front of vectors whose values have the given alignment
+  void align(const size_t alignment) {
+    _offset = (_offset + alignment - 1) / alignment * alignment;
+    Assert(_offset <= _size, "Unexpected end of binary file");
+  }
+
+  // Skips the padding in front of the next count values and returns a pointer to them if the file is memory-mapped.
+  // Otherwise, nullptr is returned and the values are not consumed.
+  template <typename T>
+  const T* read_in_place(const size_t count) {
+    align(alignof(T));
+    if (_load_mode != LoadMode::MemoryMapped || count == 0) return nullptr;
+
+    // The mapping starts at a page boundary, so offsets that are multiples of the alignment are aligned in memory
+    DebugAssert(reinterpret_cast<uintptr_t>(_mapping.get() + _offset) % alignof(T) == 0, "Values are not aligned");
+    return reinterpret_cast<const T*>(read(count * sizeof(T)));
+  }
+
+  const std::shared_ptr<const char>& mapping() const { return _mapping; }
+
+ private:
+  const LoadMode _load_mode;
+  std::shared_ptr<const char> _mapping;
+  size_t _size{0};
+  size_t _offset{0};
+};
+
+std::shared_ptr<Table> BinaryParser::parse(const std::string& filename, const LoadMode load_mode) {
+  auto file = MappedFile{filename, load_mode};
+  _read_format_version(file);
 
   auto [table, chunk_count] = _read_header(file);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -34,8 +107,24 @@ std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
   return table;
 }
 
+Segments BinaryParser::parse_chunk(const std::string& filename, const TableColumnDefinitions& column_definitions,
+                                   const LoadMode load_mode) {
+  auto file = MappedFile{filename, load_mode};
+  _read_format_version(file);
+
+  const auto row_count = _read_value<ChunkOffset>(file);
+
+  Segments segments;
+  for (const auto& column_definition : column_definitions) {
+    segments.push_back(_import_segment(file, row_count, column_definition.data_type, column_definition.nullable));
+  }
+
+  return segments;
+}
+
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> BinaryParser::_read_values(MappedFile& file, const size_t count) {
+  file.align(alignof(T));
   pmr_vector<T> values(count);
   file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
   return values;
@@ -43,28 +132,28 @@ pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(MappedFile& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<bool> BinaryParser::_read_values(MappedFile& file, const size_t count) {
   pmr_vector<BoolAsByteType> readable_bools(count);
   file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
   return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_string_values(MappedFile& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+  const auto* buffer = file.read(total_length);
 
   pmr_vector<pmr_string> values(count);
   size_t start = 0;
 
   for (size_t i = 0; i < count; ++i) {
-    values[i] = pmr_string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
+    values[i] = pmr_string(buffer + start, buffer + start + string_lengths[i]);
     start += string_lengths[i];
   }
 
@@ -72,13 +161,21 @@ pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, co
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
+T BinaryParser::_read_value(MappedFile& file) {
   T result;
   file.read(reinterpret_cast<char*>(&result), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+void BinaryParser::_read_format_version(MappedFile& file) {
+  const auto format_version = _read_value<uint32_t>(file);
+  Assert(format_version == FORMAT_VERSION, "Unsupported binary format version " + std::to_string(format_version) +
+                                               " (expected " + std::to_string(FORMAT_VERSION) +
+                                               "). Files of older versions, e.g., cached benchmark tables, have to be "
+                                               "written again.");
+}
+
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(MappedFile& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -98,7 +195,7 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+void BinaryParser::_import_chunk(MappedFile& file, std::shared_ptr<Table>& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   Segments output_segments;
@@ -112,7 +209,7 @@ void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
   table->last_chunk()->finalize();
 }
 
-std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> BinaryParser::_import_segment(MappedFile& file, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -124,7 +221,7 @@ std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file,
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> BinaryParser::_import_segment(MappedFile& file, ChunkOffset row_count,
                                                            bool is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -157,7 +254,7 @@ std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file,
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(MappedFile& file, ChunkOffset row_count,
                                                                      bool is_nullable) {
   if (is_nullable) {
     auto nullables = _read_values<bool>(file, row_count);
@@ -170,7 +267,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(MappedFile& file,
                                                                                ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
@@ -182,7 +279,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    MappedFile& file, ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = _import_fixed_string_vector(file, dictionary_size);
@@ -192,7 +289,7 @@ std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(MappedFile& file,
                                                                               ChunkOffset row_count) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -203,7 +300,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(MappedFile& file,
                                                                                              ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -216,7 +313,7 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(MappedFile& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
 
@@ -256,8 +353,14 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
     const auto string_offsets_data_size = _read_value<uint32_t>(file);
 
     // so far, only SimdBp128 compression is supported
-    auto string_offsets =
-        std::make_unique<SimdBp128Vector>(_read_values<uint128_t>(file, string_offsets_data_size), string_offsets_size);
+    auto string_offsets = std::unique_ptr<const BaseCompressedVector>{};
+    if (const auto* data = file.read_in_place<uint128_t>(string_offsets_data_size)) {
+      string_offsets = std::make_unique<SimdBp128Vector>(data, string_offsets_data_size, string_offsets_size,
+                                                         file.mapping());
+    } else {
+      string_offsets = std::make_unique<SimdBp128Vector>(_read_values<uint128_t>(file, string_offsets_data_size),
+                                                         string_offsets_size);
+    }
 
     return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
                                            std::move(string_offsets), block_size, last_block_size, compressed_size,
@@ -274,34 +377,43 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
 }
 
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    MappedFile& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint8_t>(file, row_count);
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint16_t>(file, row_count);
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint32_t>(file, row_count);
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    MappedFile& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint8_t>(file, row_count);
     case 2:
-      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint16_t>(file, row_count);
     case 4:
-      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint32_t>(file, row_count);
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+template <typename UnsignedIntType>
+std::unique_ptr<FixedSizeByteAlignedVector<UnsignedIntType>> BinaryParser::_import_fixed_size_byte_aligned_vector(
+    MappedFile& file, ChunkOffset row_count) {
+  if (const auto* data = file.read_in_place<UnsignedIntType>(row_count)) {
+    return std::make_unique<FixedSizeByteAlignedVector<UnsignedIntType>>(data, row_count, file.mapping());
+  }
+  return std::make_unique<FixedSizeByteAlignedVector<UnsignedIntType>>(_read_values<UnsignedIntType>(file, row_count));
+}
+
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(MappedFile& file, const size_t count) {
   const auto string_length = _read_value<uint32_t>(file);
   pmr_vector<char> values(string_length * count);
   file.read(values.data(), values.size());
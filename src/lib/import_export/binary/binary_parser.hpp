@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -16,6 +15,7 @@
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
 namespace opossum {
 
@@ -25,10 +25,28 @@ namespace opossum {
  */
 class BinaryParser {
  public:
+  enum class LoadMode {
+    // All values are copied into the segments. The file is not accessed after parsing.
+    Copy,
+
+    // The file is memory-mapped. Attribute vectors of (fixed-string) dictionary segments, offset vectors of
+    // frame-of-reference segments, and string offsets of LZ4 segments are not copied but refer to the mapped file.
+    // Thus, they are only read from disk when they are first accessed and can be evicted by the operating system.
+    // All other data (e.g., dictionaries) is copied from the mapping. The file must not be modified or truncated as
+    // long as the segments exist.
+    MemoryMapped
+  };
+
+  // Version of the file format written by BinaryWriter. Files of other versions are rejected. Version 2 introduced
+  // the padding that aligns vectors within the file.
+  static constexpr uint32_t FORMAT_VERSION = 2;
+
   /*
    * Reads the given binary file. The file must be in the following form:
    *
    * --------------
+   * |  Version   |
+   * |------------|
    * |   Header   |
    * |------------|
    * |   Chunks¹  |
@@ -36,15 +54,29 @@ class BinaryParser {
    *
    * ¹ Zero or more chunks
    */
-  static std::shared_ptr<Table> parse(const std::string& filename);
+  static std::shared_ptr<Table> parse(const std::string& filename, const LoadMode load_mode = LoadMode::Copy);
+
+  /*
+   * Reads a file written by BinaryWriter::write_chunk and returns its segments. As the file does not contain a table
+   * header, the data types and nullability of the columns have to be passed in. The segments are not added to a table
+   * so that multiple chunks can be read concurrently.
+   */
+  static Segments parse_chunk(const std::string& filename, const TableColumnDefinitions& column_definitions,
+                              const LoadMode load_mode = LoadMode::Copy);
 
  private:
+  // Read-only mapping of the parsed file, from which values are read sequentially
+  class MappedFile;
+
+  // Reads the format version from the given file and fails if it does not match FORMAT_VERSION
+  static void _read_format_version(MappedFile& file);
+
   /*
    * Reads the header from the given file.
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(MappedFile& file);
 
   /*
    * Creates a chunk from chunk information from the given file and adds it to the given table.
@@ -58,53 +90,58 @@ class BinaryParser {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static void _import_chunk(MappedFile& file, std::shared_ptr<Table>& table);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+  static std::shared_ptr<BaseSegment> _import_segment(MappedFile& file, ChunkOffset row_count, DataType data_type,
                                                       bool is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(MappedFile& file, ChunkOffset row_count, bool is_nullable);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(MappedFile& file, ChunkOffset row_count,
                                                                 bool is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(MappedFile& file, ChunkOffset row_count);
 
   static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
-      std::ifstream& file, ChunkOffset row_count);
+      MappedFile& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(MappedFile& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(MappedFile& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(MappedFile& file, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(MappedFile& file, ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+      MappedFile& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+
+  // Refers to the values in the mapped file if possible (see LoadMode::MemoryMapped) and copies them otherwise
+  template <typename UnsignedIntType>
+  static std::unique_ptr<FixedSizeByteAlignedVector<UnsignedIntType>> _import_fixed_size_byte_aligned_vector(
+      MappedFile& file, ChunkOffset row_count);
 
-  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
+  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(MappedFile& file, const size_t count);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(MappedFile& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(MappedFile& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(MappedFile& file);
 };
 
 }  // namespace opossum
@@ -12,6 +12,7 @@
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
+#include "binary_parser.hpp"
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
 #include "types.hpp"
@@ -20,6 +21,14 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
+// Writes zeros until the file position is a multiple of the given alignment (see BinaryWriter)
+void export_padding(std::ofstream& ofstream, const size_t alignment) {
+  const auto position = static_cast<size_t>(ofstream.tellp());
+  for (auto padding = (alignment - position % alignment) % alignment; padding > 0; --padding) {
+    ofstream.put('\0');
+  }
+}
+
 // Writes the content of the vector to the ofstream
 template <typename T, typename Alloc>
 void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
@@ -59,9 +68,22 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
 
 template <typename T, typename Alloc>
 void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
+  export_padding(ofstream, alignof(T));
   ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
+// The values of compressed vectors do not necessarily reside in a pmr_vector (see BinaryParser)
+template <typename UnsignedIntType>
+void export_values(std::ofstream& ofstream, const FixedSizeByteAlignedVector<UnsignedIntType>& values) {
+  export_padding(ofstream, alignof(UnsignedIntType));
+  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(UnsignedIntType));
+}
+
+void export_values(std::ofstream& ofstream, const SimdBp128Vector& values) {
+  export_padding(ofstream, alignof(uint128_t));
+  ofstream.write(reinterpret_cast<const char*>(values.data()), values.data_block_count() * sizeof(uint128_t));
+}
+
 void export_values(std::ofstream& ofstream, const FixedStringVector& values) {
   ofstream.write(values.data(), values.size() * values.string_length());
 }
@@ -95,6 +117,7 @@ void BinaryWriter::write(const Table& table, const std::string& filename) {
   ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
   ofstream.open(filename, std::ios::binary);
 
+  export_value(ofstream, BinaryParser::FORMAT_VERSION);
   _write_header(table, ofstream);
 
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
@@ -102,6 +125,15 @@ void BinaryWriter::write(const Table& table, const std::string& filename) {
   }
 }
 
+void BinaryWriter::write_chunk(const Table& table, const ChunkID chunk_id, const std::string& filename) {
+  std::ofstream ofstream;
+  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  ofstream.open(filename, std::ios::binary);
+
+  export_value(ofstream, BinaryParser::FORMAT_VERSION);
+  _write_chunk(table, ofstream, chunk_id);
+}
+
 void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
   export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
@@ -151,9 +183,13 @@ void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std
   // We materialize reference segments and save them as value segments
   export_value(ofstream, EncodingType::Unencoded);
 
-  if (reference_segment.size() == 0) return;
   resolve_data_type(reference_segment.data_type(), [&](auto type) {
     using SegmentDataType = typename decltype(type)::type;
+
+    // Like for value segments, the values (or the string lengths) are aligned, even if there are none
+    export_padding(ofstream, std::is_same_v<SegmentDataType, pmr_string> ? alignof(size_t) : alignof(SegmentDataType));
+    if (reference_segment.size() == 0) return;
+
     auto iterable = ReferenceSegmentIterable<SegmentDataType, EraseReferencedSegmentType::No>{reference_segment};
 
     if (reference_segment.data_type() == DataType::String) {
@@ -277,9 +313,12 @@ void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ofstrea
   }
 
   // Write compressed size for each LZ4 Block
+  auto lz4_block_sizes = pmr_vector<uint32_t>{};
+  lz4_block_sizes.reserve(lz4_segment.lz4_blocks().size());
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_value(ofstream, static_cast<uint32_t>(lz4_block.size()));
+    lz4_block_sizes.push_back(static_cast<uint32_t>(lz4_block.size()));
   }
+  export_values(ofstream, lz4_block_sizes);
 
   // Write LZ4 Blocks
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
@@ -308,7 +347,7 @@ void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ofstrea
     // Write string_offset data_size
     export_value(ofstream,
                  static_cast<uint32_t>(
-                     dynamic_cast<const SimdBp128Vector&>(*lz4_segment.string_offsets().value()).data().size()));
+                     dynamic_cast<const SimdBp128Vector&>(*lz4_segment.string_offsets().value()).data_block_count()));
     // Write string offsets
     _export_compressed_vector(ofstream, *lz4_segment.compressed_vector_type(), *lz4_segment.string_offsets().value());
   } else {
@@ -343,16 +382,16 @@ void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const Comp
                                              const BaseCompressedVector& compressed_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
+      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector));
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
+      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector));
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
+      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector));
       return;
     case CompressedVectorType::SimdBp128:
-      export_values(ofstream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
+      export_values(ofstream, dynamic_cast<const SimdBp128Vector&>(compressed_vector));
       return;
     default:
       Fail("Any other type should have been caught before.");
@@ -18,10 +18,23 @@ namespace opossum {
 class BaseCompressedVector;
 enum class CompressedVectorType : uint8_t;
 
+/**
+ * Files start with the format version (uint32_t, see BinaryParser::FORMAT_VERSION), followed by the contents
+ * described below. Each vector of values (e.g., dictionaries, attribute vectors, or string lengths) is preceded by up
+ * to alignof(value type) - 1 zero bytes, so that it starts at a file offset that is a multiple of the alignment of its
+ * values. This allows the BinaryParser to use them in place when the file is memory-mapped. The padding is not listed
+ * in the tables below.
+ */
 class BinaryWriter {
  public:
   static void write(const Table& table, const std::string& filename);
 
+  /**
+   * Writes a single chunk without the table header (see _write_chunk), e.g., for incremental checkpoints. Such files
+   * can be read using BinaryParser::parse_chunk. Like other files, they start with the format version.
+   */
+  static void write_chunk(const Table& table, const ChunkID chunk_id, const std::string& filename);
+
  private:
   /**
    * This methods writes the header of this table into the given ofstream.
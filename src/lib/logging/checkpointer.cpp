@@ -0,0 +1,402 @@
+#include "checkpointer.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "constant_mappings.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/list_directory.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto DATA_FILE_EXTENSION = ".chunk";
+constexpr auto INVALIDATED_ROWS_FILE_EXTENSION = ".invalid";
+
+// Makes sure that a written file (or a directory entry) survives a crash
+void sync_file(const std::string& path) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open '" + path + "' for syncing");
+  fsync(file_descriptor);
+  close(file_descriptor);
+}
+
+void write_invalidated_rows(const std::vector<ChunkOffset>& invalidated_rows, const std::string& filename) {
+  std::ofstream ofstream;
+  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  ofstream.open(filename, std::ios::binary);
+
+  const auto row_count = static_cast<uint32_t>(invalidated_rows.size());
+  ofstream.write(reinterpret_cast<const char*>(&row_count), sizeof(row_count));
+  ofstream.write(reinterpret_cast<const char*>(invalidated_rows.data()), row_count * sizeof(ChunkOffset));
+}
+
+std::vector<ChunkOffset> read_invalidated_rows(const std::string& filename) {
+  std::ifstream ifstream;
+  ifstream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  ifstream.open(filename, std::ios::binary);
+
+  auto row_count = uint32_t{};
+  ifstream.read(reinterpret_cast<char*>(&row_count), sizeof(row_count));
+  auto invalidated_rows = std::vector<ChunkOffset>(row_count);
+  ifstream.read(reinterpret_cast<char*>(invalidated_rows.data()), row_count * sizeof(ChunkOffset));
+  return invalidated_rows;
+}
+
+// Copies the first row_count rows of a mutable chunk into a new table, as rows might be appended to the chunk
+// concurrently. Only values of valid rows are read, because other rows might still be written by their transaction.
+std::shared_ptr<Table> copy_mutable_chunk(const Table& table, const Chunk& chunk, const ChunkOffset row_count,
+                                          const std::vector<ChunkOffset>& invalidated_rows) {
+  auto row_is_valid = std::vector<bool>(row_count, true);
+  for (const auto chunk_offset : invalidated_rows) {
+    row_is_valid[chunk_offset] = false;
+  }
+
+  auto segments = Segments{};
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      // Mutable chunks usually consist of ValueSegments, but the chunk might be finalized and encoded concurrently
+      // (e.g., by the BackgroundEncodingPlugin)
+      const auto segment_accessor = create_segment_accessor<ColumnDataType>(chunk.get_segment(column_id));
+
+      auto values = pmr_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_vector<bool>(row_count);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        if (!row_is_valid[chunk_offset]) continue;
+        const auto value = segment_accessor->access(chunk_offset);
+        if (value) {
+          values[chunk_offset] = *value;
+        } else {
+          null_values[chunk_offset] = true;
+        }
+      }
+
+      if (table.column_is_nullable(column_id)) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+
+  auto copied_table = std::make_shared<Table>(table.column_definitions(), TableType::Data);
+  copied_table->append_chunk(segments);
+  return copied_table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Checkpointer::Checkpointer(const std::string& directory) : _directory(directory) {
+  std::filesystem::create_directories(_directory);
+
+  // Continue the numbering of the previous checkpoint so that its files are not overwritten
+  if (has_checkpoint()) {
+    auto manifest_file = std::ifstream{_directory + "/" + MANIFEST_FILENAME};
+    auto manifest = nlohmann::json{};
+    manifest_file >> manifest;
+    _checkpoint_id = manifest.at("checkpoint_id").get<uint64_t>();
+  }
+}
+
+Checkpointer::Result Checkpointer::checkpoint() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  ++_checkpoint_id;
+
+  // The transaction context is only used to determine the snapshot commit ID. As long as it exists, the MVCC data
+  // of rows that are visible to it is not cleaned up.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  auto checkpointed_chunks = std::unordered_map<std::string, std::vector<std::optional<CheckpointedChunk>>>{};
+  auto written_chunk_count = std::atomic<size_t>{0};
+  auto unchanged_chunk_count = std::atomic<size_t>{0};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto table_index = size_t{0};
+  for (const auto& [table_name, table] : tables) {
+    const auto chunk_count = table->chunk_count();
+    auto& table_checkpointed_chunks = checkpointed_chunks[table_name];
+    table_checkpointed_chunks.resize(chunk_count);
+
+    const auto previous_iter = _checkpointed_chunks.find(table_name);
+    const auto* previous_checkpointed_chunks =
+        previous_iter != _checkpointed_chunks.end() ? &previous_iter->second : nullptr;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto filename_prefix =
+          std::to_string(_checkpoint_id) + "_" + std::to_string(table_index) + "_" + std::to_string(chunk_id);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, table = table, chunk_id, filename_prefix,
+                                                   previous_checkpointed_chunks]() {
+        const auto chunk = std::shared_ptr<const Chunk>{table->get_chunk(chunk_id)};
+        if (!chunk) return;
+
+        // Rows might be appended concurrently. These are not part of this checkpoint.
+        const auto row_count = static_cast<ChunkOffset>(chunk->size());
+        if (row_count == 0) return;
+
+        // Read the invalid row count before the MVCC data. If a delete commits in the meantime, the count differs in
+        // the next checkpoint.
+        const auto invalid_row_count = chunk->invalid_row_count();
+
+        auto segments = std::vector<std::weak_ptr<const BaseSegment>>{};
+        const auto column_count = chunk->column_count();
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          segments.emplace_back(chunk->get_segment(column_id));
+        }
+
+        const auto* previous = previous_checkpointed_chunks && chunk_id < previous_checkpointed_chunks->size() &&
+                                       (*previous_checkpointed_chunks)[chunk_id]
+                                   ? &*(*previous_checkpointed_chunks)[chunk_id]
+                                   : nullptr;
+
+        auto data_is_unchanged = previous && previous->chunk.lock() == chunk && previous->row_count == row_count;
+        for (auto column_id = ColumnID{0}; data_is_unchanged && column_id < column_count; ++column_id) {
+          data_is_unchanged = previous->segments[column_id].lock() == segments[column_id].lock();
+        }
+
+        auto& checkpointed_chunk = table_checkpointed_chunks[chunk_id];
+        if (data_is_unchanged && previous->is_settled && previous->invalid_row_count == invalid_row_count) {
+          checkpointed_chunk = *previous;
+          ++unchanged_chunk_count;
+          return;
+        }
+
+        checkpointed_chunk.emplace();
+        checkpointed_chunk->chunk = chunk;
+        checkpointed_chunk->segments = std::move(segments);
+        checkpointed_chunk->row_count = row_count;
+        checkpointed_chunk->invalid_row_count = invalid_row_count;
+        checkpointed_chunk->is_settled = true;
+
+        // Collect the rows that are not visible as of the snapshot commit ID
+        auto invalidated_rows = std::vector<ChunkOffset>{};
+        if (const auto mvcc_data = chunk->mvcc_data()) {
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+            const auto begin_cid = mvcc_data->get_begin_cid(chunk_offset);
+            const auto end_cid = mvcc_data->get_end_cid(chunk_offset);
+            if (begin_cid > snapshot_commit_id || end_cid <= snapshot_commit_id) {
+              invalidated_rows.emplace_back(chunk_offset);
+            }
+            const auto delete_committed_later = end_cid > snapshot_commit_id && end_cid != MvccData::MAX_COMMIT_ID;
+            if (begin_cid > snapshot_commit_id || delete_committed_later) {
+              checkpointed_chunk->is_settled = false;
+            }
+          }
+        }
+
+        // Rows that were not yet committed when the previous checkpoint copied a mutable chunk were written as default
+        // values. If they were committed since, the data file has to be written again even if the chunk is unchanged.
+        const auto reuse_data_file = data_is_unchanged && previous->is_settled;
+        if (reuse_data_file) {
+          checkpointed_chunk->data_filename = previous->data_filename;
+        } else {
+          checkpointed_chunk->data_filename = filename_prefix + DATA_FILE_EXTENSION;
+          const auto path = _directory + "/" + checkpointed_chunk->data_filename;
+          if (chunk->is_mutable()) {
+            BinaryWriter::write_chunk(*copy_mutable_chunk(*table, *chunk, row_count, invalidated_rows), ChunkID{0},
+                                      path);
+          } else {
+            BinaryWriter::write_chunk(*table, chunk_id, path);
+          }
+          sync_file(path);
+          ++written_chunk_count;
+        }
+
+        if (!invalidated_rows.empty()) {
+          checkpointed_chunk->invalidated_rows_filename = filename_prefix + INVALIDATED_ROWS_FILE_EXTENSION;
+          const auto path = _directory + "/" + checkpointed_chunk->invalidated_rows_filename;
+          write_invalidated_rows(invalidated_rows, path);
+          sync_file(path);
+        }
+
+        if (reuse_data_file) ++unchanged_chunk_count;
+      }));
+    }
+    ++table_index;
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Write the manifest to a temporary file first and then atomically replace the previous one
+  auto manifest = nlohmann::json{};
+  manifest["checkpoint_id"] = _checkpoint_id;
+  manifest["snapshot_commit_id"] = snapshot_commit_id;
+  manifest["tables"] = nlohmann::json::array();
+
+  auto referenced_filenames = std::unordered_set<std::string>{};
+  for (const auto& [table_name, table] : tables) {
+    auto table_json = nlohmann::json{};
+    table_json["name"] = table_name;
+    table_json["target_chunk_size"] = table->target_chunk_size();
+    table_json["uses_mvcc"] = table->uses_mvcc() == UseMvcc::Yes;
+
+    table_json["columns"] = nlohmann::json::array();
+    for (const auto& column_definition : table->column_definitions()) {
+      table_json["columns"].push_back({{"name", column_definition.name},
+                                       {"data_type", data_type_to_string.left.at(column_definition.data_type)},
+                                       {"nullable", column_definition.nullable}});
+    }
+
+    table_json["chunks"] = nlohmann::json::array();
+    for (const auto& checkpointed_chunk : checkpointed_chunks[table_name]) {
+      if (!checkpointed_chunk) continue;
+
+      auto chunk_json = nlohmann::json{};
+      chunk_json["data"] = checkpointed_chunk->data_filename;
+      chunk_json["row_count"] = checkpointed_chunk->row_count;
+      referenced_filenames.emplace(checkpointed_chunk->data_filename);
+      if (!checkpointed_chunk->invalidated_rows_filename.empty()) {
+        chunk_json["invalidated_rows"] = checkpointed_chunk->invalidated_rows_filename;
+        referenced_filenames.emplace(checkpointed_chunk->invalidated_rows_filename);
+      }
+      table_json["chunks"].push_back(chunk_json);
+    }
+
+    manifest["tables"].push_back(table_json);
+  }
+
+  const auto manifest_path = _directory + "/" + MANIFEST_FILENAME;
+  const auto temporary_manifest_path = manifest_path + ".tmp";
+  {
+    auto manifest_file = std::ofstream{temporary_manifest_path};
+    manifest_file << manifest.dump(2);
+    Assert(manifest_file.good(), "Could not write checkpoint manifest");
+  }
+  sync_file(temporary_manifest_path);
+  std::filesystem::rename(temporary_manifest_path, manifest_path);
+  sync_file(_directory);
+
+  // Remove files that belong to previous checkpoints only (or to a checkpoint that was interrupted)
+  for (const auto& path : list_directory(_directory)) {
+    const auto extension = path.extension().string();
+    if (extension != DATA_FILE_EXTENSION && extension != INVALIDATED_ROWS_FILE_EXTENSION) continue;
+    if (referenced_filenames.count(path.filename().string())) continue;
+    std::filesystem::remove(path);
+  }
+
+  _checkpointed_chunks = std::move(checkpointed_chunks);
+
+  return Result{written_chunk_count.load(), unchanged_chunk_count.load()};
+}
+
+bool Checkpointer::has_checkpoint() const { return std::filesystem::exists(_directory + "/" + MANIFEST_FILENAME); }
+
+size_t Checkpointer::restore() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  Assert(has_checkpoint(), "No checkpoint found in '" + _directory + "'");
+
+  auto manifest_file = std::ifstream{_directory + "/" + MANIFEST_FILENAME};
+  auto manifest = nlohmann::json{};
+  manifest_file >> manifest;
+  _checkpoint_id = manifest.at("checkpoint_id").get<uint64_t>();
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& table_json : manifest.at("tables")) {
+    const auto table_name = table_json.at("name").get<std::string>();
+    Assert(!storage_manager.has_table(table_name), "Cannot restore table '" + table_name + "', it already exists");
+
+    auto column_definitions = TableColumnDefinitions{};
+    for (const auto& column_json : table_json.at("columns")) {
+      column_definitions.emplace_back(column_json.at("name").get<std::string>(),
+                                      data_type_to_string.right.at(column_json.at("data_type").get<std::string>()),
+                                      column_json.at("nullable").get<bool>());
+    }
+    const auto use_mvcc = table_json.at("uses_mvcc").get<bool>() ? UseMvcc::Yes : UseMvcc::No;
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data,
+                                               table_json.at("target_chunk_size").get<ChunkOffset>(), use_mvcc);
+
+    // Read the chunks in parallel and append them in their original order afterwards. The files are memory-mapped, so
+    // that the attribute vectors are only read once they are accessed. This is safe, as the files of a checkpoint are
+    // never modified (only deleted once they are no longer referenced by the manifest).
+    const auto& chunks_json = table_json.at("chunks");
+    const auto chunk_count = chunks_json.size();
+    auto chunk_segments = std::vector<Segments>(chunk_count);
+    auto chunk_invalidated_rows = std::vector<std::vector<ChunkOffset>>(chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+        const auto& chunk_json = chunks_json[chunk_index];
+        chunk_segments[chunk_index] =
+            BinaryParser::parse_chunk(_directory + "/" + chunk_json.at("data").get<std::string>(), column_definitions,
+                                      BinaryParser::LoadMode::MemoryMapped);
+        if (chunk_json.contains("invalidated_rows")) {
+          chunk_invalidated_rows[chunk_index] =
+              read_invalidated_rows(_directory + "/" + chunk_json.at("invalidated_rows").get<std::string>());
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    auto& table_checkpointed_chunks = _checkpointed_chunks[table_name];
+    table_checkpointed_chunks.clear();
+
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      const auto& chunk_json = chunks_json[chunk_index];
+      const auto row_count = chunk_json.at("row_count").get<ChunkOffset>();
+      const auto& invalidated_rows = chunk_invalidated_rows[chunk_index];
+
+      auto mvcc_data = std::shared_ptr<MvccData>{};
+      if (use_mvcc == UseMvcc::Yes) {
+        mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
+        for (const auto chunk_offset : invalidated_rows) {
+          mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+        }
+      }
+
+      table->append_chunk(chunk_segments[chunk_index], mvcc_data);
+      const auto chunk = table->last_chunk();
+      chunk->increase_invalid_row_count(static_cast<ChunkOffset>(invalidated_rows.size()));
+      chunk->finalize();
+
+      // Restored chunks are part of the last checkpoint, so that they are not written again
+      auto& checkpointed_chunk = table_checkpointed_chunks.emplace_back(CheckpointedChunk{});
+      checkpointed_chunk->chunk = chunk;
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        checkpointed_chunk->segments.emplace_back(chunk->get_segment(column_id));
+      }
+      checkpointed_chunk->row_count = row_count;
+      checkpointed_chunk->invalid_row_count = chunk->invalid_row_count();
+      checkpointed_chunk->is_settled = true;
+      checkpointed_chunk->data_filename = chunk_json.at("data").get<std::string>();
+      checkpointed_chunk->invalidated_rows_filename = chunk_json.value("invalidated_rows", "");
+    }
+
+    storage_manager.add_table(table_name, table);
+  }
+
+  return manifest.at("tables").size();
+}
+
+}  // namespace opossum
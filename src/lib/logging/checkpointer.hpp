@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+/**
+ * Writes incremental checkpoints of all tables in the StorageManager into a directory and restores the StorageManager
+ * from them. Restoring a checkpoint is much faster than importing the original (e.g., CSV) files, as the chunks are
+ * stored in the binary format, including their encoding.
+ *
+ * A checkpoint consists of
+ *  - one file per chunk, written by BinaryWriter::write_chunk,
+ *  - one file per chunk with invalidated rows, which holds the offsets of these rows, and
+ *  - a JSON manifest, which lists the tables, their columns, and the files of their chunks.
+ *
+ * A checkpoint reflects the committed state as of the snapshot commit ID at which it was started. Rows that were
+ * deleted before, and rows that were inserted after (or not committed at) that commit ID are stored as invalidated.
+ *
+ * Checkpoints are incremental: The data file of a chunk is only written if the chunk was not part of the previous
+ * checkpoint, if it grew, or if its segments were replaced (e.g., because it was encoded). Its file of invalidated
+ * rows is only written if rows were invalidated in the meantime. All other files are taken over from the previous
+ * checkpoint. Only checkpoints written or restored by the same Checkpointer are considered, so that the first
+ * checkpoint of a process writes all chunks unless restore() was called before.
+ *
+ * All files of a checkpoint are written before the manifest is atomically replaced. Afterwards, files that are no
+ * longer referenced are deleted. Thus, a crash during a checkpoint leaves the previous checkpoint intact.
+ *
+ * Restored chunks are immutable (as for BinaryParser::parse). Physically deleted chunks and empty chunks are not
+ * restored, so that the ChunkIDs of the restored tables might differ from the original ones. For the same reason,
+ * a redo log (see LogManager) cannot be replayed on top of a restored checkpoint.
+ */
+class Checkpointer : public Noncopyable {
+ public:
+  struct Result {
+    // Chunks whose data was written to a new file
+    size_t written_chunk_count{0};
+
+    // Chunks whose data file was taken over from the previous checkpoint
+    size_t unchanged_chunk_count{0};
+  };
+
+  static constexpr auto MANIFEST_FILENAME = "manifest.json";
+
+  explicit Checkpointer(const std::string& directory);
+
+  /**
+   * Writes a checkpoint of all tables in the StorageManager. Can be called while transactions are running.
+   */
+  Result checkpoint();
+
+  bool has_checkpoint() const;
+
+  /**
+   * Adds all tables of the last checkpoint to the StorageManager and returns the number of restored tables. The tables
+   * must not exist yet.
+   */
+  size_t restore();
+
+ private:
+  // Files and state of a chunk as of the last checkpoint, used to determine whether the chunk has changed
+  struct CheckpointedChunk {
+    std::weak_ptr<const Chunk> chunk;
+    std::vector<std::weak_ptr<const BaseSegment>> segments;
+    ChunkOffset row_count{0};
+    ChunkOffset invalid_row_count{0};
+
+    // Whether the MVCC data of all rows was final as of the snapshot commit ID, i.e., all inserts were committed or
+    // rolled back and all deletes were committed before the snapshot commit ID. Otherwise, the chunk is checked again
+    // even if it did not change.
+    bool is_settled{false};
+
+    std::string data_filename;
+    std::string invalidated_rows_filename;
+  };
+
+  const std::string _directory;
+  uint64_t _checkpoint_id{0};
+
+  // Checkpointed chunks per table, indexed by ChunkID
+  std::unordered_map<std::string, std::vector<std::optional<CheckpointedChunk>>> _checkpointed_chunks;
+
+  std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include "log_entry_writer.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+LogEntryWriter::LogEntryWriter(const CommitID commit_id) {
+  // Reserve the header, which is filled in finish()
+  _buffer.resize(HEADER_SIZE);
+  _write(commit_id);
+  _write(_record_count);
+}
+
+void LogEntryWriter::create_table(const std::string& table_name, const Table& table) {
+  _write(LogRecordType::CreateTable);
+  _write_string(table_name);
+  _write(table.target_chunk_size());
+  _write(static_cast<BoolAsByteType>(table.uses_mvcc() == UseMvcc::Yes));
+  _write(static_cast<ColumnID::base_type>(table.column_count()));
+  for (const auto& column_definition : table.column_definitions()) {
+    _write_string(column_definition.name);
+    _write(static_cast<uint8_t>(column_definition.data_type));
+    _write(static_cast<BoolAsByteType>(column_definition.nullable));
+  }
+  ++_record_count;
+}
+
+void LogEntryWriter::drop_table(const std::string& table_name) {
+  _write(LogRecordType::DropTable);
+  _write_string(table_name);
+  ++_record_count;
+}
+
+void LogEntryWriter::insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                            const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  DebugAssert(begin_chunk_offset <= end_chunk_offset, "Invalid range of inserted rows");
+
+  _write(LogRecordType::Insert);
+  _write_string(table_name);
+  _write(chunk_id);
+  _write(begin_chunk_offset);
+  _write(end_chunk_offset);
+
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Cannot log rows of a physically deleted chunk");
+
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto accessor = create_segment_accessor<ColumnDataType>(chunk->get_segment(column_id));
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        const auto value = accessor->access(chunk_offset);
+        _write(static_cast<BoolAsByteType>(!value));
+        if (!value) continue;
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          _write_string(*value);
+        } else {
+          _write(*value);
+        }
+      }
+    });
+  }
+  ++_record_count;
+}
+
+void LogEntryWriter::delete_rows(const std::string& table_name, const std::vector<RowID>& row_ids) {
+  _write(LogRecordType::Delete);
+  _write_string(table_name);
+  _write(static_cast<uint32_t>(row_ids.size()));
+  for (const auto& row_id : row_ids) {
+    _write(row_id.chunk_id);
+    _write(row_id.chunk_offset);
+  }
+  ++_record_count;
+}
+
+size_t LogEntryWriter::record_count() const { return _record_count; }
+
+std::vector<char> LogEntryWriter::finish() {
+  const auto payload_size = _buffer.size() - HEADER_SIZE;
+  Assert(payload_size <= std::numeric_limits<uint32_t>::max(), "Log entry is too large");
+
+  // The record count is the second field of the payload
+  std::memcpy(_buffer.data() + HEADER_SIZE + sizeof(CommitID), &_record_count, sizeof(_record_count));
+
+  const auto size_field = static_cast<uint32_t>(payload_size);
+  const auto checksum_field = checksum(_buffer.data() + HEADER_SIZE, payload_size);
+  std::memcpy(_buffer.data(), &size_field, sizeof(size_field));
+  std::memcpy(_buffer.data() + sizeof(size_field), &checksum_field, sizeof(checksum_field));
+
+  return std::move(_buffer);
+}
+
+uint32_t LogEntryWriter::checksum(const char* data, const size_t size) {
+  // 32-bit FNV-1a, which is sufficient to detect entries that were only partially written before a crash
+  auto hash = uint32_t{2166136261u};
+  for (auto index = size_t{0}; index < size; ++index) {
+    hash ^= static_cast<uint8_t>(data[index]);
+    hash *= uint32_t{16777619u};
+  }
+  return hash;
+}
+
+template <typename T>
+void LogEntryWriter::_write(const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+  const auto offset = _buffer.size();
+  _buffer.resize(offset + sizeof(T));
+  std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+}
+
+void LogEntryWriter::_write_string(const std::string_view string) {
+  _write(static_cast<uint32_t>(string.size()));
+  _buffer.insert(_buffer.end(), string.begin(), string.end());
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class LogRecordType : uint8_t { CreateTable, DropTable, Insert, Delete };
+
+/**
+ * Serializes the redo records of one transaction (a log entry) for the LogManager. Read-write operators append their
+ * records in AbstractReadWriteOperator::log_records() before the transaction commits.
+ *
+ * The redo log is physical with regard to row positions: Insert records contain the ChunkID and ChunkOffsets that the
+ * rows were written to and Delete records contain the RowIDs of the deleted rows. Thus, the log can only be replayed
+ * on top of tables with the same physical layout as when logging was enabled (e.g., empty tables or tables that were
+ * loaded from the same binary file).
+ *
+ * A log entry has the following layout:
+ *
+ * Description                 | Type                                | Size in bytes
+ * -----------------------------------------------------------------------------------------------------------------
+ * Payload size                | uint32_t                            | 4
+ * Checksum of the payload     | uint32_t (FNV-1a)                   | 4
+ * Commit ID                   | CommitID (0 if not transactional)   | 4
+ * Record count                | uint32_t                            | 4
+ * Records                     | see below                           | Sum of record sizes
+ *
+ * Each record starts with its LogRecordType (1 byte) followed by the name of the table (uint32_t length + characters):
+ *  - CreateTable: target chunk size (ChunkOffset), MVCC (BoolAsByteType), column count (ColumnID), and for each
+ *                 column its name (uint32_t length + characters), DataType (uint8_t) and nullability (BoolAsByteType)
+ *  - DropTable:   no further data
+ *  - Insert:      ChunkID, first and last + 1 ChunkOffset, and for each column and row a null flag (BoolAsByteType)
+ *                 followed by the value (omitted for NULLs); strings are stored as uint32_t length + characters
+ *  - Delete:      row count (uint32_t) and the RowIDs
+ */
+class LogEntryWriter {
+ public:
+  static constexpr auto HEADER_SIZE = sizeof(uint32_t) * 2;
+
+  explicit LogEntryWriter(const CommitID commit_id = CommitID{0});
+
+  void create_table(const std::string& table_name, const Table& table);
+  void drop_table(const std::string& table_name);
+
+  /**
+   * Logs the rows [begin_chunk_offset, end_chunk_offset) of the given chunk, which have to be written already
+   */
+  void insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+              const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+  void delete_rows(const std::string& table_name, const std::vector<RowID>& row_ids);
+
+  size_t record_count() const;
+
+  /**
+   * Returns the serialized entry, including its header. The writer must not be used afterwards.
+   */
+  std::vector<char> finish();
+
+  static uint32_t checksum(const char* data, const size_t size);
+
+ private:
+  template <typename T>
+  void _write(const T& value);
+  void _write_string(const std::string_view string);
+
+  std::vector<char> _buffer;
+  uint32_t _record_count{0};
+};
+
+}  // namespace opossum
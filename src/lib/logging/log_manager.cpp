@@ -0,0 +1,384 @@
+#include "log_manager.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Reads the records of a single, already validated log entry
+class LogEntryReader {
+ public:
+  LogEntryReader(const char* data, const size_t size) : _data(data), _size(size) {}
+
+  template <typename T>
+  T read() {
+    Assert(_offset + sizeof(T) <= _size, "Log entry is shorter than expected");
+    auto value = T{};
+    std::memcpy(&value, _data + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  template <typename T>
+  T read_string() {
+    const auto length = read<uint32_t>();
+    Assert(_offset + length <= _size, "Log entry is shorter than expected");
+    auto string = T{_data + _offset, length};
+    _offset += length;
+    return string;
+  }
+
+ private:
+  const char* _data;
+  size_t _size;
+  size_t _offset{0};
+};
+
+void replay_create_table(LogEntryReader& reader) {
+  const auto table_name = reader.read_string<std::string>();
+  const auto target_chunk_size = reader.read<ChunkOffset>();
+  const auto use_mvcc = reader.read<BoolAsByteType>() ? UseMvcc::Yes : UseMvcc::No;
+  const auto column_count = reader.read<ColumnID::base_type>();
+
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto column_name = reader.read_string<std::string>();
+    const auto data_type = static_cast<DataType>(reader.read<uint8_t>());
+    const auto nullable = static_cast<bool>(reader.read<BoolAsByteType>());
+    column_definitions.emplace_back(column_name, data_type, nullable);
+  }
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  Assert(!storage_manager.has_table(table_name), "Cannot replay creation of existing table '" + table_name + "'");
+  storage_manager.add_table(table_name,
+                            std::make_shared<Table>(column_definitions, TableType::Data, target_chunk_size, use_mvcc));
+}
+
+// Returns the chunk that the rows were written to
+std::shared_ptr<Chunk> replay_insert(LogEntryReader& reader, Table& table) {
+  const auto chunk_id = reader.read<ChunkID>();
+  const auto begin_chunk_offset = reader.read<ChunkOffset>();
+  const auto end_chunk_offset = reader.read<ChunkOffset>();
+
+  // Chunks that were appended by other transactions but are not contained in the log (e.g., because the transaction
+  // was rolled back) are appended as well, so that all ChunkIDs match.
+  while (table.chunk_count() <= chunk_id) {
+    table.append_mutable_chunk();
+  }
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk && chunk->is_mutable(), "Cannot replay insert into immutable chunk");
+
+  // Grow the segments if necessary. As for the Insert operator, the first segment is resized last.
+  const auto column_count = table.column_count();
+  const auto new_size = std::max(static_cast<ChunkOffset>(chunk->size()), end_chunk_offset);
+  for (auto reverse_column_id = ColumnID{0}; reverse_column_id < column_count; ++reverse_column_id) {
+    const auto column_id = static_cast<ColumnID>(column_count - reverse_column_id - 1);
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Cannot replay insert into non-ValueSegments");
+      value_segment->resize(new_size);
+    });
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::static_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      auto& values = value_segment->values();
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        if (reader.read<BoolAsByteType>()) {
+          value_segment->set_null_value(chunk_offset);
+          continue;
+        }
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          values[chunk_offset] = reader.read_string<pmr_string>();
+        } else {
+          values[chunk_offset] = reader.read<ColumnDataType>();
+        }
+      }
+    });
+  }
+
+  // Replayed rows are visible to all transactions, similar to rows that were loaded from a file
+  if (const auto mvcc_data = chunk->mvcc_data()) {
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+      mvcc_data->set_tid(chunk_offset, TransactionID{0}, std::memory_order_relaxed);
+    }
+  }
+
+  return chunk;
+}
+
+void replay_delete(LogEntryReader& reader, Table& table) {
+  const auto row_count = reader.read<uint32_t>();
+  for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+    const auto chunk_id = reader.read<ChunkID>();
+    const auto chunk_offset = reader.read<ChunkOffset>();
+
+    Assert(chunk_id < table.chunk_count(), "Cannot replay delete of non-existing row");
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk && chunk_offset < chunk->size(), "Cannot replay delete of non-existing row");
+
+    const auto mvcc_data = chunk->mvcc_data();
+    Assert(mvcc_data, "Cannot replay delete on table without MVCC data");
+    mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+    chunk->increase_invalid_row_count(1);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Writes log entries in groups. Appending threads add their entries to a pending group, which the writer thread
+ * swaps out, writes, and syncs with a single fdatasync. While a group is being written, the next group accumulates.
+ */
+class GroupCommitLogWriter : public Noncopyable {
+ public:
+  explicit GroupCommitLogWriter(const std::string& path) {
+    _file_descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    Assert(_file_descriptor >= 0, "Could not open log file '" + path + "': " + std::strerror(errno));
+
+    _thread = std::thread{&GroupCommitLogWriter::_write_groups, this};
+  }
+
+  ~GroupCommitLogWriter() {
+    stop();
+    close(_file_descriptor);
+  }
+
+  void append(std::vector<char>&& log_entry, const std::function<void()>& on_durable) {
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      Assert(!_stop_requested, "Cannot append to log after logging was disabled");
+      _pending_buffer.insert(_pending_buffer.end(), log_entry.begin(), log_entry.end());
+      _pending_callbacks.emplace_back(on_durable);
+    }
+    _condition_variable.notify_one();
+  }
+
+  // Writes the remaining group and stops the writer thread
+  void stop() {
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      if (_stop_requested) return;
+      _stop_requested = true;
+    }
+    _condition_variable.notify_one();
+    _thread.join();
+  }
+
+  bool is_running() const {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    return !_stop_requested;
+  }
+
+  std::atomic<uint64_t> written_entry_count{0};
+  std::atomic<uint64_t> written_byte_count{0};
+  std::atomic<uint64_t> sync_count{0};
+
+ private:
+  void _write_groups() {
+    auto buffer = std::vector<char>{};
+    auto callbacks = std::vector<std::function<void()>>{};
+
+    while (true) {
+      {
+        auto lock = std::unique_lock<std::mutex>{_mutex};
+        _condition_variable.wait(lock, [&] { return !_pending_callbacks.empty() || _stop_requested; });
+        if (_pending_callbacks.empty()) return;
+
+        std::swap(buffer, _pending_buffer);
+        std::swap(callbacks, _pending_callbacks);
+      }
+
+      auto written_bytes = size_t{0};
+      while (written_bytes < buffer.size()) {
+        const auto result = write(_file_descriptor, buffer.data() + written_bytes, buffer.size() - written_bytes);
+        if (result < 0 && errno == EINTR) continue;
+        Assert(result >= 0, std::string{"Could not write to log file: "} + std::strerror(errno));
+        written_bytes += static_cast<size_t>(result);
+      }
+      Assert(fdatasync(_file_descriptor) == 0, std::string{"Could not sync log file: "} + std::strerror(errno));
+
+      written_entry_count += callbacks.size();
+      written_byte_count += buffer.size();
+      ++sync_count;
+
+      for (const auto& callback : callbacks) {
+        if (callback) callback();
+      }
+
+      buffer.clear();
+      callbacks.clear();
+    }
+  }
+
+  int _file_descriptor{-1};
+
+  mutable std::mutex _mutex;
+  std::condition_variable _condition_variable;
+  std::vector<char> _pending_buffer;
+  std::vector<std::function<void()>> _pending_callbacks;
+  bool _stop_requested{false};
+
+  std::thread _thread;
+};
+
+LogManager::LogManager() = default;
+
+LogManager::~LogManager() = default;
+
+void LogManager::enable(const std::string& path) {
+  Assert(!is_enabled(), "Logging is already enabled");
+  _writer = std::make_unique<GroupCommitLogWriter>(path);
+}
+
+void LogManager::disable() {
+  if (_writer) _writer->stop();
+}
+
+bool LogManager::is_enabled() const { return _writer && _writer->is_running(); }
+
+void LogManager::append(LogEntryWriter&& log_entry, const std::function<void()>& on_durable) {
+  Assert(is_enabled(), "Cannot append to log while logging is disabled");
+  _writer->append(log_entry.finish(), on_durable);
+}
+
+void LogManager::append_and_wait(LogEntryWriter&& log_entry) {
+  auto durable = std::promise<void>{};
+  append(std::move(log_entry), [&]() { durable.set_value(); });
+  durable.get_future().wait();
+}
+
+size_t LogManager::recover(const std::string& path) {
+  Assert(!is_enabled(), "Cannot recover while logging is enabled");
+
+  auto file = std::ifstream{path, std::ios::binary};
+  Assert(file.is_open(), "Could not open log file '" + path + "'");
+  const auto data = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  file.close();
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  auto modified_tables = std::set<std::shared_ptr<Table>>{};
+  auto modified_chunks = std::set<std::shared_ptr<Chunk>>{};
+
+  auto entry_count = size_t{0};
+  auto offset = size_t{0};
+  while (offset + LogEntryWriter::HEADER_SIZE <= data.size()) {
+    auto payload_size = uint32_t{};
+    auto checksum = uint32_t{};
+    std::memcpy(&payload_size, data.data() + offset, sizeof(payload_size));
+    std::memcpy(&checksum, data.data() + offset + sizeof(payload_size), sizeof(checksum));
+
+    // Stop at entries that were not completely written
+    const auto payload = data.data() + offset + LogEntryWriter::HEADER_SIZE;
+    if (offset + LogEntryWriter::HEADER_SIZE + payload_size > data.size()) break;
+    if (LogEntryWriter::checksum(payload, payload_size) != checksum) break;
+
+    auto reader = LogEntryReader{payload, payload_size};
+    reader.read<CommitID>();
+    const auto record_count = reader.read<uint32_t>();
+
+    for (auto record_index = uint32_t{0}; record_index < record_count; ++record_index) {
+      const auto record_type = reader.read<LogRecordType>();
+      switch (record_type) {
+        case LogRecordType::CreateTable:
+          replay_create_table(reader);
+          break;
+
+        case LogRecordType::DropTable: {
+          const auto table_name = reader.read_string<std::string>();
+          modified_tables.erase(storage_manager.get_table(table_name));
+          storage_manager.drop_table(table_name);
+        } break;
+
+        case LogRecordType::Insert: {
+          const auto table = storage_manager.get_table(reader.read_string<std::string>());
+          modified_chunks.emplace(replay_insert(reader, *table));
+          modified_tables.emplace(table);
+        } break;
+
+        case LogRecordType::Delete: {
+          const auto table = storage_manager.get_table(reader.read_string<std::string>());
+          replay_delete(reader, *table);
+          modified_tables.emplace(table);
+        } break;
+      }
+    }
+
+    offset += LogEntryWriter::HEADER_SIZE + payload_size;
+    ++entry_count;
+  }
+
+  // Remove the incompletely written tail, so that new entries are not appended after it
+  if (offset < data.size()) {
+    std::filesystem::resize_file(path, offset);
+  }
+
+  // Rows that were allocated by transactions that were rolled back or did not commit before the crash are not part of
+  // the log. They are invalidated in the same way as rows of rolled back inserts.
+  for (const auto& chunk : modified_chunks) {
+    const auto mvcc_data = chunk->mvcc_data();
+    if (!mvcc_data) continue;
+
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_begin_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) continue;
+      mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+      chunk->increase_invalid_row_count(1);
+    }
+  }
+
+  // Statistics were generated when the tables were added (i.e., without the replayed rows)
+  for (const auto& table : modified_tables) {
+    table->set_table_statistics(TableStatistics::from_table(*table));
+    generate_chunk_pruning_statistics(table);
+  }
+
+  return entry_count;
+}
+
+uint64_t LogManager::written_entry_count() const { return _writer ? _writer->written_entry_count.load() : 0; }
+
+uint64_t LogManager::written_byte_count() const { return _writer ? _writer->written_byte_count.load() : 0; }
+
+uint64_t LogManager::sync_count() const { return _writer ? _writer->sync_count.load() : 0; }
+
+LogManager& LogManager::operator=(LogManager&& log_manager) noexcept {
+  _writer = std::move(log_manager._writer);
+  return *this;
+}
+
+}  // namespace opossum
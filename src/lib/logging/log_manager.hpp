@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "log_entry_writer.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class GroupCommitLogWriter;
+
+/**
+ * The LogManager provides durability for committed transactions by writing a redo log (write-ahead log, WAL).
+ *
+ * When logging is enabled, every committing transaction serializes the changes of its read-write operators into a
+ * log entry (see LogEntryWriter). The transaction only becomes visible (i.e., the TransactionManager's last commit ID
+ * is only advanced) once its entry has been written to the log file and synced to disk.
+ *
+ * Log entries are written using group commit: Entries of concurrently committing transactions are collected in a
+ * buffer while the previous group is being written. A dedicated thread then writes the whole group and calls
+ * fdatasync once for all of its entries. Thus, the cost of a sync is amortized over all transactions that committed
+ * in the meantime.
+ *
+ * On startup, recover() replays the log into the StorageManager. As the log is physical with regard to row positions,
+ * the tables must have the same layout as when logging was enabled. Replayed changes become part of the initial
+ * database state, i.e., they are visible to all transactions. Entries at the end of the file that were not completely
+ * written (e.g., because of a crash during a write) are detected by their checksum and discarded.
+ */
+class LogManager : public Noncopyable {
+ public:
+  ~LogManager();
+
+  /**
+   * Appends to the log file at the given path, which is created if it does not exist
+   */
+  void enable(const std::string& path);
+
+  /**
+   * Writes all pending entries to disk and stops logging
+   */
+  void disable();
+
+  bool is_enabled() const;
+
+  /**
+   * Appends a log entry and calls on_durable from the log writer thread once the entry (and all entries appended
+   * before it) have been written and synced. on_durable must not block.
+   */
+  void append(LogEntryWriter&& log_entry, const std::function<void()>& on_durable);
+
+  /**
+   * Appends a log entry and blocks until it has been synced
+   */
+  void append_and_wait(LogEntryWriter&& log_entry);
+
+  /**
+   * Replays the log file at the given path into the StorageManager and returns the number of replayed entries.
+   * Incompletely written entries at the end of the file are removed from the file. Logging must be disabled while
+   * recovering.
+   */
+  size_t recover(const std::string& path);
+
+  /**
+   * @defgroup Statistics about the log written since the last call to enable(), kept after disable()
+   * @{
+   */
+  uint64_t written_entry_count() const;
+  uint64_t written_byte_count() const;
+  uint64_t sync_count() const;
+  /** @} */
+
+  LogManager& operator=(LogManager&& log_manager) noexcept;
+
+ protected:
+  LogManager();
+  friend class Hyrise;
+
+  std::unique_ptr<GroupCommitLogWriter> _writer;
+};
+
+}  // namespace opossum
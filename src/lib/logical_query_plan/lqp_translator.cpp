@@ -20,7 +20,9 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -31,6 +33,7 @@
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lossless_cast.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
@@ -56,6 +59,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
@@ -64,6 +68,7 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "storage/index/primary_key_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
@@ -180,6 +185,41 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   // Our IndexScan implementation does not work on reference segments yet.
   Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
 
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+
+  // The IndexScanRule merges equality predicates on all primary key columns into a single PredicateNode. Its
+  // conjunctive predicates compare the primary key columns (in the order of the PrimaryKeyIndex) to values.
+  if (const auto& primary_key_index = table->primary_key_index()) {
+    const auto& primary_key_column_ids = primary_key_index->column_ids();
+    const auto predicates = flatten_logical_expressions(node->predicate(), LogicalOperator::And);
+
+    auto column_ids = std::vector<ColumnID>{};
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto predicate_idx = size_t{0}; predicate_idx < predicates.size(); ++predicate_idx) {
+      const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicates[predicate_idx]);
+      if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) break;
+
+      const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+      const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->right_operand());
+      if (!column_expression || !value_expression || predicate_idx >= primary_key_column_ids.size() ||
+          column_expression->column_reference.original_node() != stored_table_node ||
+          column_expression->column_reference.original_column_id() != primary_key_column_ids[predicate_idx]) {
+        break;
+      }
+
+      column_ids.emplace_back(stored_table_node->get_column_id(*column_expression));
+      values.emplace_back(value_expression->value);
+    }
+
+    if (predicates.size() == primary_key_column_ids.size() && values.size() == primary_key_column_ids.size()) {
+      const auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::PrimaryKey, column_ids,
+                                                           PredicateCondition::Equals, values);
+      index_scan->lqp_node = node;
+      return index_scan;
+    }
+  }
+
   const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
   Assert(predicate, "Expected predicate");
   Assert(!predicate->arguments.empty(), "Expected arguments");
@@ -203,9 +243,6 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   std::vector<AllTypeVariant> right_values2 = {};
   if (value2_variant) right_values2.emplace_back(*value2_variant);
 
-  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
-  const auto table_name = stored_table_node->table_name;
-  const auto table = Hyrise::get().storage_manager.get_table(table_name);
   std::vector<ChunkID> indexed_chunks;
 
   const auto chunk_count = table->chunk_count();
@@ -266,28 +303,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
-
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-
-  auto pqp_expression_iter = pqp_expressions.begin();
-  auto order_by_mode_iter = sort_node->order_by_modes.begin();
-
-  std::vector<SortColumnDefinition> column_definitions;
-  column_definitions.reserve(pqp_expressions.size());
-  for (; pqp_expression_iter != pqp_expressions.end(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
-    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
-    Assert(pqp_column_expression,
-           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
-
-    column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *order_by_mode_iter});
-  }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
-
-  return current_pqp;
+  return std::make_shared<Sort>(input_operator, _translate_sort_column_definitions(node));
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -386,10 +403,27 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto& input_node = node->left_input();
+
+  // For ORDER BY ... LIMIT n with a constant n, TopK determines the first n rows without sorting and materializing the
+  // entire input. This is only possible if no other node consumes the output of the SortNode.
+  if (input_node->type == LQPNodeType::Sort && input_node->output_count() == 1) {
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression());
+    if (value_expression &&
+        (value_expression->data_type() == DataType::Int || value_expression->data_type() == DataType::Long)) {
+      const auto row_count = lossless_variant_cast<int64_t>(value_expression->value);
+      if (row_count && *row_count >= 0) {
+        const auto input_operator = translate_node(input_node->left_input());
+        return std::make_shared<TopK>(input_operator, _translate_sort_column_definitions(input_node),
+                                      static_cast<size_t>(*row_count));
+      }
+    }
+  }
+
+  const auto input_operator = translate_node(input_node);
+  return std::make_shared<Limit>(input_operator,
+                                 _translate_expressions({limit_node->num_rows_expression()}, input_node).front());
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -403,7 +437,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_delete_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
   auto delete_node = std::dynamic_pointer_cast<DeleteNode>(node);
-  return std::make_shared<Delete>(input_operator);
+  return std::make_shared<Delete>(delete_node->table_name, input_operator);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_update_node(
@@ -515,6 +549,28 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_dummy_table_node(
   return std::make_shared<TableWrapper>(Projection::dummy_table());
 }
 
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+
+  auto pqp_expression_iter = pqp_expressions.begin();
+  auto order_by_mode_iter = sort_node->order_by_modes.begin();
+
+  std::vector<SortColumnDefinition> column_definitions;
+  column_definitions.reserve(pqp_expressions.size());
+  for (; pqp_expression_iter != pqp_expressions.end(); ++pqp_expression_iter, ++order_by_mode_iter) {
+    const auto& pqp_expression = *pqp_expression_iter;
+    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
+    Assert(pqp_column_expression,
+           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+
+    column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *order_by_mode_iter});
+  }
+
+  return column_definitions;
+}
+
 std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
     const std::shared_ptr<AbstractExpression>& lqp_expression, const std::shared_ptr<AbstractLQPNode>& node) const {
   auto pqp_expression = lqp_expression->deep_copy();
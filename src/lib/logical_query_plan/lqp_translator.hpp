@@ -16,6 +16,7 @@ class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
+struct SortColumnDefinition;
 
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
@@ -65,6 +66,10 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_create_prepared_plan_node(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Translate the expressions of a SortNode to the SortColumnDefinitions used by Sort and TopK
+  std::vector<SortColumnDefinition> _translate_sort_column_definitions(
+      const std::shared_ptr<AbstractLQPNode>& node) const;
+
   // Translate LQP- to PQPExpressions
   std::shared_ptr<AbstractExpression> _translate_expression(const std::shared_ptr<AbstractExpression>& lqp_expression,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -151,6 +151,15 @@ void AbstractOperator::set_transaction_context_recursively(
   if (_input_right) mutable_input_right()->set_transaction_context_recursively(transaction_context);
 }
 
+std::optional<size_t> AbstractOperator::memory_budget() const { return _memory_budget; }
+
+void AbstractOperator::set_memory_budget_recursively(const std::optional<size_t>& memory_budget) {
+  _memory_budget = memory_budget;
+
+  if (_input_left) mutable_input_left()->set_memory_budget_recursively(memory_budget);
+  if (_input_right) mutable_input_right()->set_memory_budget_recursively(memory_budget);
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_left() const {
   return std::const_pointer_cast<AbstractOperator>(_input_left);
 }
@@ -38,6 +38,7 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
@@ -99,6 +100,14 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // Number of bytes that operators may use for their intermediate data structures before spilling them to disk
+  // (currently only respected by JoinHash). Like the transaction context, the budget is set per query (see
+  // SQLPipelineBuilder::with_memory_budget) and is not copied by deep_copy(). std::nullopt means unlimited.
+  std::optional<size_t> memory_budget() const;
+
+  // Calls set_memory_budget on itself and both input operators recursively
+  void set_memory_budget_recursively(const std::optional<size_t>& memory_budget);
+
   // Returns a new instance of the same operator with the same configuration.
   // Recursively copies the input operators.
   // An operator needs to implement this method in order to be cacheable.
@@ -127,6 +136,9 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   std::shared_ptr<const AbstractLQPNode> lqp_node;
 
  protected:
+  // Executes copies of the operators for each morsel and sets the combined output and performance data of the originals
+  friend class OperatorPipeline;
+
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
@@ -166,6 +178,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  std::optional<size_t> _memory_budget;
+
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
 };
 
@@ -7,6 +7,7 @@
 #include "abstract_operator.hpp"
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/log_entry_writer.hpp"
 #include "storage/table.hpp"
 
 #include "utils/assert.hpp"
@@ -48,6 +49,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Adds the redo records of the (executed, but not yet committed) operator to the log entry of its transaction. Only
+   * called if logging is enabled (see LogManager).
+   */
+  void log_records(LogEntryWriter& log_entry) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -80,6 +87,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by log_records. Operators that do not modify tables themselves (e.g., Update, which uses Insert and Delete)
+   * do not need to log anything.
+   */
+  virtual void _on_log_records(LogEntryWriter& log_entry) const {}
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
@@ -1,7 +1,10 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -73,6 +76,127 @@ const AggregateKey& get_aggregate_key([[maybe_unused]] const KeysPerChunk<Aggreg
   }
 }
 
+// Merges the result of a group that was pre-aggregated by one job into the result of the same group in another job.
+// The source is left in an unspecified state.
+template <AggregateFunction function, typename ColumnDataType, typename AggregateType>
+void merge_aggregate_results(AggregateResult<ColumnDataType, AggregateType>& target,
+                             AggregateResult<ColumnDataType, AggregateType>& source) {
+  target.aggregate_count += source.aggregate_count;
+
+  if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max ||
+                function == AggregateFunction::Any) {
+    if (!source.current_primary_aggregate) return;
+
+    if (!target.current_primary_aggregate ||
+        (function == AggregateFunction::Min &&
+         value_smaller(*source.current_primary_aggregate, *target.current_primary_aggregate)) ||
+        (function == AggregateFunction::Max &&
+         value_greater(*source.current_primary_aggregate, *target.current_primary_aggregate))) {
+      target.current_primary_aggregate = std::move(source.current_primary_aggregate);
+    }
+  } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+    if (!source.current_primary_aggregate) return;
+
+    if (target.current_primary_aggregate) {
+      *target.current_primary_aggregate += *source.current_primary_aggregate;
+    } else {
+      target.current_primary_aggregate = std::move(source.current_primary_aggregate);
+    }
+  } else if constexpr (function == AggregateFunction::CountDistinct) {
+    target.distinct_values.merge(source.distinct_values);
+  } else if constexpr (function == AggregateFunction::StandardDeviationSample && std::is_arithmetic_v<AggregateType>) {
+    // Combines the count, mean, and squared_distance_from_mean of Welford's algorithm (see AggregateFunctionBuilder):
+    // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+    if (source.current_secondary_aggregates.empty()) return;
+
+    if (target.current_secondary_aggregates.empty()) {
+      target.current_secondary_aggregates = std::move(source.current_secondary_aggregates);
+      target.current_primary_aggregate = source.current_primary_aggregate;
+      return;
+    }
+
+    auto& count = target.current_secondary_aggregates[0];
+    auto& mean = target.current_secondary_aggregates[1];
+    auto& squared_distance_from_mean = target.current_secondary_aggregates[2];
+    const auto source_count = source.current_secondary_aggregates[0];
+    const auto source_mean = source.current_secondary_aggregates[1];
+    const auto source_squared_distance_from_mean = source.current_secondary_aggregates[2];
+
+    const auto merged_count = count + source_count;
+    const auto delta = source_mean - mean;
+    mean += delta * source_count / merged_count;
+    squared_distance_from_mean +=
+        source_squared_distance_from_mean + delta * delta * count * source_count / merged_count;
+    count = merged_count;
+
+    if (count > 1) {
+      target.current_primary_aggregate = std::sqrt(squared_distance_from_mean / (count - 1));
+    } else {
+      target.current_primary_aggregate = std::nullopt;
+    }
+  }
+}
+
+// Calls the functor with the ColumnDataType, the AggregateType, and the AggregateFunction (as an
+// std::integral_constant) of the AggregateContext that AggregateHash uses for the aggregate at aggregate_idx.
+template <typename Functor>
+void resolve_aggregate_context_types(const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                                     const Table& input_table, const ColumnID aggregate_idx, const Functor& functor) {
+  using boost::hana::type_c;
+
+  if (aggregates.empty()) {
+    // Dummy context of the DISTINCT implementation, which only holds the row ids of the groups
+    functor(type_c<DistinctColumnType>, type_c<DistinctAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Any>{});
+    return;
+  }
+
+  const auto& aggregate = *aggregates[aggregate_idx];
+  const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate.argument()).column_id;
+  if (input_column_id == INVALID_COLUMN_ID) {
+    // COUNT(*)
+    functor(type_c<CountColumnType>, type_c<CountAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  resolve_data_type(input_table.column_data_type(input_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto call_functor = [&](auto function_t) {
+      using AggregateType = typename AggregateTraits<ColumnDataType, decltype(function_t)::value>::AggregateType;
+      functor(type_c<ColumnDataType>, type_c<AggregateType>, function_t);
+    };
+
+    switch (aggregate.aggregate_function) {
+      case AggregateFunction::Min:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+        break;
+      case AggregateFunction::Max:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+        break;
+      case AggregateFunction::Sum:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+        break;
+      case AggregateFunction::Avg:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+        break;
+      case AggregateFunction::Count:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+        break;
+      case AggregateFunction::CountDistinct:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+        break;
+      case AggregateFunction::StandardDeviationSample:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::StandardDeviationSample>{});
+        break;
+      case AggregateFunction::Any:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Any>{});
+        break;
+    }
+  });
+}
+
 }  // namespace
 
 namespace opossum {
@@ -127,13 +251,14 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, Aggregat
 
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
 void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                       const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+                                       const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                       const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  auto& context =
+      *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
@@ -439,25 +564,48 @@ void AggregateHash::_aggregate() {
   /*
   AGGREGATION PHASE
   */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  const auto chunk_count = input_table->chunk_count();
+
+  // Using more jobs than there are workers balances the load if some chunk ranges take longer than others
+  const auto job_count = std::min({static_cast<size_t>(chunk_count),
+                                   input_table->row_count() / MIN_ROWS_PER_PREAGGREGATION_JOB,
+                                   2 * std::max(Hyrise::get().topology.num_cpus(), size_t{1})});
+  if (job_count > 1) {
+    _aggregate_in_parallel(keys_per_chunk, job_count);
+    return;
+  }
+
+  // Create the contexts here, and not in the per-chunk-loop below, because there might be no Chunks in the input and
+  // _write_aggregate_output() needs these contexts anyway.
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
+
+  // Process Chunks and perform aggregations
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    _aggregate_chunk(chunk_id, keys_per_chunk, _contexts_per_column);
+  }
+}
+
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts() const {
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
 
   if (_aggregates.empty()) {
     /*
     Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
+    That way, contexts will always have at least one context with results.
     This is important later on when we write the group keys into the table.
 
     We choose int8_t for column type and aggregate type because it's small.
     */
     auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    _contexts_per_column.push_back(context);
+    contexts.push_back(context);
   }
 
   /**
    * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
+   * created on.
    */
+  const auto& input_table = input_table_left();
   for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
     const auto& aggregate = _aggregates[aggregate_idx];
 
@@ -468,145 +616,320 @@ void AggregateHash::_aggregate() {
       Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
       auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      _contexts_per_column[aggregate_idx] = context;
+      contexts[aggregate_idx] = context;
       continue;
     }
     auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
+    contexts[aggregate_idx] = _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
   }
 
-  // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) continue;
+  return contexts;
+}
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
+  const auto& input_table = input_table_left();
+  const auto chunk_in = input_table->get_chunk(chunk_id);
+  if (!chunk_in) return;
 
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
+  // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
+  const auto input_chunk_size = chunk_in->size();
 
-    if (_aggregates.empty()) {
+  if (_aggregates.empty()) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+     *
+     * For a query like "SELECT DISTINCT * FROM A;"
+     * we would assume that all columns from A are part of 'groupby_columns',
+     * respectively any columns that were specified in the projection.
+     * The optimizer is responsible to take care of passing in the correct columns.
+     *
+     * How does this operation work?
+     * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
+     * these vectors are used as keys in the 'column_results' map.
+     *
+     * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
+     * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
+     * One could optimize here in the future.
+     *
+     * Obviously this implementation is also used for plain GroupBy's.
+     */
+
+    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
+        contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+      // Make sure the value or combination of values is added to the list of distinct value(s)
+      get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                        RowID{chunk_id, chunk_offset});
+    }
+  } else {
+    ColumnID aggregate_idx{0};
+    for (const auto& aggregate : _aggregates) {
       /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+       * We then go through the keys_per_chunk map and count the occurrences of each group key.
+       * The results are saved in the regular aggregate_count variable so that we don't need a
+       * specific output logic for COUNT(*).
        */
 
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
+      const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+      const auto input_column_id = pqp_column.column_id;
 
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
+      if (input_column_id == INVALID_COLUMN_ID) {
+        Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+        auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+            contexts[aggregate_idx]);
 
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                          RowID{chunk_id, chunk_offset});
-      }
-    } else {
-      ColumnID aggregate_idx{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
-
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[aggregate_idx]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
-
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
-          } else {
-            // count occurrences for each group key
-            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-              auto& result = get_or_add_result(result_ids, results,
-                                               get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                               RowID{chunk_id, chunk_offset});
-              ++result.aggregate_count;
-            }
+        auto& result_ids = *context->result_ids;
+        auto& results = context->results;
+
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          // Not grouped by anything, simply count the number of rows
+          results.resize(1);
+          results[0].aggregate_count += input_chunk_size;
+        } else {
+          // count occurrences for each group key
+          for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+            auto& result = get_or_add_result(result_ids, results,
+                                             get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                             RowID{chunk_id, chunk_offset});
+            ++result.aggregate_count;
           }
+        }
+
+        ++aggregate_idx;
+        continue;
+      }
 
-          ++aggregate_idx;
-          continue;
+      auto base_segment = chunk_in->get_segment(input_column_id);
+      auto data_type = input_table->column_data_type(input_column_id);
+
+      /*
+      Invoke correct aggregator for each segment
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->aggregate_function) {
+          case AggregateFunction::Min:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Max:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Sum:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Avg:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Count:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::CountDistinct:
+            _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::StandardDeviationSample:
+            _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Any:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
         }
+      });
 
-        auto base_segment = chunk_in->get_segment(input_column_id);
-        auto data_type = input_table->column_data_type(input_column_id);
+      ++aggregate_idx;
+    }
+  }
+}
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk, const size_t job_count) {
+  const auto& input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+  // Without GROUP BY columns, there is only a single group and thus a single partition
+  auto partition_count = size_t{1};
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    while (partition_count < job_count) partition_count *= 2;
+  }
+  const auto partition_mask = partition_count - 1;
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
+  /*
+  PRE-AGGREGATION
+  Each job aggregates a consecutive range of chunks into its own contexts. As all contexts of a job see the rows in the
+  same order, a group has the same AggregateResultId in each of them. Once the contexts hold more than
+  MAX_PREAGGREGATION_GROUP_COUNT groups after a chunk, and when the job is done, the job flushes its results into the
+  buffers of the radix partitions and starts over with empty contexts. Thus, inputs with many distinct groups do not
+  keep a full-sized hash table per job. The AggregateKey of a group is retrieved via the row id stored in its results.
+  */
+  const auto aggregate_context_count = std::max(_aggregates.size(), size_t{1});
+  auto buffers_per_partition = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+  for (auto& buffers : buffers_per_partition) {
+    buffers.resize(aggregate_context_count);
+    for (auto column_index = ColumnID{0}; column_index < aggregate_context_count; ++column_index) {
+      resolve_aggregate_context_types(_aggregates, *input_table, column_index,
+                                      [&](const auto column_data_type_t, const auto aggregate_type_t, auto) {
+                                        using ColumnDataType = typename decltype(column_data_type_t)::type;
+                                        using AggregateType = typename decltype(aggregate_type_t)::type;
+                                        buffers[column_index] =
+                                            std::make_shared<AggregateResultContext<ColumnDataType, AggregateType>>();
+                                      });
+    }
+  }
+  auto buffer_mutexes = std::vector<std::mutex>(partition_count);
+
+  const auto flush = [&](const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
+    auto result_ids_per_partition = std::vector<std::vector<AggregateResultId>>(partition_count);
+    resolve_aggregate_context_types(_aggregates, *input_table, ColumnID{0}, [&](const auto column_data_type_t,
+                                                                                const auto aggregate_type_t, auto) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+      using AggregateType = typename decltype(aggregate_type_t)::type;
+
+      const auto& results =
+          static_cast<const AggregateResultContext<ColumnDataType, AggregateType>&>(*contexts[0]).results;
+      const auto result_count = results.size();
+      for (auto result_id = AggregateResultId{0}; result_id < result_count; ++result_id) {
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          result_ids_per_partition[0].emplace_back(result_id);
+        } else {
+          const auto& row_id = results[result_id].row_id;
+          const auto& key = get_aggregate_key<AggregateKey>(keys_per_chunk, row_id.chunk_id, row_id.chunk_offset);
+          result_ids_per_partition[std::hash<AggregateKey>{}(key) & partition_mask].emplace_back(result_id);
+        }
+      }
+    });
 
-          switch (aggregate->aggregate_function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                         *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Any:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      const auto& result_ids = result_ids_per_partition[partition_id];
+      if (result_ids.empty()) continue;
+
+      const auto lock = std::lock_guard<std::mutex>{buffer_mutexes[partition_id]};
+      for (auto column_index = ColumnID{0}; column_index < aggregate_context_count; ++column_index) {
+        resolve_aggregate_context_types(_aggregates, *input_table, column_index, [&](const auto column_data_type_t,
+                                                                                     const auto aggregate_type_t,
+                                                                                     auto) {
+          using ColumnDataType = typename decltype(column_data_type_t)::type;
+          using AggregateType = typename decltype(aggregate_type_t)::type;
+          using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+          auto& results = static_cast<Context&>(*contexts[column_index]).results;
+          auto& buffer = static_cast<Context&>(*buffers_per_partition[partition_id][column_index]).results;
+          for (const auto result_id : result_ids) {
+            buffer.emplace_back(std::move(results[result_id]));
           }
         });
-
-        ++aggregate_idx;
       }
     }
+  };
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      auto contexts = _create_aggregate_contexts<AggregateKey>();
+
+      const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * job_id / job_count)};
+      const auto end_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (job_id + 1) / job_count)};
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        _aggregate_chunk(chunk_id, keys_per_chunk, contexts);
+
+        // The contexts of all aggregates hold the same groups, so the size of the first one is checked only
+        resolve_aggregate_context_types(_aggregates, *input_table, ColumnID{0}, [&](const auto column_data_type_t,
+                                                                                    const auto aggregate_type_t, auto) {
+          using ColumnDataType = typename decltype(column_data_type_t)::type;
+          using AggregateType = typename decltype(aggregate_type_t)::type;
+
+          const auto& context = static_cast<const AggregateResultContext<ColumnDataType, AggregateType>&>(*contexts[0]);
+          if (context.results.size() > MAX_PREAGGREGATION_GROUP_COUNT && chunk_id + 1 < end_chunk_id) {
+            flush(contexts);
+            contexts = _create_aggregate_contexts<AggregateKey>();
+          }
+        });
+      }
+
+      flush(contexts);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /*
+  MERGE
+  Each job merges the pre-aggregated groups of one partition. All contexts of the partition process the groups in the
+  same order, so that the results of a group have the same index in each of them.
+  */
+  auto contexts_per_partition = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& contexts = contexts_per_partition[partition_id];
+      contexts = _create_aggregate_contexts<AggregateKey>();
+
+      for (auto column_index = ColumnID{0}; column_index < contexts.size(); ++column_index) {
+        resolve_aggregate_context_types(
+            _aggregates, *input_table, column_index,
+            [&](const auto column_data_type_t, const auto aggregate_type_t, const auto function_t) {
+              using ColumnDataType = typename decltype(column_data_type_t)::type;
+              using AggregateType = typename decltype(aggregate_type_t)::type;
+              constexpr auto FUNCTION = decltype(function_t)::value;
+
+              auto& context =
+                  static_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(*contexts[column_index]);
+              auto& buffer = static_cast<AggregateResultContext<ColumnDataType, AggregateType>&>(
+                  *buffers_per_partition[partition_id][column_index]);
+
+              for (auto& source_result : buffer.results) {
+                const auto& row_id = source_result.row_id;
+                auto& result = get_or_add_result(
+                    *context.result_ids, context.results,
+                    get_aggregate_key<AggregateKey>(keys_per_chunk, row_id.chunk_id, row_id.chunk_offset), row_id);
+                merge_aggregate_results<FUNCTION>(result, source_result);
+              }
+
+              // The buffered results are not needed anymore
+              buffers_per_partition[partition_id][column_index] = nullptr;
+            });
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Concatenate the results of the partitions. Only the results are used from here on, the result_ids of the contexts
+  // are not updated.
+  _contexts_per_column = std::move(contexts_per_partition[0]);
+  for (auto column_index = ColumnID{0}; column_index < _contexts_per_column.size(); ++column_index) {
+    resolve_aggregate_context_types(
+        _aggregates, *input_table, column_index, [&](const auto column_data_type_t, const auto aggregate_type_t, auto) {
+          using ColumnDataType = typename decltype(column_data_type_t)::type;
+          using AggregateType = typename decltype(aggregate_type_t)::type;
+          using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+          auto& results = static_cast<Context&>(*_contexts_per_column[column_index]).results;
+          for (auto partition_id = size_t{1}; partition_id < partition_count; ++partition_id) {
+            auto& partition_results =
+                static_cast<Context&>(*contexts_per_partition[partition_id][column_index]).results;
+            results.insert(results.end(), std::make_move_iterator(partition_results.begin()),
+                           std::make_move_iterator(partition_results.end()));
+          }
+        });
   }
 }
 
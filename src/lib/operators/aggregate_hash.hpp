@@ -38,6 +38,11 @@ Operator to aggregate columns by certain functions, such as min, max, sum, avera
  i.e. your sorting order.
 
 For implementation details, please check the wiki: https://github.com/hyrise/hyrise/wiki/Operators_Aggregate
+
+Large inputs are aggregated in parallel. Each job pre-aggregates a range of chunks into its own AggregateContexts and
+assigns its groups to radix partitions based on the hash of their AggregateKey. Afterwards, one job per partition
+merges the pre-aggregated results of that partition. As every group belongs to exactly one partition, the partitions
+can be merged independently.
 */
 
 /*
@@ -106,6 +111,12 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename ColumnDataType, AggregateFunction function>
   void write_aggregate_output(ColumnID column_index);
 
+  // Inputs are pre-aggregated in parallel if each job gets at least this many rows
+  static constexpr auto MIN_ROWS_PER_PREAGGREGATION_JOB = size_t{10'000};
+
+  // Pre-aggregation jobs flush their groups into the radix partitions once they hold more than this many groups
+  static constexpr auto MAX_PREAGGREGATION_GROUP_COUNT = size_t{65'536};
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -128,7 +139,20 @@ class AggregateHash : public AbstractAggregateOperator {
 
   template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  // Aggregates all rows of the chunk into the given contexts (one per aggregate)
+  template <typename AggregateKey>
+  void _aggregate_chunk(ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  // Pre-aggregates chunk ranges in parallel and merges the results per radix partition into _contexts_per_column
+  template <typename AggregateKey>
+  void _aggregate_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk, size_t job_count);
+
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts() const;
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
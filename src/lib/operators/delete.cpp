@@ -2,18 +2,24 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-Delete::Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op)
-    : AbstractReadWriteOperator{OperatorType::Delete, referencing_table_op}, _transaction_id{0} {}
+Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& referencing_table_op)
+    : AbstractReadWriteOperator{OperatorType::Delete, referencing_table_op},
+      _table_name{table_name},
+      _transaction_id{0} {}
 
 const std::string& Delete::name() const {
   static const auto name = std::string{"Delete"};
@@ -21,6 +27,7 @@ const std::string& Delete::name() const {
 }
 
 std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _table = Hyrise::get().storage_manager.get_table(_table_name);
   _referencing_table = input_table_left();
 
   DebugAssert(_referencing_table->type() == TableType::References,
@@ -28,6 +35,7 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
   DebugAssert(_referencing_table->column_count() > 0, "_referencing_table needs columns to determine referenced table");
 
   _transaction_id = context->transaction_id();
+  _deleted_rows.null_counts.resize(_table->column_count());
 
   for (ChunkID chunk_id{0}; chunk_id < _referencing_table->chunk_count(); ++chunk_id) {
     const auto chunk = _referencing_table->get_chunk(chunk_id);
@@ -83,6 +91,17 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
         }
       }
     }
+
+    // Count the deleted rows and their NULLs for the table's statistics. The input columns of Delete are never
+    // pruned, so the ColumnIDs of the referencing table are those of the stored table.
+    _deleted_rows.row_count += pos_list->size();
+    for (auto column_id = ColumnID{0}; column_id < _referencing_table->column_count(); ++column_id) {
+      if (!_referencing_table->column_is_nullable(column_id)) continue;
+
+      segment_iterate(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) ++_deleted_rows.null_counts[column_id];
+      });
+    }
   }
 
   return nullptr;
@@ -104,6 +123,8 @@ void Delete::_on_commit_records(const CommitID commit_id) {
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
   }
+
+  update_table_statistics_for_deleted_rows(_table, _deleted_rows);
 }
 
 void Delete::_on_rollback_records() {
@@ -130,10 +151,43 @@ void Delete::_on_rollback_records() {
   }
 }
 
+void Delete::_on_log_records(LogEntryWriter& log_entry) const {
+  // The RowIDs of the referencing table point into GetTable's output, which omits pruned chunks and thus does not use
+  // the ChunkIDs of the stored table. The output chunks share the MVCC data of the stored chunks, which therefore
+  // identifies the stored ChunkID.
+  auto stored_chunk_ids = std::unordered_map<const MvccData*, ChunkID>{};
+  const auto chunk_count = _table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    if (!chunk) continue;
+    stored_chunk_ids.emplace(chunk->mvcc_data().get(), chunk_id);
+  }
+
+  auto row_ids = std::vector<RowID>{};
+  row_ids.reserve(_deleted_rows.row_count);
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+    const auto referenced_table = referencing_segment->referenced_table();
+
+    for (const auto row_id : *referencing_segment->pos_list()) {
+      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+      const auto stored_chunk_id_iter = stored_chunk_ids.find(referenced_chunk->mvcc_data().get());
+      Assert(stored_chunk_id_iter != stored_chunk_ids.end(), "Deleted row is not part of table " + _table_name);
+      row_ids.emplace_back(RowID{stored_chunk_id_iter->second, row_id.chunk_offset});
+    }
+  }
+
+  if (row_ids.empty()) return;
+  log_entry.delete_rows(_table_name, row_ids);
+}
+
 std::shared_ptr<AbstractOperator> Delete::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Delete>(copied_input_left);
+  return std::make_shared<Delete>(_table_name, copied_input_left);
 }
 
 void Delete::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -2,9 +2,11 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
+#include "statistics/update_table_statistics.hpp"
 #include "storage/pos_lists/rowid_pos_list.hpp"
 #include "utils/assert.hpp"
 
@@ -12,11 +14,11 @@ namespace opossum {
 
 /**
  * Operator that marks the rows referenced by its input table as MVCC-expired.
- * Assumption: The input has been validated before.
+ * Assumption: The input has been validated before and references rows of the stored table `table_name`.
  */
 class Delete : public AbstractReadWriteOperator {
  public:
-  explicit Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op);
+  explicit Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& referencing_table_op);
 
   const std::string& name() const override;
 
@@ -28,9 +30,15 @@ class Delete : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID commit_id) override;
   void _on_rollback_records() override;
+  void _on_log_records(LogEntryWriter& log_entry) const override;
 
  private:
+  const std::string _table_name;
   TransactionID _transaction_id;
+  std::shared_ptr<const Table> _table;
   std::shared_ptr<const Table> _referencing_table;
+
+  // Rows deleted from _table, applied to its statistics on commit
+  ModifiedRows _deleted_rows;
 };
 }  // namespace opossum
@@ -60,6 +60,19 @@ const std::vector<ChunkID>& GetTable::pruned_chunk_ids() const { return _pruned_
 
 const std::vector<ColumnID>& GetTable::pruned_column_ids() const { return _pruned_column_ids; }
 
+std::optional<ChunkID> GetTable::output_chunk_id(const ChunkID stored_chunk_id) const {
+  if (stored_chunk_id >= _stored_chunk_count) return std::nullopt;
+
+  // Output chunks are in the same order as the stored chunks, only the excluded chunks are skipped
+  const auto excluded_chunk_ids_iter =
+      std::lower_bound(_excluded_chunk_ids.begin(), _excluded_chunk_ids.end(), stored_chunk_id);
+  if (excluded_chunk_ids_iter != _excluded_chunk_ids.end() && *excluded_chunk_ids_iter == stored_chunk_id) {
+    return std::nullopt;
+  }
+
+  return static_cast<ChunkID>(stored_chunk_id - std::distance(_excluded_chunk_ids.begin(), excluded_chunk_ids_iter));
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -122,6 +135,9 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
     }
   }
 
+  _stored_chunk_count = chunk_count;
+  _excluded_chunk_ids = excluded_chunk_ids;
+
   // We cannot create a Table without columns - since Chunks rely on their first column to determine their row count
   Assert(_pruned_column_ids.size() < static_cast<size_t>(stored_table->column_count()),
          "Cannot prune all columns from Table");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -34,6 +35,11 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  // Maps the ChunkID of a chunk in the stored table to its ChunkID in the output table. Returns std::nullopt if the
+  // chunk is not part of the output, e.g., because it was pruned or added after GetTable was executed. Used by
+  // operators that look up RowIDs of the stored table in its PrimaryKeyIndex.
+  std::optional<ChunkID> output_chunk_id(const ChunkID stored_chunk_id) const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -46,5 +52,9 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
+
+  // Set during the execution, see output_chunk_id()
+  ChunkID _stored_chunk_count{0};
+  std::vector<ChunkID> _excluded_chunk_ids;
 };
 }  // namespace opossum
@@ -1,15 +1,18 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <map>
 
 #include "expression/between_expression.hpp"
 
 #include "hyrise.hpp"
+#include "operators/get_table.hpp"
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/primary_key_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
@@ -38,6 +41,11 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_index_type == SegmentIndexType::PrimaryKey) {
+    _scan_primary_key_index();
+    return _out_table;
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -109,6 +117,45 @@ void IndexScan::_validate_input() {
   }
 
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+
+  if (_index_type == SegmentIndexType::PrimaryKey) {
+    Assert(_predicate_condition == PredicateCondition::Equals, "PrimaryKeyIndex only supports point lookups.");
+  }
+}
+
+void IndexScan::_scan_primary_key_index() {
+  // The PrimaryKeyIndex belongs to the stored table, so its RowIDs have to be mapped to the chunks of GetTable's output
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(input_left());
+  Assert(get_table, "IndexScan on a PrimaryKeyIndex requires a GetTable as input.");
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+  const auto& primary_key_index = stored_table->primary_key_index();
+  Assert(primary_key_index, "Table has no PrimaryKeyIndex.");
+
+  // Usually, a key is held by a single row. Multiple versions exist if the row was updated.
+  auto matches_per_chunk = std::map<ChunkID, std::shared_ptr<RowIDPosList>>{};
+  for (const auto& stored_row_id : primary_key_index->lookup(_right_values)) {
+    const auto chunk_id = get_table->output_chunk_id(stored_row_id.chunk_id);
+    if (!chunk_id) continue;
+    if (!included_chunk_ids.empty() &&
+        std::find(included_chunk_ids.begin(), included_chunk_ids.end(), *chunk_id) == included_chunk_ids.end()) {
+      continue;
+    }
+
+    auto& matches = matches_per_chunk[*chunk_id];
+    if (!matches) {
+      matches = std::make_shared<RowIDPosList>();
+      matches->guarantee_single_chunk();
+    }
+    matches->emplace_back(RowID{*chunk_id, stored_row_id.chunk_offset});
+  }
+
+  for (const auto& [chunk_id, matches] : matches_per_chunk) {
+    Segments segments;
+    for (auto column_id = ColumnID{0}; column_id < _in_table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches));
+    }
+    _out_table->append_chunk(segments);
+  }
 }
 
 RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
@@ -18,6 +18,10 @@ class AbstractTask;
  * Operator that performs a predicate search using indexes
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * With SegmentIndexType::PrimaryKey, the table's PrimaryKeyIndex is used instead of the indexes of the single chunks.
+ * In this case, the input has to be a GetTable, the predicate condition has to be Equals, and the right values are the
+ * key in the column order of the index.
  */
 class IndexScan : public AbstractReadOnlyOperator {
  public:
@@ -42,6 +46,9 @@ class IndexScan : public AbstractReadOnlyOperator {
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   RowIDPosList _scan_chunk(const ChunkID chunk_id);
 
+  // For SegmentIndexType::PrimaryKey, looks up the key in the table-wide PrimaryKeyIndex instead of scanning chunks
+  void _scan_primary_key_index();
+
  private:
   const SegmentIndexType _index_type;
   const std::vector<ColumnID> _left_column_ids;
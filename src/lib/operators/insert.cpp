@@ -9,6 +9,8 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/index/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -213,6 +215,39 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Count the inserted rows and NULLs, which are applied to the table statistics on commit. The target segments are
+   *    counted rather than the input, as the input's segments may be of any type.
+   */
+  const auto column_count = _target_table->column_count();
+  _inserted_rows.null_counts.resize(column_count);
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    _inserted_rows.row_count += target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset;
+
+    const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (!_target_table->column_is_nullable(column_id)) continue;
+
+      const auto& null_values =
+          std::static_pointer_cast<const BaseValueSegment>(target_chunk->get_segment(column_id))->null_values();
+      _inserted_rows.null_counts[column_id] +=
+          std::count(null_values.begin() + target_chunk_range.begin_chunk_offset,
+                     null_values.begin() + target_chunk_range.end_chunk_offset, true);
+    }
+  }
+
+  /**
+   * 4. Add the new rows to the table's PrimaryKeyIndex. This happens before the commit, the index is not aware of MVCC.
+   *    Deleted rows (including the old versions of updated rows) remain in the index, as older transactions may still
+   *    see them.
+   */
+  if (const auto& primary_key_index = _target_table->primary_key_index()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      primary_key_index->insert(*_target_table, target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset,
+                                target_chunk_range.end_chunk_offset);
+    }
+  }
+
   return nullptr;
 }
 
@@ -230,6 +265,8 @@ void Insert::_on_commit_records(const CommitID cid) {
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
   }
+
+  update_table_statistics_for_inserted_rows(_target_table, _inserted_rows);
 }
 
 void Insert::_on_rollback_records() {
@@ -273,6 +310,13 @@ void Insert::_on_rollback_records() {
   }
 }
 
+void Insert::_on_log_records(LogEntryWriter& log_entry) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    log_entry.insert(_target_table_name, *_target_table, target_chunk_range.chunk_id,
+                     target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+  }
+}
+
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
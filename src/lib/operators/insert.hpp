@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
+#include "statistics/update_table_statistics.hpp"
 #include "storage/pos_lists/rowid_pos_list.hpp"
 #include "utils/assert.hpp"
 
@@ -34,6 +35,7 @@ class Insert : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_log_records(LogEntryWriter& log_entry) const override;
 
  private:
   const std::string _target_table_name;
@@ -46,6 +48,9 @@ class Insert : public AbstractReadWriteOperator {
   };
   std::vector<ChunkRange> _target_chunk_ranges;
 
+  // Applied to the table statistics on commit
+  ModifiedRows _inserted_rows;
+
   std::shared_ptr<Table> _target_table;
 };
 
@@ -17,6 +17,8 @@
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
+#include "utils/performance_warning.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -42,7 +44,8 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const OperatorJoinPredicate& primary_predicate,
                    const std::vector<OperatorJoinPredicate>& secondary_predicates,
                    const std::optional<size_t>& radix_bits)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, primary_predicate, secondary_predicates),
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<JoinHash::PerformanceData>()),
       _radix_bits(radix_bits) {}
 
 const std::string& JoinHash::name() const {
@@ -108,6 +111,16 @@ size_t JoinHash::calculate_radix_bits(const size_t build_relation_size, const si
   return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
 }
 
+template <typename T>
+size_t JoinHash::estimate_build_side_memory_usage(const size_t build_relation_size) {
+  // Every row is materialized as a PartitionedElement and its RowID is stored in the hash table's SmallPosLists. We
+  // assume that each key appears once (see calculate_radix_bits), so that every row also needs a hash map entry (key,
+  // offset, and one byte overhead). Characters of long strings, which are stored outside of pmr_string, are ignored.
+  const auto bytes_per_row = sizeof(PartitionedElement<T>) + sizeof(boost::container::small_vector<RowID, 1>) +
+                             sizeof(T) + sizeof(uint32_t) + 1;
+  return build_relation_size * bytes_per_row;
+}
+
 std::shared_ptr<const Table> JoinHash::_on_execute() {
   Assert(supports({_mode, _primary_predicate.predicate_condition,
                    input_table_left()->column_data_type(_primary_predicate.column_ids.first),
@@ -128,10 +141,14 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
    * JoinMode::Left/Right   The outer relation becomes the probe side, the inner relation becomes the build side
    * JoinMode::FullOuter    Not supported by JoinHash
    * JoinMode::Semi/Anti*   The left relation becomes the build side, the right relation becomes the probe side
+   *
+   * If the build side is shared (see share_build_side), the right relation is always the build side.
    */
+  Assert(!share_build_side || _mode != JoinMode::Right, "Cannot share the build side of a right outer join");
+  Assert(!shared_build_side || share_build_side, "Shared build side is only used if share_build_side is set");
   const auto build_hash_table_for_right_input =
-      _mode == JoinMode::Left || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse ||
-      _mode == JoinMode::Semi ||
+      share_build_side || _mode == JoinMode::Left || _mode == JoinMode::AntiNullAsTrue ||
+      _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::Semi ||
       (_mode == JoinMode::Inner && _input_left->get_output()->row_count() > _input_right->get_output()->row_count());
 
   if (build_hash_table_for_right_input) {
@@ -184,7 +201,9 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
           !std::is_same_v<pmr_string, BuildColumnDataType> && !std::is_same_v<pmr_string, ProbeColumnDataType>;
 
       if constexpr (BOTH_ARE_STRING || NEITHER_IS_STRING) {
-        if (!_radix_bits) {
+        if (shared_build_side) {
+          _radix_bits = shared_build_side->radix_bits;
+        } else if (!_radix_bits) {
           _radix_bits =
               calculate_radix_bits<BuildColumnDataType>(build_input_table->row_count(), probe_input_table->row_count());
         }
@@ -215,7 +234,7 @@ void JoinHash::_on_cleanup() { _impl.reset(); }
 template <typename BuildColumnType, typename ProbeColumnType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
-  JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const Table>& build_input_table,
+  JoinHashImpl(JoinHash& join_hash, const std::shared_ptr<const Table>& build_input_table,
                const std::shared_ptr<const Table>& probe_input_table, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                const OutputColumnOrder output_column_order, const size_t radix_bits,
@@ -228,10 +247,13 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         _predicate_condition(predicate_condition),
         _output_column_order(output_column_order),
         _secondary_predicates(std::move(secondary_predicates)),
-        _radix_bits(radix_bits) {}
+        _radix_bits(radix_bits),
+        _keep_nulls_build_column(mode == JoinMode::AntiNullAsTrue),
+        _keep_nulls_probe_column(mode == JoinMode::Left || mode == JoinMode::Right ||
+                                 mode == JoinMode::AntiNullAsTrue || mode == JoinMode::AntiNullAsFalse) {}
 
  protected:
-  const JoinHash& _join_hash;
+  JoinHash& _join_hash;
   const std::shared_ptr<const Table> _build_input_table, _probe_input_table;
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
@@ -248,24 +270,141 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
 
+  /**
+   * Keep/Discard NULLs from build and probe columns as follows
+   *
+   * JoinMode::Inner              Discard NULLs from both columns
+   * JoinMode::Left/Right         Discard NULLs from the build column (the inner relation), but keep them on the probe
+   *                              column (the outer relation)
+   * JoinMode::FullOuter          Not supported by JoinHash
+   * JoinMode::Semi               Discard NULLs from both columns
+   * JoinMode::AntiNullAsFalse    Discard NULLs from the build column (the right relation), but keep them on the probe
+   *                              column (the left relation)
+   * JoinMode::AntiNullAsTrue     Keep NULLs from both columns
+   */
+  const bool _keep_nulls_build_column;
+  const bool _keep_nulls_probe_column;
+
+  // Hash tables built from the build column, one for each partition (see JoinHash::shared_build_side)
+  class TypedBuildSide : public JoinHash::BuildSide {
+   public:
+    using JoinHash::BuildSide::BuildSide;
+
+    std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
+
+    // Used for the short cut of AntiNullAsTrue, see _join_in_memory
+    bool has_null_values{false};
+  };
+
   std::shared_ptr<const Table> _on_execute() override {
+    // After the join phase, build_side_pos_lists and probe_side_pos_lists contain all pairs of joined rows grouped by
+    // partition (see step 3).
+    std::vector<RowIDPosList> build_side_pos_lists;
+    std::vector<RowIDPosList> probe_side_pos_lists;
+
+    const auto memory_budget = _join_hash.memory_budget();
+    auto emits_output = false;
+    if (memory_budget && JoinHash::estimate_build_side_memory_usage<BuildColumnType>(_build_input_table->row_count()) >
+                             *memory_budget) {
+      emits_output = _join_spilled(build_side_pos_lists, probe_side_pos_lists, *memory_budget);
+    } else {
+      emits_output = _join_in_memory(build_side_pos_lists, probe_side_pos_lists);
+    }
+
+    if (!emits_output) {
+      return _join_hash._build_output_table({});
+    }
+
+    /**
+     * 3. Write output Table
+     */
+
+    /**
+     * After the probe phase build_side_pos_lists and probe_side_pos_lists contain all pairs of joined rows grouped by
+     * partition. Let p be a partition index and r a row index. The value of build_side_pos_lists[p][r] will match probe_side_pos_lists[p][r].
+     */
+
     /**
-     * Keep/Discard NULLs from build and probe columns as follows
+     * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
+     *  quite a lot Partitions (>500 seen), input Chunks (>500 seen), and columns (>50 seen), this speeds up
+     *  write_output_chunks a lot.
+     *
+     * They do two things:
+     *      - Make it possible to re-use output pos lists if two segments in the input table have exactly the same
+     *          PosLists Chunk by Chunk
+     *      - Avoid creating the std::vector<const RowIDPosList*> for each Partition over and over again.
      *
-     * JoinMode::Inner              Discard NULLs from both columns
-     * JoinMode::Left/Right         Discard NULLs from the build column (the inner relation), but keep them on the probe
-     *                              column (the outer relation)
-     * JoinMode::FullOuter          Not supported by JoinHash
-     * JoinMode::Semi               Discard NULLs from both columns
-     * JoinMode::AntiNullAsFalse    Discard NULLs from the build column (the right relation), but keep them on the probe
-     *                              column (the left relation)
-     * JoinMode::AntiNullAsTrue     Keep NULLs from both columns
+     * They hold one entry per column in the table, not per BaseSegment in a single chunk
      */
 
-    const auto keep_nulls_build_column = _mode == JoinMode::AntiNullAsTrue;
-    const auto keep_nulls_probe_column = _mode == JoinMode::Left || _mode == JoinMode::Right ||
-                                         _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse;
+    PosListsByChunk build_side_pos_lists_by_segment;
+    PosListsByChunk probe_side_pos_lists_by_segment;
+
+    // build_side_pos_lists_by_segment will only be needed if build is a reference table and being output
+    if (_build_input_table->type() == TableType::References && _output_column_order != OutputColumnOrder::ProbeOnly) {
+      build_side_pos_lists_by_segment = setup_pos_lists_by_chunk(_build_input_table);
+    }
+
+    // probe_side_pos_lists_by_segment will only be needed if right is a reference table
+    if (_probe_input_table->type() == TableType::References) {
+      probe_side_pos_lists_by_segment = setup_pos_lists_by_chunk(_probe_input_table);
+    }
+
+    auto output_chunk_count = size_t{0};
+    for (size_t partition_id = 0; partition_id < build_side_pos_lists.size(); ++partition_id) {
+      if (!build_side_pos_lists[partition_id].empty() || !probe_side_pos_lists[partition_id].empty()) {
+        ++output_chunk_count;
+      }
+    }
+
+    std::vector<std::shared_ptr<Chunk>> output_chunks{output_chunk_count};
+
+    // for every partition create a reference segment
+    for (size_t partition_id = 0, output_chunk_id{0}; partition_id < build_side_pos_lists.size(); ++partition_id) {
+      // moving the values into a shared pos list saves us some work in write_output_segments. We know that
+      // build_pos_lists and probe_side_pos_lists will not be used again.
+      auto build_side_pos_list = std::make_shared<RowIDPosList>(std::move(build_side_pos_lists[partition_id]));
+      auto probe_side_pos_list = std::make_shared<RowIDPosList>(std::move(probe_side_pos_lists[partition_id]));
+
+      if (build_side_pos_list->empty() && probe_side_pos_list->empty()) {
+        continue;
+      }
+
+      Segments output_segments;
+
+      // we need to swap back the inputs, so that the order of the output columns is not harmed
+      switch (_output_column_order) {
+        case OutputColumnOrder::BuildFirstProbeSecond:
+          write_output_segments(output_segments, _build_input_table, build_side_pos_lists_by_segment,
+                                build_side_pos_list);
+          write_output_segments(output_segments, _probe_input_table, probe_side_pos_lists_by_segment,
+                                probe_side_pos_list);
+          break;
+
+        case OutputColumnOrder::ProbeFirstBuildSecond:
+          write_output_segments(output_segments, _probe_input_table, probe_side_pos_lists_by_segment,
+                                probe_side_pos_list);
+          write_output_segments(output_segments, _build_input_table, build_side_pos_lists_by_segment,
+                                build_side_pos_list);
+          break;
+
+        case OutputColumnOrder::ProbeOnly:
+          write_output_segments(output_segments, _probe_input_table, probe_side_pos_lists_by_segment,
+                                probe_side_pos_list);
+          break;
+      }
+
+      output_chunks[output_chunk_id] = std::make_shared<Chunk>(std::move(output_segments));
+      ++output_chunk_id;
+    }
+
+    return _join_hash._build_output_table(std::move(output_chunks));
+  }
 
+  // Materializes, (optionally) radix partitions, and joins both inputs in memory. Returns false if the join cannot emit
+  // any rows.
+  bool _join_in_memory(std::vector<RowIDPosList>& build_side_pos_lists,
+                       std::vector<RowIDPosList>& probe_side_pos_lists) {
     // Containers used to store histograms for (potentially subsequent) radix
     // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
     std::vector<std::vector<size_t>> histograms_build_column;
@@ -278,11 +417,12 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     RadixContainer<ProbeColumnType> materialized_probe_column;
 
     // Containers for potential (skipped when build side small) radix partitioning phase
-    RadixContainer<BuildColumnType> radix_build_column;
     RadixContainer<ProbeColumnType> radix_probe_column;
 
-    // HashTables for the build column, one for each partition
-    std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
+    // HashTables for the build column, one for each partition. If the build side is shared and has already been built
+    // by another execution, only the probe side is materialized.
+    auto build_side = std::dynamic_pointer_cast<const TypedBuildSide>(_join_hash.shared_build_side);
+    Assert(build_side || !_join_hash.shared_build_side, "Shared build side was built for other data types");
 
     // Depiction of the hash join parallelization (radix partitioning can be skipped when radix_bits = 0)
     // ===============================================================================================
@@ -310,51 +450,52 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /**
      * 1.1 Schedule a JobTask for materialization, optional radix partitioning and hash table building for the build side
      */
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
-      if (keep_nulls_build_column) {
-        materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
-      } else {
-        materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
-      }
+    if (!build_side) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        auto typed_build_side = std::make_shared<TypedBuildSide>(_radix_bits);
+        RadixContainer<BuildColumnType> radix_build_column;
+
+        if (_keep_nulls_build_column) {
+          materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
+              _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
+        } else {
+          materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
+              _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
+        }
 
-      if (_radix_bits > 0) {
-        // radix partition the build table
-        if (keep_nulls_build_column) {
-          radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+        if (_radix_bits > 0) {
+          // radix partition the build table
+          if (_keep_nulls_build_column) {
+            radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
+                materialized_build_column, histograms_build_column, _radix_bits);
+          } else {
+            radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
+                materialized_build_column, histograms_build_column, _radix_bits);
+          }
+          // After the data in materialized_build_column has been partitioned, it is not needed anymore.
+          materialized_build_column.clear();
         } else {
-          radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+          // short cut: skip radix partitioning and use materialized data directly
+          radix_build_column = std::move(materialized_build_column);
         }
-        // After the data in materialized_build_column has been partitioned, it is not needed anymore.
-        materialized_build_column.clear();
-      } else {
-        // short cut: skip radix partitioning and use materialized data directly
-        radix_build_column = std::move(materialized_build_column);
-      }
 
-      // Build hash tables. In the case of semi or anti joins, we do not need to track all rows on the hashed side,
-      // just one per value. However, if we have secondary predicates, those might fail on that single row. In that
-      // case, we DO need all rows.
-      if (_secondary_predicates.empty() &&
-          (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-        hash_tables =
-            build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::SinglePosition, _radix_bits);
-      } else {
-        hash_tables =
-            build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits);
-      }
-    }));
-    jobs.back()->schedule();
+        typed_build_side->hash_tables = _build(radix_build_column, _radix_bits);
+        for (const auto& build_side_partition : radix_build_column) {
+          for (const auto null_value : build_side_partition.null_values) {
+            typed_build_side->has_null_values |= null_value;
+          }
+        }
+        build_side = std::move(typed_build_side);
+      }));
+      jobs.back()->schedule();
+    }
 
     /**
      * 1.2 Schedule a JobTask for materialization, optional radix partitioning for the probe side
      */
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
       // Materialize probe column.
-      if (keep_nulls_probe_column) {
+      if (_keep_nulls_probe_column) {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
             _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits);
       } else {
@@ -364,7 +505,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       if (_radix_bits > 0) {
         // radix partition the probe column.
-        if (keep_nulls_probe_column) {
+        if (_keep_nulls_probe_column) {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
               materialized_probe_column, histograms_probe_column, _radix_bits);
         } else {
@@ -387,21 +528,13 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //   anyway (as long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out
     //   right here is hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no
     //   chance detecting a NULL value on the build side there.
-    if (_mode == JoinMode::AntiNullAsTrue) {
-      for (const auto& build_side_partition : radix_build_column) {
-        for (const auto null_value : build_side_partition.null_values) {
-          if (null_value) {
-            return _join_hash._build_output_table({});
-          }
-        }
-      }
+    if (_mode == JoinMode::AntiNullAsTrue && build_side->has_null_values) {
+      return false;
     }
 
     /**
      * 2. Probe phase
      */
-    std::vector<RowIDPosList> build_side_pos_lists;
-    std::vector<RowIDPosList> probe_side_pos_lists;
     const size_t partition_count = radix_probe_column.size();
     build_side_pos_lists.resize(partition_count);
     probe_side_pos_lists.resize(partition_count);
@@ -419,131 +552,204 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     The workers for each radix partition P should be scheduled on the same node as the input data:
     buildP, probeP and hash tableP.
     */
+    _probe(radix_probe_column, build_side->hash_tables, build_side_pos_lists, probe_side_pos_lists);
+
+    // After probing, the partitioned probe column is not needed anymore. The hash tables are kept if they are shared.
+    radix_probe_column.clear();
+    if (_join_hash.share_build_side) _join_hash.shared_build_side = build_side;
+
+    return true;
+  }
+
+  // Executes the join as a Grace hash join (see join_hash.hpp). Returns false if the join cannot emit any rows.
+  bool _join_spilled(std::vector<RowIDPosList>& build_side_pos_lists, std::vector<RowIDPosList>& probe_side_pos_lists,
+                     const size_t memory_budget) {
+    const auto partition_bits = _spill_partition_bits(_build_input_table->row_count(), memory_budget);
+
+    std::vector<SpilledPartition> build_partitions;
+    std::vector<SpilledPartition> probe_partitions;
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      if (_keep_nulls_build_column) {
+        build_partitions = materialize_and_spill_input<BuildColumnType, HashedType, true>(
+            _build_input_table, _column_ids.first, partition_bits);
+      } else {
+        build_partitions = materialize_and_spill_input<BuildColumnType, HashedType, false>(
+            _build_input_table, _column_ids.first, partition_bits);
+      }
+    }));
+    jobs.back()->schedule();
+
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      if (_keep_nulls_probe_column) {
+        probe_partitions = materialize_and_spill_input<ProbeColumnType, HashedType, true>(
+            _probe_input_table, _column_ids.second, partition_bits);
+      } else {
+        probe_partitions = materialize_and_spill_input<ProbeColumnType, HashedType, false>(
+            _probe_input_table, _column_ids.second, partition_bits);
+      }
+    }));
+    jobs.back()->schedule();
+
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+    // Short cut for AntiNullAsTrue, see _join_in_memory
+    if (_mode == JoinMode::AntiNullAsTrue) {
+      for (const auto& build_partition : build_partitions) {
+        if (build_partition.has_null_values) return false;
+      }
+    }
+
+    _join_spilled_partitions(build_partitions, probe_partitions, 0, memory_budget, build_side_pos_lists,
+                             probe_side_pos_lists);
+    return true;
+  }
+
+  // Joins the spilled partitions one after another. As a build partition and the hash table built from it have to fit
+  // into the memory budget, partitions that exceed it are spilled again.
+  void _join_spilled_partitions(std::vector<SpilledPartition>& build_partitions,
+                                std::vector<SpilledPartition>& probe_partitions, const size_t spill_level,
+                                const size_t memory_budget, std::vector<RowIDPosList>& build_side_pos_lists,
+                                std::vector<RowIDPosList>& probe_side_pos_lists) {
+    auto& performance_data = static_cast<JoinHash::PerformanceData&>(*_join_hash._performance_data);
+    performance_data.spilled_partition_count += build_partitions.size();
+
+    for (auto partition_idx = size_t{0}; partition_idx < build_partitions.size(); ++partition_idx) {
+      auto& build_partition = build_partitions[partition_idx];
+      auto& probe_partition = probe_partitions[partition_idx];
+      performance_data.spilled_bytes += build_partition.file.size() + probe_partition.file.size();
+
+      // Only rows of the probe side are emitted, either with or without a matching build row. Without a build row,
+      // they are only emitted by outer and anti joins.
+      if (probe_partition.element_count == 0) continue;
+      if (build_partition.element_count == 0 && (_mode == JoinMode::Inner || _mode == JoinMode::Semi)) continue;
+
+      const auto build_partition_memory_usage =
+          JoinHash::estimate_build_side_memory_usage<BuildColumnType>(build_partition.element_count);
+      if (build_partition_memory_usage > memory_budget && spill_level < JoinHash::MAX_SPILL_LEVELS) {
+        const auto partition_bits = _spill_partition_bits(build_partition.element_count, memory_budget);
+        auto build_subpartitions =
+            respill_partition<BuildColumnType, HashedType>(build_partition, spill_level + 1, partition_bits);
+        auto probe_subpartitions =
+            respill_partition<ProbeColumnType, HashedType>(probe_partition, spill_level + 1, partition_bits);
+        _join_spilled_partitions(build_subpartitions, probe_subpartitions, spill_level + 1, memory_budget,
+                                 build_side_pos_lists, probe_side_pos_lists);
+        continue;
+      }
+
+      if (build_partition_memory_usage > memory_budget) {
+        PerformanceWarning("Partition of JoinHash exceeds memory budget even after repeated spilling (skewed input?)");
+      }
+
+      // Build a single hash table for all blocks of the build partition. Its elements are not needed afterwards.
+      auto hash_tables = std::vector<std::optional<PosHashTable<HashedType>>>{};
+      {
+        auto build_blocks = RadixContainer<BuildColumnType>{};
+        build_blocks.reserve(build_partition.block_count);
+        for (auto block_idx = size_t{0}; block_idx < build_partition.block_count; ++block_idx) {
+          build_blocks.emplace_back(read_spilled_block<BuildColumnType>(build_partition));
+        }
+        hash_tables = _build(build_blocks, 0);
+      }
+
+      // Probe the hash table with batches of probe blocks that fit into the memory budget, one job per block
+      auto block_idx = size_t{0};
+      while (block_idx < probe_partition.block_count) {
+        auto probe_blocks = RadixContainer<ProbeColumnType>{};
+        auto probe_blocks_memory_usage = size_t{0};
+        while (block_idx < probe_partition.block_count &&
+               (probe_blocks.empty() || probe_blocks_memory_usage < memory_budget)) {
+          probe_blocks.emplace_back(read_spilled_block<ProbeColumnType>(probe_partition));
+          probe_blocks_memory_usage += probe_blocks.back().elements.size() * sizeof(PartitionedElement<ProbeColumnType>);
+          ++block_idx;
+        }
+
+        auto build_side_block_pos_lists = std::vector<RowIDPosList>(probe_blocks.size());
+        auto probe_side_block_pos_lists = std::vector<RowIDPosList>(probe_blocks.size());
+        _probe(probe_blocks, hash_tables, build_side_block_pos_lists, probe_side_block_pos_lists);
+
+        for (auto probe_block_idx = size_t{0}; probe_block_idx < probe_blocks.size(); ++probe_block_idx) {
+          if (build_side_block_pos_lists[probe_block_idx].empty() &&
+              probe_side_block_pos_lists[probe_block_idx].empty()) {
+            continue;
+          }
+          build_side_pos_lists.emplace_back(std::move(build_side_block_pos_lists[probe_block_idx]));
+          probe_side_pos_lists.emplace_back(std::move(probe_side_block_pos_lists[probe_block_idx]));
+        }
+      }
+    }
+  }
+
+  // Number of bits for partitioning a build side of the given size into spilled partitions that fit into the memory
+  // budget. One additional bit accounts for unevenly sized partitions.
+  static size_t _spill_partition_bits(const size_t build_relation_size, const size_t memory_budget) {
+    const auto memory_usage = JoinHash::estimate_build_side_memory_usage<BuildColumnType>(build_relation_size);
+    const auto partition_count = std::max(1.0, static_cast<double>(memory_usage) / static_cast<double>(memory_budget));
+    const auto partition_bits = static_cast<size_t>(std::ceil(std::log2(partition_count))) + 1;
+    return std::min(partition_bits, JoinHash::MAX_SPILL_PARTITION_BITS);
+  }
+
+  // Builds the hash tables. In the case of semi or anti joins, we do not need to track all rows on the hashed side,
+  // just one per value. However, if we have secondary predicates, those might fail on that single row. In that case,
+  // we DO need all rows.
+  std::vector<std::optional<PosHashTable<HashedType>>> _build(const RadixContainer<BuildColumnType>& build_partitions,
+                                                              const size_t radix_bits) const {
+    if (_secondary_predicates.empty() &&
+        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
+      return build<BuildColumnType, HashedType>(build_partitions, JoinHashBuildMode::SinglePosition, radix_bits);
+    }
+    return build<BuildColumnType, HashedType>(build_partitions, JoinHashBuildMode::AllPositions, radix_bits);
+  }
+
+  // Probes the hash tables with the probe partitions and writes the matches into one pair of PosLists per partition
+  void _probe(const RadixContainer<ProbeColumnType>& probe_partitions,
+              const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
+              std::vector<RowIDPosList>& build_side_pos_lists, std::vector<RowIDPosList>& probe_side_pos_lists) const {
     switch (_mode) {
       case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
+        probe<ProbeColumnType, HashedType, false>(probe_partitions, hash_tables, build_side_pos_lists,
                                                   probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
                                                   _secondary_predicates);
         break;
 
       case JoinMode::Left:
       case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
+        probe<ProbeColumnType, HashedType, true>(probe_partitions, hash_tables, build_side_pos_lists,
                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
                                                  _secondary_predicates);
         break;
 
       case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
+        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(probe_partitions, hash_tables,
                                                                      probe_side_pos_lists, *_build_input_table,
                                                                      *_probe_input_table, _secondary_predicates);
         break;
 
       case JoinMode::AntiNullAsTrue:
         probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+            probe_partitions, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
             _secondary_predicates);
         break;
 
       case JoinMode::AntiNullAsFalse:
         probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+            probe_partitions, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
             _secondary_predicates);
         break;
 
       default:
         Fail("JoinMode not supported by JoinHash");
     }
-
-    // After probing, the partitioned columns are not needed anymore.
-    radix_build_column.clear();
-    radix_probe_column.clear();
-
-    /**
-     * 3. Write output Table
-     */
-
-    /**
-     * After the probe phase build_side_pos_lists and probe_side_pos_lists contain all pairs of joined rows grouped by
-     * partition. Let p be a partition index and r a row index. The value of build_side_pos_lists[p][r] will match probe_side_pos_lists[p][r].
-     */
-
-    /**
-     * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
-     *  quite a lot Partitions (>500 seen), input Chunks (>500 seen), and columns (>50 seen), this speeds up
-     *  write_output_chunks a lot.
-     *
-     * They do two things:
-     *      - Make it possible to re-use output pos lists if two segments in the input table have exactly the same
-     *          PosLists Chunk by Chunk
-     *      - Avoid creating the std::vector<const RowIDPosList*> for each Partition over and over again.
-     *
-     * They hold one entry per column in the table, not per BaseSegment in a single chunk
-     */
-
-    PosListsByChunk build_side_pos_lists_by_segment;
-    PosListsByChunk probe_side_pos_lists_by_segment;
-
-    // build_side_pos_lists_by_segment will only be needed if build is a reference table and being output
-    if (_build_input_table->type() == TableType::References && _output_column_order != OutputColumnOrder::ProbeOnly) {
-      build_side_pos_lists_by_segment = setup_pos_lists_by_chunk(_build_input_table);
-    }
-
-    // probe_side_pos_lists_by_segment will only be needed if right is a reference table
-    if (_probe_input_table->type() == TableType::References) {
-      probe_side_pos_lists_by_segment = setup_pos_lists_by_chunk(_probe_input_table);
-    }
-
-    auto output_chunk_count = size_t{0};
-    for (size_t partition_id = 0; partition_id < build_side_pos_lists.size(); ++partition_id) {
-      if (!build_side_pos_lists[partition_id].empty() || !probe_side_pos_lists[partition_id].empty()) {
-        ++output_chunk_count;
-      }
-    }
-
-    std::vector<std::shared_ptr<Chunk>> output_chunks{output_chunk_count};
-
-    // for every partition create a reference segment
-    for (size_t partition_id = 0, output_chunk_id{0}; partition_id < build_side_pos_lists.size(); ++partition_id) {
-      // moving the values into a shared pos list saves us some work in write_output_segments. We know that
-      // build_pos_lists and probe_side_pos_lists will not be used again.
-      auto build_side_pos_list = std::make_shared<RowIDPosList>(std::move(build_side_pos_lists[partition_id]));
-      auto probe_side_pos_list = std::make_shared<RowIDPosList>(std::move(probe_side_pos_lists[partition_id]));
-
-      if (build_side_pos_list->empty() && probe_side_pos_list->empty()) {
-        continue;
-      }
-
-      Segments output_segments;
-
-      // we need to swap back the inputs, so that the order of the output columns is not harmed
-      switch (_output_column_order) {
-        case OutputColumnOrder::BuildFirstProbeSecond:
-          write_output_segments(output_segments, _build_input_table, build_side_pos_lists_by_segment,
-                                build_side_pos_list);
-          write_output_segments(output_segments, _probe_input_table, probe_side_pos_lists_by_segment,
-                                probe_side_pos_list);
-          break;
-
-        case OutputColumnOrder::ProbeFirstBuildSecond:
-          write_output_segments(output_segments, _probe_input_table, probe_side_pos_lists_by_segment,
-                                probe_side_pos_list);
-          write_output_segments(output_segments, _build_input_table, build_side_pos_lists_by_segment,
-                                build_side_pos_list);
-          break;
-
-        case OutputColumnOrder::ProbeOnly:
-          write_output_segments(output_segments, _probe_input_table, probe_side_pos_lists_by_segment,
-                                probe_side_pos_list);
-          break;
-      }
-
-      output_chunks[output_chunk_id] = std::make_shared<Chunk>(std::move(output_segments));
-      ++output_chunk_id;
-    }
-
-    return _join_hash._build_output_table(std::move(output_chunks));
   }
 };
 
+void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData::output_to_stream(stream, description_mode);
+
+  if (spilled_bytes == 0) return;
+  stream << (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  stream << format_bytes(spilled_bytes) << " spilled to disk in " << spilled_partition_count << " partitions";
+}
+
 }  // namespace opossum
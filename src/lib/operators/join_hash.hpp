@@ -17,6 +17,12 @@ namespace opossum {
  * i.e., your sorting order might be disturbed.
  *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Hash-Join-Operator
+ *
+ * If the operator has a memory budget (see AbstractOperator::memory_budget()) and the materialized build side and its
+ * hash tables are estimated to exceed it, the join is executed as a Grace hash join: Both inputs are materialized
+ * chunk by chunk and partitioned by their hash values into spill files. Afterwards, the partitions are joined one
+ * after another, each with a hash table that fits into the budget. Partitions that are still too large are
+ * partitioned again, up to MAX_SPILL_LEVELS times.
  */
 class JoinHash : public AbstractJoinOperator {
  public:
@@ -33,6 +39,43 @@ class JoinHash : public AbstractJoinOperator {
   template <typename T>
   static size_t calculate_radix_bits(const size_t build_relation_size, const size_t probe_relation_size);
 
+  // Estimates the number of bytes needed for materializing the build side and building its hash tables
+  template <typename T>
+  static size_t estimate_build_side_memory_usage(const size_t build_relation_size);
+
+  struct PerformanceData : public OperatorPerformanceData {
+    size_t spilled_bytes{0};
+    size_t spilled_partition_count{0};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+  };
+
+  // Number of times that partitions exceeding the memory budget are partitioned again. Beyond that, heavily skewed
+  // partitions are joined in memory regardless of the budget.
+  constexpr static auto MAX_SPILL_LEVELS = size_t{3};
+
+  // Limits the number of spill files (one per partition and input) that are open at the same time
+  constexpr static auto MAX_SPILL_PARTITION_BITS = size_t{7};
+
+  // Hash tables built from the right input, type-erased as they depend on the data types of the join columns
+  class BuildSide {
+   public:
+    explicit BuildSide(const size_t init_radix_bits) : radix_bits(init_radix_bits) {}
+    virtual ~BuildSide() = default;
+
+    const size_t radix_bits;
+  };
+
+  /**
+   * Used by OperatorPipeline, which executes a copy of the join for every morsel of its left input. If
+   * share_build_side is set, the right input is always the build side and, after the execution, shared_build_side
+   * holds its hash tables. If shared_build_side is already set before the execution (taken from a copy that has been
+   * executed before), only the left input is materialized and probed against these hash tables. Like the transaction
+   * context, both are set per execution and are not copied by deep_copy().
+   */
+  bool share_build_side{false};
+  std::shared_ptr<const BuildSide> shared_build_side;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -2,6 +2,7 @@
 
 #include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
+#include <mutex>
 #include <uninitialized_vector.hpp>
 
 #include "bytell_hash_map.hpp"
@@ -13,6 +14,7 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
+#include "utils/spill_file.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -182,16 +184,12 @@ class PosHashTable {
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
 };
 
+// Materializes the values of the given chunk's segment into the partition. Returns a histogram that counts the values
+// per radix partition.
 template <typename T, typename HashedType, bool keep_null_values>
-RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
-  // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
-  auto chunk_count = in_table->chunk_count();
-
+std::vector<size_t> materialize_chunk(const Chunk& chunk, const ChunkID chunk_id, const ColumnID column_id,
+                                      Partition<T>& partition, const size_t radix_bits) {
   const std::hash<HashedType> hash_function;
-  // list of all elements that will be partitioned
-  auto radix_container = RadixContainer<T>{};
-  radix_container.resize(chunk_count);
 
   // fan-out
   const size_t num_radix_partitions = 1ull << radix_bits;
@@ -200,97 +198,111 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   const auto pass = size_t{0};
   const auto radix_mask = static_cast<size_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
-  // create histograms per chunk
-  histograms.resize(chunk_count);
+  auto& elements = partition.elements;
+  auto& null_values = partition.null_values;
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(chunk_count);
+  elements.resize(chunk.size());
+  if constexpr (keep_null_values) {
+    null_values.resize(chunk.size());
+  }
 
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    if (!in_table->get_chunk(chunk_id)) continue;
+  auto elements_iter = elements.begin();
+  [[maybe_unused]] auto null_values_iter = null_values.begin();
 
-    jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
-      const auto chunk_in = in_table->get_chunk(chunk_id);
+  // prepare histogram
+  auto histogram = std::vector<size_t>(num_radix_partitions);
 
-      // Skip chunks that were physically deleted
-      if (!chunk_in) return;
+  auto reference_chunk_offset = ChunkOffset{0};
 
-      auto& elements = radix_container[chunk_id].elements;
-      auto& null_values = radix_container[chunk_id].null_values;
+  const auto segment = chunk.get_segment(column_id);
+  segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+    using IterableType = typename decltype(it)::IterableType;
 
-      elements.resize(chunk_in->size());
-      if constexpr (keep_null_values) {
-        null_values.resize(chunk_in->size());
-      }
+    while (it != end) {
+      const auto& value = *it;
 
-      auto elements_iter = elements.begin();
-      [[maybe_unused]] auto null_values_iter = null_values.begin();
+      if (!value.is_null() || keep_null_values) {
+        // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
+        // joins an information loss is possible when joining with longs that cannot be losslessly converted to
+        // double. See #1550 for details.
+        const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
-      // prepare histogram
-      auto histogram = std::vector<size_t>(num_radix_partitions);
+        /*
+        For ReferenceSegments we do not use the RowIDs from the referenced tables.
+        Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+        values from different inputs (important for Multi Joins).
+        */
+        if constexpr (is_reference_segment_iterable_v<IterableType>) {
+          *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
+        } else {
+          *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+        }
+        ++elements_iter;
 
-      auto reference_chunk_offset = ChunkOffset{0};
+        // In case we care about NULL values, store the NULL flag
+        if constexpr (keep_null_values) {
+          if (value.is_null()) {
+            *null_values_iter = true;
+          }
+          ++null_values_iter;
+        }
 
-      const auto segment = chunk_in->get_segment(column_id);
-      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
-        using IterableType = typename decltype(it)::IterableType;
+        if (radix_bits > 0) {
+          const Hash radix = hashed_value & radix_mask;
+          ++histogram[radix];
+        }
+      }
 
-        while (it != end) {
-          const auto& value = *it;
+      // reference_chunk_offset is only used for ReferenceSegments
+      if constexpr (is_reference_segment_iterable_v<IterableType>) {
+        ++reference_chunk_offset;
+      }
 
-          if (!value.is_null() || keep_null_values) {
-            // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
-            // joins an information loss is possible when joining with longs that cannot be losslessly converted to
-            // double. See #1550 for details.
-            const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+      ++it;
 
-            /*
-            For ReferenceSegments we do not use the RowIDs from the referenced tables.
-            Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-            values from different inputs (important for Multi Joins).
-            */
-            if constexpr (is_reference_segment_iterable_v<IterableType>) {
-              *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-            } else {
-              *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
-            }
-            ++elements_iter;
+      if (elements_iter == elements.end()) {
+        // The last chunk has changed its size since we allocated elements. This is due to a concurrent insert
+        // into that chunk. In any case, those inserts will not be visible to our current transaction, so we can
+        // ignore them.
+        break;
+      }
+    }
+  });
 
-            // In case we care about NULL values, store the NULL flag
-            if constexpr (keep_null_values) {
-              if (value.is_null()) {
-                *null_values_iter = true;
-              }
-              ++null_values_iter;
-            }
+  // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
+  // vector to the number of values actually written.
+  elements.resize(std::distance(elements.begin(), elements_iter));
 
-            if (radix_bits > 0) {
-              const Hash radix = hashed_value & radix_mask;
-              ++histogram[radix];
-            }
-          }
+  return histogram;
+}
 
-          // reference_chunk_offset is only used for ReferenceSegments
-          if constexpr (is_reference_segment_iterable_v<IterableType>) {
-            ++reference_chunk_offset;
-          }
+template <typename T, typename HashedType, bool keep_null_values>
+RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+  // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
+  auto chunk_count = in_table->chunk_count();
 
-          ++it;
+  // list of all elements that will be partitioned
+  auto radix_container = RadixContainer<T>{};
+  radix_container.resize(chunk_count);
 
-          if (elements_iter == elements.end()) {
-            // The last chunk has changed its size since we allocated elements. This is due to a concurrent insert
-            // into that chunk. In any case, those inserts will not be visible to our current transaction, so we can
-            // ignore them.
-            break;
-          }
-        }
-      });
+  // create histograms per chunk
+  histograms.resize(chunk_count);
 
-      // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
-      // vector to the number of values actually written.
-      elements.resize(std::distance(elements.begin(), elements_iter));
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
 
-      histograms[chunk_id] = std::move(histogram);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!in_table->get_chunk(chunk_id)) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+
+      // Skip chunks that were physically deleted
+      if (!chunk_in) return;
+
+      histograms[chunk_id] = materialize_chunk<T, HashedType, keep_null_values>(
+          *chunk_in, chunk_id, column_id, radix_container[chunk_id], radix_bits);
     }));
     jobs.back()->schedule();
   }
@@ -474,6 +486,154 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   return output;
 }
 
+/*
+  Spilling: If the build side of a JoinHash exceeds its memory budget, both inputs are partitioned into spill files,
+  which are then joined one after another (see join_hash.hpp).
+*/
+
+// Determines the spill partition of a hash value. Radix partitioning uses the lowest bits of the hash value, which
+// would be the same for all values of a spill partition if spilling used them as well. Also, std::hash is the identity
+// for integers. Thus, the hash value is remixed (using the finalizer of SplitMix64) with a different seed for every
+// spill level, so that partitions that are spilled again are split up.
+inline size_t spill_partition_index(const Hash hash, const size_t spill_level, const size_t partition_bits) {
+  if (partition_bits == 0) return 0;
+
+  auto remixed = static_cast<uint64_t>(hash) + (spill_level + 1) * 0x9E3779B97F4A7C15ull;
+  remixed = (remixed ^ (remixed >> 30u)) * 0xBF58476D1CE4E5B9ull;
+  remixed = (remixed ^ (remixed >> 27u)) * 0x94D049BB133111EBull;
+  remixed ^= remixed >> 31u;
+  return static_cast<size_t>(remixed >> (64u - partition_bits));
+}
+
+// A partition of a materialized join column that was written to a spill file. It consists of blocks, which are
+// appended concurrently by the materialization jobs. Each block holds the RowIDs, the values, and the NULL flags (empty
+// if NULL values are not kept) of its elements in columnar form.
+struct SpilledPartition {
+  SpillFile file;
+  std::mutex mutex;
+  size_t block_count{0};
+  size_t element_count{0};
+  bool has_null_values{false};
+};
+
+template <typename T>
+void spill_block(SpilledPartition& spilled_partition, Partition<T>& partition) {
+  const auto element_count = partition.elements.size();
+  auto row_ids = std::vector<RowID>(element_count);
+  auto values = std::vector<T>(element_count);
+  for (auto element_idx = size_t{0}; element_idx < element_count; ++element_idx) {
+    auto& element = partition.elements[element_idx];
+    row_ids[element_idx] = element.row_id;
+    values[element_idx] = std::move(element.value);
+  }
+  const auto& null_values = partition.null_values;
+  const auto has_null_values = std::find(null_values.begin(), null_values.end(), true) != null_values.end();
+
+  const auto lock = std::lock_guard<std::mutex>{spilled_partition.mutex};
+  spilled_partition.file.write(row_ids);
+  spilled_partition.file.write(values);
+  spilled_partition.file.write(null_values);
+  ++spilled_partition.block_count;
+  spilled_partition.element_count += element_count;
+  spilled_partition.has_null_values |= has_null_values;
+}
+
+// Reads the next block of a spilled partition. SpillFile::finish_writing() has to be called before.
+template <typename T>
+Partition<T> read_spilled_block(SpilledPartition& spilled_partition) {
+  auto row_ids = std::vector<RowID>{};
+  auto values = std::vector<T>{};
+  spilled_partition.file.read(row_ids);
+  spilled_partition.file.read(values);
+
+  auto partition = Partition<T>{};
+  partition.elements.resize(row_ids.size());
+  for (auto element_idx = size_t{0}; element_idx < row_ids.size(); ++element_idx) {
+    partition.elements[element_idx] = PartitionedElement<T>{row_ids[element_idx], std::move(values[element_idx])};
+  }
+  spilled_partition.file.read(partition.null_values);
+
+  return partition;
+}
+
+// Distributes the elements of the partition to the spilled partitions according to their spill partition index
+template <typename T, typename HashedType>
+void spill_by_partition_index(Partition<T>& partition, std::vector<SpilledPartition>& spilled_partitions,
+                              const size_t spill_level, const size_t partition_bits) {
+  const std::hash<HashedType> hash_function;
+  const auto keep_null_values = !partition.null_values.empty();
+
+  auto output = RadixContainer<T>(spilled_partitions.size());
+  for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+    auto& element = partition.elements[element_idx];
+    const auto hashed_value = hash_function(static_cast<HashedType>(element.value));
+    auto& output_partition = output[spill_partition_index(hashed_value, spill_level, partition_bits)];
+
+    output_partition.elements.push_back(std::move(element));
+    if (keep_null_values) {
+      output_partition.null_values.push_back(partition.null_values[element_idx]);
+    }
+  }
+
+  for (auto partition_idx = size_t{0}; partition_idx < output.size(); ++partition_idx) {
+    if (output[partition_idx].elements.empty()) continue;
+    spill_block(spilled_partitions[partition_idx], output[partition_idx]);
+  }
+}
+
+// Materializes the input chunk by chunk and writes the elements to 2^partition_bits spilled partitions. Apart from the
+// spill files' buffers, only the chunks currently being materialized are held in memory.
+template <typename T, typename HashedType, bool keep_null_values>
+std::vector<SpilledPartition> materialize_and_spill_input(const std::shared_ptr<const Table>& in_table,
+                                                          const ColumnID column_id, const size_t partition_bits) {
+  auto spilled_partitions = std::vector<SpilledPartition>(size_t{1} << partition_bits);
+
+  const auto chunk_count = in_table->chunk_count();
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!in_table->get_chunk(chunk_id)) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+
+      // Skip chunks that were physically deleted
+      if (!chunk_in) return;
+
+      auto partition = Partition<T>{};
+      materialize_chunk<T, HashedType, keep_null_values>(*chunk_in, chunk_id, column_id, partition, 0);
+      spill_by_partition_index<T, HashedType>(partition, spilled_partitions, 0, partition_bits);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  for (auto& spilled_partition : spilled_partitions) {
+    spilled_partition.file.finish_writing();
+  }
+
+  return spilled_partitions;
+}
+
+// Splits a spilled partition that exceeds the memory budget into 2^partition_bits spilled partitions of the next level
+template <typename T, typename HashedType>
+std::vector<SpilledPartition> respill_partition(SpilledPartition& spilled_partition, const size_t spill_level,
+                                                const size_t partition_bits) {
+  auto spilled_partitions = std::vector<SpilledPartition>(size_t{1} << partition_bits);
+
+  for (auto block_idx = size_t{0}; block_idx < spilled_partition.block_count; ++block_idx) {
+    auto block = read_spilled_block<T>(spilled_partition);
+    spill_by_partition_index<T, HashedType>(block, spilled_partitions, spill_level, partition_bits);
+  }
+
+  for (auto& new_spilled_partition : spilled_partitions) {
+    new_spilled_partition.file.finish_writing();
+  }
+
+  return spilled_partitions;
+}
+
 /*
   In the probe phase we take all partitions from the probe partition, iterate over them and compare each join candidate
   with the values in the hash table. Since build and probe are hashed using the same hash function, we can reduce the
@@ -9,10 +9,13 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "get_table.hpp"
+#include "hyrise.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -135,8 +138,35 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
 
   auto secondary_predicate_evaluator = MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
 
-  if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
-      _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
+  // If the index side is a stored table with a PrimaryKeyIndex on the join column, that index is probed instead of the
+  // indexes of the single chunks. It also covers mutable chunks, which are never indexed otherwise. As the matches on
+  // the index side are not tracked, outer joins that need to emit unmatched index side rows cannot use it.
+  const auto index_get_table =
+      std::dynamic_pointer_cast<const GetTable>(_index_side == IndexSide::Left ? input_left() : input_right());
+  auto primary_key_index = std::shared_ptr<const PrimaryKeyIndex>{};
+  if (index_get_table && _adjusted_primary_predicate.predicate_condition == PredicateCondition::Equals &&
+      !track_index_matches && _mode != JoinMode::AntiNullAsTrue && _secondary_predicates.empty()) {
+    // Map the ColumnID in GetTable's output to the ColumnID in the stored table
+    auto stored_column_id = _adjusted_primary_predicate.column_ids.second;
+    for (const auto pruned_column_id : index_get_table->pruned_column_ids()) {
+      if (pruned_column_id > stored_column_id) break;
+      ++stored_column_id;
+    }
+
+    const auto stored_table = Hyrise::get().storage_manager.get_table(index_get_table->table_name());
+    const auto& stored_primary_key_index = stored_table->primary_key_index();
+    if (stored_primary_key_index && stored_primary_key_index->column_ids() == std::vector<ColumnID>{stored_column_id}) {
+      primary_key_index = stored_primary_key_index;
+    }
+  }
+
+  if (primary_key_index) {
+    _join_using_primary_key_index(*index_get_table, *primary_key_index, track_probe_matches, is_semi_or_anti_join);
+    performance_data.chunks_scanned_with_index = _index_input_table->chunk_count();
+
+    _append_matches_non_inner(is_semi_or_anti_join);
+  } else if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
+             _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
     // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
     for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
@@ -290,6 +320,38 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
   performance_data.chunks_scanned_without_index++;
 }
 
+void JoinIndex::_join_using_primary_key_index(const GetTable& index_get_table,
+                                              const PrimaryKeyIndex& primary_key_index, const bool track_probe_matches,
+                                              const bool is_semi_or_anti_join) {
+  const auto chunk_count = _probe_input_table->chunk_count();
+  for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
+    const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+    segment_iterate(*probe_segment, [&](const auto& probe_side_position) {
+      if (probe_side_position.is_null()) return;
+
+      const auto probe_chunk_offset = probe_side_position.chunk_offset();
+      for (const auto& stored_row_id : primary_key_index.lookup({AllTypeVariant{probe_side_position.value()}})) {
+        // The index returns RowIDs of the stored table, which need to be mapped to GetTable's output
+        const auto index_chunk_id = index_get_table.output_chunk_id(stored_row_id.chunk_id);
+        if (!index_chunk_id) continue;
+
+        if (track_probe_matches) {
+          _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
+        }
+
+        // Semi and anti joins only write their results in _append_matches_non_inner
+        if (!is_semi_or_anti_join) {
+          _probe_pos_list->emplace_back(RowID{probe_chunk_id, probe_chunk_offset});
+          _index_pos_list->emplace_back(RowID{*index_chunk_id, stored_row_id.chunk_offset});
+        }
+      }
+    });
+  }
+}
+
 // join loop that joins two segments of two columns using an iterator for the probe side,
 // and an index for the index side
 template <typename ProbeIterator>
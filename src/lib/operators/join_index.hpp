@@ -13,7 +13,9 @@
 
 namespace opossum {
 
+class GetTable;
 class MultiPredicateJoinEvaluator;
+class PrimaryKeyIndex;
 using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
 
 /**
@@ -27,6 +29,9 @@ using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
    * scanned with index in the performance data.
    *
    * Note: An index needs to be present on the index side table in order to execute an index join.
+   *
+   * If the index side input is a GetTable and the stored table has a PrimaryKeyIndex on the join column, equi-joins
+   * probe that index instead (see _join_using_primary_key_index).
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -58,6 +63,9 @@ class JoinIndex : public AbstractJoinOperator {
                              const bool track_index_matches, const bool is_semi_or_anti_join,
                              MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
 
+  void _join_using_primary_key_index(const GetTable& index_get_table, const PrimaryKeyIndex& primary_key_index,
+                                     const bool track_probe_matches, const bool is_semi_or_anti_join);
+
   template <typename ProbeIterator>
   void _data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                            const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
@@ -0,0 +1,246 @@
+#include "join_runtime_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <unordered_map>
+
+#include "operators/abstract_operator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+uint64_t hash_key(const T& value) {
+  // -0.0 and 0.0 compare as equal, so they need to have the same hash
+  auto hash = uint64_t{0};
+  if constexpr (std::is_floating_point_v<T>) {
+    hash = std::hash<T>{}(value == T{0} ? T{0} : value);
+  } else {
+    hash = std::hash<T>{}(value);
+  }
+
+  // std::hash is the identity for integers. Multiplying with an odd constant spreads the keys over the upper bits,
+  // which choose the word of the Bloom filter.
+  return hash * 0x9E3779B97F4A7C15ull;
+}
+
+// Bits of the word that are set for a key. They are taken from the middle of the hash, which are independent of the
+// upper bits that choose the word.
+uint64_t key_mask(const uint64_t hash) {
+  auto mask = uint64_t{0};
+  for (auto hash_index = size_t{0}; hash_index < JoinRuntimeFilter::BLOOM_FILTER_HASH_COUNT; ++hash_index) {
+    mask |= uint64_t{1} << ((hash >> (16 + 6 * hash_index)) & 63u);
+  }
+  return mask;
+}
+
+void count_consumers(const std::shared_ptr<AbstractOperator>& op,
+                     std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+    if (consumer_counts[input]++ == 0) count_consumers(input, consumer_counts);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinRuntimeFilter::JoinRuntimeFilter(const std::shared_ptr<AbstractOperator>& build_operator,
+                                     const ColumnID build_column_id, const ColumnID probe_column_id)
+    : _build_operator(build_operator), _build_column_id(build_column_id), _probe_column_id(probe_column_id) {}
+
+const std::shared_ptr<AbstractOperator>& JoinRuntimeFilter::build_operator() const { return _build_operator; }
+
+ColumnID JoinRuntimeFilter::build_column_id() const { return _build_column_id; }
+
+ColumnID JoinRuntimeFilter::probe_column_id() const { return _probe_column_id; }
+
+bool JoinRuntimeFilter::build(const size_t probe_row_count, const DataType probe_data_type) {
+  return build(probe_row_count) && _data_type == probe_data_type;
+}
+
+bool JoinRuntimeFilter::build(const size_t probe_row_count) {
+  if (_is_built) return true;
+
+  const auto build_table = _build_operator->get_output();
+  if (!build_table || build_table->row_count() > probe_row_count) return false;
+
+  std::call_once(_build_flag, [&]() {
+    _data_type = build_table->column_data_type(_build_column_id);
+    resolve_data_type(_data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      _build<ColumnDataType>(*build_table);
+    });
+    _is_built = true;
+  });
+
+  return true;
+}
+
+template <typename T>
+void JoinRuntimeFilter::_build(const Table& build_table) {
+  auto non_null_row_count = size_t{0};
+  auto min = T{};
+  auto max = T{};
+
+  auto hashes = std::vector<uint64_t>{};
+  hashes.reserve(build_table.row_count());
+
+  const auto chunk_count = build_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = build_table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    segment_iterate<T>(*chunk->get_segment(_build_column_id), [&](const auto& position) {
+      if (position.is_null()) return;
+
+      const auto& value = position.value();
+      if (non_null_row_count == 0 || value < min) min = value;
+      if (non_null_row_count == 0 || max < value) max = value;
+      ++non_null_row_count;
+      hashes.emplace_back(hash_key(value));
+    });
+  }
+
+  if (non_null_row_count == 0) return;
+  _min = min;
+  _max = max;
+
+  // Round the number of words up to a power of two, so that the word can be chosen by the upper bits of the hash
+  const auto bit_count = std::max(size_t{64}, non_null_row_count * BLOOM_FILTER_BITS_PER_ROW);
+  _word_bits = std::min(static_cast<size_t>(std::ceil(std::log2(bit_count / 64.0))), MAX_BLOOM_FILTER_WORD_BITS);
+  _bloom_filter.resize(size_t{1} << _word_bits);
+
+  for (const auto hash : hashes) {
+    const auto word_index = _word_bits == 0 ? uint64_t{0} : hash >> (64 - _word_bits);
+    _bloom_filter[word_index] |= key_mask(hash);
+  }
+}
+
+template <typename T>
+bool JoinRuntimeFilter::_may_contain(const T& value) const {
+  const auto hash = hash_key(value);
+  const auto word_index = _word_bits == 0 ? uint64_t{0} : hash >> (64 - _word_bits);
+  const auto mask = key_mask(hash);
+  return (_bloom_filter[word_index] & mask) == mask;
+}
+
+bool JoinRuntimeFilter::can_prune(const Chunk& chunk) const {
+  DebugAssert(_is_built, "Runtime filter has not been built");
+
+  // Without non-NULL keys on the build side, no row of the probe side has a join partner
+  if (variant_is_null(_min)) return true;
+
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics) return false;
+
+  auto can_prune = false;
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& segment_statistics =
+        static_cast<const AttributeStatistics<ColumnDataType>&>(*(*pruning_statistics)[_probe_column_id]);
+
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (segment_statistics.range_filter &&
+          segment_statistics.range_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min, _max)) {
+        can_prune = true;
+      }
+    }
+
+    if (segment_statistics.min_max_filter &&
+        segment_statistics.min_max_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min, _max)) {
+      can_prune = true;
+    }
+  });
+
+  return can_prune;
+}
+
+std::shared_ptr<RowIDPosList> JoinRuntimeFilter::filter(const Chunk& chunk,
+                                                        const std::shared_ptr<RowIDPosList>& matches) const {
+  DebugAssert(_is_built, "Runtime filter has not been built");
+
+  auto filtered_matches = std::make_shared<RowIDPosList>();
+  if (variant_is_null(_min)) return filtered_matches;
+
+  filtered_matches->reserve(matches->size());
+  matches->guarantee_single_chunk();
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto min = boost::get<ColumnDataType>(_min);
+    const auto max = boost::get<ColumnDataType>(_max);
+
+    // For filtered iterables, chunk_offset() is the position within the position filter
+    segment_iterate_filtered<ColumnDataType>(*chunk.get_segment(_probe_column_id), matches, [&](const auto& position) {
+      if (position.is_null()) return;
+
+      const auto& value = position.value();
+      if (value < min || max < value || !_may_contain(value)) return;
+
+      filtered_matches->emplace_back((*matches)[position.chunk_offset()]);
+    });
+  });
+
+  filtered_matches->guarantee_single_chunk();
+  return filtered_matches;
+}
+
+std::string JoinRuntimeFilter::description() const {
+  std::stringstream stream;
+  stream << "RuntimeFilter on Column #" << _probe_column_id << " from " << _build_operator->name() << " Column #"
+         << _build_column_id;
+  return stream.str();
+}
+
+void add_join_runtime_filters(const std::shared_ptr<AbstractOperator>& root) {
+  // The root has no consumer within the plan, but its output is used by the caller
+  auto consumer_counts = std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>{{root, 1}};
+  count_consumers(root, consumer_counts);
+
+  for (const auto& [op, consumer_count] : consumer_counts) {
+    if (op->type() != OperatorType::JoinHash) continue;
+
+    const auto& join = static_cast<const JoinHash&>(*op);
+    if ((join.mode() != JoinMode::Inner && join.mode() != JoinMode::Semi) ||
+        join.primary_predicate().predicate_condition != PredicateCondition::Equals) {
+      continue;
+    }
+
+    // TableScans and Validates forward all columns, so the join column has the same ColumnID in their inputs. The
+    // lowest TableScan is filtered, as it processes the most rows and is the most likely to scan a stored table, whose
+    // chunks have pruning statistics.
+    auto lowest_table_scan = std::shared_ptr<TableScan>{};
+    auto probe_operator = join.mutable_input_left();
+    while (probe_operator && consumer_counts.at(probe_operator) == 1 &&
+           (probe_operator->type() == OperatorType::TableScan || probe_operator->type() == OperatorType::Validate)) {
+      if (probe_operator->type() == OperatorType::TableScan) {
+        lowest_table_scan = std::static_pointer_cast<TableScan>(probe_operator);
+      }
+      probe_operator = probe_operator->mutable_input_left();
+    }
+    if (!lowest_table_scan) continue;
+
+    const auto& [probe_column_id, build_column_id] = join.primary_predicate().column_ids;
+    lowest_table_scan->runtime_filters.emplace_back(
+        std::make_shared<JoinRuntimeFilter>(join.mutable_input_right(), build_column_id, probe_column_id));
+  }
+}
+
+}  // namespace opossum
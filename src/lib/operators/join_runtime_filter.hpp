@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Chunk;
+class Table;
+
+/**
+ * Sideways information passing from the build side of a JoinHash to a TableScan on its probe side. The filter
+ * summarizes the join keys of the build input in a blocked Bloom filter and a min/max range. The TableScan (see
+ * TableScan::runtime_filters) removes rows whose join key is NULL or cannot be part of the build input and skips chunks
+ * whose ChunkPruningStatistics do not overlap the range. Thus, rows that the join would discard are not materialized.
+ *
+ * The filter is built from the output of the join's build input. As the TableScan has to be executed after the build
+ * input, OperatorTask adds a dependency between them. If the build input has not been executed when the TableScan
+ * runs, the filter is not applied.
+ *
+ * Filters are only added for inner and semi joins, where the right input is the build side and rows of the left input
+ * without a join partner are discarded. They are added to a PQP by add_join_runtime_filters() right before it is
+ * executed. As they connect operators in different branches of the PQP, they are not copied by deep_copy().
+ */
+class JoinRuntimeFilter : private Noncopyable {
+ public:
+  JoinRuntimeFilter(const std::shared_ptr<AbstractOperator>& build_operator, const ColumnID build_column_id,
+                    const ColumnID probe_column_id);
+
+  const std::shared_ptr<AbstractOperator>& build_operator() const;
+  ColumnID build_column_id() const;
+
+  // Column of the filtered TableScan's input that holds the join key
+  ColumnID probe_column_id() const;
+
+  // Builds the filter on first use (thread-safe). Returns false if it cannot be applied to a scan whose input has the
+  // given row count and data type in the probe column: The build operator has not been executed, the data types of
+  // the join columns differ, or the build side is larger than the scanned input, so that the filter is unlikely to be
+  // selective but expensive to build. Once the filter is built, the row count is not considered anymore.
+  bool build(const size_t probe_row_count, const DataType probe_data_type);
+
+  // Builds the filter without checking the data type. OperatorPipeline uses it with the row count of the pipeline's
+  // input, as the TableScans of its morsels only see a single chunk.
+  bool build(const size_t probe_row_count);
+
+  // True if the pruning statistics of the chunk show that none of its values in the probe column are part of the
+  // build input
+  bool can_prune(const Chunk& chunk) const;
+
+  // Returns the matches (positions in the chunk) whose values in the probe column may be part of the build input
+  std::shared_ptr<RowIDPosList> filter(const Chunk& chunk, const std::shared_ptr<RowIDPosList>& matches) const;
+
+  std::string description() const;
+
+  // Number of bits that each key sets in its word of the Bloom filter
+  constexpr static auto BLOOM_FILTER_HASH_COUNT = size_t{3};
+
+  // Size of the Bloom filter per non-NULL row of the build input
+  constexpr static auto BLOOM_FILTER_BITS_PER_ROW = size_t{16};
+
+  // Limits the Bloom filter to 128 MiB
+  constexpr static auto MAX_BLOOM_FILTER_WORD_BITS = size_t{24};
+
+ protected:
+  template <typename T>
+  void _build(const Table& build_table);
+
+  template <typename T>
+  bool _may_contain(const T& value) const;
+
+  const std::shared_ptr<AbstractOperator> _build_operator;
+  const ColumnID _build_column_id;
+  const ColumnID _probe_column_id;
+
+  std::once_flag _build_flag;
+  std::atomic_bool _is_built{false};
+  DataType _data_type{DataType::Null};
+
+  // Blocked Bloom filter, where every key sets BLOOM_FILTER_HASH_COUNT bits in a single word. The word is chosen by
+  // the upper _word_bits bits of the key's hash.
+  std::vector<uint64_t> _bloom_filter;
+  size_t _word_bits{0};
+
+  // Smallest and largest non-NULL key of the build input. Both are NULL if there is no such key.
+  AllTypeVariant _min{NULL_VALUE};
+  AllTypeVariant _max{NULL_VALUE};
+};
+
+// Adds runtime filters to the TableScans on the probe side of the inner and semi JoinHashes in the PQP. The TableScan
+// has to be reachable from the join's left input through TableScans and Validates that have no other consumers, so
+// that filtering them only affects the join.
+void add_join_runtime_filters(const std::shared_ptr<AbstractOperator>& root);
+
+}  // namespace opossum
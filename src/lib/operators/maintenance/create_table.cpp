@@ -74,6 +74,13 @@ std::shared_ptr<AbstractOperator> CreateTable::_on_deep_copy(
   return std::make_shared<CreateTable>(table_name, if_not_exists, copied_input_left);
 }
 
+void CreateTable::_on_log_records(LogEntryWriter& log_entry) const {
+  // Only log the creation if the table did not exist before (see IF NOT EXISTS)
+  if (!_insert) return;
+
+  log_entry.create_table(table_name, *Hyrise::get().storage_manager.get_table(table_name));
+}
+
 void CreateTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
   // No parameters possible for CREATE TABLE
 }
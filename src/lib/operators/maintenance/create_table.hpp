@@ -34,6 +34,9 @@ class CreateTable : public AbstractReadWriteOperator {
   // Rollback happens in Insert operator
   void _on_rollback_records() override {}
 
+  // The inserted rows are logged by the Insert operator
+  void _on_log_records(LogEntryWriter& log_entry) const override;
+
   std::shared_ptr<Insert> _insert;
 };
 }  // namespace opossum
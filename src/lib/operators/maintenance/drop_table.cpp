@@ -1,6 +1,7 @@
 #include "drop_table.hpp"
 
 #include "hyrise.hpp"
+#include "logging/log_manager.hpp"
 
 namespace opossum {
 
@@ -18,6 +19,14 @@ std::shared_ptr<const Table> DropTable::_on_execute() {
   // If IF EXISTS is not set and the table is not found, StorageManager throws an exception
   if (!if_exists || Hyrise::get().storage_manager.has_table(table_name)) {
     Hyrise::get().storage_manager.drop_table(table_name);
+
+    // DROP TABLE is not transactional, so it is logged on its own
+    auto& log_manager = Hyrise::get().log_manager;
+    if (log_manager.is_enabled()) {
+      auto log_entry = LogEntryWriter{};
+      log_entry.drop_table(table_name);
+      log_manager.append_and_wait(std::move(log_entry));
+    }
   }
 
   return std::make_shared<Table>(TableColumnDefinitions{{"OK", DataType::Int, false}}, TableType::Data);  // Dummy table
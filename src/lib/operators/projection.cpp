@@ -1,6 +1,7 @@
 #include "projection.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -12,6 +13,9 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
@@ -60,20 +64,23 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   const auto uncorrelated_subquery_results =
       ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
 
-  auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  // Chunks are projected in parallel, so the flags are only ever set (and never reset) by the jobs
+  auto column_is_nullable = std::vector<std::atomic_bool>(expressions.size());
 
   /**
    * Perform the projection
    */
   auto output_chunk_segments = std::vector<Segments>(input_table.chunk_count());
 
-  const auto chunk_count_input_table = input_table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_input_table; ++chunk_id) {
+  const auto project_chunk = [&](const ChunkID chunk_id) {
     const auto input_chunk = input_table.get_chunk(chunk_id);
     Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     auto output_segments = Segments{expressions.size()};
 
+    // The evaluator caches the results of all (sub)expressions that it evaluates for this chunk. As it is shared by
+    // all expressions of the projection list, subexpressions that appear in multiple expressions (e.g.,
+    // `l_extendedprice * (1 - l_discount)` in TPC-H Q1) are only evaluated once per chunk.
     ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_subquery_results);
 
     for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
@@ -83,8 +90,9 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       if (expression->type == ExpressionType::PQPColumn && forward_columns) {
         const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
         output_segments[column_id] = input_chunk->get_segment(pqp_column_expression->column_id);
-        column_is_nullable[column_id] =
-            column_is_nullable[column_id] || input_table.column_is_nullable(pqp_column_expression->column_id);
+        if (input_table.column_is_nullable(pqp_column_expression->column_id)) {
+          column_is_nullable[column_id] = true;
+        }
       } else if (expression->type == ExpressionType::PQPColumn && !forward_columns) {
         // The current column will be returned without any logical modifications. As other columns do get modified (and
         // returned as a ValueSegment), all segments (including this one) need to become ValueSegments. This segment is
@@ -186,17 +194,36 @@ std::shared_ptr<const Table> Projection::_on_execute() {
             }
 
             output_segments[column_id] = std::move(value_segment);
-            column_is_nullable[column_id] = has_null;
+            if (has_null) {
+              column_is_nullable[column_id] = true;
+            }
           }
         });
       } else {
         auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
+        if (output_segment->is_nullable()) {
+          column_is_nullable[column_id] = true;
+        }
         output_segments[column_id] = std::move(output_segment);
       }
     }
 
     output_chunk_segments[chunk_id] = std::move(output_segments);
+  };
+
+  const auto chunk_count_input_table = input_table.chunk_count();
+  if (forward_columns || chunk_count_input_table == 1) {
+    // Forwarding segments is cheap, jobs would only add scheduling overhead. The same goes for a single chunk.
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_input_table; ++chunk_id) {
+      project_chunk(chunk_id);
+    }
+  } else {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count_input_table);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_input_table; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&project_chunk, chunk_id]() { project_chunk(chunk_id); }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
   }
 
   /**
@@ -1,22 +1,44 @@
 #include "sort.hpp"
 
+#include <array>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <queue>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/segment_iterate.hpp"
+#include "utils/format_bytes.hpp"
+#include "utils/spill_file.hpp"
 
 namespace {
 
 using namespace opossum;  // NOLINT
 
+// Number of bytes of a string that are encoded into the normalized key. If a sort column contains longer strings (or
+// strings containing '\0', which cannot be distinguished from the padding), rows with equal key prefixes are ordered
+// by a comparison-based fallback.
+constexpr auto MAX_NORMALIZED_STRING_PREFIX = size_t{32};
+
+// Buckets of the radix sort that are smaller than this are sorted with std::stable_sort instead of being partitioned
+// further.
+constexpr auto RADIX_SORT_SMALL_BUCKET_SIZE = size_t{64};
+
+// Number of rows that one job partitions in the first, parallel radix sort pass.
+constexpr auto RADIX_SORT_MORSEL_SIZE = size_t{Chunk::DEFAULT_SIZE};
+
 // Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
-// creating chunks of output_chunk_size rows at maximum.
+// creating chunks of output_chunk_size rows at maximum. Each output chunk is materialized by a separate job.
 std::shared_ptr<Table> materialize_output_table(const std::shared_ptr<const Table>& unsorted_table,
                                                 const RowIDPosList& pos_list, const ChunkOffset output_chunk_size) {
   // First we create a new table as the output
   // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
   auto output = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::Data, output_chunk_size);
 
-  // After we created the output table and initialized the column structure, we can start adding values. Because the
-  // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-  // copied column by column for each output row.
+  // Because the values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead, each
+  // job copies the values of all columns for the rows of one output chunk.
 
   // Ceiling of integer division
   const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
@@ -26,72 +48,701 @@ std::shared_ptr<Table> materialize_output_table(const std::shared_ptr<const Tabl
   // Vector of segments for each chunk
   std::vector<Segments> output_segments_by_chunk(output_chunk_count);
 
-  // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
   const auto input_chunk_count = unsorted_table->chunk_count();
-  const auto row_count = unsorted_table->row_count();
-  for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-    const auto column_data_type = output->column_data_type(column_id);
+  const auto column_count = output->column_count();
+  const auto row_count = pos_list.size();
 
-    resolve_data_type(column_data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(output_chunk_count);
+  for (auto output_chunk_index = size_t{0}; output_chunk_index < output_chunk_count; ++output_chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, output_chunk_index]() {
+      const auto begin_row_index = output_chunk_index * output_chunk_size;
+      const auto end_row_index = std::min(begin_row_index + output_chunk_size, row_count);
+
+      auto& output_segments = output_segments_by_chunk[output_chunk_index];
+      output_segments.reserve(column_count);
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        resolve_data_type(output->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto value_segment_value_vector = pmr_vector<ColumnDataType>();
+          auto value_segment_null_vector = pmr_vector<bool>();
+          value_segment_value_vector.reserve(end_row_index - begin_row_index);
+          value_segment_null_vector.reserve(end_row_index - begin_row_index);
 
-      auto chunk_it = output_segments_by_chunk.begin();
-      auto current_segment_size = 0u;
+          // Accessors are not thread-safe, so each job creates its own ones for the input chunks it encounters
+          auto accessor_by_chunk_id =
+              std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
 
-      auto value_segment_value_vector = pmr_vector<ColumnDataType>();
-      auto value_segment_null_vector = pmr_vector<bool>();
+          for (auto row_index = begin_row_index; row_index < end_row_index; ++row_index) {
+            const auto [chunk_id, chunk_offset] = pos_list[row_index];
 
-      value_segment_value_vector.reserve(output_chunk_size);
-      value_segment_null_vector.reserve(output_chunk_size);
+            auto& accessor = accessor_by_chunk_id[chunk_id];
+            if (!accessor) {
+              accessor = create_segment_accessor<ColumnDataType>(
+                  unsorted_table->get_chunk(chunk_id)->get_segment(column_id));
+            }
 
-      auto accessor_by_chunk_id =
-          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(unsorted_table->chunk_count());
-      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-        const auto& base_segment = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
-        accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<ColumnDataType>(base_segment);
+            const auto typed_value = accessor->access(chunk_offset);
+            const auto is_null = !typed_value;
+            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
+            value_segment_null_vector.push_back(is_null);
+          }
+
+          output_segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(
+              std::move(value_segment_value_vector), std::move(value_segment_null_vector)));
+        });
       }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (auto& segments : output_segments_by_chunk) {
+    output->append_chunk(segments);
+  }
 
-      for (auto row_index = 0u; row_index < row_count; ++row_index) {
-        const auto [chunk_id, chunk_offset] = pos_list[row_index];
+  return output;
+}
+
+// Runs functor(chunk_id) for every chunk of the table, one job per chunk.
+template <typename Functor>
+void for_each_chunk_in_parallel(const Table& table, const Functor& functor) {
+  const auto chunk_count = table.chunk_count();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+    jobs.emplace_back(std::make_shared<JobTask>([&functor, chunk_id]() { functor(chunk_id); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
 
-        auto& accessor = accessor_by_chunk_id[chunk_id];
-        const auto typed_value = accessor->access(chunk_offset);
-        const auto is_null = !typed_value;
-        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-        value_segment_null_vector.push_back(is_null);
+/**
+ * The normalized key of a row is the concatenation of the encoded values of its sort columns. Each encoded value
+ * consists of
+ *  - one byte that orders NULLs before or after all other values (only for nullable columns) and
+ *  - the value itself in a big-endian, order-preserving binary representation. For descending sort columns, these
+ *    bytes are inverted.
+ * Thus, comparing two normalized keys with memcmp yields the same result as comparing the rows column by column.
+ *
+ * Strings are encoded by their first MAX_NORMALIZED_STRING_PREFIX bytes, padded with '\0'. If a string column cannot
+ * be encoded without loss, the key ends after this column's prefix, and rows with equal keys are ordered by comparing
+ * the remaining sort columns (starting with the truncated string column) with a FallbackComparator.
+ */
+struct NormalizedKeyColumn {
+  ColumnID column_id;
+  OrderByMode order_by_mode;
+  bool nullable;
 
-        ++current_segment_size;
+  // Position of the column's bytes within the normalized key
+  size_t offset;
 
-        // Check if value segment is full
-        if (current_segment_size >= output_chunk_size) {
-          current_segment_size = 0u;
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
-          value_segment_value_vector = pmr_vector<ColumnDataType>();
-          value_segment_null_vector = pmr_vector<bool>();
+  // Number of bytes used for the value, excluding the NULL byte
+  size_t value_width;
+};
+
+bool nulls_first(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+}
+
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+template <typename ColumnDataType>
+void encode_normalized_value(uint8_t* destination, const ColumnDataType& value, const size_t value_width) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    const auto prefix_length = std::min(value.size(), value_width);
+    std::memcpy(destination, value.data(), prefix_length);
+    std::memset(destination + prefix_length, 0, value_width - prefix_length);
+  } else {
+    using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
 
-          value_segment_value_vector.reserve(output_chunk_size);
-          value_segment_null_vector.reserve(output_chunk_size);
+    auto bits = UnsignedType{};
+    if constexpr (std::is_floating_point_v<ColumnDataType>) {
+      // -0.0 and 0.0 compare as equal, so they need to have the same key
+      const auto normalized_value = value == ColumnDataType{0} ? ColumnDataType{0} : value;
+      std::memcpy(&bits, &normalized_value, sizeof(bits));
+      // Negative values are ordered inversely to their bit patterns, positive values are ordered after them
+      bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    } else {
+      // Flipping the sign bit maps the two's complement order to the unsigned order
+      bits = static_cast<UnsignedType>(value) ^ SIGN_BIT;
+    }
 
-          ++chunk_it;
+    for (auto byte_index = size_t{0}; byte_index < sizeof(UnsignedType); ++byte_index) {
+      destination[byte_index] = static_cast<uint8_t>(bits >> ((sizeof(UnsignedType) - 1 - byte_index) * 8));
+    }
+  }
+}
+
+// Compares the values of two rows for one sort column that is not (fully) part of the normalized key.
+class FallbackComparator {
+ public:
+  virtual ~FallbackComparator() = default;
+
+  // Returns a negative number if left_row is ordered before right_row, 0 if they are equal, and a positive number
+  // otherwise.
+  virtual int compare(const size_t left_row_index, const size_t right_row_index) const = 0;
+};
+
+template <typename ColumnDataType>
+class TypedFallbackComparator : public FallbackComparator {
+ public:
+  TypedFallbackComparator(const Table& table, const ColumnID column_id, const OrderByMode order_by_mode,
+                          const std::vector<size_t>& chunk_row_offsets)
+      : _values(chunk_row_offsets.back()),
+        _nulls(chunk_row_offsets.back()),
+        _nulls_first(nulls_first(order_by_mode)),
+        _descending(is_descending(order_by_mode)) {
+    for_each_chunk_in_parallel(table, [&](const ChunkID chunk_id) {
+      const auto row_offset = chunk_row_offsets[chunk_id];
+      segment_iterate<ColumnDataType>(*table.get_chunk(chunk_id)->get_segment(column_id), [&](const auto& position) {
+        const auto row_index = row_offset + position.chunk_offset();
+        _nulls[row_index] = position.is_null();
+        if (!position.is_null()) {
+          _values[row_index] = position.value();
         }
+      });
+    });
+  }
+
+  int compare(const size_t left_row_index, const size_t right_row_index) const override {
+    const auto left_is_null = _nulls[left_row_index];
+    const auto right_is_null = _nulls[right_row_index];
+    if (left_is_null || right_is_null) {
+      if (left_is_null && right_is_null) return 0;
+      return (left_is_null == _nulls_first) ? -1 : 1;
+    }
+
+    const auto& left_value = _values[left_row_index];
+    const auto& right_value = _values[right_row_index];
+    if (left_value == right_value) return 0;
+    return ((left_value < right_value) != _descending) ? -1 : 1;
+  }
+
+ protected:
+  std::vector<ColumnDataType> _values;
+  // BoolAsByteType instead of bool, because the vector is written concurrently by one job per chunk
+  std::vector<BoolAsByteType> _nulls;
+  const bool _nulls_first;
+  const bool _descending;
+};
+
+// Stable sort of rows that only differ from byte_index on, used for small buckets of the radix sort.
+void comparison_sort_rows(uint8_t* rows, uint8_t* buffer, const size_t row_count, const size_t row_width,
+                          const size_t key_width, const size_t byte_index) {
+  auto row_pointers = std::vector<const uint8_t*>(row_count);
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    row_pointers[row_index] = rows + row_index * row_width;
+  }
+
+  std::stable_sort(row_pointers.begin(), row_pointers.end(), [&](const uint8_t* left, const uint8_t* right) {
+    return std::memcmp(left + byte_index, right + byte_index, key_width - byte_index) < 0;
+  });
+
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    std::memcpy(buffer + row_index * row_width, row_pointers[row_index], row_width);
+  }
+  std::memcpy(rows, buffer, row_count * row_width);
+}
+
+// Stable MSD radix sort of fixed-width rows by their first key_width bytes, assuming that all rows share the bytes
+// before byte_index. buffer has to provide space for row_count rows. After the call, the sorted rows are in rows.
+void radix_sort_rows(uint8_t* rows, uint8_t* buffer, const size_t row_count, const size_t row_width,
+                     const size_t key_width, size_t byte_index) {
+  while (row_count > 1 && byte_index < key_width) {
+    if (row_count < RADIX_SORT_SMALL_BUCKET_SIZE) {
+      comparison_sort_rows(rows, buffer, row_count, row_width, key_width, byte_index);
+      return;
+    }
+
+    auto bucket_sizes = std::array<size_t, 256>{};
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      ++bucket_sizes[rows[row_index * row_width + byte_index]];
+    }
+
+    // If all rows share the current byte, continue with the next byte without moving any rows
+    if (std::find(bucket_sizes.cbegin(), bucket_sizes.cend(), row_count) != bucket_sizes.cend()) {
+      ++byte_index;
+      continue;
+    }
+
+    auto bucket_offsets = std::array<size_t, 256>{};
+    std::exclusive_scan(bucket_sizes.cbegin(), bucket_sizes.cend(), bucket_offsets.begin(), size_t{0});
+
+    auto write_offsets = bucket_offsets;
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      const auto* row = rows + row_index * row_width;
+      std::memcpy(buffer + write_offsets[row[byte_index]]++ * row_width, row, row_width);
+    }
+    std::memcpy(rows, buffer, row_count * row_width);
+
+    for (auto bucket = size_t{0}; bucket < 256; ++bucket) {
+      const auto offset = bucket_offsets[bucket] * row_width;
+      radix_sort_rows(rows + offset, buffer + offset, bucket_sizes[bucket], row_width, key_width, byte_index + 1);
+    }
+    return;
+  }
+}
+
+// Same as radix_sort_rows, but the first pass is partitioned by multiple jobs and the resulting buckets are sorted
+// by one job each.
+void parallel_radix_sort_rows(std::vector<uint8_t>& rows, const size_t row_count, const size_t row_width,
+                              const size_t key_width) {
+  auto buffer = std::vector<uint8_t>(rows.size());
+
+  if (row_count <= RADIX_SORT_MORSEL_SIZE || key_width == 0) {
+    radix_sort_rows(rows.data(), buffer.data(), row_count, row_width, key_width, 0);
+    return;
+  }
+
+  const auto morsel_count = (row_count + RADIX_SORT_MORSEL_SIZE - 1) / RADIX_SORT_MORSEL_SIZE;
+  const auto morsel_range = [&](const size_t morsel_index) {
+    const auto begin = morsel_index * RADIX_SORT_MORSEL_SIZE;
+    return std::make_pair(begin, std::min(begin + RADIX_SORT_MORSEL_SIZE, row_count));
+  };
+
+  // 1. Build one histogram of the first key byte per morsel
+  auto bucket_sizes_by_morsel = std::vector<std::array<size_t, 256>>(morsel_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(morsel_count);
+  for (auto morsel_index = size_t{0}; morsel_index < morsel_count; ++morsel_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, morsel_index]() {
+      const auto [begin, end] = morsel_range(morsel_index);
+      auto& bucket_sizes = bucket_sizes_by_morsel[morsel_index];
+      for (auto row_index = begin; row_index < end; ++row_index) {
+        ++bucket_sizes[rows[row_index * row_width]];
       }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // 2. Compute where each morsel writes its rows. Morsels write to a bucket in their original order, which keeps the
+  //    partitioning stable.
+  auto bucket_sizes = std::array<size_t, 256>{};
+  auto write_offsets_by_morsel = std::vector<std::array<size_t, 256>>(morsel_count);
+  for (auto bucket = size_t{0}; bucket < 256; ++bucket) {
+    for (auto morsel_index = size_t{0}; morsel_index < morsel_count; ++morsel_index) {
+      write_offsets_by_morsel[morsel_index][bucket] = bucket_sizes[bucket];
+      bucket_sizes[bucket] += bucket_sizes_by_morsel[morsel_index][bucket];
+    }
+  }
+
+  auto bucket_offsets = std::array<size_t, 256>{};
+  std::exclusive_scan(bucket_sizes.cbegin(), bucket_sizes.cend(), bucket_offsets.begin(), size_t{0});
+
+  // 3. Scatter the rows into the buffer
+  jobs.clear();
+  for (auto morsel_index = size_t{0}; morsel_index < morsel_count; ++morsel_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, morsel_index]() {
+      const auto [begin, end] = morsel_range(morsel_index);
+      auto write_offsets = write_offsets_by_morsel[morsel_index];
+      for (auto bucket = size_t{0}; bucket < 256; ++bucket) {
+        write_offsets[bucket] += bucket_offsets[bucket];
+      }
+
+      for (auto row_index = begin; row_index < end; ++row_index) {
+        const auto* row = rows.data() + row_index * row_width;
+        std::memcpy(buffer.data() + write_offsets[row[0]]++ * row_width, row, row_width);
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // 4. Copy each bucket back and sort it by the remaining key bytes
+  jobs.clear();
+  for (auto bucket = size_t{0}; bucket < 256; ++bucket) {
+    if (bucket_sizes[bucket] == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, bucket]() {
+      const auto offset = bucket_offsets[bucket] * row_width;
+      std::memcpy(rows.data() + offset, buffer.data() + offset, bucket_sizes[bucket] * row_width);
+      radix_sort_rows(rows.data() + offset, buffer.data() + offset, bucket_sizes[bucket], row_width, key_width, 1);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Determines the order of the table's rows by encoding all sort columns into normalized keys and radix sorting them.
+RowIDPosList sort_by_normalized_keys(const std::shared_ptr<const Table>& table,
+                                     const std::vector<SortColumnDefinition>& sort_definitions) {
+  const auto chunk_count = table->chunk_count();
+
+  // Rows are numbered chunk by chunk, so that each chunk can be encoded independently. chunk_row_offsets[chunk_id]
+  // holds the number of the chunk's first row, the last entry holds the table's row count.
+  auto chunk_row_offsets = std::vector<size_t>(chunk_count + 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    chunk_row_offsets[chunk_id + 1] = chunk_row_offsets[chunk_id] + chunk->size();
+  }
+  const auto row_count = chunk_row_offsets.back();
+
+  // 1. Determine the layout of the normalized key. For string columns, this requires knowing the longest string.
+  auto key_columns = std::vector<NormalizedKeyColumn>{};
+  auto fallback_begin = std::optional<size_t>{};
+  auto key_width = size_t{0};
+
+  for (const auto& sort_definition : sort_definitions) {
+    auto value_width = size_t{0};
+    auto is_lossless = true;
 
-      // Last segment has not been added
-      if (current_segment_size > 0u) {
-        auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                            std::move(value_segment_null_vector));
-        chunk_it->push_back(value_segment);
+    resolve_data_type(table->column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        auto max_length_by_chunk = std::vector<size_t>(chunk_count);
+        auto contains_zero_byte_by_chunk = std::vector<BoolAsByteType>(chunk_count);
+        for_each_chunk_in_parallel(*table, [&](const ChunkID chunk_id) {
+          const auto& segment = *table->get_chunk(chunk_id)->get_segment(sort_definition.column);
+          segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+            if (position.is_null()) return;
+            const auto& value = position.value();
+            max_length_by_chunk[chunk_id] = std::max(max_length_by_chunk[chunk_id], value.size());
+            contains_zero_byte_by_chunk[chunk_id] |= value.find('\0') != pmr_string::npos;
+          });
+        });
+
+        const auto max_length = std::accumulate(max_length_by_chunk.cbegin(), max_length_by_chunk.cend(), size_t{0},
+                                                [](const auto lhs, const auto rhs) { return std::max(lhs, rhs); });
+        value_width = std::min(max_length, MAX_NORMALIZED_STRING_PREFIX);
+        is_lossless = max_length <= MAX_NORMALIZED_STRING_PREFIX &&
+                      std::none_of(contains_zero_byte_by_chunk.cbegin(), contains_zero_byte_by_chunk.cend(),
+                                   [](const auto contains_zero_byte) { return contains_zero_byte; });
+      } else {
+        value_width = sizeof(ColumnDataType);
       }
     });
+
+    const auto nullable = table->column_is_nullable(sort_definition.column);
+    key_columns.push_back({sort_definition.column, sort_definition.order_by_mode, nullable, key_width, value_width});
+    key_width += (nullable ? 1 : 0) + value_width;
+
+    if (!is_lossless) {
+      // All following columns are compared by the fallback, so they do not need to be part of the key
+      fallback_begin = key_columns.size() - 1;
+      break;
+    }
   }
 
-  for (auto& segments : output_segments_by_chunk) {
-    output->append_chunk(segments);
+  // Each row holds the normalized key followed by the row's number
+  const auto row_width = key_width + sizeof(size_t);
+
+  // 2. Encode the keys and remember the RowID of each row
+  auto rows = std::vector<uint8_t>(row_count * row_width);
+  auto row_ids = std::vector<RowID>(row_count);
+
+  for_each_chunk_in_parallel(*table, [&](const ChunkID chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto row_offset = chunk_row_offsets[chunk_id];
+    const auto chunk_size = chunk->size();
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto row_index = row_offset + chunk_offset;
+      row_ids[row_index] = RowID{chunk_id, chunk_offset};
+      std::memcpy(rows.data() + row_index * row_width + key_width, &row_index, sizeof(size_t));
+    }
+
+    for (const auto& key_column : key_columns) {
+      const auto null_byte_for_values = static_cast<uint8_t>(nulls_first(key_column.order_by_mode) ? 1 : 0);
+      const auto descending = is_descending(key_column.order_by_mode);
+
+      resolve_data_type(table->column_data_type(key_column.column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(key_column.column_id), [&](const auto& position) {
+          auto* destination = rows.data() + (row_offset + position.chunk_offset()) * row_width + key_column.offset;
+
+          if (key_column.nullable) {
+            *destination = position.is_null() ? static_cast<uint8_t>(1 - null_byte_for_values) : null_byte_for_values;
+            ++destination;
+          }
+
+          if (position.is_null()) {
+            std::memset(destination, 0, key_column.value_width);
+            return;
+          }
+
+          encode_normalized_value(destination, position.value(), key_column.value_width);
+          if (descending) {
+            for (auto byte_index = size_t{0}; byte_index < key_column.value_width; ++byte_index) {
+              destination[byte_index] = ~destination[byte_index];
+            }
+          }
+        });
+      });
+    }
+  });
+
+  // 3. Sort the rows by their keys
+  parallel_radix_sort_rows(rows, row_count, row_width, key_width);
+
+  auto sorted_row_indices = std::vector<size_t>(row_count);
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    std::memcpy(&sorted_row_indices[row_index], rows.data() + row_index * row_width + key_width, sizeof(size_t));
   }
 
-  return output;
+  // 4. Order rows with equal keys by the sort columns that are not (fully) encoded in the key
+  if (fallback_begin) {
+    auto fallback_comparators = std::vector<std::unique_ptr<FallbackComparator>>{};
+    for (auto sort_definition_index = *fallback_begin; sort_definition_index < sort_definitions.size();
+         ++sort_definition_index) {
+      const auto& sort_definition = sort_definitions[sort_definition_index];
+      resolve_data_type(table->column_data_type(sort_definition.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        fallback_comparators.emplace_back(std::make_unique<TypedFallbackComparator<ColumnDataType>>(
+            *table, sort_definition.column, sort_definition.order_by_mode, chunk_row_offsets));
+      });
+    }
+
+    const auto compare_rows = [&](const size_t left_row_index, const size_t right_row_index) {
+      for (const auto& fallback_comparator : fallback_comparators) {
+        const auto result = fallback_comparator->compare(left_row_index, right_row_index);
+        if (result != 0) return result < 0;
+      }
+      return false;
+    };
+
+    auto run_begin = size_t{0};
+    while (run_begin < row_count) {
+      auto run_end = run_begin + 1;
+      while (run_end < row_count &&
+             std::memcmp(rows.data() + run_begin * row_width, rows.data() + run_end * row_width, key_width) == 0) {
+        ++run_end;
+      }
+
+      if (run_end - run_begin > 1) {
+        std::stable_sort(sorted_row_indices.begin() + run_begin, sorted_row_indices.begin() + run_end, compare_rows);
+      }
+      run_begin = run_end;
+    }
+  }
+
+  auto pos_list = RowIDPosList(row_count);
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    pos_list[row_index] = row_ids[sorted_row_indices[row_index]];
+  }
+  return pos_list;
+}
+
+// Rough estimate of the number of bytes that sorting one row of the table in memory and materializing it requires:
+// the materialized values and NULL flags, the normalized key (twice, as the radix sort needs a buffer), and the row's
+// number and RowID. Strings are counted without their heap-allocated characters.
+size_t estimate_memory_usage_per_row(const Table& table, const std::vector<SortColumnDefinition>& sort_definitions) {
+  const auto value_size = [&](const ColumnID column_id) {
+    auto size = size_t{1};
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      size += sizeof(ColumnDataType);
+    });
+    return size;
+  };
+
+  auto memory_usage = 2 * (sizeof(size_t) + sizeof(RowID));
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    memory_usage += value_size(column_id);
+  }
+  for (const auto& sort_definition : sort_definitions) {
+    memory_usage += 2 * value_size(sort_definition.column);
+  }
+  return memory_usage;
+}
+
+// Handles one column of the sorted runs of the external sort. Within the runs, all columns are stored as nullable
+// ValueSegments, which are written to and read from the runs' spill files block by block.
+class RunColumn {
+ public:
+  virtual ~RunColumn() = default;
+
+  virtual void write(SpillFile& file, const BaseSegment& segment) const = 0;
+  virtual std::shared_ptr<BaseSegment> read(SpillFile& file) const = 0;
+
+  // Returns a negative number if the left row is ordered before the right row, 0 if they are equal, and a positive
+  // number otherwise.
+  virtual int compare(const BaseSegment& left_segment, const ChunkOffset left_offset,
+                      const BaseSegment& right_segment, const ChunkOffset right_offset,
+                      const OrderByMode order_by_mode) const = 0;
+
+  // Appends a value to the segment that is currently being merged and returns the segment once it is complete
+  virtual void append(const BaseSegment& segment, const ChunkOffset offset) = 0;
+  virtual std::shared_ptr<BaseSegment> finish_segment() = 0;
+};
+
+template <typename ColumnDataType>
+class TypedRunColumn : public RunColumn {
+ public:
+  void write(SpillFile& file, const BaseSegment& segment) const override {
+    const auto& value_segment = static_cast<const ValueSegment<ColumnDataType>&>(segment);
+    file.write(value_segment.values());
+    file.write(value_segment.null_values());
+  }
+
+  std::shared_ptr<BaseSegment> read(SpillFile& file) const override {
+    auto values = pmr_vector<ColumnDataType>{};
+    auto null_values = pmr_vector<bool>{};
+    file.read(values);
+    file.read(null_values);
+    return std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+  }
+
+  int compare(const BaseSegment& left_segment, const ChunkOffset left_offset,
+              const BaseSegment& right_segment, const ChunkOffset right_offset,
+              const OrderByMode order_by_mode) const override {
+    const auto& left_value_segment = static_cast<const ValueSegment<ColumnDataType>&>(left_segment);
+    const auto& right_value_segment = static_cast<const ValueSegment<ColumnDataType>&>(right_segment);
+
+    const auto left_is_null = left_value_segment.null_values()[left_offset];
+    const auto right_is_null = right_value_segment.null_values()[right_offset];
+    if (left_is_null || right_is_null) {
+      if (left_is_null && right_is_null) return 0;
+      return (left_is_null == nulls_first(order_by_mode)) ? -1 : 1;
+    }
+
+    const auto& left_value = left_value_segment.values()[left_offset];
+    const auto& right_value = right_value_segment.values()[right_offset];
+    if (left_value == right_value) return 0;
+    return ((left_value < right_value) != is_descending(order_by_mode)) ? -1 : 1;
+  }
+
+  void append(const BaseSegment& segment, const ChunkOffset offset) override {
+    const auto& value_segment = static_cast<const ValueSegment<ColumnDataType>&>(segment);
+    _values.push_back(value_segment.values()[offset]);
+    _null_values.push_back(value_segment.null_values()[offset]);
+  }
+
+  std::shared_ptr<BaseSegment> finish_segment() override {
+    auto segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(_values), std::move(_null_values));
+    _values = {};
+    _null_values = {};
+    return segment;
+  }
+
+ private:
+  pmr_vector<ColumnDataType> _values;
+  pmr_vector<bool> _null_values;
+};
+
+using RunColumns = std::vector<std::unique_ptr<RunColumn>>;
+
+Segments get_segments(const Chunk& chunk) {
+  auto segments = Segments{};
+  const auto column_count = chunk.column_count();
+  segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    segments.emplace_back(chunk.get_segment(column_id));
+  }
+  return segments;
+}
+
+// A sorted run of the external sort, stored as blocks of rows in a compressed spill file
+struct SortedRun {
+  SortedRun() : file(true) {}
+
+  void write_block(const RunColumns& run_columns, const Segments& segments) {
+    for (auto column_id = size_t{0}; column_id < run_columns.size(); ++column_id) {
+      run_columns[column_id]->write(file, *segments[column_id]);
+    }
+    ++block_count;
+  }
+
+  Segments read_block(const RunColumns& run_columns) {
+    auto segments = Segments{};
+    segments.reserve(run_columns.size());
+    for (const auto& run_column : run_columns) {
+      segments.emplace_back(run_column->read(file));
+    }
+    return segments;
+  }
+
+  SpillFile file;
+  size_t block_count{0};
+};
+
+// K-way merge of sorted runs into blocks of up to block_size rows, which are passed to emit_block. Only the current
+// block of each run is held in memory. Rows that compare as equal are emitted in the order of their runs. As the runs
+// are ordered like the input, this keeps the sort stable.
+void merge_runs(std::vector<std::unique_ptr<SortedRun>>& runs, RunColumns& run_columns,
+                const std::vector<SortColumnDefinition>& sort_definitions, const size_t block_size,
+                const std::function<void(Segments&&)>& emit_block) {
+  struct RunCursor {
+    Segments block;
+    ChunkOffset offset{0};
+    size_t read_block_count{0};
+  };
+
+  const auto run_count = runs.size();
+  auto cursors = std::vector<RunCursor>(run_count);
+
+  const auto read_next_block = [&](const size_t run_index) {
+    auto& cursor = cursors[run_index];
+    auto& run = *runs[run_index];
+    if (cursor.read_block_count == run.block_count) return false;
+
+    cursor.block = run.read_block(run_columns);
+    cursor.offset = ChunkOffset{0};
+    ++cursor.read_block_count;
+    return true;
+  };
+
+  // The priority queue returns its largest element first. Thus, a run is "less" than another one if its current row
+  // has to be emitted later.
+  const auto is_emitted_later = [&](const size_t left_run_index, const size_t right_run_index) {
+    const auto& left_cursor = cursors[left_run_index];
+    const auto& right_cursor = cursors[right_run_index];
+    for (const auto& sort_definition : sort_definitions) {
+      const auto column_id = sort_definition.column;
+      const auto result =
+          run_columns[column_id]->compare(*left_cursor.block[column_id], left_cursor.offset,
+                                          *right_cursor.block[column_id], right_cursor.offset,
+                                          sort_definition.order_by_mode);
+      if (result != 0) return result > 0;
+    }
+    return left_run_index > right_run_index;
+  };
+
+  auto queue = std::priority_queue<size_t, std::vector<size_t>, decltype(is_emitted_later)>{is_emitted_later};
+  for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+    runs[run_index]->file.finish_writing();
+    if (read_next_block(run_index)) queue.push(run_index);
+  }
+
+  const auto column_count = run_columns.size();
+  const auto emit_merged_rows = [&]() {
+    auto segments = Segments{};
+    segments.reserve(column_count);
+    for (const auto& run_column : run_columns) {
+      segments.emplace_back(run_column->finish_segment());
+    }
+    emit_block(std::move(segments));
+  };
+
+  auto merged_row_count = size_t{0};
+  while (!queue.empty()) {
+    const auto run_index = queue.top();
+    queue.pop();
+
+    auto& cursor = cursors[run_index];
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      run_columns[column_id]->append(*cursor.block[column_id], cursor.offset);
+    }
+
+    ++merged_row_count;
+    if (merged_row_count % block_size == 0) emit_merged_rows();
+
+    ++cursor.offset;
+    if (cursor.offset < cursor.block.front()->size() || read_next_block(run_index)) {
+      queue.push(run_index);
+    }
+  }
+
+  if (merged_row_count % block_size != 0) emit_merged_rows();
 }
 
 }  // namespace
@@ -99,15 +750,18 @@ std::shared_ptr<Table> materialize_output_table(const std::shared_ptr<const Tabl
 namespace opossum {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
-           const ChunkOffset output_chunk_size)
-    : AbstractReadOnlyOperator(OperatorType::Sort, in),
+           const ChunkOffset output_chunk_size, const SortMode sort_mode)
+    : AbstractReadOnlyOperator(OperatorType::Sort, in, nullptr, std::make_unique<PerformanceData>()),
       _sort_definitions(sort_definitions),
-      _output_chunk_size(output_chunk_size) {
+      _output_chunk_size(output_chunk_size),
+      _sort_mode(sort_mode) {
   DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
 }
 
 const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
+SortMode Sort::sort_mode() const { return _sort_mode; }
+
 const std::string& Sort::name() const {
   static const auto name = std::string{"Sort"};
   return name;
@@ -116,7 +770,7 @@ const std::string& Sort::name() const {
 std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size);
+  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size, _sort_mode);
 }
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -131,40 +785,140 @@ std::shared_ptr<const Table> Sort::_on_execute() {
 
   std::shared_ptr<Table> sorted_table;
 
-  // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
-  // been determined so far. This is not a completely proper PosList on the input table as it might point to
+  const auto memory_usage_per_row = estimate_memory_usage_per_row(*input_table, _sort_definitions);
+  if (memory_budget() && input_table->row_count() * memory_usage_per_row > *memory_budget()) {
+    sorted_table = _sort_externally(input_table, *memory_budget(), memory_usage_per_row);
+  } else {
+    sorted_table = materialize_output_table(input_table, _sort(input_table), _output_chunk_size);
+  }
+
+  auto final_sort_definition = _sort_definitions[0];
+  // Set the ordered_by attribute of the output's chunks according to the most significant sort operation, which is the
+  // column the table was sorted by last.
+  const auto chunk_count = sorted_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = sorted_table->get_chunk(chunk_id);
+    chunk->finalize();
+    chunk->set_ordered_by(std::make_pair(final_sort_definition.column, final_sort_definition.order_by_mode));
+  }
+  return sorted_table;
+}
+
+RowIDPosList Sort::_sort(const std::shared_ptr<const Table>& table) const {
+  if (_sort_mode == SortMode::NormalizedKey) {
+    return sort_by_normalized_keys(table, _sort_definitions);
+  }
+
+  // After the first (least significant) sort operation has been completed, this holds the order of the table as it
+  // has been determined so far. This is not a completely proper PosList on the input table as it might point to
   // ReferenceSegments.
   auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
 
   for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const bool is_last_sorting_step = (sort_step == 0);
-
     const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
+    const auto data_type = table->column_data_type(sort_definition.column);
 
     resolve_data_type(data_type, [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
 
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.order_by_mode);
+      auto sort_impl = SortImpl<ColumnDataType>(table, sort_definition.column, sort_definition.order_by_mode);
       previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
+    });
+  }
 
-      if (is_last_sorting_step) {
-        // This is inside the for loop so that we do not have to resolve the type again
-        sorted_table = materialize_output_table(input_table, *previously_sorted_pos_list, _output_chunk_size);
-      }
+  return std::move(*previously_sorted_pos_list);
+}
+
+std::shared_ptr<Table> Sort::_sort_externally(const std::shared_ptr<const Table>& table, const size_t memory_budget,
+                                              const size_t memory_usage_per_row) {
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+
+  auto run_columns = RunColumns{};
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      run_columns.emplace_back(std::make_unique<TypedRunColumn<ColumnDataType>>());
     });
   }
 
-  auto final_sort_definition = _sort_definitions[0];
-  // Set the ordered_by attribute of the output's chunks according to the most significant sort operation, which is the
-  // column the table was sorted by last.
-  const auto chunk_count = sorted_table->chunk_count();
+  // 1. Sort runs of consecutive chunks that fit into the memory budget and spill them. A run holds at least one chunk.
+  auto runs = std::vector<std::unique_ptr<SortedRun>>{};
+  // The chunks of the current run. They are appended without their MVCC data, which the sort does not need.
+  auto run_table = std::shared_ptr<Table>{};
+
+  const auto spill_run = [&]() {
+    const auto sorted_run_table = materialize_output_table(run_table, _sort(run_table), _output_chunk_size);
+    run_table = nullptr;
+
+    auto& run = *runs.emplace_back(std::make_unique<SortedRun>());
+    const auto chunk_count = sorted_run_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      run.write_block(run_columns, get_segments(*sorted_run_table->get_chunk(chunk_id)));
+    }
+  };
+
+  const auto chunk_count = table->chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto& chunk = sorted_table->get_chunk(chunk_id);
-    chunk->finalize();
-    chunk->set_ordered_by(std::make_pair(final_sort_definition.column, final_sort_definition.order_by_mode));
+    const auto chunk = table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    if (chunk->size() == 0) continue;
+
+    if (run_table && (run_table->row_count() + chunk->size()) * memory_usage_per_row > memory_budget) {
+      spill_run();
+    }
+    if (!run_table) {
+      run_table = std::make_shared<Table>(table->column_definitions(), table->type());
+    }
+    run_table->append_chunk(get_segments(*chunk));
   }
-  return sorted_table;
+  if (run_table) spill_run();
+
+  performance_data.run_count = runs.size();
+  const auto count_spilled_bytes = [&]() {
+    for (const auto& run : runs) {
+      performance_data.spilled_bytes += run->file.size();
+    }
+  };
+
+  // 2. Merge the runs. As each merged run needs one block in memory, the number of runs that are merged at once is
+  //    limited by the memory budget. If there are more runs, consecutive runs are merged into longer runs first.
+  const auto block_memory_usage = memory_usage_per_row * _output_chunk_size;
+  const auto max_merged_run_count = std::max(size_t{2}, memory_budget / block_memory_usage);
+
+  while (runs.size() > max_merged_run_count) {
+    count_spilled_bytes();
+    ++performance_data.merge_pass_count;
+
+    auto merged_runs = std::vector<std::unique_ptr<SortedRun>>{};
+    for (auto run_index = size_t{0}; run_index < runs.size(); run_index += max_merged_run_count) {
+      const auto run_end_index = std::min(run_index + max_merged_run_count, runs.size());
+      auto runs_to_merge = std::vector<std::unique_ptr<SortedRun>>(std::make_move_iterator(runs.begin() + run_index),
+                                                                   std::make_move_iterator(runs.begin() + run_end_index));
+
+      auto& merged_run = *merged_runs.emplace_back(std::make_unique<SortedRun>());
+      merge_runs(runs_to_merge, run_columns, _sort_definitions, _output_chunk_size,
+                 [&](Segments&& segments) { merged_run.write_block(run_columns, segments); });
+    }
+    runs = std::move(merged_runs);
+  }
+
+  count_spilled_bytes();
+  ++performance_data.merge_pass_count;
+
+  auto output = std::make_shared<Table>(table->column_definitions(), TableType::Data, _output_chunk_size);
+  merge_runs(runs, run_columns, _sort_definitions, _output_chunk_size,
+             [&](Segments&& segments) { output->append_chunk(segments); });
+  return output;
+}
+
+void Sort::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData::output_to_stream(stream, description_mode);
+
+  if (spilled_bytes == 0) return;
+  stream << (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  stream << format_bytes(spilled_bytes) << " spilled to disk in " << run_count << " runs, merged in "
+         << merge_pass_count << " passes";
 }
 
 template <typename SortColumnType>
@@ -26,20 +26,46 @@ struct SortColumnDefinition final {
   const OrderByMode order_by_mode;
 };
 
+/**
+ * Defines how the Sort operator determines the order of the rows.
+ *  - Iterative: The table is sorted column by column, from the least to the most significant sort column, using one
+ *    single-threaded std::stable_sort per column.
+ *  - NormalizedKey: All sort columns are encoded into a single binary key per row, which can be compared with memcmp.
+ *    The keys are sorted with a parallel MSD radix sort.
+ */
+enum class SortMode { Iterative, NormalizedKey };
+
 /**
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
  * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ * Independent of the SortMode, the output table is materialized in parallel, one job per output chunk.
+ *
+ * If the operator has a memory budget (see AbstractOperator::memory_budget()) and sorting the input in memory is
+ * estimated to exceed it, an external merge sort is used: Consecutive input chunks that fit into the budget are sorted
+ * (using the SortMode) into runs, which are written to LZ4-compressed spill files. The runs are then merged with a
+ * k-way merge that only holds one block per run in memory. If there are too many runs for one merge, they are merged
+ * in multiple passes. The output chunks are produced by the final merge.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
-       const ChunkOffset output_chunk_size = Chunk::DEFAULT_SIZE);
+       const ChunkOffset output_chunk_size = Chunk::DEFAULT_SIZE, const SortMode sort_mode = SortMode::NormalizedKey);
 
   const std::vector<SortColumnDefinition>& sort_definitions() const;
 
+  SortMode sort_mode() const;
+
   const std::string& name() const override;
 
+  struct PerformanceData : public OperatorPerformanceData {
+    size_t spilled_bytes{0};
+    size_t run_count{0};
+    size_t merge_pass_count{0};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -47,6 +73,12 @@ class Sort : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
+  // Determines the order of the table's rows using the SortMode
+  RowIDPosList _sort(const std::shared_ptr<const Table>& table) const;
+
+  std::shared_ptr<Table> _sort_externally(const std::shared_ptr<const Table>& table, const size_t memory_budget,
+                                          const size_t memory_usage_per_row);
+
   template <typename SortColumnType>
   class SortImpl;
 
@@ -56,6 +88,8 @@ class Sort : public AbstractReadOnlyOperator {
   const std::vector<SortColumnDefinition> _sort_definitions;
 
   const ChunkOffset _output_chunk_size;
+
+  const SortMode _sort_mode;
 };
 
 }  // namespace opossum
@@ -26,6 +26,7 @@
 #include "scheduler/job_task.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
@@ -38,6 +39,25 @@
 #include "utils/lossless_predicate_cast.hpp"
 #include "utils/performance_warning.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// If a PosList references a large fraction of a single chunk, a BitmapPosList is smaller and faster to iterate than
+// the RowIDPosList. Returns the original PosList if it cannot or should not be converted.
+std::shared_ptr<const AbstractPosList> try_convert_to_bitmap_pos_list(const std::shared_ptr<RowIDPosList>& pos_list,
+                                                                      const Table& referenced_table) {
+  const auto chunk_size = referenced_table.get_chunk(pos_list->common_chunk_id())->size();
+  if (pos_list->size() < BitmapPosList::MIN_SELECTIVITY * chunk_size) return pos_list;
+
+  const auto bitmap_pos_list = BitmapPosList::from_pos_list(*pos_list, chunk_size);
+  if (!bitmap_pos_list) return pos_list;
+
+  return bitmap_pos_list;
+}
+
+}  // namespace
+
 namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
@@ -59,6 +79,9 @@ std::string TableScan::description(DescriptionMode description_mode) const {
   stream << name() << separator;
   stream << "Impl: " << _impl_description;
   stream << separator << _predicate->as_column_name();
+  for (const auto& runtime_filter : runtime_filters) {
+    stream << separator << runtime_filter->description();
+  }
 
   return stream.str();
 }
@@ -87,81 +110,122 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
 
+  // Runtime filters can only be applied if the operator they are built from has already been executed
+  auto applied_runtime_filters = std::vector<std::shared_ptr<JoinRuntimeFilter>>{};
+  for (const auto& runtime_filter : runtime_filters) {
+    if (runtime_filter->build(in_table->row_count(), in_table->column_data_type(runtime_filter->probe_column_id()))) {
+      applied_runtime_filters.emplace_back(runtime_filter);
+    }
+  }
+
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
   output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
-
-  const auto chunk_count = in_table->chunk_count();
-  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
-    const auto chunk_in = in_table->get_chunk(chunk_id);
-    Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  const auto scan_chunk = [&](const ChunkID chunk_id, const std::shared_ptr<const Chunk>& chunk_in) {
+    for (const auto& runtime_filter : applied_runtime_filters) {
+      if (runtime_filter->can_prune(*chunk_in)) return;
+    }
 
-    // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto job_task = std::make_shared<JobTask>([this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      Segments out_segments;
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (in_table->type() == TableType::References) {
-        auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
-
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
-
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
-
-          const auto pos_list_in = ref_segment_in->pos_list();
-
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
-
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-            if (pos_list_in->references_single_chunk()) {
-              filtered_pos_list->guarantee_single_chunk();
+    // The actual scan happens in the sub classes of BaseTableScanImpl
+    auto matches_out = _impl->scan_chunk(chunk_id);
+    for (const auto& runtime_filter : applied_runtime_filters) {
+      if (matches_out->empty()) break;
+      matches_out = runtime_filter->filter(*chunk_in, matches_out);
+    }
+    if (matches_out->empty()) return;
+
+    Segments out_segments;
+
+    /**
+     * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+     * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+     * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+     * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+     * between segments as much as possible. Position lists can be shared between two segments iff
+     * (a) they point to the same table and
+     * (b) the reference segments of the input table point to the same positions in the same order
+     *     (i.e. they share their position list).
+     */
+    if (in_table->type() == TableType::References) {
+      auto filtered_pos_lists =
+          std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
+
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        auto segment_in = chunk_in->get_segment(column_id);
+
+        auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+        DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+        const auto pos_list_in = ref_segment_in->pos_list();
+
+        const auto table_out = ref_segment_in->referenced_table();
+        const auto column_id_out = ref_segment_in->referenced_column_id();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          auto row_ids = std::make_shared<RowIDPosList>(matches_out->size());
+
+          size_t offset = 0;
+          if (const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in)) {
+            // The matches are usually sorted. Instead of searching the bitmap for every match, we move an iterator
+            // forward, which can skip entire words of the bitmap.
+            auto pos_list_in_it = bitmap_pos_list_in->cbegin();
+            auto pos_list_in_offset = ChunkOffset{0};
+            for (const auto& match : *matches_out) {
+              pos_list_in_it += static_cast<std::ptrdiff_t>(match.chunk_offset) - pos_list_in_offset;
+              pos_list_in_offset = match.chunk_offset;
+              (*row_ids)[offset] = *pos_list_in_it;
+              ++offset;
             }
-
-            size_t offset = 0;
+          } else {
             for (const auto& match : *matches_out) {
               const auto row_id = (*pos_list_in)[match.chunk_offset];
-              (*filtered_pos_list)[offset] = row_id;
+              (*row_ids)[offset] = row_id;
               ++offset;
             }
           }
 
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
+          filtered_pos_list = row_ids;
+          if (pos_list_in->references_single_chunk()) {
+            row_ids->guarantee_single_chunk();
+            filtered_pos_list = try_convert_to_bitmap_pos_list(row_ids, *table_out);
+          }
         }
+
+        auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+        out_segments.push_back(ref_segment_out);
+      }
+    } else {
+      matches_out->guarantee_single_chunk();
+      const auto pos_list_out = try_convert_to_bitmap_pos_list(matches_out, *in_table);
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, pos_list_out);
+        out_segments.push_back(ref_segment_out);
       }
+    }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_chunks.emplace_back(std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator()));
-    });
+    std::lock_guard<std::mutex> lock(output_mutex);
+    output_chunks.emplace_back(std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator()));
+  };
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
+  const auto chunk_count = in_table->chunk_count();
+  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
+    if (excluded_chunk_set.count(chunk_id)) continue;
+    const auto chunk_in = in_table->get_chunk(chunk_id);
+    Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    // A single chunk (e.g., a morsel of an OperatorPipeline) is scanned directly instead of scheduling a single job
+    if (chunk_count == 1) {
+      scan_chunk(chunk_id, chunk_in);
+      continue;
+    }
+
+    // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
+    auto job_task = std::make_shared<JobTask>([&scan_chunk, chunk_id, chunk_in]() { scan_chunk(chunk_id, chunk_in); });
     jobs.push_back(job_task);
     job_task->schedule();
   }
@@ -8,6 +8,7 @@
 #include "abstract_read_only_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "join_runtime_filter.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -48,6 +49,13 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::vector<ChunkID> excluded_chunk_ids;
 
+  /**
+   * Filters from the build side of a hash join that consumes the output of this scan (see JoinRuntimeFilter). Chunks
+   * that they prune are skipped, and rows that match the predicate but not the filters are removed. Like the
+   * transaction context, the filters are set per execution and are not copied by deep_copy().
+   */
+  std::vector<std::shared_ptr<JoinRuntimeFilter>> runtime_filters;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
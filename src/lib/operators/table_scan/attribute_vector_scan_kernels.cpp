@@ -0,0 +1,395 @@
+#include "attribute_vector_scan_kernels.hpp"
+
+#if defined(__AVX2__) || (defined(__AVX512F__) && defined(__AVX512BW__))
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Value IDs are scanned in batches. The offsets of the matching rows within a batch are written to a buffer that stays
+// in the L1 cache and are then appended to the output. Must be a multiple of the number of values per SIMD iteration.
+constexpr auto BATCH_SIZE = size_t{2048};
+
+// The AVX2 kernel writes eight offsets at once, even if fewer rows matched. The buffer is padded accordingly.
+constexpr auto BUFFER_PADDING = size_t{8};
+
+using OffsetBuffer = std::array<ChunkOffset, BATCH_SIZE + BUFFER_PADDING>;
+
+// Returns the number of matches written to `offsets_out`
+template <bool Inverted, typename UnsignedIntType>
+size_t scan_batch_scalar(const UnsignedIntType* value_ids, const size_t count, const ChunkOffset first_chunk_offset,
+                         const ValueIDRangePredicate& predicate, ChunkOffset* offsets_out) {
+  const auto lower_bound = predicate.lower_bound;
+  const auto range_size = predicate.upper_bound - predicate.lower_bound;
+  const auto null_value_id = predicate.null_value_id;
+
+  auto match_count = size_t{0};
+  for (auto index = size_t{0}; index < count; ++index) {
+    const auto value_id = ValueID::base_type{value_ids[index]};
+    const auto in_range = value_id - lower_bound < range_size;
+
+    // Always write the offset, but only advance the output position for a match. This avoids mispredicted branches
+    // for selectivities that are neither very high nor very low.
+    offsets_out[match_count] = first_chunk_offset + static_cast<ChunkOffset>(index);
+    if constexpr (Inverted) {
+      match_count += !in_range & (value_id < null_value_id);
+    } else {
+      match_count += in_range;
+    }
+  }
+  return match_count;
+}
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+constexpr auto VALUES_PER_ITERATION = size_t{64};
+
+// Unsigned range comparisons for a 512-bit register of value IDs. Returns one bit per value ID.
+template <typename UnsignedIntType>
+struct Avx512Lanes;
+
+template <>
+struct Avx512Lanes<uint8_t> {
+  static __m512i set1(const uint32_t value) { return _mm512_set1_epi8(static_cast<char>(value)); }
+  static __m512i sub(const __m512i lhs, const __m512i rhs) { return _mm512_sub_epi8(lhs, rhs); }
+  static __mmask64 less_than(const __m512i lhs, const __m512i rhs) { return _mm512_cmplt_epu8_mask(lhs, rhs); }
+};
+
+template <>
+struct Avx512Lanes<uint16_t> {
+  static __m512i set1(const uint32_t value) { return _mm512_set1_epi16(static_cast<int16_t>(value)); }
+  static __m512i sub(const __m512i lhs, const __m512i rhs) { return _mm512_sub_epi16(lhs, rhs); }
+  static __mmask32 less_than(const __m512i lhs, const __m512i rhs) { return _mm512_cmplt_epu16_mask(lhs, rhs); }
+};
+
+template <>
+struct Avx512Lanes<uint32_t> {
+  static __m512i set1(const uint32_t value) { return _mm512_set1_epi32(static_cast<int32_t>(value)); }
+  static __m512i sub(const __m512i lhs, const __m512i rhs) { return _mm512_sub_epi32(lhs, rhs); }
+  static __mmask16 less_than(const __m512i lhs, const __m512i rhs) { return _mm512_cmplt_epu32_mask(lhs, rhs); }
+};
+
+template <bool Inverted, typename UnsignedIntType>
+size_t scan_batch(const UnsignedIntType* value_ids, const size_t count, const ChunkOffset first_chunk_offset,
+                  const ValueIDRangePredicate& predicate, ChunkOffset* offsets_out) {
+  using Lanes = Avx512Lanes<UnsignedIntType>;
+  constexpr auto VALUES_PER_REGISTER = sizeof(__m512i) / sizeof(UnsignedIntType);
+
+  const auto lower_bound = Lanes::set1(predicate.lower_bound);
+  const auto range_size = Lanes::set1(predicate.upper_bound - predicate.lower_bound);
+  const auto null_value_id = Lanes::set1(predicate.null_value_id);
+
+  const auto iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const auto sixteen = _mm512_set1_epi32(16);
+
+  auto match_count = size_t{0};
+  auto index = size_t{0};
+  for (; index + VALUES_PER_ITERATION <= count; index += VALUES_PER_ITERATION) {
+    // Build a mask with one bit per value ID of this iteration
+    auto mask = uint64_t{0};
+    for (auto register_index = size_t{0}; register_index < VALUES_PER_ITERATION / VALUES_PER_REGISTER;
+         ++register_index) {
+      const auto values =
+          _mm512_loadu_si512(reinterpret_cast<const void*>(value_ids + index + register_index * VALUES_PER_REGISTER));
+      auto register_mask = Lanes::less_than(Lanes::sub(values, lower_bound), range_size);
+      if constexpr (Inverted) {
+        // Negate in the register's mask type so that no bits beyond VALUES_PER_REGISTER are set
+        register_mask = static_cast<decltype(register_mask)>(~register_mask & Lanes::less_than(values, null_value_id));
+      }
+      mask |= static_cast<uint64_t>(register_mask) << (register_index * VALUES_PER_REGISTER);
+    }
+
+    if (!mask) continue;
+
+    // Compress the offsets of the matching rows and write them out, 16 rows at a time
+    auto offsets = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int32_t>(first_chunk_offset + index)), iota);
+    for (; mask; mask >>= 16) {
+      const auto offsets_mask = static_cast<__mmask16>(mask & 0xFFFFu);
+      _mm512_mask_compressstoreu_epi32(offsets_out + match_count, offsets_mask, offsets);
+      match_count += __builtin_popcount(offsets_mask);
+      offsets = _mm512_add_epi32(offsets, sixteen);
+    }
+  }
+
+  return match_count + scan_batch_scalar<Inverted>(value_ids + index, count - index,
+                                                   first_chunk_offset + static_cast<ChunkOffset>(index), predicate,
+                                                   offsets_out + match_count);
+}
+
+#elif defined(__AVX2__)
+
+constexpr auto VALUES_PER_ITERATION = size_t{32};
+
+// For each 8-bit mask, the positions of the set bits, moved to the front. Used to compact eight offsets with
+// _mm256_permutevar8x32_epi32, as AVX2 has no compress instruction.
+constexpr auto COMPACTION_PERMUTATIONS = [] {
+  auto permutations = std::array<std::array<uint32_t, 8>, 256>{};
+  for (auto mask = size_t{0}; mask < 256; ++mask) {
+    auto position = size_t{0};
+    for (auto bit = uint32_t{0}; bit < 8; ++bit) {
+      if ((mask >> bit) & 1u) permutations[mask][position++] = bit;
+    }
+  }
+  return permutations;
+}();
+
+// Unsigned range comparisons for a 256-bit register of value IDs. AVX2 only has signed comparisons, so both sides are
+// biased by the sign bit first. Matching lanes are set to all ones.
+template <typename UnsignedIntType>
+struct Avx2Lanes;
+
+template <>
+struct Avx2Lanes<uint8_t> {
+  static __m256i set1(const uint32_t value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+  static __m256i sub(const __m256i lhs, const __m256i rhs) { return _mm256_sub_epi8(lhs, rhs); }
+  static __m256i less_than(const __m256i lhs, const __m256i rhs) {
+    const auto sign = _mm256_set1_epi8(static_cast<char>(0x80));
+    return _mm256_cmpgt_epi8(_mm256_xor_si256(rhs, sign), _mm256_xor_si256(lhs, sign));
+  }
+};
+
+template <>
+struct Avx2Lanes<uint16_t> {
+  static __m256i set1(const uint32_t value) { return _mm256_set1_epi16(static_cast<int16_t>(value)); }
+  static __m256i sub(const __m256i lhs, const __m256i rhs) { return _mm256_sub_epi16(lhs, rhs); }
+  static __m256i less_than(const __m256i lhs, const __m256i rhs) {
+    const auto sign = _mm256_set1_epi16(static_cast<int16_t>(0x8000));
+    return _mm256_cmpgt_epi16(_mm256_xor_si256(rhs, sign), _mm256_xor_si256(lhs, sign));
+  }
+};
+
+template <>
+struct Avx2Lanes<uint32_t> {
+  static __m256i set1(const uint32_t value) { return _mm256_set1_epi32(static_cast<int32_t>(value)); }
+  static __m256i sub(const __m256i lhs, const __m256i rhs) { return _mm256_sub_epi32(lhs, rhs); }
+  static __m256i less_than(const __m256i lhs, const __m256i rhs) {
+    const auto sign = _mm256_set1_epi32(static_cast<int32_t>(0x80000000));
+    return _mm256_cmpgt_epi32(_mm256_xor_si256(rhs, sign), _mm256_xor_si256(lhs, sign));
+  }
+};
+
+// Converts the comparison results of 32 bytes' worth of value IDs into one bit per value ID
+uint32_t to_mask(const __m256i comparison_uint8) {
+  return static_cast<uint32_t>(_mm256_movemask_epi8(comparison_uint8));
+}
+
+uint32_t to_mask(const __m256i comparison_uint16_a, const __m256i comparison_uint16_b) {
+  // Packing interleaves the 128-bit lanes of both inputs, which is undone by the permutation
+  const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(comparison_uint16_a, comparison_uint16_b), 0xD8);
+  return static_cast<uint32_t>(_mm256_movemask_epi8(packed));
+}
+
+template <bool Inverted, typename UnsignedIntType>
+__m256i compare(const UnsignedIntType* value_ids, const __m256i lower_bound, const __m256i range_size,
+                const __m256i null_value_id) {
+  using Lanes = Avx2Lanes<UnsignedIntType>;
+  const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(value_ids));
+  const auto in_range = Lanes::less_than(Lanes::sub(values, lower_bound), range_size);
+  if constexpr (Inverted) {
+    return _mm256_andnot_si256(in_range, Lanes::less_than(values, null_value_id));
+  } else {
+    return in_range;
+  }
+}
+
+template <bool Inverted, typename UnsignedIntType>
+size_t scan_batch(const UnsignedIntType* value_ids, const size_t count, const ChunkOffset first_chunk_offset,
+                  const ValueIDRangePredicate& predicate, ChunkOffset* offsets_out) {
+  using Lanes = Avx2Lanes<UnsignedIntType>;
+  constexpr auto VALUES_PER_REGISTER = sizeof(__m256i) / sizeof(UnsignedIntType);
+
+  const auto lower_bound = Lanes::set1(predicate.lower_bound);
+  const auto range_size = Lanes::set1(predicate.upper_bound - predicate.lower_bound);
+  const auto null_value_id = Lanes::set1(predicate.null_value_id);
+
+  const auto iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const auto eight = _mm256_set1_epi32(8);
+
+  auto match_count = size_t{0};
+  auto index = size_t{0};
+  for (; index + VALUES_PER_ITERATION <= count; index += VALUES_PER_ITERATION) {
+    const auto* values = value_ids + index;
+
+    // Build a mask with one bit per value ID of this iteration
+    auto mask = uint32_t{0};
+    if constexpr (std::is_same_v<UnsignedIntType, uint8_t>) {
+      mask = to_mask(compare<Inverted>(values, lower_bound, range_size, null_value_id));
+    } else if constexpr (std::is_same_v<UnsignedIntType, uint16_t>) {
+      mask = to_mask(compare<Inverted>(values, lower_bound, range_size, null_value_id),
+                     compare<Inverted>(values + VALUES_PER_REGISTER, lower_bound, range_size, null_value_id));
+    } else {
+      for (auto register_index = size_t{0}; register_index < VALUES_PER_ITERATION / VALUES_PER_REGISTER;
+           ++register_index) {
+        const auto comparison = compare<Inverted>(values + register_index * VALUES_PER_REGISTER, lower_bound,
+                                                  range_size, null_value_id);
+        mask |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(comparison)))
+                << (register_index * VALUES_PER_REGISTER);
+      }
+    }
+
+    if (!mask) continue;
+
+    // Compact the offsets of the matching rows and write them out, eight rows at a time
+    auto offsets = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int32_t>(first_chunk_offset + index)), iota);
+    for (; mask; mask >>= 8) {
+      const auto offsets_mask = mask & 0xFFu;
+      if (offsets_mask) {
+        const auto permutation =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(COMPACTION_PERMUTATIONS[offsets_mask].data()));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(offsets_out + match_count),
+                            _mm256_permutevar8x32_epi32(offsets, permutation));
+        match_count += __builtin_popcount(offsets_mask);
+      }
+      offsets = _mm256_add_epi32(offsets, eight);
+    }
+  }
+
+  return match_count + scan_batch_scalar<Inverted>(value_ids + index, count - index,
+                                                   first_chunk_offset + static_cast<ChunkOffset>(index), predicate,
+                                                   offsets_out + match_count);
+}
+
+#else
+
+template <bool Inverted, typename UnsignedIntType>
+size_t scan_batch(const UnsignedIntType* value_ids, const size_t count, const ChunkOffset first_chunk_offset,
+                  const ValueIDRangePredicate& predicate, ChunkOffset* offsets_out) {
+  return scan_batch_scalar<Inverted>(value_ids, count, first_chunk_offset, predicate, offsets_out);
+}
+
+#endif
+
+void append_matches(const OffsetBuffer& offsets, const size_t match_count, const ChunkID chunk_id,
+                    RowIDPosList& matches) {
+  const auto previous_size = matches.size();
+  matches.resize(previous_size + match_count);
+  for (auto index = size_t{0}; index < match_count; ++index) {
+    matches[previous_size + index] = RowID{chunk_id, offsets[index]};
+  }
+}
+
+template <bool Inverted, typename UnsignedIntType>
+void scan_value_ids(const UnsignedIntType* value_ids, const size_t count, const ChunkOffset first_chunk_offset,
+                    const ValueIDRangePredicate& predicate, const ChunkID chunk_id, RowIDPosList& matches,
+                    OffsetBuffer& offsets) {
+  for (auto batch_begin = size_t{0}; batch_begin < count; batch_begin += BATCH_SIZE) {
+    const auto batch_size = std::min(BATCH_SIZE, count - batch_begin);
+    const auto match_count =
+        scan_batch<Inverted>(value_ids + batch_begin, batch_size,
+                             first_chunk_offset + static_cast<ChunkOffset>(batch_begin), predicate, offsets.data());
+    append_matches(offsets, match_count, chunk_id, matches);
+  }
+}
+
+template <bool Inverted>
+void scan_simd_bp128_vector(const SimdBp128Vector& attribute_vector, const ValueIDRangePredicate& predicate,
+                            const ChunkID chunk_id, RowIDPosList& matches) {
+  using Packing = SimdBp128Packing;
+
+  const auto size = attribute_vector.size();
+  const auto* data = attribute_vector.data();
+
+  auto offsets = OffsetBuffer{};
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  alignas(16) auto unpacked_block = std::array<uint32_t, Packing::block_size>{};
+
+  for (auto meta_block_begin = size_t{0}; meta_block_begin < size; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(data, meta_info.data());
+    ++data;
+
+    for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+      if (block_begin >= size) break;
+
+      // The last block is padded with zeros, which must not be scanned
+      const auto block_size = std::min(size_t{Packing::block_size}, size - block_begin);
+      const auto first_chunk_offset = static_cast<ChunkOffset>(block_begin);
+      const auto bit_size = meta_info[block_index];
+
+      // All value IDs in the block are in [0, max_value_id]
+      const auto max_value_id = bit_size == 32 ? std::numeric_limits<uint32_t>::max() : (uint32_t{1} << bit_size) - 1;
+      const auto all_values_below_bound = [&](const auto bound) { return max_value_id < bound; };
+
+      auto all_rows_match = false;
+      auto no_row_matches = false;
+      if constexpr (Inverted) {
+        all_rows_match =
+            all_values_below_bound(predicate.lower_bound) && all_values_below_bound(predicate.null_value_id);
+      } else {
+        all_rows_match = predicate.lower_bound == 0 && all_values_below_bound(predicate.upper_bound);
+        no_row_matches =
+            all_values_below_bound(predicate.lower_bound) || predicate.lower_bound == predicate.upper_bound;
+      }
+
+      if (all_rows_match) {
+        const auto previous_size = matches.size();
+        matches.resize(previous_size + block_size);
+        for (auto index = size_t{0}; index < block_size; ++index) {
+          matches[previous_size + index] = RowID{chunk_id, first_chunk_offset + static_cast<ChunkOffset>(index)};
+        }
+      } else if (!no_row_matches) {
+        Packing::unpack_block(data, unpacked_block.data(), bit_size);
+        scan_value_ids<Inverted>(unpacked_block.data(), block_size, first_chunk_offset, predicate, chunk_id, matches,
+                                 offsets);
+      }
+
+      data += bit_size;
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename UnsignedIntType>
+void scan_attribute_vector(const FixedSizeByteAlignedVector<UnsignedIntType>& attribute_vector,
+                           const ValueIDRangePredicate& predicate, const ChunkID chunk_id, RowIDPosList& matches) {
+  DebugAssert(predicate.lower_bound <= predicate.upper_bound, "Invalid value ID range");
+  DebugAssert(predicate.upper_bound <= predicate.null_value_id, "Value ID range must not include the NULL value ID");
+  DebugAssert(predicate.null_value_id <= std::numeric_limits<UnsignedIntType>::max(),
+              "NULL value ID exceeds the width of the attribute vector");
+
+  auto offsets = OffsetBuffer{};
+  if (predicate.inverted) {
+    scan_value_ids<true>(attribute_vector.data(), attribute_vector.size(), ChunkOffset{0}, predicate, chunk_id,
+                         matches, offsets);
+  } else {
+    scan_value_ids<false>(attribute_vector.data(), attribute_vector.size(), ChunkOffset{0}, predicate, chunk_id,
+                          matches, offsets);
+  }
+}
+
+void scan_attribute_vector(const SimdBp128Vector& attribute_vector, const ValueIDRangePredicate& predicate,
+                           const ChunkID chunk_id, RowIDPosList& matches) {
+  DebugAssert(predicate.lower_bound <= predicate.upper_bound, "Invalid value ID range");
+  DebugAssert(predicate.upper_bound <= predicate.null_value_id, "Value ID range must not include the NULL value ID");
+
+  if (predicate.inverted) {
+    scan_simd_bp128_vector<true>(attribute_vector, predicate, chunk_id, matches);
+  } else {
+    scan_simd_bp128_vector<false>(attribute_vector, predicate, chunk_id, matches);
+  }
+}
+
+template void scan_attribute_vector(const FixedSizeByteAlignedVector<uint8_t>& attribute_vector,
+                                    const ValueIDRangePredicate& predicate, const ChunkID chunk_id,
+                                    RowIDPosList& matches);
+template void scan_attribute_vector(const FixedSizeByteAlignedVector<uint16_t>& attribute_vector,
+                                    const ValueIDRangePredicate& predicate, const ChunkID chunk_id,
+                                    RowIDPosList& matches);
+template void scan_attribute_vector(const FixedSizeByteAlignedVector<uint32_t>& attribute_vector,
+                                    const ValueIDRangePredicate& predicate, const ChunkID chunk_id,
+                                    RowIDPosList& matches);
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/pos_lists/rowid_pos_list.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Predicate on the value IDs of a dictionary segment's attribute vector. Comparisons of a dictionary-encoded column
+ * with a value (see ColumnVsValueTableScanImpl) can be expressed as a value ID range: A value ID matches if it lies
+ * within [lower_bound, upper_bound) or, if the predicate is inverted (used for NotEquals), outside of it. The NULL
+ * value ID never matches.
+ */
+struct ValueIDRangePredicate {
+  ValueID::base_type lower_bound;
+  ValueID::base_type upper_bound;
+  bool inverted;
+  ValueID::base_type null_value_id;
+
+  bool matches(const ValueID::base_type value_id) const {
+    const auto in_range = value_id - lower_bound < upper_bound - lower_bound;
+    return inverted ? !in_range && value_id < null_value_id : in_range;
+  }
+};
+
+/**
+ * Kernels that scan an attribute vector for a ValueIDRangePredicate and append the RowIDs of all matching rows to
+ * `matches`. They replace the element-wise iteration through segment iterables for the common case of scanning a
+ * complete dictionary segment (i.e., without a position filter).
+ *
+ * The kernels compare a full SIMD register of value IDs at once, producing a bit mask of matches. Blocks without
+ * matches are skipped. For the others, the chunk offsets of the matching rows are compacted (via VPCOMPRESSD on
+ * AVX-512 or a permutation lookup table on AVX2) and written out without branches. Which kernel is used is decided
+ * at compile time (Hyrise is built with -march=native for release builds). A branch-free scalar loop is used if
+ * neither AVX2 nor AVX-512 BW are available and for the remainder that does not fill a full register.
+ *
+ * For SIMD-BP128-compressed attribute vectors, the bit width of each packed block of 128 value IDs bounds the value
+ * IDs in it. Blocks in which all or no rows match are handled without unpacking them. The other blocks are unpacked
+ * into a small buffer, which is then scanned using the 32-bit kernel.
+ */
+template <typename UnsignedIntType>
+void scan_attribute_vector(const FixedSizeByteAlignedVector<UnsignedIntType>& attribute_vector,
+                           const ValueIDRangePredicate& predicate, const ChunkID chunk_id, RowIDPosList& matches);
+
+void scan_attribute_vector(const SimdBp128Vector& attribute_vector, const ValueIDRangePredicate& predicate,
+                           const ChunkID chunk_id, RowIDPosList& matches);
+
+}  // namespace opossum
@@ -10,6 +10,7 @@
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -120,6 +121,16 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  if (!position_filter) {
+    // Without a position filter, all value IDs of the attribute vector are scanned, which the SIMD kernels handle
+    // much faster than the iterators below
+    const auto value_id_range_predicate = _get_value_id_range_predicate(segment, search_value_id);
+    resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+      scan_attribute_vector(attribute_vector, value_id_range_predicate, chunk_id, matches);
+    });
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -226,4 +237,30 @@ bool ColumnVsValueTableScanImpl::_value_matches_none(const BaseDictionarySegment
   }
 }
 
+ValueIDRangePredicate ColumnVsValueTableScanImpl::_get_value_id_range_predicate(
+    const BaseDictionarySegment& segment, const ValueID search_value_id) const {
+  // See the table in _scan_dictionary_segment(). The early outs guarantee that search_value_id is a valid value ID.
+  const auto null_value_id = static_cast<ValueID::base_type>(segment.null_value_id());
+  const auto search_value_id_base = static_cast<ValueID::base_type>(search_value_id);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return {search_value_id_base, search_value_id_base + 1, false, null_value_id};
+
+    case PredicateCondition::NotEquals:
+      return {search_value_id_base, search_value_id_base + 1, true, null_value_id};
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      return {0, search_value_id_base, false, null_value_id};
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return {search_value_id_base, null_value_id, false, null_value_id};
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
 }  // namespace opossum
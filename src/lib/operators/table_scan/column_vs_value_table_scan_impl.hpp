@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
+#include "attribute_vector_scan_kernels.hpp"
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
@@ -20,7 +21,8 @@ namespace opossum {
  * - Value segments are scanned sequentially
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   enables us to detect if all or none of the values in the segment satisfy the expression. Complete attribute
+ *   vectors (i.e., without a position filter) are scanned using SIMD kernels (see attribute_vector_scan_kernels.hpp).
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -55,6 +57,9 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
 
   bool _value_matches_none(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
 
+  ValueIDRangePredicate _get_value_id_range_predicate(const BaseDictionarySegment& segment,
+                                                      const ValueID search_value_id) const;
+
   template <typename Functor>
   void _with_operator_for_dict_segment_scan(const Functor& func) const {
     switch (predicate_condition) {
@@ -0,0 +1,289 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Materialized values of one sort column for a set of rows
+class SortColumnValues {
+ public:
+  virtual ~SortColumnValues() = default;
+
+  // Returns a negative number if the row at left_index is ordered before the row at right_index, 0 if both are equal,
+  // and a positive number otherwise.
+  virtual int compare(const size_t left_index, const size_t right_index) const = 0;
+};
+
+template <typename ColumnDataType>
+class TypedSortColumnValues : public SortColumnValues {
+ public:
+  TypedSortColumnValues(const OrderByMode order_by_mode, const size_t row_count)
+      : _values(row_count),
+        _nulls(row_count),
+        _nulls_first(order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending),
+        _descending(order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast) {}
+
+  void set(const size_t index, const std::optional<ColumnDataType>& value) {
+    _nulls[index] = !value;
+    if (value) {
+      _values[index] = *value;
+    }
+  }
+
+  int compare(const size_t left_index, const size_t right_index) const override {
+    const auto left_is_null = _nulls[left_index];
+    const auto right_is_null = _nulls[right_index];
+    if (left_is_null || right_is_null) {
+      if (left_is_null && right_is_null) return 0;
+      return (left_is_null == _nulls_first) ? -1 : 1;
+    }
+
+    const auto& left_value = _values[left_index];
+    const auto& right_value = _values[right_index];
+    if (left_value == right_value) return 0;
+    return ((left_value < right_value) != _descending) ? -1 : 1;
+  }
+
+ protected:
+  std::vector<ColumnDataType> _values;
+  std::vector<bool> _nulls;
+  const bool _nulls_first;
+  const bool _descending;
+};
+
+using SortKeyValues = std::vector<std::unique_ptr<SortColumnValues>>;
+
+// Orders two rows by their sort column values. Rows with equal values are ordered by their index, which keeps the
+// result stable as long as the indexes follow the input order.
+bool row_is_ordered_before(const SortKeyValues& sort_key_values, const size_t left_index, const size_t right_index) {
+  for (const auto& column_values : sort_key_values) {
+    const auto result = column_values->compare(left_index, right_index);
+    if (result != 0) return result < 0;
+  }
+  return left_index < right_index;
+}
+
+// Materializes the sort columns of all rows of a chunk, indexed by their ChunkOffset
+SortKeyValues materialize_chunk(const Chunk& chunk, const std::vector<SortColumnDefinition>& sort_definitions,
+                                const Table& table) {
+  auto sort_key_values = SortKeyValues{};
+  sort_key_values.reserve(sort_definitions.size());
+
+  for (const auto& sort_definition : sort_definitions) {
+    resolve_data_type(table.column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto column_values =
+          std::make_unique<TypedSortColumnValues<ColumnDataType>>(sort_definition.order_by_mode, chunk.size());
+      segment_iterate<ColumnDataType>(*chunk.get_segment(sort_definition.column), [&](const auto& position) {
+        if (position.is_null()) {
+          column_values->set(position.chunk_offset(), std::nullopt);
+        } else {
+          column_values->set(position.chunk_offset(), position.value());
+        }
+      });
+      sort_key_values.emplace_back(std::move(column_values));
+    });
+  }
+
+  return sort_key_values;
+}
+
+// Materializes the sort columns of the given rows, indexed by their position in row_ids
+SortKeyValues materialize_rows(const Table& table, const std::vector<RowID>& row_ids,
+                               const std::vector<SortColumnDefinition>& sort_definitions) {
+  auto sort_key_values = SortKeyValues{};
+  sort_key_values.reserve(sort_definitions.size());
+
+  for (const auto& sort_definition : sort_definitions) {
+    resolve_data_type(table.column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto column_values =
+          std::make_unique<TypedSortColumnValues<ColumnDataType>>(sort_definition.order_by_mode, row_ids.size());
+      auto accessor_by_chunk_id =
+          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(table.chunk_count());
+      for (auto index = size_t{0}; index < row_ids.size(); ++index) {
+        const auto [chunk_id, chunk_offset] = row_ids[index];
+        auto& accessor = accessor_by_chunk_id[chunk_id];
+        if (!accessor) {
+          accessor =
+              create_segment_accessor<ColumnDataType>(table.get_chunk(chunk_id)->get_segment(sort_definition.column));
+        }
+        column_values->set(index, accessor->access(chunk_offset));
+      }
+      sort_key_values.emplace_back(std::move(column_values));
+    });
+  }
+
+  return sort_key_values;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t k)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in), _sort_definitions(sort_definitions), _k(k) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+size_t TopK::k() const { return _k; }
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "k: " << _k;
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopK>(copied_input_left, _sort_definitions, _k);
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = input_table_left();
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column != INVALID_COLUMN_ID, "TopK: Invalid column in sort definition");
+    Assert(sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count");
+  }
+
+  // Like Sort, TopK returns a data table without MVCC data
+  auto output = std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+  if (_k == 0) return output;
+
+  // 1. Determine the k best rows of each chunk. Each job keeps a max-heap of ChunkOffsets, so that the front element
+  //    is the worst of the current candidates and can be replaced by any row that is ordered before it.
+  const auto chunk_count = input_table->chunk_count();
+  auto candidates_by_chunk = std::vector<std::vector<RowID>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      const auto sort_key_values = materialize_chunk(*chunk, _sort_definitions, *input_table);
+      const auto is_ordered_before = [&](const ChunkOffset left, const ChunkOffset right) {
+        return row_is_ordered_before(sort_key_values, left, right);
+      };
+
+      auto heap = std::vector<ChunkOffset>{};
+      heap.reserve(std::min(_k, static_cast<size_t>(chunk->size())));
+
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (heap.size() < _k) {
+          heap.push_back(chunk_offset);
+          std::push_heap(heap.begin(), heap.end(), is_ordered_before);
+        } else if (is_ordered_before(chunk_offset, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), is_ordered_before);
+          heap.back() = chunk_offset;
+          std::push_heap(heap.begin(), heap.end(), is_ordered_before);
+        }
+      }
+
+      // Keep the candidates in input order, so that the merge can break ties by the candidates' positions
+      std::sort(heap.begin(), heap.end());
+
+      auto& candidates = candidates_by_chunk[chunk_id];
+      candidates.reserve(heap.size());
+      for (const auto chunk_offset : heap) {
+        candidates.push_back(RowID{chunk_id, chunk_offset});
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // 2. Merge the candidates of all chunks and select the k best rows
+  auto candidates = std::vector<RowID>{};
+  for (const auto& chunk_candidates : candidates_by_chunk) {
+    candidates.insert(candidates.end(), chunk_candidates.begin(), chunk_candidates.end());
+  }
+
+  const auto sort_key_values = materialize_rows(*input_table, candidates, _sort_definitions);
+  auto candidate_indexes = std::vector<size_t>(candidates.size());
+  std::iota(candidate_indexes.begin(), candidate_indexes.end(), size_t{0});
+
+  const auto output_row_count = std::min(_k, candidates.size());
+  std::partial_sort(candidate_indexes.begin(), candidate_indexes.begin() + output_row_count, candidate_indexes.end(),
+                    [&](const size_t left, const size_t right) {
+                      return row_is_ordered_before(sort_key_values, left, right);
+                    });
+
+  // 3. Materialize the output in chunks of at most Chunk::DEFAULT_SIZE rows
+  const auto column_count = input_table->column_count();
+  for (auto chunk_begin = size_t{0}; chunk_begin < output_row_count; chunk_begin += Chunk::DEFAULT_SIZE) {
+    const auto chunk_end = std::min(chunk_begin + Chunk::DEFAULT_SIZE, output_row_count);
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto values = pmr_vector<ColumnDataType>(chunk_end - chunk_begin);
+        auto nulls = pmr_vector<bool>(chunk_end - chunk_begin);
+
+        auto accessor_by_chunk_id =
+            std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(chunk_count);
+        for (auto output_index = chunk_begin; output_index < chunk_end; ++output_index) {
+          const auto [chunk_id, chunk_offset] = candidates[candidate_indexes[output_index]];
+          auto& accessor = accessor_by_chunk_id[chunk_id];
+          if (!accessor) {
+            accessor =
+                create_segment_accessor<ColumnDataType>(input_table->get_chunk(chunk_id)->get_segment(column_id));
+          }
+
+          const auto typed_value = accessor->access(chunk_offset);
+          nulls[output_index - chunk_begin] = !typed_value;
+          if (typed_value) {
+            values[output_index - chunk_begin] = *typed_value;
+          }
+        }
+
+        output_segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls)));
+      });
+    }
+    output->append_chunk(output_segments);
+
+    const auto& chunk = output->last_chunk();
+    chunk->finalize();
+    chunk->set_ordered_by(std::make_pair(_sort_definitions[0].column, _sort_definitions[0].order_by_mode));
+  }
+
+  return output;
+}
+
+}  // namespace opossum
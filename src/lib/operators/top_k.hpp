@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "operators/sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first k rows of its input according to the given sort definitions, i.e., it implements
+ * ORDER BY ... LIMIT k without sorting and materializing the entire input.
+ *
+ * Each input chunk is processed by a separate job that keeps the chunk's best k rows in a bounded heap. Afterwards,
+ * the candidates of all chunks are merged and the k best rows are materialized in sort order. Rows with equal sort
+ * values keep their relative order from the input, so the result equals that of a (stable) Sort followed by a Limit.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t k);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  size_t k() const;
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+
+  const size_t _k;
+};
+
+}  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -9,6 +10,7 @@
 #include <vector>
 
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -78,6 +80,11 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  const auto bitmap_result = _union_bitmap_pos_lists();
+  if (bitmap_result) {
+    return bitmap_result;
+  }
+
   const auto& left_input_table = *input_table_left();
 
   /**
@@ -312,6 +319,50 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_bitmap_pos_lists() const {
+  // A single ColumnCluster means that all segments of a chunk share their PosList
+  if (_column_cluster_offsets.size() != 1) {
+    return nullptr;
+  }
+
+  // Combine the BitmapPosLists of all chunks that reference the same chunk. The map keeps them sorted by ChunkID, so
+  // that the output is sorted by RowID, just as the output of the merge in _on_execute().
+  auto bitmap_pos_lists = std::map<ChunkID, std::shared_ptr<const BitmapPosList>>{};
+  for (const auto& input_table : {input_table_left(), input_table_right()}) {
+    const auto chunk_count = input_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment = input_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      const auto ref_segment = std::static_pointer_cast<const ReferenceSegment>(segment);
+      const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(ref_segment->pos_list());
+      if (!bitmap_pos_list) {
+        return nullptr;
+      }
+
+      auto& combined_pos_list = bitmap_pos_lists[bitmap_pos_list->common_chunk_id()];
+      if (combined_pos_list) {
+        combined_pos_list = BitmapPosList::bitwise_or(*combined_pos_list, *bitmap_pos_list);
+      } else {
+        combined_pos_list = bitmap_pos_list;
+      }
+    }
+  }
+
+  const auto& left_input_table = *input_table_left();
+  auto out_table = std::make_shared<Table>(left_input_table.column_definitions(), TableType::References);
+  for (const auto& [referenced_chunk_id, pos_list] : bitmap_pos_lists) {
+    if (pos_list->empty()) continue;
+
+    Segments output_segments;
+    for (auto column_id = ColumnID{0}; column_id < left_input_table.column_count(); ++column_id) {
+      output_segments.push_back(
+          std::make_shared<ReferenceSegment>(_referenced_tables.front(), _referenced_column_ids[column_id], pos_list));
+    }
+    out_table->append_chunk(output_segments);
+  }
+
+  return out_table;
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
@@ -107,6 +107,15 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * If all chunks of both input tables share a single BitmapPosList across their segments, the union is computed by
+   * combining the bitmaps that reference the same chunk with a bitwise OR. Neither ReferenceMatrices nor sorting are
+   * needed in this case. The output contains one chunk per referenced chunk.
+   *
+   * @returns the result table or nullptr if the inputs do not qualify for this
+   */
+  std::shared_ptr<const Table> _union_bitmap_pos_lists() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
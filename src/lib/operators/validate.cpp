@@ -1,5 +1,6 @@
 #include "validate.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,7 +10,9 @@
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
@@ -25,6 +28,53 @@ bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOff
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+// Returns whether a row is visible if the current transaction has neither inserted nor locked it, i.e., if its TID
+// does not need to be considered.
+bool is_committed_row_visible(CommitID snapshot_commit_id, ChunkOffset chunk_offset, const MvccData& mvcc_data) {
+  return mvcc_data.get_begin_cid(chunk_offset) <= snapshot_commit_id &&
+         snapshot_commit_id < mvcc_data.get_end_cid(chunk_offset);
+}
+
+// Returns a PosList with the positions of the given PosList that are visible. If all positions are visible, the given
+// PosList is returned so that it does not have to be rewritten. Otherwise, the positions preceding the first invisible
+// one are copied at once.
+template <typename IsVisible>
+std::shared_ptr<const AbstractPosList> filter_positions(const std::shared_ptr<const AbstractPosList>& pos_list_in,
+                                                         const IsVisible& is_visible) {
+  const auto end = pos_list_in->cend();
+  auto iter = std::find_if_not(pos_list_in->cbegin(), end, is_visible);
+  if (iter == end) return pos_list_in;
+
+  auto pos_list_out = RowIDPosList(pos_list_in->cbegin(), iter);
+  pos_list_out.reserve(pos_list_in->size());
+  for (++iter; iter != end; ++iter) {
+    const auto row_id = *iter;
+    if (is_visible(row_id)) pos_list_out.emplace_back(row_id);
+  }
+
+  if (pos_list_in->references_single_chunk()) pos_list_out.guarantee_single_chunk();
+  return std::make_shared<const RowIDPosList>(std::move(pos_list_out));
+}
+
+// Computes the bitwise AND of the given bitmap and the visibility of the rows of a chunk, i.e., clears the bits of
+// all rows that are not visible. Only the rows whose bits are set are checked.
+void remove_invisible_rows(std::vector<BitmapPosList::Word>& words, TransactionID our_tid,
+                           CommitID snapshot_commit_id, const MvccData& mvcc_data) {
+  const auto word_count = words.size();
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    auto remaining_bits = words[word_index];
+    auto visible_bits = BitmapPosList::Word{0};
+    while (remaining_bits != 0) {
+      const auto bit = __builtin_ctzll(remaining_bits);
+      remaining_bits &= remaining_bits - 1;
+
+      const auto chunk_offset = static_cast<ChunkOffset>(word_index * BitmapPosList::BITS_PER_WORD + bit);
+      visible_bits |= BitmapPosList::Word{is_row_visible(our_tid, snapshot_commit_id, chunk_offset, mvcc_data)} << bit;
+    }
+    words[word_index] = visible_bits;
+  }
+}
+
 }  // namespace
 
 bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
@@ -53,6 +103,31 @@ bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chun
   return snapshot_commit_id >= max_begin_cid && chunk->invalid_row_count() == 0;
 }
 
+bool Validate::_is_entire_chunk_invisible(const std::shared_ptr<const Chunk>& chunk,
+                                          const CommitID snapshot_commit_id) const {
+  Assert(
+      _can_use_chunk_shortcut,
+      "This call to _is_entire_chunk_invisible is not allowed. Are there any DeleteOperators in the same transaction?");
+  DebugAssert(!std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0})),
+              "_is_entire_chunk_invisible cannot be called on reference chunks.");
+
+  const auto& mvcc_data = chunk->mvcc_data();
+  const auto min_begin_cid = mvcc_data->min_begin_cid;
+  if (!min_begin_cid) return false;
+
+  // Either all rows were inserted after the snapshot was taken or all of them were invalidated before. As
+  // set_end_cid() raises max_end_cid before the invalid_row_count is increased, max_end_cid covers all invalidations
+  // that have been counted.
+  if (snapshot_commit_id < *min_begin_cid) return true;
+  return chunk->invalid_row_count() == chunk->size() && mvcc_data->max_end_cid() <= snapshot_commit_id;
+}
+
+bool Validate::_can_use_committed_rows_kernel(const std::shared_ptr<const Chunk>& chunk) const {
+  // All rows of a finalized chunk have been committed (or rolled back) by their inserters. As the current transaction
+  // does not delete any rows either, no row carries our TID and only the commit ids need to be compared.
+  return _can_use_chunk_shortcut && chunk->mvcc_data()->max_begin_cid.has_value();
+}
+
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
     : AbstractReadOnlyOperator(OperatorType::Validate, in) {}
 
@@ -172,37 +247,56 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         if (_can_use_chunk_shortcut && _is_entire_chunk_visible(referenced_chunk, snapshot_commit_id)) {
           // We can reuse the old PosList since it is entirely visible.
           pos_list_out = pos_list_in;
-        } else {
-          RowIDPosList temp_pos_list;
-          temp_pos_list.guarantee_single_chunk();
-          for (auto row_id : *pos_list_in) {
-            if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-              temp_pos_list.emplace_back(row_id);
-            }
+        } else if (_can_use_chunk_shortcut && _is_entire_chunk_invisible(referenced_chunk, snapshot_commit_id)) {
+          // Keep the empty PosList, the chunk is dropped below.
+        } else if (const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in)) {
+          // Combine the bitmap with the visibility of the rows instead of materializing the visible RowIDs.
+          auto words = bitmap_pos_list_in->words();
+          if (_can_use_committed_rows_kernel(referenced_chunk)) {
+            mvcc_data->remove_invisible_committed_rows(words, snapshot_commit_id);
+          } else {
+            remove_invisible_rows(words, our_tid, snapshot_commit_id, *mvcc_data);
           }
-          pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+
+          if (words == bitmap_pos_list_in->words()) {
+            pos_list_out = pos_list_in;
+          } else {
+            pos_list_out = std::make_shared<const BitmapPosList>(pos_list_in->common_chunk_id(),
+                                                                 bitmap_pos_list_in->chunk_size(), std::move(words));
+          }
+        } else if (_can_use_committed_rows_kernel(referenced_chunk)) {
+          pos_list_out = filter_positions(pos_list_in, [&](const auto& row_id) {
+            return is_committed_row_visible(snapshot_commit_id, row_id.chunk_offset, *mvcc_data);
+          });
+        } else {
+          pos_list_out = filter_positions(pos_list_in, [&](const auto& row_id) {
+            return opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data);
+          });
         }
       } else {
         // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every row.
-        RowIDPosList temp_pos_list;
-        for (auto row_id : *pos_list_in) {
+        pos_list_out = filter_positions(pos_list_in, [&](const auto& row_id) {
           const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
-
-          auto mvcc_data = referenced_chunk->mvcc_data();
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            temp_pos_list.emplace_back(row_id);
-          }
-        }
-        pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+          return opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset,
+                                         *referenced_chunk->mvcc_data());
+        });
       }
 
-      // Construct the actual ReferenceSegment objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto reference_segment =
-            std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
-        const auto referenced_column_id = reference_segment->referenced_column_id();
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+      if (pos_list_out == pos_list_in) {
+        // Nothing was filtered, so the input segments can be forwarded instead of creating identical ones.
+        for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+          output_segments.push_back(chunk_in->get_segment(column_id));
+        }
+      } else {
+        // Construct the actual ReferenceSegment objects and add them to the chunk.
+        for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+          const auto reference_segment =
+              std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
+          const auto referenced_column_id = reference_segment->referenced_column_id();
+          auto ref_segment_out =
+              std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
+          output_segments.push_back(ref_segment_out);
+        }
       }
 
       // Otherwise we have a non-reference Segment and simply iterate over all rows to build a poslist.
@@ -213,18 +307,36 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
 
       if (_can_use_chunk_shortcut && _is_entire_chunk_visible(chunk_in, snapshot_commit_id)) {
         pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
+      } else if (_can_use_chunk_shortcut && _is_entire_chunk_invisible(chunk_in, snapshot_commit_id)) {
+        // Keep the empty PosList, the chunk is dropped below.
       } else {
         const auto mvcc_data = chunk_in->mvcc_data();
-        RowIDPosList temp_pos_list;
-        temp_pos_list.guarantee_single_chunk();
-        // Generate pos_list_out.
-        auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-        for (auto i = 0u; i < chunk_size; i++) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-            temp_pos_list.emplace_back(RowID{chunk_id, i});
-          }
+        const auto chunk_size = chunk_in->size();
+
+        // Start with a bitmap of all rows and remove the invisible ones
+        const auto word_count = (size_t{chunk_size} + BitmapPosList::BITS_PER_WORD - 1) / BitmapPosList::BITS_PER_WORD;
+        auto words = std::vector<BitmapPosList::Word>(word_count, ~BitmapPosList::Word{0});
+        if (chunk_size % BitmapPosList::BITS_PER_WORD != 0) {
+          words.back() >>= BitmapPosList::BITS_PER_WORD - chunk_size % BitmapPosList::BITS_PER_WORD;
+        }
+        if (_can_use_committed_rows_kernel(chunk_in)) {
+          mvcc_data->remove_invisible_committed_rows(words, snapshot_commit_id);
+        } else {
+          remove_invisible_rows(words, our_tid, snapshot_commit_id, *mvcc_data);
+        }
+        const auto bitmap_pos_list = std::make_shared<const BitmapPosList>(chunk_id, chunk_size, std::move(words));
+
+        // Use the bitmap only if enough rows are visible, otherwise, a RowIDPosList is smaller. If all rows are
+        // visible, an EntireChunkPosList is cheaper to iterate.
+        if (bitmap_pos_list->size() == chunk_size) {
+          pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_size);
+        } else if (bitmap_pos_list->size() >= BitmapPosList::MIN_SELECTIVITY * chunk_size) {
+          pos_list_out = bitmap_pos_list;
+        } else {
+          auto temp_pos_list = RowIDPosList(bitmap_pos_list->cbegin(), bitmap_pos_list->cend());
+          temp_pos_list.guarantee_single_chunk();
+          pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
         }
-        pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
       }
 
       // Create actual ReferenceSegment objects.
@@ -37,6 +37,14 @@ class Validate : public AbstractReadOnlyOperator {
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
+  // Counterpart of _is_entire_chunk_visible, uses the minimum begin_cid and maximum end_cid of the chunk's MvccData
+  // to identify chunks none of whose rows are visible.
+  bool _is_entire_chunk_invisible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
+
+  // Returns whether the visibility of the chunk's rows can be determined from the commit ids alone, which allows
+  // using MvccData::remove_invisible_committed_rows.
+  bool _can_use_committed_rows_kernel(const std::shared_ptr<const Chunk>& chunk) const;
+
   bool _can_use_chunk_shortcut = true;
 
  protected:
@@ -89,8 +89,9 @@ void collect_subquery_expressions_by_lqp(SubqueryExpressionsByLQP& subquery_expr
 
 namespace opossum {
 
-std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
-  const auto optimizer = std::make_shared<Optimizer>();
+std::shared_ptr<Optimizer> Optimizer::create_default_optimizer(
+    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  const auto optimizer = std::make_shared<Optimizer>(cost_estimator);
 
   optimizer->add_rule(std::make_unique<DependentGroupByReductionRule>());
 
@@ -22,7 +22,9 @@ class AbstractLQPNode;
  */
 class Optimizer final {
  public:
-  static std::shared_ptr<Optimizer> create_default_optimizer();
+  static std::shared_ptr<Optimizer> create_default_optimizer(
+      const std::shared_ptr<AbstractCostEstimator>& cost_estimator =
+          std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()));
 
   explicit Optimizer(const std::shared_ptr<AbstractCostEstimator>& cost_estimator =
                          std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()));
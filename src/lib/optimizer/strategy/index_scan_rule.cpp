@@ -9,14 +9,22 @@
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/primary_key_index.hpp"
 #include "utils/assert.hpp"
 
+using namespace opossum::expression_functional;  // NOLINT
+
 namespace opossum {
 
 // Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
@@ -32,6 +40,18 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
+  auto stored_table_nodes = std::vector<std::shared_ptr<StoredTableNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      stored_table_nodes.emplace_back(std::static_pointer_cast<StoredTableNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& stored_table_node : stored_table_nodes) {
+    _apply_to_primary_key_lookup(stored_table_node);
+  }
+
   visit_lqp(root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
       const auto& child = node->left_input();
@@ -85,4 +105,68 @@ bool IndexScanRule::_is_single_segment_index(const IndexStatistics& index_statis
   return index_statistics.column_ids.size() == 1;
 }
 
+void IndexScanRule::_apply_to_primary_key_lookup(const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto& primary_key_index = table->primary_key_index();
+  if (!primary_key_index) return;
+
+  const auto& primary_key_column_ids = primary_key_index->column_ids();
+
+  // Look for `<primary key column> = <value>` predicates in the chain of PredicateNodes above the table
+  auto key_predicates = std::vector<std::shared_ptr<AbstractExpression>>(primary_key_column_ids.size());
+  auto key_predicate_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+
+  auto node = std::static_pointer_cast<AbstractLQPNode>(stored_table_node);
+  while (node->output_count() == 1) {
+    const auto output = node->outputs()[0];
+    if (output->type != LQPNodeType::Predicate || output->left_input() != node) break;
+    node = output;
+
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate());
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) continue;
+
+    auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+    auto value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->right_operand());
+    if (!column_expression) {
+      column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+      value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->left_operand());
+    }
+    if (!column_expression || !value_expression || variant_is_null(value_expression->value)) continue;
+    if (column_expression->column_reference.original_node() != stored_table_node) continue;
+
+    const auto key_column_iter = std::find(primary_key_column_ids.begin(), primary_key_column_ids.end(),
+                                           column_expression->column_reference.original_column_id());
+    if (key_column_iter == primary_key_column_ids.end()) continue;
+
+    // If a column is compared to multiple values (e.g., `a = 1 AND a = 2`), the others remain regular predicates
+    auto& key_predicate = key_predicates[std::distance(primary_key_column_ids.begin(), key_column_iter)];
+    if (key_predicate) continue;
+
+    key_predicate = equals_(column_expression, value_expression);
+    key_predicate_nodes.emplace_back(node);
+  }
+
+  if (std::any_of(key_predicates.begin(), key_predicates.end(), [](const auto& predicate) { return !predicate; })) {
+    return;
+  }
+
+  // Replace the PredicateNodes with a single one directly above the table. Its predicates are ordered like the primary
+  // key columns, which is expected by the LQPTranslator.
+  auto merged_predicate = key_predicates.front();
+  for (auto key_index = size_t{1}; key_index < key_predicates.size(); ++key_index) {
+    merged_predicate = and_(merged_predicate, key_predicates[key_index]);
+  }
+
+  for (const auto& key_predicate_node : key_predicate_nodes) {
+    lqp_remove_node(key_predicate_node);
+  }
+
+  const auto index_scan_node = PredicateNode::make(merged_predicate);
+  index_scan_node->scan_type = ScanType::IndexScan;
+
+  const auto output = stored_table_node->outputs()[0];
+  lqp_insert_node(output, stored_table_node->get_input_side(output), index_scan_node);
+}
+
 }  // namespace opossum
@@ -12,6 +12,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -23,6 +24,10 @@ class PredicateNode;
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
  * Currently, only GroupKeyIndexes are supported.
+ *
+ * Independently of the selectivity, point lookups on a table with a PrimaryKeyIndex (i.e., equality predicates that
+ * compare every primary key column to a value) are executed as an IndexScan on that index. For this, the respective
+ * PredicateNodes directly above the StoredTableNode are merged into a single PredicateNode.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,6 +38,7 @@ class IndexScanRule : public AbstractRule {
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
   static bool _is_single_segment_index(const IndexStatistics& index_statistics);
+  static void _apply_to_primary_key_lookup(const std::shared_ptr<StoredTableNode>& stored_table_node);
 };
 
 }  // namespace opossum
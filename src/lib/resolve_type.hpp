@@ -16,6 +16,7 @@
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 
 namespace opossum {
@@ -138,6 +139,8 @@ void resolve_pos_list_type(const std::shared_ptr<const AbstractPosList>& untyped
     func(rowid_pos_list);
   } else if (auto entire_chunk_pos_list = std::dynamic_pointer_cast<const EntireChunkPosList>(untyped_pos_list)) {
     func(entire_chunk_pos_list);
+  } else if (auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(untyped_pos_list)) {
+    func(bitmap_pos_list);
   } else {
     Fail("Unrecognized PosList type encountered");
   }
@@ -7,6 +7,7 @@
 
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
+#include "task_deque.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
@@ -15,7 +16,9 @@
 
 namespace opossum {
 
-NodeQueueScheduler::NodeQueueScheduler() { _worker_id_allocator = std::make_shared<UidAllocator>(); }
+NodeQueueScheduler::NodeQueueScheduler(TaskQueueMode task_queue_mode) : _task_queue_mode(task_queue_mode) {
+  _worker_id_allocator = std::make_shared<UidAllocator>();
+}
 
 NodeQueueScheduler::~NodeQueueScheduler() {
   if (HYRISE_DEBUG && _active) {
@@ -25,6 +28,8 @@ NodeQueueScheduler::~NodeQueueScheduler() {
   }
 }
 
+TaskQueueMode NodeQueueScheduler::task_queue_mode() const { return _task_queue_mode; }
+
 void NodeQueueScheduler::begin() {
   DebugAssert(!_active, "Scheduler is already active");
 
@@ -39,7 +44,32 @@ void NodeQueueScheduler::begin() {
     auto& topology_node = Hyrise::get().topology.nodes()[node_id];
 
     for (auto& topology_cpu : topology_node.cpus) {
-      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      auto deque = std::shared_ptr<TaskDeque>{};
+      if (_task_queue_mode == TaskQueueMode::WorkStealingDeques) {
+        deque = std::make_shared<TaskDeque>(node_id);
+        _deques.emplace_back(deque);
+      }
+
+      _workers.emplace_back(
+          std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id, deque));
+    }
+  }
+
+  if (_task_queue_mode == TaskQueueMode::WorkStealingDeques) {
+    // Workers steal from the other Workers of their node first, as this does not require accessing remote memory
+    for (const auto& worker : _workers) {
+      auto same_node_deques = std::vector<std::shared_ptr<TaskDeque>>{};
+      auto remote_node_deques = std::vector<std::shared_ptr<TaskDeque>>{};
+      for (const auto& deque : _deques) {
+        if (deque == worker->deque()) continue;
+
+        if (deque->node_id() == worker->queue()->node_id()) {
+          same_node_deques.emplace_back(deque);
+        } else {
+          remote_node_deques.emplace_back(deque);
+        }
+      }
+      worker->set_steal_victims(same_node_deques, remote_node_deques);
     }
   }
 
@@ -71,6 +101,9 @@ void NodeQueueScheduler::finish() {
     for ([[maybe_unused]] auto& queue : _queues) {
       DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for ([[maybe_unused]] auto& deque : _deques) {
+      DebugAssert(deque->empty(), "NodeQueueScheduler bug: Deque wasn't empty even though all tasks finished");
+    }
   }
 
   _active = false;
@@ -81,6 +114,7 @@ void NodeQueueScheduler::finish() {
 
   _workers = {};
   _queues = {};
+  _deques = {};
   _task_counter = 0;
 }
 
@@ -102,8 +136,8 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   if (!task->is_ready()) return;
 
   // Lookup node id for current worker.
+  const auto worker = Worker::get_this_thread_worker();
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -115,6 +149,12 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
               "preferred_node_id is not within range of available nodes");
 
+  // Tasks scheduled by a Worker for its own node are handed to the Worker, which might put them into its TaskDeque
+  if (worker && worker->queue()->node_id() == preferred_node_id) {
+    worker->enqueue(task, priority);
+    return;
+  }
+
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
 }
@@ -70,20 +70,37 @@ namespace opossum {
  * Afterwards, the current worker is checking its local queue gain.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * WORK-STEALING DEQUES
+ *
+ * With many cores and fine-grained JobTasks, the single TaskQueue per node becomes a point of contention. In the
+ * TaskQueueMode::WorkStealingDeques mode, every Worker additionally owns a lock-free TaskDeque. Tasks scheduled from
+ * within a Worker (e.g., the JobTasks of an operator) are pushed into the Worker's own deque and popped in LIFO order.
+ * Idle Workers steal the oldest tasks from the deques of other Workers, preferring Workers on the same node. The
+ * TaskQueues remain in place for tasks scheduled from non-Worker threads and for tasks that are not stealable.
  */
 
 class Worker;
+class TaskDeque;
 class TaskQueue;
 class UidAllocator;
 
+enum class TaskQueueMode {
+  NodeQueues,          // All Workers of a node share the node's TaskQueue
+  WorkStealingDeques,  // Every Worker owns a TaskDeque that other Workers steal from
+};
+
 /**
  * Schedules Tasks
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  NodeQueueScheduler();
+  explicit NodeQueueScheduler(TaskQueueMode task_queue_mode = TaskQueueMode::NodeQueues);
   ~NodeQueueScheduler() override;
 
+  TaskQueueMode task_queue_mode() const;
+
   /**
    * Create a queue on every node and a processing unit for every core.
    * Start a single worker for each processing unit.
@@ -107,9 +124,11 @@ class NodeQueueScheduler : public AbstractScheduler {
   void wait_for_all_tasks() override;
 
  private:
+  const TaskQueueMode _task_queue_mode;
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
+  std::vector<std::shared_ptr<TaskDeque>> _deques;
   std::vector<std::shared_ptr<Worker>> _workers;
   std::atomic_bool _active{false};
 };
@@ -0,0 +1,300 @@
+#include "operator_pipeline.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool contains_subquery(const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto found_subquery = false;
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::PQPSubquery) found_subquery = true;
+      return found_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+    });
+  }
+  return found_subquery;
+}
+
+// Returns a PosList with the positions of `pos_list`, which references the single chunk of a morsel table, in the
+// chunk `chunk_id` of the pipeline's input table
+std::shared_ptr<const AbstractPosList> move_to_chunk(const std::shared_ptr<const AbstractPosList>& pos_list,
+                                                     const ChunkID chunk_id) {
+  if (const auto entire_chunk_pos_list = std::dynamic_pointer_cast<const EntireChunkPosList>(pos_list)) {
+    return std::make_shared<EntireChunkPosList>(chunk_id, static_cast<ChunkOffset>(entire_chunk_pos_list->size()));
+  }
+
+  if (const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(pos_list)) {
+    auto words = bitmap_pos_list->words();
+    return std::make_shared<BitmapPosList>(chunk_id, bitmap_pos_list->chunk_size(), std::move(words));
+  }
+
+  auto moved_pos_list = std::make_shared<RowIDPosList>(pos_list->size());
+  auto moved_pos_list_iter = moved_pos_list->begin();
+  for (const auto row_id : *pos_list) {
+    *moved_pos_list_iter = row_id.is_null() ? row_id : RowID{chunk_id, row_id.chunk_offset};
+    ++moved_pos_list_iter;
+  }
+  moved_pos_list->guarantee_single_chunk();
+  return moved_pos_list;
+}
+
+// Performance data of a copy of an operator that processed a single morsel
+struct MorselPerformanceData {
+  std::chrono::nanoseconds walltime{0};
+  uint64_t output_row_count{0};
+  uint64_t output_chunk_count{0};
+};
+
+}  // namespace
+
+namespace opossum {
+
+OperatorPipeline::OperatorPipeline(std::vector<std::shared_ptr<AbstractOperator>> operators)
+    : _operators(std::move(operators)) {
+  Assert(!_operators.empty(), "A pipeline requires at least one operator");
+  for (auto operator_index = size_t{0}; operator_index < _operators.size(); ++operator_index) {
+    Assert(is_pipelineable(*_operators[operator_index]), "Operator cannot be part of a pipeline");
+    Assert(operator_index == 0 || _operators[operator_index]->input_left() == _operators[operator_index - 1],
+           "Operators of a pipeline must consume the output of their predecessor");
+  }
+}
+
+bool OperatorPipeline::is_pipelineable(const AbstractOperator& op) {
+  switch (op.type()) {
+    case OperatorType::TableScan: {
+      // Excluded chunks are identified by their ID in the input table, which differs from the ID in the morsel
+      const auto& table_scan = static_cast<const TableScan&>(op);
+      return table_scan.excluded_chunk_ids.empty() && !contains_subquery({table_scan.predicate()});
+    }
+    case OperatorType::Validate:
+      return true;
+    case OperatorType::JoinHash: {
+      // The morsels of the left input are probed against hash tables built from the right input. Joins with a memory
+      // budget are not pipelined, as they might have to spill their inputs.
+      const auto& join_hash = static_cast<const JoinHash&>(op);
+      const auto mode = join_hash.mode();
+      return mode != JoinMode::Right && mode != JoinMode::FullOuter && !join_hash.memory_budget();
+    }
+    case OperatorType::Projection:
+      return !contains_subquery(static_cast<const Projection&>(op).expressions);
+    default:
+      return false;
+  }
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& OperatorPipeline::operators() const { return _operators; }
+
+std::string OperatorPipeline::description() const {
+  auto description = std::string{"Pipeline of"};
+  for (const auto& op : _operators) {
+    description += " " + op->description();
+  }
+  return description;
+}
+
+void OperatorPipeline::execute() {
+  const auto input_table = _operators.front()->input_table_left();
+  DebugAssert(input_table, "Input of the pipeline has not yet been executed");
+
+  // Within the pipeline, the right input of a join is always its build side. If the right input of an inner join is
+  // larger than the input of the pipeline, the left input would be the better build side, so the operators are
+  // executed one after another.
+  auto build_side_is_larger = false;
+  for (const auto& op : _operators) {
+    if (op->type() == OperatorType::JoinHash && static_cast<const JoinHash&>(*op).mode() == JoinMode::Inner &&
+        op->input_table_right()->row_count() > input_table->row_count()) {
+      build_side_is_larger = true;
+    }
+  }
+
+  const auto morsel_count = input_table->chunk_count();
+  if (morsel_count <= 1 || build_side_is_larger) {
+    // Pipelining a single chunk does not save anything. The intermediate results are not needed anymore once the last
+    // operator is executed.
+    for (const auto& op : _operators) {
+      op->execute();
+    }
+    for (auto operator_index = size_t{0}; operator_index + 1 < _operators.size(); ++operator_index) {
+      _operators[operator_index]->clear_output();
+    }
+    return;
+  }
+
+  // The TableScans of the morsels decide whether to apply a runtime filter based on the row count of their input,
+  // which is a single chunk. Thus, the filters are built here for the input of the entire pipeline, which is at least
+  // as large as the input of each of its scans. Once built, the morsels' scans apply them.
+  for (const auto& op : _operators) {
+    if (op->type() != OperatorType::TableScan) continue;
+    for (const auto& runtime_filter : static_cast<const TableScan&>(*op).runtime_filters) {
+      runtime_filter->build(input_table->row_count());
+    }
+  }
+
+  const auto operator_count = _operators.size();
+  auto morsel_outputs = std::vector<std::shared_ptr<const Table>>(morsel_count);
+  auto morsel_output_chunks = std::vector<std::vector<std::shared_ptr<Chunk>>>(morsel_count);
+  auto morsel_performance_data =
+      std::vector<std::vector<MorselPerformanceData>>(morsel_count, std::vector<MorselPerformanceData>(operator_count));
+
+  // The hash tables of the joins' build sides are built by the first morsel and probed by all others
+  auto shared_build_sides = std::vector<std::shared_ptr<const JoinHash::BuildSide>>(operator_count);
+  const auto has_join = std::any_of(_operators.begin(), _operators.end(),
+                                    [](const auto& op) { return op->type() == OperatorType::JoinHash; });
+
+  const auto process_morsel = [&](const ChunkID morsel_id) {
+    const auto chunk = input_table->get_chunk(morsel_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    // The morsel table shares the chunk with the input table. As the chunk is only read, casting away the const is
+    // safe. References to the morsel table are redirected to the input table below.
+    auto morsel_chunks = std::vector<std::shared_ptr<Chunk>>{std::const_pointer_cast<Chunk>(chunk)};
+    const auto morsel_table = std::make_shared<Table>(input_table->column_definitions(), input_table->type(),
+                                                      std::move(morsel_chunks), input_table->uses_mvcc());
+
+    auto morsel_input = std::shared_ptr<AbstractOperator>{std::make_shared<TableWrapper>(morsel_table)};
+    morsel_input->execute();
+
+    for (auto operator_index = size_t{0}; operator_index < operator_count; ++operator_index) {
+      const auto& op = _operators[operator_index];
+      const auto morsel_op = op->_on_deep_copy(morsel_input, op->mutable_input_right());
+      if (op->_transaction_context) morsel_op->set_transaction_context(*op->_transaction_context);
+      morsel_op->lqp_node = op->lqp_node;
+      if (op->type() == OperatorType::TableScan) {
+        // Runtime filters are not part of the copy, see JoinRuntimeFilter
+        static_cast<TableScan&>(*morsel_op).runtime_filters = static_cast<const TableScan&>(*op).runtime_filters;
+      } else if (op->type() == OperatorType::JoinHash) {
+        auto& morsel_join = static_cast<JoinHash&>(*morsel_op);
+        morsel_join.share_build_side = true;
+        morsel_join.shared_build_side = shared_build_sides[operator_index];
+      }
+      morsel_op->execute();
+      if (morsel_id == 0 && op->type() == OperatorType::JoinHash) {
+        shared_build_sides[operator_index] = static_cast<const JoinHash&>(*morsel_op).shared_build_side;
+      }
+
+      // Operators do not produce an output if the transaction has been aborted
+      const auto& morsel_output = morsel_op->get_output();
+      if (!morsel_output) return;
+
+      auto& performance_data = morsel_performance_data[morsel_id][operator_index];
+      performance_data.walltime = morsel_op->performance_data().walltime;
+      performance_data.output_row_count = morsel_output->row_count();
+      performance_data.output_chunk_count = morsel_output->chunk_count();
+
+      morsel_input = morsel_op;
+    }
+
+    const auto morsel_output = morsel_input->get_output();
+    morsel_outputs[morsel_id] = morsel_output;
+
+    // If the input of the pipeline is a data table, the morsel's output references the morsel table. Consumers expect
+    // all chunks of a table to reference the same tables (e.g., JoinHash and UnionPositions take them from the first
+    // chunk), so the references are redirected to the input table and the morsel's ChunkID in it. As the output
+    // tables of the morsels are not used by anyone else, their other chunks are moved to the output.
+    auto& output_chunks = morsel_output_chunks[morsel_id];
+    const auto output_chunk_count = morsel_output->chunk_count();
+    output_chunks.reserve(output_chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < output_chunk_count; ++chunk_id) {
+      const auto output_chunk = morsel_output->get_chunk(chunk_id);
+      if (morsel_output->type() == TableType::Data || input_table->type() == TableType::References) {
+        output_chunks.emplace_back(std::const_pointer_cast<Chunk>(output_chunk));
+        continue;
+      }
+
+      const auto column_count = output_chunk->column_count();
+      auto segments = Segments{};
+      segments.reserve(column_count);
+      auto moved_pos_lists =
+          std::unordered_map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto segment = output_chunk->get_segment(column_id);
+        const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(segment);
+        if (reference_segment->referenced_table() != morsel_table) {
+          segments.emplace_back(segment);
+          continue;
+        }
+
+        auto& moved_pos_list = moved_pos_lists[reference_segment->pos_list()];
+        if (!moved_pos_list) moved_pos_list = move_to_chunk(reference_segment->pos_list(), morsel_id);
+        segments.emplace_back(std::make_shared<ReferenceSegment>(
+            input_table, reference_segment->referenced_column_id(), moved_pos_list));
+      }
+      output_chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
+    }
+  };
+
+  // If the pipeline contains a join, the first morsel is processed before the others, so that they can use the hash
+  // tables that it builds
+  auto first_parallel_morsel_id = ChunkID{0};
+  if (has_join) {
+    process_morsel(ChunkID{0});
+    first_parallel_morsel_id = ChunkID{1};
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(morsel_count);
+  for (auto morsel_id = first_parallel_morsel_id; morsel_id < morsel_count; ++morsel_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&process_morsel, morsel_id]() { process_morsel(morsel_id); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  if (std::any_of(morsel_outputs.begin(), morsel_outputs.end(), [](const auto& output) { return !output; })) return;
+
+  // Combine the outputs of the morsels. A column is nullable if it is nullable in any of the morsels (the Projection
+  // only marks columns as nullable if it encounters a NULL value).
+  auto column_definitions = morsel_outputs.front()->column_definitions();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto morsel_id = ChunkID{0}; morsel_id < morsel_count; ++morsel_id) {
+    for (auto column_id = ColumnID{0}; column_id < column_definitions.size(); ++column_id) {
+      column_definitions[column_id].nullable |= morsel_outputs[morsel_id]->column_is_nullable(column_id);
+    }
+
+    auto& chunks = morsel_output_chunks[morsel_id];
+    output_chunks.insert(output_chunks.end(), std::make_move_iterator(chunks.begin()),
+                         std::make_move_iterator(chunks.end()));
+  }
+
+  const auto& last_morsel_output = *morsel_outputs.back();
+  const auto& last_operator = _operators.back();
+  last_operator->_output = std::make_shared<Table>(column_definitions, last_morsel_output.type(),
+                                                   std::move(output_chunks), last_morsel_output.uses_mvcc());
+
+  for (auto operator_index = size_t{0}; operator_index < operator_count; ++operator_index) {
+    auto& performance_data = *_operators[operator_index]->_performance_data;
+    performance_data.executed = true;
+    // Only the last operator holds an output, the outputs of the other operators' copies are discarded
+    performance_data.has_output = static_cast<bool>(_operators[operator_index]->_output);
+    for (auto morsel_id = ChunkID{0}; morsel_id < morsel_count; ++morsel_id) {
+      const auto& morsel_performance = morsel_performance_data[morsel_id][operator_index];
+      performance_data.walltime += morsel_performance.walltime;
+      performance_data.output_row_count += morsel_performance.output_row_count;
+      performance_data.output_chunk_count += morsel_performance.output_chunk_count;
+    }
+  }
+}
+
+}  // namespace opossum
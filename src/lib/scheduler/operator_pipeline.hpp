@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * A chain of operators that is executed morsel-wise: Instead of executing one operator after the other, each of them
+ * producing an intermediate table for the entire input, every chunk (morsel) of the pipeline's input is pushed
+ * through all operators of the chain by a single task. Thus, the intermediate results of a morsel are still in the
+ * cache of the worker when they are consumed, and only the output of the last operator is materialized.
+ *
+ * Only operators that produce each output chunk from a single input chunk are pipelineable (TableScan, Validate, and
+ * Projection), as well as the probe side (left input) of JoinHash: The hash tables of its right input are built once
+ * by the first morsel and shared with the copies of the join that probe the other morsels (see
+ * JoinHash::share_build_side). All other operators are pipeline breakers, i.e., they are executed as usual once their
+ * inputs are complete. This includes the build side of joins and aggregates, as they need to see their entire input
+ * before any output can be produced.
+ *
+ * For each morsel, the operators of the pipeline are copied and executed on a table holding only the morsel. The
+ * original operators are not executed themselves. Once all morsels are done, the outputs of the morsels are combined
+ * into the output of the last operator, and the performance data of the originals holds the sum over all morsels.
+ * References to the morsel tables are redirected to the input of the pipeline, so that the output looks exactly like
+ * the output of the last operator executed on the entire input.
+ */
+class OperatorPipeline {
+ public:
+  // @param operators   Chain of pipelineable operators, starting with the one that consumes the input of the pipeline.
+  //                    Each other operator consumes the output of its predecessor in the chain.
+  explicit OperatorPipeline(std::vector<std::shared_ptr<AbstractOperator>> operators);
+
+  // Returns whether the operator can be part of a pipeline. Operators with subqueries are not pipelineable, as the
+  // subqueries would be executed for every morsel.
+  static bool is_pipelineable(const AbstractOperator& op);
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+  std::string description() const;
+
+  // Requires the input of the first operator to be executed. Sets the output of the last operator.
+  void execute();
+
+ private:
+  const std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+}  // namespace opossum
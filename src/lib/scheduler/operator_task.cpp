@@ -1,49 +1,113 @@
 #include "operator_task.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/table_scan.hpp"
 
 #include "scheduler/job_task.hpp"
+#include "scheduler/operator_pipeline.hpp"
 #include "scheduler/worker.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void count_consumers(const std::shared_ptr<AbstractOperator>& op,
+                     std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+    // Visit the inputs of each operator only once, even if it is part of a diamond shape
+    if (consumer_counts[input]++ == 0) count_consumers(input, consumer_counts);
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, SchedulePriority priority, bool stealable)
     : AbstractTask(priority, stealable), _op(std::move(op)) {}
 
+OperatorTask::OperatorTask(std::shared_ptr<OperatorPipeline> pipeline, SchedulePriority priority, bool stealable)
+    : AbstractTask(priority, stealable), _op(pipeline->operators().back()), _pipeline(std::move(pipeline)) {}
+
 std::string OperatorTask::description() const {
+  if (_pipeline) return "OperatorTask with id: " + std::to_string(id()) + " for " + _pipeline->description();
   return "OperatorTask with id: " + std::to_string(id()) + " for op: " + _op->description();
 }
 
 std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    const std::shared_ptr<AbstractOperator>& op) {
+    const std::shared_ptr<AbstractOperator>& op, const ExecutionMode execution_mode) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  _add_tasks_from_operator(op, tasks, task_by_op);
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_counts;
+  if (execution_mode == ExecutionMode::Pipelined) {
+    // The root has no consumer within the plan, but its output is used by the caller
+    consumer_counts.emplace(op, 1);
+    count_consumers(op, consumer_counts);
+  }
+  _add_tasks_from_operator(op, tasks, task_by_op, consumer_counts);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     const std::shared_ptr<AbstractOperator>& op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
-    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op) {
+    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
-  const auto task = std::make_shared<OperatorTask>(op);
+  // Collect the chain of pipelineable operators that ends with op. Operators that are consumed by more than one
+  // operator cannot be part of the chain below op, as they need to be materialized.
+  auto pipeline_operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+  if (!consumer_counts.empty()) {
+    auto pipeline_operator = op;
+    while (pipeline_operator && OperatorPipeline::is_pipelineable(*pipeline_operator) &&
+           (pipeline_operator == op || consumer_counts.at(pipeline_operator) == 1)) {
+      pipeline_operators.emplace_back(pipeline_operator);
+      pipeline_operator = pipeline_operator->mutable_input_left();
+    }
+  }
+
+  auto task = std::shared_ptr<OperatorTask>{};
+  auto first_operator = op;
+  if (pipeline_operators.size() > 1) {
+    std::reverse(pipeline_operators.begin(), pipeline_operators.end());
+    first_operator = pipeline_operators.front();
+    task = std::make_shared<OperatorTask>(std::make_shared<OperatorPipeline>(std::move(pipeline_operators)));
+  } else {
+    task = std::make_shared<OperatorTask>(op);
+  }
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = _add_tasks_from_operator(left, tasks, task_by_op);
+  // The inputs of a pipeline are the inputs of its first operator and the right inputs (i.e., the build sides of
+  // joins) of the other operators
+  if (auto left = first_operator->mutable_input_left()) {
+    auto subtree_root = _add_tasks_from_operator(left, tasks, task_by_op, consumer_counts);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = _add_tasks_from_operator(right, tasks, task_by_op);
-    subtree_root->set_as_predecessor_of(task);
+  const auto task_operators = task->_pipeline ? task->_pipeline->operators() : std::vector{op};
+  for (const auto& task_operator : task_operators) {
+    if (auto right = task_operator->mutable_input_right()) {
+      auto subtree_root = _add_tasks_from_operator(right, tasks, task_by_op, consumer_counts);
+      subtree_root->set_as_predecessor_of(task);
+    }
+  }
+
+  // TableScans with runtime filters have to be executed after the operators that the filters are built from
+  for (const auto& task_operator : task_operators) {
+    if (task_operator->type() != OperatorType::TableScan) continue;
+
+    for (const auto& runtime_filter : static_cast<const TableScan&>(*task_operator).runtime_filters) {
+      auto build_task = _add_tasks_from_operator(runtime_filter->build_operator(), tasks, task_by_op, consumer_counts);
+      build_task->set_as_predecessor_of(task);
+    }
   }
 
   // Add AFTER the inputs to establish a task order where predecessor get executed before successors
@@ -54,6 +118,8 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+const std::shared_ptr<OperatorPipeline>& OperatorTask::get_pipeline() const { return _pipeline; }
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -79,7 +145,11 @@ void OperatorTask::_on_execute() {
   }
 
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  if (_pipeline) {
+    _pipeline->execute();
+  } else {
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
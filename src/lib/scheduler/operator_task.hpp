@@ -5,13 +5,16 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
+class OperatorPipeline;
 
 /**
- * Makes an AbstractOperator scheduleable
+ * Makes an AbstractOperator scheduleable. Alternatively, the task executes an OperatorPipeline, in which case the
+ * operator of the task is the last operator of the pipeline.
  */
 class OperatorTask : public AbstractTask {
  public:
@@ -19,14 +22,22 @@ class OperatorTask : public AbstractTask {
   OperatorTask(std::shared_ptr<AbstractOperator> op,
                SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
 
+  explicit OperatorTask(std::shared_ptr<OperatorPipeline> pipeline,
+                        SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
+
   /**
-   * Create tasks recursively from result operator and set task dependencies automatically.
+   * Create tasks recursively from result operator and set task dependencies automatically. In the pipelined execution
+   * mode, a single task is created for each chain of (at least two) pipelineable operators. Operators whose output is
+   * consumed by more than one operator end a chain, as their output has to be materialized anyway.
    */
   static std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      const std::shared_ptr<AbstractOperator>& op);
+      const std::shared_ptr<AbstractOperator>& op, const ExecutionMode execution_mode = ExecutionMode::Materializing);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
+  // nullptr if the task executes a single operator
+  const std::shared_ptr<OperatorPipeline>& get_pipeline() const;
+
   std::string description() const override;
 
  protected:
@@ -34,13 +45,16 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
-   * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param task_by_op        Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param consumer_counts   Number of consumers per operator, only set in the pipelined execution mode
    */
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       const std::shared_ptr<AbstractOperator>& op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
-      std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op);
+      std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
+  std::shared_ptr<OperatorPipeline> _pipeline;
 };
 }  // namespace opossum
@@ -0,0 +1,125 @@
+#include "task_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TaskDeque::Buffer::Buffer(size_t init_capacity)
+    : capacity(init_capacity), mask(init_capacity - 1), entries(std::make_unique<std::atomic<Entry>[]>(capacity)) {
+  DebugAssert(capacity > 0 && (capacity & mask) == 0, "Capacity of TaskDeque has to be a power of two");
+}
+
+TaskDeque::Entry TaskDeque::Buffer::get(int64_t index) const {
+  return entries[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+}
+
+void TaskDeque::Buffer::put(int64_t index, Entry entry) {
+  entries[static_cast<size_t>(index) & mask].store(entry, std::memory_order_relaxed);
+}
+
+TaskDeque::TaskDeque(NodeID node_id, size_t initial_capacity) : _node_id(node_id) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+TaskDeque::~TaskDeque() {
+  // Free entries of tasks that were never executed. This only happens if the scheduler is destroyed without finish().
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    delete buffer->get(index);
+  }
+}
+
+NodeID TaskDeque::node_id() const { return _node_id; }
+
+bool TaskDeque::empty() const {
+  return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+}
+
+void TaskDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_node_id);
+
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  // Publish the entry to thieves. A release store is used instead of a release fence (as in [2]), because tsan does not
+  // understand standalone fences.
+  buffer->put(bottom, new std::shared_ptr<AbstractTask>(task));
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> TaskDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  // Reserving the bottom entry and reading top must not be reordered, otherwise the owner and a thief could both take
+  // the last task. For the same reason as above, seq_cst operations are used instead of a seq_cst fence.
+  _bottom.store(bottom, std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_seq_cst);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto entry = buffer->get(bottom);
+  if (top == bottom) {
+    // This is the last task in the deque, race against thieves for it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      entry = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!entry) return nullptr;
+
+  auto task = std::move(*entry);
+  delete entry;
+  return task;
+}
+
+std::shared_ptr<AbstractTask> TaskDeque::steal() {
+  auto top = _top.load(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_seq_cst);
+
+  if (top >= bottom) return nullptr;
+
+  // The entry has to be read before the CAS, because the owner might overwrite the slot as soon as top was advanced.
+  // memory_order_consume would suffice for the buffer, but is promoted to acquire by all major compilers anyway.
+  const auto buffer = _buffer.load(std::memory_order_acquire);
+  const auto entry = buffer->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Lost the race against the owner or another thief
+    return nullptr;
+  }
+
+  auto task = std::move(*entry);
+  delete entry;
+  return task;
+}
+
+TaskDeque::Buffer* TaskDeque::_grow(Buffer* buffer, int64_t top, int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer->get(index));
+  }
+
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(_buffers.back().get(), std::memory_order_release);
+  return _buffers.back().get();
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque of AbstractTasks, owned by a single Worker (Chase-Lev deque, see [1] and the C11
+ * formulation in [2]).
+ *
+ * Only the owning Worker may push() and pop(). It does so at the bottom end of the deque, i.e., in LIFO order, which
+ * keeps recently spawned (and thus cache-hot) tasks on the worker that created them. Any other Worker may steal() from
+ * the top end, i.e., in FIFO order, which hands the oldest and usually largest pieces of work to thieves.
+ * Neither operation takes a lock; pop() and steal() only synchronize via a CAS when they compete for the last task.
+ *
+ * The deque grows when it is full. Since thieves may still read from the previous buffer, replaced buffers are kept
+ * until the deque is destroyed. As the capacity doubles with every growth, they take up less memory than the current
+ * buffer.
+ *
+ * [1] Chase and Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005
+ * [2] Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013
+ */
+class TaskDeque : private Noncopyable {
+ public:
+  explicit TaskDeque(NodeID node_id, size_t initial_capacity = 256);
+  ~TaskDeque();
+
+  NodeID node_id() const;
+
+  /**
+   * Approximation, as other threads might push or steal concurrently
+   */
+  bool empty() const;
+
+  /**
+   * Adds a task at the bottom end. Must only be called by the owning Worker.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Removes and returns the most recently pushed task, or nullptr if the deque is empty. Must only be called by the
+   * owning Worker.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes and returns the least recently pushed task. Returns nullptr if the deque is empty or if another thread
+   * won the race for the task, in which case the caller should try another deque.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+ private:
+  // Tasks are stored as pointers to heap-allocated shared_ptrs, since a shared_ptr itself cannot be stored in an
+  // array of lock-free atomics. The thread that successfully removes an entry takes over the task and frees the entry.
+  using Entry = std::shared_ptr<AbstractTask>*;
+
+  struct Buffer {
+    explicit Buffer(size_t init_capacity);
+
+    Entry get(int64_t index) const;
+    void put(int64_t index, Entry entry);
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<std::atomic<Entry>[]> entries;
+  };
+
+  Buffer* _grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  const NodeID _node_id;
+
+  // top is modified by thieves, bottom only by the owner. Keep them on separate cache lines to avoid false sharing.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<Buffer*> _buffer;
+
+  // All buffers ever allocated by this deque, only accessed by the owner
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
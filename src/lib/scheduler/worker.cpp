@@ -14,6 +14,7 @@
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
+#include "task_deque.hpp"
 #include "task_queue.hpp"
 
 namespace {
@@ -32,8 +33,12 @@ namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id,
+               const std::shared_ptr<TaskDeque>& deque)
+    : _queue(queue), _deque(deque), _id(id), _cpu_id(cpu_id) {
+  DebugAssert(!_deque || _deque->node_id() == _queue->node_id(),
+              "Deque and queue of a Worker must belong to the same node");
+}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -41,6 +46,30 @@ std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
+std::shared_ptr<TaskDeque> Worker::deque() const { return _deque; }
+
+void Worker::set_steal_victims(const std::vector<std::shared_ptr<TaskDeque>>& same_node_deques,
+                               const std::vector<std::shared_ptr<TaskDeque>>& remote_node_deques) {
+  DebugAssert(!_thread.joinable(), "Steal victims must be set before the Worker is started");
+  _same_node_victims = same_node_deques;
+  _remote_node_victims = remote_node_deques;
+}
+
+void Worker::enqueue(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  if (!_deque || !task->is_stealable()) {
+    // Non-stealable tasks must not leave their node. As thieves cannot inspect a task before removing it from a
+    // deque, such tasks are put into the node's TaskQueue, which is only stolen from if the task allows it.
+    _queue->push(task, static_cast<uint32_t>(priority));
+    return;
+  }
+
+  // The deque has no priorities. As the owner pops in LIFO order, a task pushed by this Worker (e.g., a successor
+  // that just became ready) is executed next anyway.
+  _deque->push(task);
+
+  // Wake up a sleeping Worker of this node so that it can steal from us
+  _queue->new_task.notify_one();
+}
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -54,7 +83,10 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
-  auto task = _queue->pull();
+  auto task = std::shared_ptr<AbstractTask>{};
+  if (_deque) task = _deque->pop();
+  if (!task) task = _queue->pull();
+  if (!task && _deque) task = _steal_from_deques();
 
   if (!task) {
     // Simple work stealing without explicitly transferring data between nodes.
@@ -99,6 +131,24 @@ void Worker::join() {
 
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+std::shared_ptr<AbstractTask> Worker::_steal_from_deques() {
+  ++_next_victim_offset;
+
+  for (const auto* victims : {&_same_node_victims, &_remote_node_victims}) {
+    const auto victim_count = victims->size();
+    for (auto victim_index = size_t{0}; victim_index < victim_count; ++victim_index) {
+      const auto& victim = (*victims)[(_next_victim_offset + victim_index) % victim_count];
+      auto task = victim->steal();
+      if (task) {
+        task->set_node_id(_queue->node_id());
+        return task;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
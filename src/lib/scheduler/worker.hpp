@@ -10,11 +10,17 @@
 
 namespace opossum {
 
+class AbstractTask;
+class TaskDeque;
 class TaskQueue;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * If the Worker owns a TaskDeque (see TaskQueueMode::WorkStealingDeques), tasks scheduled by the Worker itself are
+ * pushed into that deque. When looking for work, the Worker checks its own deque, then the TaskQueue of its node, then
+ * the deques of the other Workers on the same node, and only then the deques and queues of remote nodes.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractScheduler;
@@ -22,7 +28,8 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id,
+         const std::shared_ptr<TaskDeque>& deque = nullptr);
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -30,6 +37,20 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
+  std::shared_ptr<TaskDeque> deque() const;
+
+  /**
+   * Deques that this Worker steals from if it has no work of its own, ordered by preference. Has to be set before the
+   * Worker is started.
+   */
+  void set_steal_victims(const std::vector<std::shared_ptr<TaskDeque>>& same_node_deques,
+                         const std::vector<std::shared_ptr<TaskDeque>>& remote_node_deques);
+
+  /**
+   * Enqueues a task that was scheduled by (or became ready on) this Worker. Stealable tasks go to the Worker's own
+   * deque if it has one, everything else into the TaskQueue of the Worker's node.
+   */
+  void enqueue(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority);
 
   void start();
   void join();
@@ -67,7 +88,14 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  std::shared_ptr<AbstractTask> _steal_from_deques();
+
   std::shared_ptr<TaskQueue> _queue;
+  std::shared_ptr<TaskDeque> _deque;
+  std::vector<std::shared_ptr<TaskDeque>> _same_node_victims;
+  std::vector<std::shared_ptr<TaskDeque>> _remote_node_victims;
+  // Rotates the victim that is tried first, so that concurrent thieves do not all hit the same deque
+  size_t _next_victim_offset{0};
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
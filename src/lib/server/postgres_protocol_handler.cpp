@@ -89,7 +89,8 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width,
+                                                               const FormatCode format_code) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,7 +100,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));
 }
 
 template <typename SocketType>
@@ -132,6 +133,11 @@ void PostgresProtocolHandler<SocketType>::send_data_row(
   }
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_data_rows(const std::vector<char>& data_rows) {
+  _write_buffer.put_bytes(data_rows.data(), data_rows.size());
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_command_complete(const std::string& command_complete_message) {
   const auto packet_size = LENGTH_FIELD_SIZE + command_complete_message.size() + 1u /* null terminator */;
@@ -207,11 +213,16 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
 
   const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
 
+  std::vector<FormatCode> result_format_codes;
   for (auto i = 0; i < num_result_column_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    Assert(format_code == static_cast<int16_t>(FormatCode::Text) ||
+               format_code == static_cast<int16_t>(FormatCode::Binary),
+           "Unknown format code for result column");
+    result_format_codes.emplace_back(static_cast<FormatCode>(format_code));
   }
 
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, result_format_codes};
 }
 
 template <typename SocketType>
@@ -11,11 +11,14 @@ namespace opossum {
 
 using ErrorMessage = std::unordered_map<PostgresMessageType, std::string>;
 
-// This struct stores a prepared statement's name, its portal used and the specified parameters.
+// This struct stores a prepared statement's name, its portal used, the specified parameters, and the formats requested
+// for the result columns. No format code means that all columns use the text format, a single one applies to all
+// columns. Otherwise, there is one format code per result column.
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  std::vector<FormatCode> result_format_codes;
 };
 
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
@@ -44,9 +47,12 @@ class PostgresProtocolHandler {
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const FormatCode format_code = FormatCode::Text);
   void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
                      const uint32_t string_length_sum);
+  // Send a batch of DataRow messages that have already been serialized (see ResultSerializer::send_query_response)
+  void send_data_rows(const std::vector<char>& data_rows);
   void send_command_complete(const std::string& command_complete_message);
 
   // Messages for parsing prepared statements
@@ -67,6 +73,10 @@ class PostgresProtocolHandler {
   // Additional (optional) message containing execution times of different components (such as translator or optimizer)
   void send_execution_info(const std::string& execution_information);
 
+  // Returns true if data has been received from the client that has not been processed yet, e.g., the next message of
+  // a pipelined request.
+  bool has_buffered_input() const { return _read_buffer.size() > 0; }
+
   // This method is required for testing. Otherwise we cannot make the protocol handler flush its data.
   void force_flush() { _write_buffer.flush(); }
 
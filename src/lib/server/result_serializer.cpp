@@ -1,12 +1,119 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <boost/endian/conversion.hpp>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// DataRow messages are collected until the batch has reached this size. Then, they are handed to the WriteBuffer,
+// which sends them to the network device without copying them into its (small) ring buffer.
+constexpr auto DATA_ROW_BATCH_SIZE = size_t{256} * 1024;
+
+// NULL values are represented by setting the value's length to -1
+constexpr auto NULL_VALUE_LENGTH = int32_t{-1};
+
+// Fields (i.e., value length and value) of one column for all rows of a chunk
+struct SerializedColumn {
+  std::vector<char> fields;
+
+  // The field of the n-th row is stored in [field_offsets[n], field_offsets[n + 1])
+  std::vector<size_t> field_offsets;
+};
+
+template <typename T>
+void append_in_network_byte_order(std::vector<char>& buffer, const T value) {
+  const auto converted_value = boost::endian::native_to_big(value);
+  const auto* bytes = reinterpret_cast<const char*>(&converted_value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename ColumnDataType>
+void append_field(std::vector<char>& buffer, const ColumnDataType& value, const FormatCode format_code) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    // The binary representation of text is the same as the text representation
+    append_in_network_byte_order(buffer, static_cast<int32_t>(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+  } else if (format_code == FormatCode::Binary) {
+    // Integers and IEEE 754 floating-point numbers in network byte order. The floating-point numbers are converted
+    // via an integer of the same size.
+    using BinaryType = std::conditional_t<sizeof(ColumnDataType) == sizeof(uint32_t), uint32_t, uint64_t>;
+    static_assert(sizeof(BinaryType) == sizeof(ColumnDataType), "Unexpected size of numerical type");
+    auto binary_value = BinaryType{};
+    std::memcpy(&binary_value, &value, sizeof(ColumnDataType));
+
+    append_in_network_byte_order(buffer, static_cast<int32_t>(sizeof(ColumnDataType)));
+    append_in_network_byte_order(buffer, binary_value);
+  } else {
+    // Large enough for all integers and for all floating-point numbers printed with max_digits10 digits
+    auto characters = std::array<char, 32>{};
+    auto length = size_t{0};
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      const auto result = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+      length = static_cast<size_t>(result.ptr - characters.data());
+    } else {
+      // Same representation as boost::lexical_cast, i.e., with enough digits to restore the value
+      length = static_cast<size_t>(std::snprintf(characters.data(), characters.size(), "%.*g",
+                                                 std::numeric_limits<ColumnDataType>::max_digits10, value));
+    }
+
+    append_in_network_byte_order(buffer, static_cast<int32_t>(length));
+    buffer.insert(buffer.end(), characters.data(), characters.data() + length);
+  }
+}
+
+template <typename ColumnDataType>
+void serialize_segment(const BaseSegment& segment, const FormatCode format_code,
+                       SerializedColumn& serialized_column) {
+  auto& fields = serialized_column.fields;
+  auto& field_offsets = serialized_column.field_offsets;
+
+  // The buffers are reused for all chunks
+  fields.clear();
+  field_offsets.clear();
+  field_offsets.emplace_back(0);
+
+  segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+    if (position.is_null()) {
+      append_in_network_byte_order(fields, NULL_VALUE_LENGTH);
+    } else {
+      append_field(fields, position.value(), format_code);
+    }
+    field_offsets.emplace_back(fields.size());
+  });
+}
+
+// No format code means that all columns use the text format, a single one applies to all columns
+std::vector<FormatCode> format_code_per_column(const std::vector<FormatCode>& result_format_codes,
+                                               const ColumnCount column_count) {
+  if (result_format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (result_format_codes.size() == 1) return std::vector<FormatCode>(column_count, result_format_codes.front());
+
+  AssertInput(result_format_codes.size() == column_count, "Expected one format code per result column.");
+  return result_format_codes;
+}
+
+}  // namespace
 
 namespace opossum {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& result_format_codes) {
+  const auto format_codes = format_code_per_column(result_format_codes, table->column_count());
+
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -47,15 +154,22 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    format_codes[column_id]);
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& result_format_codes) {
+  const auto column_count = table->column_count();
+  const auto format_codes = format_code_per_column(result_format_codes, column_count);
+
+  auto serialized_columns = std::vector<SerializedColumn>(column_count);
+  auto data_rows = std::vector<char>{};
+  data_rows.reserve(DATA_ROW_BATCH_SIZE);
 
   const auto chunk_count = table->chunk_count();
 
@@ -64,29 +178,44 @@ void ResultSerializer::send_query_response(
     const auto chunk = table->get_chunk(chunk_id);
     const auto chunk_size = chunk->size();
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
+    // Convert the values column-wise. The PostgreSQL protocol requires the conversion of values to strings for the
+    // text format and to network byte order for the binary format.
     for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
+      resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        serialize_segment<ColumnDataType>(*chunk->get_segment(column_id), format_codes[column_id],
+                                          serialized_columns[column_id]);
+      });
     }
 
-    // Iterate over each row in chunk
+    // Assemble the DataRow messages. The documentation of the fields in this message can be found at:
+    // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = 0;
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += string_value.value().size();
-        }
-        values_as_strings[segment_id] = string_value;
+      auto fields_size = size_t{0};
+      for (const auto& serialized_column : serialized_columns) {
+        const auto& field_offsets = serialized_column.field_offsets;
+        fields_size += field_offsets[chunk_offset + 1] - field_offsets[chunk_offset];
+      }
+
+      const auto packet_size = LENGTH_FIELD_SIZE + sizeof(uint16_t) + fields_size;
+      data_rows.emplace_back(static_cast<char>(PostgresMessageType::DataRow));
+      append_in_network_byte_order(data_rows, static_cast<uint32_t>(packet_size));
+      append_in_network_byte_order(data_rows, static_cast<uint16_t>(column_count));
+
+      for (const auto& serialized_column : serialized_columns) {
+        const auto fields_begin = serialized_column.fields.begin();
+        data_rows.insert(data_rows.end(), fields_begin + serialized_column.field_offsets[chunk_offset],
+                         fields_begin + serialized_column.field_offsets[chunk_offset + 1]);
+      }
+
+      if (data_rows.size() >= DATA_ROW_BATCH_SIZE) {
+        postgres_protocol_handler->send_data_rows(data_rows);
+        data_rows.clear();
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
     }
   }
+
+  postgres_protocol_handler->send_data_rows(data_rows);
 }
 
 std::string ResultSerializer::build_command_complete_message(const OperatorType root_operator_type,
@@ -113,17 +242,21 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
 }
 
 template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                               const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                            const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
 }  // namespace opossum
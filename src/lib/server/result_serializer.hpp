@@ -1,26 +1,34 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
-// The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
+// The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol. The
+// result_format_codes are those requested by the client in the Bind message (see PreparedStatementDetails). Simple
+// queries always use the text format.
 class ResultSerializer {
  public:
   // Serialize information about the result table
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& result_format_codes = {});
 
+  // Convert the values of the result table chunk by chunk and send them row-wise. Within a chunk, the values are
+  // converted column by column, so that each segment is resolved only once. The resulting DataRow messages are handed
+  // to the PostgresProtocolHandler in large batches.
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& result_format_codes = {});
 
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const OperatorType root_operator_type, const uint64_t row_count);
@@ -3,8 +3,11 @@
 #include <pthread.h>
 
 #include <iostream>
+#include <string>
 #include <thread>
+#include <vector>
 
+#include "cache/sharded_clock_cache.hpp"
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 
@@ -12,8 +15,11 @@ namespace opossum {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const uint32_t io_thread_count)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _send_execution_info(send_execution_info),
+      _io_thread_count(io_thread_count) {
+  Assert(_io_thread_count > 0, "Server requires at least one thread for the io_service");
   std::cout << "Server started at " << server_address() << " and port " << server_port() << std::endl
             << "Run 'psql -h localhost' to connect to the server" << std::endl;
 }
@@ -22,12 +28,40 @@ void Server::run() {
   // Set scheduler so that the server can execute the tasks on separate threads.
   Hyrise::get().set_scheduler(std::make_shared<opossum::NodeQueueScheduler>());
 
-  // Set caches
-  Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
-  Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  // Set caches. As they are accessed by all sessions concurrently, they use the sharded cache implementation, where
+  // cache hits do not block each other.
+  auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  pqp_cache->replace_cache_impl<ShardedClockCache<std::string, std::shared_ptr<AbstractOperator>>>(
+      DefaultCacheCapacity);
+  Hyrise::get().default_pqp_cache = pqp_cache;
+
+  auto lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  lqp_cache->replace_cache_impl<ShardedClockCache<std::string, std::shared_ptr<AbstractLQPNode>>>(
+      DefaultCacheCapacity);
+  Hyrise::get().default_lqp_cache = lqp_cache;
 
   _accept_new_session();
+
+  // The calling thread is part of the pool
+  auto io_threads = std::vector<std::thread>{};
+  io_threads.reserve(_io_thread_count - 1);
+  for (auto thread_id = uint32_t{1}; thread_id < _io_thread_count; ++thread_id) {
+    io_threads.emplace_back([&, thread_id]() {
+      const auto thread_name = "server_io_" + std::to_string(thread_id);
+#ifdef __APPLE__
+      pthread_setname_np(thread_name.c_str());
+#elif __linux__
+      pthread_setname_np(pthread_self(), thread_name.c_str());
+#endif
+      _io_service.run();
+    });
+  }
+
   _io_service.run();
+
+  for (auto& io_thread : io_threads) {
+    io_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
@@ -42,17 +76,7 @@ void Server::_accept_new_session() {
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
   Assert(!error, error.message());
 
-  std::thread session_thread([new_session] {
-    const std::string thread_name = "server_p_" + std::to_string(new_session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-    new_session->run();
-  });
-
-  session_thread.detach();
+  new_session->start();
   _accept_new_session();
 }
 
@@ -10,9 +10,10 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client. Runs the io_service on a small pool of
+*           threads, which wait for new connections and incoming requests.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
-*            session-specific data.
+*            session-specific data. Requests are handled by tasks on the scheduler.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -29,9 +30,14 @@ namespace opossum {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  // As the threads of the io_service only dispatch requests to the scheduler, few of them suffice even for thousands
+  // of connections.
+  static constexpr auto DEFAULT_IO_THREAD_COUNT = uint32_t{2};
 
-  // Start server to accept new sessions.
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const uint32_t io_thread_count = DEFAULT_IO_THREAD_COUNT);
+
+  // Start server to accept new sessions. Blocks until the server is shut down.
   void run();
 
   // Return the port the server is running on.
@@ -51,5 +57,6 @@ class Server {
   boost::asio::io_service _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
+  const uint32_t _io_thread_count;
 };
 }  // namespace opossum
@@ -10,4 +10,9 @@ enum class HasNullTerminator : bool { Yes = true, No = false };
 
 enum class SendExecutionInfo : bool { Yes = true, No = false };
 
+// Values of parameters and result columns are either transferred as strings or in a type-specific binary format. The
+// client chooses the format per column in the Bind message, see
+// https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-FORMAT-CODES
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
 }  // namespace opossum
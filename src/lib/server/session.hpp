@@ -12,16 +12,27 @@ namespace opossum {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions do not have a thread of their own. Instead, a session waits asynchronously on the server's io_service until
+// the client sends a request. The request is then handled by a JobTask on the scheduler, which reads the request,
+// executes it, and sends the response. Afterwards, the session waits for the next request. Thus, idle sessions only
+// cost their socket and buffers.
+class Session : public std::enable_shared_from_this<Session> {
  public:
   explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
 
-  // Start new session.
-  void run();
+  // Start new session. Returns immediately, the session keeps itself alive until the connection is terminated.
+  void start();
 
   std::shared_ptr<Socket> socket();
 
  private:
+  // Wait until the client sends data and schedule a task that handles the request.
+  void _async_wait_for_request();
+
+  // Handle all requests that have been received so far. Called by the JobTask scheduled in _async_wait_for_request.
+  void _handle_requests();
+
   // Establish new connection by exchanging parameters.
   void _establish_connection();
 
@@ -46,12 +57,19 @@ class Session {
   // Commit current transaction.
   void _sync();
 
+  // A bound prepared statement together with the formats that the client requested for the result columns.
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<FormatCode> result_format_codes;
+  };
+
   const std::shared_ptr<Socket> _socket;
   const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
 };
 }  // namespace opossum
@@ -48,10 +48,31 @@ void WriteBuffer<SocketType>::put_string(const std::string& value, const HasNull
   }
 }
 
+template <typename SocketType>
+void WriteBuffer<SocketType>::put_bytes(const char* data, const size_t byte_count) {
+  if (byte_count == 0) return;
+
+  if (byte_count < maximum_capacity() - size()) {
+    std::copy_n(data, byte_count, _current_position);
+    std::advance(_current_position, byte_count);
+    return;
+  }
+
+  // Keep the order of the messages by sending the buffered data first
+  flush();
+
+  boost::system::error_code error_code;
+  const auto bytes_sent = boost::asio::write(*_socket, boost::asio::buffer(data, byte_count), error_code);
+  _handle_write_result(error_code, bytes_sent);
+}
+
 template <typename SocketType>
 void WriteBuffer<SocketType>::flush(const size_t bytes_required) {
   Assert(bytes_required <= size(), "Cannot flush more byte than available");
   const auto bytes_to_send = bytes_required ? bytes_required : size();
+  // Nothing to send, e.g., because the last block has been written to the network device directly (see put_bytes)
+  if (bytes_to_send == 0) return;
+
   size_t bytes_sent;
 
   boost::system::error_code error_code;
@@ -68,12 +89,7 @@ void WriteBuffer<SocketType>::flush(const size_t bytes_required) {
                                     boost::asio::transfer_at_least(bytes_to_send), error_code);
   }
 
-  // Socket was closed by client during execution
-  if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
-      bytes_sent == 0) {
-    throw ClientDisconnectException("Write operation failed. Client closed connection.");
-  }
-  Assert(!error_code, error_code.message());
+  _handle_write_result(error_code, bytes_sent);
 
   std::advance(_start_position, bytes_sent);
 }
@@ -85,6 +101,17 @@ void WriteBuffer<SocketType>::_flush_if_necessary(const size_t bytes_required) {
   }
 }
 
+template <typename SocketType>
+void WriteBuffer<SocketType>::_handle_write_result(const boost::system::error_code& error_code,
+                                                   const size_t bytes_sent) const {
+  // Socket was closed by client during execution
+  if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
+      bytes_sent == 0) {
+    throw ClientDisconnectException("Write operation failed. Client closed connection.");
+  }
+  Assert(!error_code, error_code.message());
+}
+
 template class WriteBuffer<Socket>;
 template class WriteBuffer<boost::asio::posix::stream_descriptor>;
 
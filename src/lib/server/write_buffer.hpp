@@ -45,12 +45,19 @@ class WriteBuffer {
   // Put string into the buffer. If the string is longer than the buffer itself the buffer will flush automatically.
   void put_string(const std::string& value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
 
+  // Put a block of raw bytes into the buffer. Blocks that do not fit into the remaining space (e.g., large batches of
+  // DataRow messages) are not copied into the buffer. Instead, the buffer is flushed and the block is written to the
+  // network device directly.
+  void put_bytes(const char* data, const size_t byte_count);
+
   // Flush buffer by at least bytes_required. 0 means, flush whole buffer.
   void flush(const size_t bytes_required = 0);
 
  private:
   void _flush_if_necessary(const size_t bytes_required);
 
+  void _handle_write_result(const boost::system::error_code& error_code, const size_t bytes_sent) const;
+
   std::array<char, SERVER_BUFFER_SIZE> _data;
   // This iterator points to the first element that has not been flushed yet.
   RingBufferIterator _start_position{_data};
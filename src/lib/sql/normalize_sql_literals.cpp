@@ -0,0 +1,105 @@
+#include "normalize_sql_literals.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+
+namespace {
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = NormalizedSQL{};
+  normalized_sql.sql.reserve(sql.size());
+
+  const auto length = sql.size();
+  auto position = size_t{0};
+
+  // Copies the characters up to (excluding) end_position to the normalized SQL string
+  const auto copy_until = [&](const size_t end_position) {
+    normalized_sql.sql.append(sql, position, end_position - position);
+    position = end_position;
+  };
+
+  while (position < length) {
+    const auto character = sql[position];
+
+    if (character == '?') return std::nullopt;
+
+    if (character == '\'') {
+      // String literal
+      const auto end_position = sql.find('\'', position + 1);
+      if (end_position == std::string::npos) return std::nullopt;
+
+      // Let the SQL parser deal with escaped quotes
+      if (end_position + 1 < length && sql[end_position + 1] == '\'') return std::nullopt;
+      if (sql.find('\\', position + 1) < end_position) return std::nullopt;
+
+      normalized_sql.literals.emplace_back(pmr_string{sql.substr(position + 1, end_position - position - 1)});
+      normalized_sql.sql += '?';
+      position = end_position + 1;
+    } else if (character == '"') {
+      // Quoted identifier
+      const auto end_position = sql.find('"', position + 1);
+      if (end_position == std::string::npos) return std::nullopt;
+      copy_until(end_position + 1);
+    } else if (character == '-' && position + 1 < length && sql[position + 1] == '-') {
+      // Line comment
+      copy_until(std::min(sql.find('\n', position), length));
+    } else if (character == '/' && position + 1 < length && sql[position + 1] == '*') {
+      // Block comment
+      const auto end_position = sql.find("*/", position + 2);
+      if (end_position == std::string::npos) return std::nullopt;
+      copy_until(end_position + 2);
+    } else if (is_identifier_character(character) && !is_digit(character)) {
+      // Identifier or keyword, which may contain digits
+      auto end_position = position + 1;
+      while (end_position < length && is_identifier_character(sql[end_position])) ++end_position;
+      copy_until(end_position);
+    } else if (is_digit(character) || (character == '.' && position + 1 < length && is_digit(sql[position + 1]))) {
+      // Numeric literal. A minus sign in front of it is kept, as the SQL parser treats it as an operator, too.
+      auto end_position = position;
+      while (end_position < length && is_digit(sql[end_position])) ++end_position;
+      const auto is_decimal = end_position < length && sql[end_position] == '.';
+      if (is_decimal) {
+        ++end_position;
+        while (end_position < length && is_digit(sql[end_position])) ++end_position;
+      }
+
+      // Scientific notation or something like `1a`
+      if (end_position < length && (is_identifier_character(sql[end_position]) || sql[end_position] == '.')) {
+        return std::nullopt;
+      }
+
+      const auto literal = sql.substr(position, end_position - position);
+      if (is_decimal) {
+        normalized_sql.literals.emplace_back(std::stod(literal));
+      } else {
+        if (literal.size() > std::numeric_limits<int64_t>::digits10) return std::nullopt;
+        const auto value = std::stoll(literal);
+        if (value <= std::numeric_limits<int32_t>::max()) {
+          normalized_sql.literals.emplace_back(static_cast<int32_t>(value));
+        } else {
+          normalized_sql.literals.emplace_back(static_cast<int64_t>(value));
+        }
+      }
+
+      normalized_sql.sql += '?';
+      position = end_position;
+    } else {
+      copy_until(position + 1);
+    }
+  }
+
+  return normalized_sql;
+}
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+struct NormalizedSQL {
+  // The SQL string with each literal replaced by a `?`
+  std::string sql;
+
+  // The values of the replaced literals, in the order of their appearance. Integers are int32_t if they fit and
+  // int64_t otherwise, decimals are doubles, and strings are pmr_strings, as in the SQLTranslator.
+  std::vector<AllTypeVariant> literals;
+};
+
+/**
+ * Replaces the numeric and string literals of a single SQL statement with value placeholders, so that statements that
+ * only differ in their literals have the same normalized SQL string. This is done lexically, i.e., without parsing the
+ * statement. Literals that are part of an identifier (e.g., `t1`), a quoted identifier, or a comment are kept.
+ *
+ * Returns std::nullopt if the statement already has value placeholders or contains literals that are not normalized
+ * (escaped quotes, numbers in scientific notation), so that the statement should be handled as is.
+ */
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql);
+
+}  // namespace opossum
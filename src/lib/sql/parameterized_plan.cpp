@@ -0,0 +1,325 @@
+#include "parameterized_plan.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "SQLParser.h"
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "expression/placeholder_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "sql/sql_translator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/prepared_plan.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Calls the visitor for all nodes of the LQP and of the LQPs of its subqueries
+template <typename Visitor>
+void visit_lqp_and_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp, Visitor visitor,
+                              std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
+  visit_lqp(lqp, [&](const auto& node) {
+    if (!visited_nodes.emplace(node).second) return LQPVisitation::DoNotVisitInputs;
+
+    visitor(node);
+
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (const auto subquery_expression = std::dynamic_pointer_cast<LQPSubqueryExpression>(sub_expression)) {
+          visit_lqp_and_subqueries(subquery_expression->lqp, visitor, visited_nodes);
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+int32_t selectivity_bucket(const float selectivity) {
+  if (selectivity <= std::pow(10.0f, ParameterizedPlan::MIN_SELECTIVITY_BUCKET)) {
+    return ParameterizedPlan::MIN_SELECTIVITY_BUCKET;
+  }
+  return std::min(static_cast<int32_t>(std::floor(std::log10(selectivity))), int32_t{0});
+}
+
+// Applies the ChunkPruningRule to instantiated plans, whose predicates now have values
+const Optimizer& chunk_pruning_optimizer() {
+  static const auto optimizer = [] {
+    auto chunk_pruning_optimizer = Optimizer{};
+    chunk_pruning_optimizer.add_rule(std::make_unique<ChunkPruningRule>());
+    return chunk_pruning_optimizer;
+  }();
+  return optimizer;
+}
+
+}  // namespace
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+std::string ParameterizedPlan::cache_key(const NormalizedSQL& normalized_sql, const UseMvcc use_mvcc) {
+  auto cache_key = normalized_sql.sql;
+  cache_key += use_mvcc == UseMvcc::Yes ? "\nMVCC:" : "\nNoMVCC:";
+  for (const auto& literal : normalized_sql.literals) {
+    cache_key += std::to_string(literal.which());
+  }
+  return cache_key;
+}
+
+std::shared_ptr<ParameterizedPlan> ParameterizedPlan::create(const NormalizedSQL& normalized_sql,
+                                                             const UseMvcc use_mvcc) {
+  const auto literal_count = normalized_sql.literals.size();
+  auto parameterized_plan = std::make_shared<ParameterizedPlan>();
+
+  // Statements that cannot be parsed or translated with placeholders (e.g., `INTERVAL ? DAY`) are handled without
+  // parameterization, where errors are reported to the user.
+  try {
+    auto parse_result = hsql::SQLParserResult{};
+    hsql::SQLParser::parse(normalized_sql.sql, &parse_result);
+    if (!parse_result.isValid() || parse_result.size() != 1) return parameterized_plan;
+
+    const auto statement_type = parse_result.getStatement(0)->type();
+    if (statement_type != hsql::kStmtSelect && statement_type != hsql::kStmtUpdate &&
+        statement_type != hsql::kStmtDelete) {
+      return parameterized_plan;
+    }
+
+    auto sql_translator = SQLTranslator{use_mvcc};
+    const auto translation_result = sql_translator.translate_parser_result(parse_result);
+    const auto& translation_info = translation_result.translation_info;
+    if (!translation_info.cacheable || translation_info.parameter_ids_of_value_placeholders.size() != literal_count) {
+      return parameterized_plan;
+    }
+
+    // The SQL parser numbers the placeholders in the order of their appearance, which is the order of the literals
+    const auto& parameter_ids = translation_info.parameter_ids_of_value_placeholders;
+    auto literal_idx_by_parameter_id = std::unordered_map<ParameterID, size_t>{};
+    for (auto literal_idx = size_t{0}; literal_idx < literal_count; ++literal_idx) {
+      literal_idx_by_parameter_id.emplace(parameter_ids[literal_idx], literal_idx);
+    }
+
+    const auto literal_idx = [&](const std::shared_ptr<AbstractExpression>& expression) -> std::optional<size_t> {
+      if (expression->type != ExpressionType::Placeholder) return std::nullopt;
+      return literal_idx_by_parameter_id.at(static_cast<const PlaceholderExpression&>(*expression).parameter_id);
+    };
+
+    auto is_parameterized = std::vector<bool>(literal_count, false);
+    auto selectivity_probes = std::vector<SelectivityProbe>{};
+
+    // Adds a probe if the column is a column of a stored table
+    const auto add_selectivity_probe = [&](const AbstractExpression& column,
+                                           const PredicateCondition predicate_condition, const size_t value_literal_idx,
+                                           const std::optional<size_t>& value2_literal_idx) {
+      const auto& column_reference = static_cast<const LQPColumnExpression&>(column).column_reference;
+      const auto original_node = column_reference.original_node();
+      if (!original_node || original_node->type != LQPNodeType::StoredTable) return;
+
+      const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+      selectivity_probes.emplace_back(SelectivityProbe{table_name, column_reference.original_column_id(),
+                                                       predicate_condition, value_literal_idx, value2_literal_idx});
+    };
+
+    // Parameterizes `<column> <condition> <literal>` and `<column> BETWEEN <literal> AND <literal>`, also as part of
+    // conjunctions and disjunctions
+    const auto parameterize_predicate = [&](const auto& self,
+                                            const std::shared_ptr<AbstractExpression>& predicate) -> void {
+      if (const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(predicate)) {
+        self(self, logical_expression->left_operand());
+        self(self, logical_expression->right_operand());
+      } else if (const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate)) {
+        auto predicate_condition = binary_predicate->predicate_condition;
+        auto column = binary_predicate->left_operand();
+        auto value_literal_idx = literal_idx(binary_predicate->right_operand());
+        if (!value_literal_idx) {
+          // `<literal> LIKE <column>` cannot be flipped
+          if (!is_binary_numeric_predicate_condition(predicate_condition)) return;
+          predicate_condition = flip_predicate_condition(predicate_condition);
+          column = binary_predicate->right_operand();
+          value_literal_idx = literal_idx(binary_predicate->left_operand());
+        }
+        if (!value_literal_idx || column->type != ExpressionType::LQPColumn) return;
+
+        is_parameterized[*value_literal_idx] = true;
+        if (is_binary_numeric_predicate_condition(predicate_condition)) {
+          add_selectivity_probe(*column, predicate_condition, *value_literal_idx, std::nullopt);
+        }
+      } else if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(predicate)) {
+        const auto lower_bound_literal_idx = literal_idx(between_expression->lower_bound());
+        const auto upper_bound_literal_idx = literal_idx(between_expression->upper_bound());
+        if (!lower_bound_literal_idx || !upper_bound_literal_idx ||
+            between_expression->value()->type != ExpressionType::LQPColumn) {
+          return;
+        }
+
+        is_parameterized[*lower_bound_literal_idx] = true;
+        is_parameterized[*upper_bound_literal_idx] = true;
+        add_selectivity_probe(*between_expression->value(), between_expression->predicate_condition,
+                              *lower_bound_literal_idx, *upper_bound_literal_idx);
+      }
+    };
+
+    auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+    const auto& lqp = translation_result.lqp_nodes.at(0);
+    visit_lqp_and_subqueries(
+        lqp,
+        [&](const auto& node) {
+          if (node->type != LQPNodeType::Predicate) return;
+          parameterize_predicate(parameterize_predicate, static_cast<const PredicateNode&>(*node).predicate());
+        },
+        visited_nodes);
+
+    if (std::none_of(is_parameterized.begin(), is_parameterized.end(), [](const auto value) { return value; })) {
+      return parameterized_plan;
+    }
+
+    auto candidate_plan = std::make_shared<ParameterizedPlan>();
+    candidate_plan->_lqp = lqp;
+    candidate_plan->_parameter_ids = parameter_ids;
+    candidate_plan->_is_parameterized = std::move(is_parameterized);
+    candidate_plan->_selectivity_probes = std::move(selectivity_probes);
+
+    auto variant = candidate_plan->_optimize_variant(normalized_sql.literals);
+    if (!variant) return parameterized_plan;
+    candidate_plan->_variants.emplace_back(std::move(*variant));
+
+    return candidate_plan;
+  } catch (const std::exception&) {
+    return parameterized_plan;
+  }
+}
+
+bool ParameterizedPlan::is_parameterizable() const { return _lqp != nullptr; }
+
+size_t ParameterizedPlan::variant_count() const { return _variants.size(); }
+
+std::shared_ptr<AbstractLQPNode> ParameterizedPlan::instantiate(const std::vector<AllTypeVariant>& literals) const {
+  DebugAssert(is_parameterizable(), "Cannot instantiate plan that is not parameterizable");
+  DebugAssert(literals.size() == _parameter_ids.size(), "Number of literals does not match the normalized statement");
+
+  const auto selectivity_buckets = _selectivity_buckets(literals);
+  const auto literal_count = literals.size();
+
+  for (auto variant_iter = _variants.rbegin(); variant_iter != _variants.rend(); ++variant_iter) {
+    const auto& variant = *variant_iter;
+    if (variant.selectivity_buckets != selectivity_buckets) continue;
+
+    auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+    parameters.reserve(variant.prepared_plan->parameter_ids.size());
+
+    auto literals_match = true;
+    for (auto literal_idx = size_t{0}; literal_idx < literal_count; ++literal_idx) {
+      if (_is_parameterized[literal_idx]) {
+        parameters.emplace_back(value_(literals[literal_idx]));
+      } else if (!(variant.literals[literal_idx] == literals[literal_idx])) {
+        literals_match = false;
+        break;
+      }
+    }
+    if (!literals_match) continue;
+
+    return chunk_pruning_optimizer().optimize(variant.prepared_plan->instantiate(parameters));
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<ParameterizedPlan> ParameterizedPlan::add_variant(const std::vector<AllTypeVariant>& literals) const {
+  DebugAssert(is_parameterizable(), "Cannot add variant to plan that is not parameterizable");
+
+  auto variant = _optimize_variant(literals);
+  if (!variant) return nullptr;
+
+  auto parameterized_plan = std::make_shared<ParameterizedPlan>(*this);
+  auto& variants = parameterized_plan->_variants;
+  if (variants.size() >= MAX_VARIANT_COUNT) {
+    variants.erase(variants.begin(), variants.begin() + (variants.size() - MAX_VARIANT_COUNT + 1));
+  }
+  variants.emplace_back(std::move(*variant));
+
+  return parameterized_plan;
+}
+
+std::vector<int32_t> ParameterizedPlan::_selectivity_buckets(const std::vector<AllTypeVariant>& literals) const {
+  auto selectivity_buckets = std::vector<int32_t>{};
+  selectivity_buckets.reserve(_selectivity_probes.size());
+
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& selectivity_probe : _selectivity_probes) {
+    const auto& table_name = selectivity_probe.table_name;
+    const auto table = storage_manager.has_table(table_name) ? storage_manager.get_table(table_name) : nullptr;
+    const auto table_statistics = table ? table->table_statistics() : nullptr;
+    if (!table_statistics || table_statistics->row_count == 0.0f) {
+      selectivity_buckets.emplace_back(0);
+      continue;
+    }
+
+    auto predicate = OperatorScanPredicate{selectivity_probe.column_id, selectivity_probe.predicate_condition,
+                                           literals[selectivity_probe.literal_idx]};
+    if (selectivity_probe.literal2_idx) predicate.value2 = literals[*selectivity_probe.literal2_idx];
+
+    const auto output_statistics = CardinalityEstimator::estimate_operator_scan_predicate(table_statistics, predicate);
+    selectivity_buckets.emplace_back(selectivity_bucket(output_statistics->row_count / table_statistics->row_count));
+  }
+
+  return selectivity_buckets;
+}
+
+std::optional<ParameterizedPlan::Variant> ParameterizedPlan::_optimize_variant(
+    const std::vector<AllTypeVariant>& literals) const {
+  const auto literal_count = literals.size();
+
+  // Bind the literals that are not parameterized and estimate the parameterized ones as if they were bound, too
+  auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+  parameters.reserve(literal_count);
+  auto parameterized_parameter_ids = std::vector<ParameterID>{};
+  const auto cardinality_estimator = std::make_shared<CardinalityEstimator>();
+
+  for (auto literal_idx = size_t{0}; literal_idx < literal_count; ++literal_idx) {
+    const auto parameter_id = _parameter_ids[literal_idx];
+    if (_is_parameterized[literal_idx]) {
+      parameters.emplace_back(placeholder_(parameter_id));
+      parameterized_parameter_ids.emplace_back(parameter_id);
+      cardinality_estimator->placeholder_values.emplace(parameter_id, literals[literal_idx]);
+    } else {
+      parameters.emplace_back(value_(literals[literal_idx]));
+    }
+  }
+
+  // Rules might not be able to handle placeholders in all places, e.g., if they need their data type. Such statements
+  // are not parameterized.
+  try {
+    auto lqp = PreparedPlan{_lqp, _parameter_ids}.instantiate(parameters);
+    const auto optimizer =
+        Optimizer::create_default_optimizer(std::make_shared<CostEstimatorLogical>(cardinality_estimator));
+    const auto optimized_lqp = optimizer->optimize(std::move(lqp));
+
+    return Variant{literals, _selectivity_buckets(literals),
+                   std::make_shared<PreparedPlan>(optimized_lqp, parameterized_parameter_ids)};
+  } catch (const std::exception&) {
+    return std::nullopt;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "sql/normalize_sql_literals.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class PreparedPlan;
+
+/**
+ * Optimized LQPs for all statements that have the same normalized SQL string (see normalize_sql_literals()), i.e., that
+ * only differ in their literals. Used by the SQLPipelineStatement if an SQLParameterizedPlanCache is given, so that
+ * statements that are not prepared, but sent with different literals (e.g., by an ORM), are not parsed, translated,
+ * and optimized again.
+ *
+ * The literals that are compared with a column in a predicate (e.g., `a < 5`, `a BETWEEN 5 AND 7`, `a LIKE 'b%'`) are
+ * parameterized: The cached LQPs have PlaceholderExpressions instead, to which the literals of a statement are bound
+ * the way PreparedPlan::instantiate() does. All other literals (e.g., in the select list, in IN lists, or in LIMIT) are
+ * part of the cached LQPs and have to be the same for a plan to be reused.
+ *
+ * As the optimizer cannot see the values of the placeholders, it would choose the same plan for selective and
+ * unselective values. Thus, each plan is optimized with the estimated selectivities of the literals it was created for
+ * (see CardinalityEstimator::placeholder_values). For every parameterized predicate on a stored table, the selectivity
+ * of the literals is estimated using the table's statistics and put into a bucket per order of magnitude. A plan is
+ * only reused if the literals fall into the same buckets. Otherwise, another variant is optimized and cached, up to
+ * MAX_VARIANT_COUNT variants per normalized SQL string. As chunks cannot be pruned for placeholders, the
+ * ChunkPruningRule is applied to the instantiated plans again.
+ *
+ * Cached ParameterizedPlans are immutable, so that they can be shared between threads. add_variant() returns a copy.
+ */
+class ParameterizedPlan final {
+ public:
+  // Maximum number of plans that are optimized for different selectivity buckets or non-parameterized literals
+  static constexpr auto MAX_VARIANT_COUNT = size_t{8};
+
+  // Selectivities of up to 10^MIN_SELECTIVITY_BUCKET share the lowest bucket
+  static constexpr auto MIN_SELECTIVITY_BUCKET = int32_t{-6};
+
+  // The key under which the plan for the normalized statement is cached. Includes the data types of the literals, as
+  // predicates on different data types might have different plans.
+  static std::string cache_key(const NormalizedSQL& normalized_sql, const UseMvcc use_mvcc);
+
+  // Parses, translates, and optimizes the normalized statement for the given literals. If the statement is not a
+  // SELECT, UPDATE, or DELETE, cannot be cached, or has no literals that can be parameterized, the returned plan is
+  // not parameterizable. This is cached as well, so that the statement is not parsed twice every time.
+  static std::shared_ptr<ParameterizedPlan> create(const NormalizedSQL& normalized_sql, const UseMvcc use_mvcc);
+
+  bool is_parameterizable() const;
+
+  size_t variant_count() const;
+
+  // Returns the optimized LQP with the literals bound to its placeholders, or nullptr if there is no variant for
+  // the literals' selectivity buckets and non-parameterized literals.
+  std::shared_ptr<AbstractLQPNode> instantiate(const std::vector<AllTypeVariant>& literals) const;
+
+  // Returns a copy of this plan with an additional variant optimized for the literals. If there are MAX_VARIANT_COUNT
+  // variants already, the oldest one is replaced. Returns nullptr if the plan could not be optimized.
+  std::shared_ptr<ParameterizedPlan> add_variant(const std::vector<AllTypeVariant>& literals) const;
+
+ protected:
+  // A predicate `<column> <predicate_condition> <literal> [AND <literal2>]` on a column of a stored table
+  struct SelectivityProbe {
+    std::string table_name;
+    ColumnID column_id;
+    PredicateCondition predicate_condition;
+    size_t literal_idx;
+    std::optional<size_t> literal2_idx;
+  };
+
+  struct Variant {
+    // The literals that the plan was optimized for. Only the non-parameterized ones have to match.
+    std::vector<AllTypeVariant> literals;
+    std::vector<int32_t> selectivity_buckets;
+    std::shared_ptr<PreparedPlan> prepared_plan;
+  };
+
+  std::vector<int32_t> _selectivity_buckets(const std::vector<AllTypeVariant>& literals) const;
+
+  std::optional<Variant> _optimize_variant(const std::vector<AllTypeVariant>& literals) const;
+
+  // The unoptimized LQP of the normalized statement, with a PlaceholderExpression for every literal
+  std::shared_ptr<AbstractLQPNode> _lqp;
+
+  // The ParameterID of each literal's placeholder in _lqp and whether it is parameterized
+  std::vector<ParameterID> _parameter_ids;
+  std::vector<bool> _is_parameterized;
+
+  std::vector<SelectivityProbe> _selectivity_probes;
+
+  // Ordered from the oldest to the newest variant
+  std::vector<Variant> _variants;
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -36,7 +37,9 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+              const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache,
+              const ExecutionMode execution_mode, const std::optional<size_t>& memory_budget);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
@@ -93,6 +96,7 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLParameterizedPlanCache> parameterized_plan_cache;
 
  private:
   std::string _sql;
@@ -5,7 +5,10 @@
 namespace opossum {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
-    : _sql(sql), _pqp_cache(Hyrise::get().default_pqp_cache), _lqp_cache(Hyrise::get().default_lqp_cache) {}
+    : _sql(sql),
+      _pqp_cache(Hyrise::get().default_pqp_cache),
+      _lqp_cache(Hyrise::get().default_lqp_cache),
+      _parameterized_plan_cache(Hyrise::get().default_parameterized_plan_cache) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -35,13 +38,29 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_parameterized_plan_cache(
+    const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_plan_cache) {
+  _parameterized_plan_cache = parameterized_plan_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_execution_mode(const ExecutionMode execution_mode) {
+  _execution_mode = execution_mode;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_budget(const size_t memory_budget) {
+  _memory_budget = memory_budget;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline =
-      SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache,
+                              _parameterized_plan_cache, _execution_mode, _memory_budget);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_per_statement().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -51,8 +70,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,       std::move(parsed_sql), _use_mvcc, _transaction_context, optimizer, _pqp_cache,
-          _lqp_cache};
+  return {_sql,       std::move(parsed_sql),     _use_mvcc,       _transaction_context, optimizer,
+          _pqp_cache, _lqp_cache, _parameterized_plan_cache, _execution_mode, _memory_budget};
 }
 
 }  // namespace opossum
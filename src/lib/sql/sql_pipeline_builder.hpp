@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -28,6 +29,8 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - Operators are executed one after another (ExecutionMode::Materializing).
+ *  - Operators do not have a memory budget, i.e., they never spill intermediate data to disk.
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -43,6 +46,21 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
 
+  /**
+   * Cache for the optimized LQPs of statements that only differ in their literals, see ParameterizedPlan. It is used
+   * before the LQP is translated and optimized, but after the SQLLogicalPlanCache, which is looked up by the exact SQL
+   * string. Plans from this cache are optimized with the default Optimizer, not the one passed to with_optimizer().
+   */
+  SQLPipelineBuilder& with_parameterized_plan_cache(
+      const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_plan_cache);
+  SQLPipelineBuilder& with_execution_mode(const ExecutionMode execution_mode);
+
+  /**
+   * Number of bytes that each operator of the query may use for its intermediate data structures before spilling them
+   * to disk, see AbstractOperator::memory_budget().
+   */
+  SQLPipelineBuilder& with_memory_budget(const size_t memory_budget);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -64,6 +82,9 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<SQLParameterizedPlanCache> _parameterized_plan_cache;
+  ExecutionMode _execution_mode{ExecutionMode::Materializing};
+  std::optional<size_t> _memory_budget;
 };
 
 }  // namespace opossum
@@ -13,12 +13,15 @@
 #include "logical_query_plan/lqp_utils.hpp"
 #include "operators/export.hpp"
 #include "operators/import.hpp"
+#include "operators/join_runtime_filter.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
 #include "optimizer/optimizer.hpp"
+#include "sql/normalize_sql_literals.hpp"
+#include "sql/parameterized_plan.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
@@ -27,16 +30,20 @@
 
 namespace opossum {
 
-SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                                           const UseMvcc use_mvcc,
-                                           const std::shared_ptr<TransactionContext>& transaction_context,
-                                           const std::shared_ptr<Optimizer>& optimizer,
-                                           const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+SQLPipelineStatement::SQLPipelineStatement(
+    const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql, const UseMvcc use_mvcc,
+    const std::shared_ptr<TransactionContext>& transaction_context, const std::shared_ptr<Optimizer>& optimizer,
+    const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
+    const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+    const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache, const ExecutionMode execution_mode,
+    const std::optional<size_t>& memory_budget)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      parameterized_plan_cache(init_parameterized_plan_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
+      _execution_mode(execution_mode),
+      _memory_budget(memory_budget),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
       _optimizer(optimizer),
@@ -117,6 +124,11 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     }
   }
 
+  if (parameterized_plan_cache) {
+    _optimized_logical_plan = _instantiate_parameterized_plan();
+    if (_optimized_logical_plan) return _optimized_logical_plan;
+  }
+
   auto unoptimized_lqp = get_unoptimized_logical_plan();
 
   const auto started = std::chrono::high_resolution_clock::now();
@@ -139,6 +151,48 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   return _optimized_logical_plan;
 }
 
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_instantiate_parameterized_plan() {
+  const auto normalized_sql = normalize_sql_literals(_sql_string);
+  if (!normalized_sql || normalized_sql->literals.empty()) return nullptr;
+
+  // The time spent on parsing and translating new statements is included in the optimization duration
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  const auto cache_key = ParameterizedPlan::cache_key(*normalized_sql, _use_mvcc);
+  auto lqp = std::shared_ptr<AbstractLQPNode>{};
+
+  if (const auto cached_plan = parameterized_plan_cache->try_get(cache_key)) {
+    const auto& parameterized_plan = *cached_plan;
+    if (!parameterized_plan->is_parameterizable()) return nullptr;
+
+    lqp = parameterized_plan->instantiate(normalized_sql->literals);
+    if (lqp) {
+      _metrics->parameterized_plan_cache_hit = true;
+    } else {
+      // The literals fall into other selectivity buckets than those of the cached variants
+      const auto extended_plan = parameterized_plan->add_variant(normalized_sql->literals);
+      if (!extended_plan) return nullptr;
+
+      parameterized_plan_cache->set(cache_key, extended_plan);
+      lqp = extended_plan->instantiate(normalized_sql->literals);
+    }
+  } else {
+    const auto parameterized_plan = ParameterizedPlan::create(*normalized_sql, _use_mvcc);
+    parameterized_plan_cache->set(cache_key, parameterized_plan);
+    if (!parameterized_plan->is_parameterizable()) return nullptr;
+
+    lqp = parameterized_plan->instantiate(normalized_sql->literals);
+  }
+
+  // The new variant is not found if the statistics changed in the meantime
+  if (!lqp) return nullptr;
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->optimization_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+
+  return lqp;
+}
+
 const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan() {
   if (_physical_plan) {
     return _physical_plan;
@@ -180,11 +234,18 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
   if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  // Cache newly created plan for the according sql statement (only if not already cached)
+  // Cache newly created plan for the according sql statement (only if not already cached). Runtime filters belong to
+  // a single execution of the plan (see JoinRuntimeFilter). Thus, they are not added to the cached plan, but only to
+  // the copy that is executed.
   if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
     pqp_cache->set(_sql_string, _physical_plan);
+    _physical_plan = _physical_plan->deep_copy();
+    if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
   }
 
+  if (_memory_budget) _physical_plan->set_memory_budget_recursively(_memory_budget);
+  add_join_runtime_filters(_physical_plan);
+
   _metrics->lqp_translation_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
 
   return _physical_plan;
@@ -195,7 +256,7 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
     return _tasks;
   }
 
-  _tasks = OperatorTask::make_tasks_from_operator(get_physical_plan());
+  _tasks = OperatorTask::make_tasks_from_operator(get_physical_plan(), _execution_mode);
   return _tasks;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
@@ -21,6 +22,9 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+
+  // Whether the optimized LQP was instantiated from a plan in the SQLParameterizedPlanCache
+  bool parameterized_plan_cache_hit = false;
 };
 
 enum class SQLPipelineStatus {
@@ -52,7 +56,9 @@ class SQLPipelineStatement : public Noncopyable {
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache,
+                       const ExecutionMode execution_mode, const std::optional<size_t>& memory_budget);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -64,6 +70,8 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<AbstractLQPNode>& get_unoptimized_logical_plan();
 
   // Returns the optimized LQP for this statement.
+  // The optimized LQP is either retrieved from the SQLLogicalPlanCache, instantiated from the
+  // SQLParameterizedPlanCache, or, if unavailable, optimized from the unoptimized LQP.
   const std::shared_ptr<AbstractLQPNode>& get_optimized_logical_plan();
 
   // Returns the PQP for this statement.
@@ -91,8 +99,13 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLParameterizedPlanCache> parameterized_plan_cache;
 
  private:
+  // Returns the optimized LQP instantiated from the parameterized_plan_cache, after adding the plan for the
+  // statement to it if necessary. Returns nullptr if the statement's literals cannot be parameterized.
+  std::shared_ptr<AbstractLQPNode> _instantiate_parameterized_plan();
+
   // Performs a sanity check in order to prevent an execution of a predictably failing DDL operator (e.g., creating a
   // table that already exists).
   // Throws an InvalidInputException if an invalid PQP is detected.
@@ -100,6 +113,8 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
+  const ExecutionMode _execution_mode;
+  const std::optional<size_t> _memory_budget;
 
   // Perform MVCC commit right after the Statement was executed
   const bool _auto_commit;
@@ -9,8 +9,12 @@ namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class ParameterizedPlan;
 
 using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string>;
 using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string>;
 
+// Caches the plans of statements that only differ in their literals, keyed by ParameterizedPlan::cache_key()
+using SQLParameterizedPlanCache = Cache<std::shared_ptr<ParameterizedPlan>, std::string>;
+
 }  // namespace opossum
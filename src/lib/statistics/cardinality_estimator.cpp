@@ -72,7 +72,9 @@ namespace opossum {
 using namespace opossum::expression_functional;  // NOLINT
 
 std::shared_ptr<AbstractCardinalityEstimator> CardinalityEstimator::new_instance() const {
-  return std::make_shared<CardinalityEstimator>();
+  const auto cardinality_estimator = std::make_shared<CardinalityEstimator>();
+  cardinality_estimator->placeholder_values = placeholder_values;
+  return cardinality_estimator;
 }
 
 Cardinality CardinalityEstimator::estimate_cardinality(const std::shared_ptr<AbstractLQPNode>& lqp) const {
@@ -150,7 +152,8 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
 
     case LQPNodeType::Predicate: {
       const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(lqp);
-      output_table_statistics = estimate_predicate_node(*predicate_node, left_input_table_statistics);
+      output_table_statistics =
+          estimate_predicate_node(*predicate_node, left_input_table_statistics, placeholder_values);
     } break;
 
     case LQPNodeType::Projection: {
@@ -308,7 +311,8 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_validate_node(
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
-    const PredicateNode& predicate_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
+    const PredicateNode& predicate_node, const std::shared_ptr<TableStatistics>& input_table_statistics,
+    const std::unordered_map<ParameterID, AllTypeVariant>& placeholder_values) {
   // For PredicateNodes, the statistics of the columns scanned on are sliced and all other columns' statistics are
   // scaled with the estimated selectivity of the predicate.
 
@@ -320,11 +324,13 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
 
       const auto left_predicate_node =
           PredicateNode::make(logical_expression->left_operand(), predicate_node.left_input());
-      const auto left_statistics = estimate_predicate_node(*left_predicate_node, input_table_statistics);
+      const auto left_statistics =
+          estimate_predicate_node(*left_predicate_node, input_table_statistics, placeholder_values);
 
       const auto right_predicate_node =
           PredicateNode::make(logical_expression->right_operand(), predicate_node.left_input());
-      const auto right_statistics = estimate_predicate_node(*right_predicate_node, input_table_statistics);
+      const auto right_statistics =
+          estimate_predicate_node(*right_predicate_node, input_table_statistics, placeholder_values);
 
       const auto row_count = Cardinality{
           std::min(left_statistics->row_count + right_statistics->row_count, input_table_statistics->row_count)};
@@ -347,11 +353,12 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
 
       const auto first_predicate_node =
           PredicateNode::make(logical_expression->left_operand(), predicate_node.left_input());
-      const auto first_predicate_statistics = estimate_predicate_node(*first_predicate_node, input_table_statistics);
+      const auto first_predicate_statistics =
+          estimate_predicate_node(*first_predicate_node, input_table_statistics, placeholder_values);
 
       const auto second_predicate_node = PredicateNode::make(logical_expression->right_operand(), first_predicate_node);
       const auto second_predicate_statistics =
-          estimate_predicate_node(*second_predicate_node, first_predicate_statistics);
+          estimate_predicate_node(*second_predicate_node, first_predicate_statistics, placeholder_values);
 
       return second_predicate_statistics;
     }
@@ -394,7 +401,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
 
     const auto disjunction = inflate_logical_expressions(expressions, LogicalOperator::Or);
     const auto new_predicate_node = PredicateNode::make(disjunction, predicate_node.left_input());
-    return estimate_predicate_node(*new_predicate_node, input_table_statistics);
+    return estimate_predicate_node(*new_predicate_node, input_table_statistics, placeholder_values);
   }
 
   const auto operator_scan_predicates = OperatorScanPredicate::from_expression(*predicate, predicate_node);
@@ -406,7 +413,16 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
   } else {
     auto output_table_statistics = input_table_statistics;
 
-    for (const auto& operator_scan_predicate : *operator_scan_predicates) {
+    for (auto operator_scan_predicate : *operator_scan_predicates) {
+      // Estimate ColumnVsPlaceholder as ColumnVsValue if the value of the placeholder is known
+      const auto bind_placeholder = [&](AllParameterVariant& value) {
+        if (value.type() != typeid(ParameterID)) return;
+        const auto placeholder_value_iter = placeholder_values.find(boost::get<ParameterID>(value));
+        if (placeholder_value_iter != placeholder_values.end()) value = placeholder_value_iter->second;
+      };
+      bind_placeholder(operator_scan_predicate.value);
+      if (operator_scan_predicate.value2) bind_placeholder(*operator_scan_predicate.value2);
+
       output_table_statistics = estimate_operator_scan_predicate(output_table_statistics, operator_scan_predicate);
     }
 
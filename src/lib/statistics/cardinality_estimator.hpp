@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 
 #include "boost/dynamic_bitset.hpp"
 
@@ -52,7 +53,8 @@ class CardinalityEstimator : public AbstractCardinalityEstimator {
       const ValidateNode& validate_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
 
   static std::shared_ptr<TableStatistics> estimate_predicate_node(
-      const PredicateNode& predicate_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
+      const PredicateNode& predicate_node, const std::shared_ptr<TableStatistics>& input_table_statistics,
+      const std::unordered_map<ParameterID, AllTypeVariant>& placeholder_values = {});
 
   static std::shared_ptr<TableStatistics> estimate_join_node(
       const JoinNode& join_node, const std::shared_ptr<TableStatistics>& left_input_table_statistics,
@@ -126,5 +128,12 @@ class CardinalityEstimator : public AbstractCardinalityEstimator {
       const std::shared_ptr<TableStatistics>& table_statistics, const std::vector<ColumnID>& pruned_column_ids);
 
   /** @} */
+
+  /**
+   * Values that the PlaceholderExpressions in the estimated plans are expected to be bound to. Predicates comparing a
+   * column with such a placeholder are estimated as if the placeholder was the value. The plan is still valid for other
+   * values, but it is chosen for these. Used by the ParameterizedPlan. Copied by new_instance().
+   */
+  std::unordered_map<ParameterID, AllTypeVariant> placeholder_values;
 };
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "equal_distinct_count_histogram.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 #include <memory>
@@ -90,9 +91,17 @@ EqualDistinctCountHistogram<T>::EqualDistinctCountHistogram(std::vector<T>&& bin
 template <typename T>
 std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_column(
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
-  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+  return from_distribution(value_distribution_from_column(table, column_id, domain), max_bin_count, domain);
+}
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_distribution(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+    const HistogramDomain<T>& domain) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+  DebugAssert(std::is_sorted(value_distribution.cbegin(), value_distribution.cend(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }),
+              "Value distribution must be sorted by value");
 
   if (value_distribution.empty()) {
     return nullptr;
@@ -36,6 +36,15 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Create an EqualDistinctCountHistogram from the number of occurrences of each value, sorted by value. Returns
+   * nullptr if @param value_distribution is empty.
+   * @param max_bin_count   Desired number of bins. Less might be created, but never more. Must not be zero.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_distribution(
+      std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+      const HistogramDomain<T>& domain = {});
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -1,18 +1,264 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
-#include <thread>
+#include <random>
+#include <unordered_map>
+#include <utility>
 
 #include "attribute_statistics.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram_builder.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Chunk ranges with fewer rows are not split further, as counting them is cheaper than scheduling another JobTask
+constexpr auto MIN_ROWS_PER_JOB = size_t{50'000};
+
+// Occurrences of the non-null values in a range of chunks. The distributions of a column's chunk ranges are merged
+// before its histogram is built.
+template <typename T>
+struct ValueDistribution {
+  void merge(ValueDistribution<T>&& other) {
+    // Insert the smaller map into the larger one
+    if (other.value_counts.size() > value_counts.size()) {
+      std::swap(value_counts, other.value_counts);
+    }
+    for (const auto& [value, count] : other.value_counts) {
+      value_counts[value] += count;
+    }
+    row_count += other.row_count;
+    null_count += other.null_count;
+  }
+
+  std::unordered_map<T, HistogramCountType> value_counts;
+
+  // Number of counted rows, including NULLs. When sampling, only the sampled rows are counted.
+  size_t row_count{0};
+  size_t null_count{0};
+};
+
+template <typename T>
+void count_chunks(ValueDistribution<T>& distribution, const Table& table, const ColumnID column_id,
+                  const ChunkID begin_chunk_id, const ChunkID end_chunk_id, const double sampling_ratio) {
+  const auto domain = HistogramDomain<T>{};
+
+  const auto count_position = [&](const auto& position) {
+    ++distribution.row_count;
+    if (position.is_null()) {
+      ++distribution.null_count;
+      return;
+    }
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      // Do "contains()" check first to avoid the string copy incurred by string_to_domain() where possible
+      if (domain.contains(position.value())) {
+        ++distribution.value_counts[position.value()];
+      } else {
+        ++distribution.value_counts[domain.string_to_domain(position.value())];
+      }
+    } else {
+      ++distribution.value_counts[position.value()];
+    }
+  };
+
+  for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& segment = *chunk->get_segment(column_id);
+    if (sampling_ratio >= 1.0) {
+      segment_iterate<T>(segment, count_position);
+      continue;
+    }
+
+    // Bernoulli sample: Each row is sampled with a probability of sampling_ratio, so the gaps between the sampled rows
+    // are geometrically distributed. The generator is seeded with the ChunkID so that the sample is deterministic.
+    auto generator = std::mt19937{static_cast<uint32_t>(chunk_id)};
+    auto gap_distribution = std::geometric_distribution<uint64_t>{sampling_ratio};
+
+    const auto chunk_size = uint64_t{chunk->size()};
+    auto sampled_positions = std::make_shared<RowIDPosList>();
+    for (auto chunk_offset = gap_distribution(generator); chunk_offset < chunk_size;
+         chunk_offset += gap_distribution(generator) + 1) {
+      sampled_positions->emplace_back(chunk_id, static_cast<ChunkOffset>(chunk_offset));
+    }
+    if (sampled_positions->empty()) continue;
+
+    sampled_positions->guarantee_single_chunk();
+    segment_iterate_filtered<T>(segment, sampled_positions, count_position);
+  }
+}
+
+template <typename T>
+std::vector<std::pair<T, HistogramCountType>> sorted_value_counts(ValueDistribution<T>& distribution) {
+  auto value_counts = std::vector<std::pair<T, HistogramCountType>>{distribution.value_counts.begin(),
+                                                                     distribution.value_counts.end()};
+  distribution.value_counts.clear();
+  std::sort(value_counts.begin(), value_counts.end(),
+            [&](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  return value_counts;
+}
+
+// Builds a histogram from a sample with equally many sampled distinct values per bin. The heights are scaled up by the
+// inverse sampling ratio and the distinct counts are estimated with the GEE estimator: Values that occur more than
+// once in the sample are assumed to be frequent and counted once. Each value that occurs exactly once in the sample
+// stands for sqrt(1 / sampling_ratio) distinct values.
+template <typename T>
+std::shared_ptr<AbstractHistogram<T>> histogram_from_sample(
+    std::vector<std::pair<T, HistogramCountType>>&& value_counts, const BinID max_bin_count,
+    const double sampling_ratio) {
+  if (value_counts.empty()) return nullptr;
+
+  const auto bin_count = std::min(max_bin_count, static_cast<BinID>(value_counts.size()));
+  const auto singleton_scale = std::sqrt(1.0 / sampling_ratio);
+
+  auto builder = GenericHistogramBuilder<T>{bin_count};
+  auto begin_value_idx = size_t{0};
+  for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+    const auto end_value_idx = (bin_id + 1) * value_counts.size() / bin_count;
+
+    auto sampled_height = HistogramCountType{0};
+    auto singleton_count = size_t{0};
+    for (auto value_idx = begin_value_idx; value_idx < end_value_idx; ++value_idx) {
+      sampled_height += value_counts[value_idx].second;
+      if (value_counts[value_idx].second == 1) ++singleton_count;
+    }
+
+    const auto sampled_distinct_count = end_value_idx - begin_value_idx;
+    const auto height = static_cast<HistogramCountType>(sampled_height / sampling_ratio);
+    const auto distinct_count =
+        static_cast<HistogramCountType>(singleton_scale * static_cast<double>(singleton_count) +
+                                        static_cast<double>(sampled_distinct_count - singleton_count));
+
+    builder.add_bin(value_counts[begin_value_idx].first, value_counts[end_value_idx - 1].first, height,
+                    std::min(height, distinct_count));
+    begin_value_idx = end_value_idx;
+  }
+
+  return builder.build();
+}
+
+// Estimates the number of distinct values in the union of two bins with the same bounds. For integral types, the
+// values of both bins are assumed to be drawn independently and uniformly from the bin's range. For other types, the
+// range is practically unlimited, so the bins are assumed to share no values.
+template <typename T>
+HistogramCountType union_distinct_count(const HistogramBin<T>& bin, const HistogramCountType other_distinct_count) {
+  if constexpr (std::is_integral_v<T>) {
+    const auto width = static_cast<double>(bin.max) - static_cast<double>(bin.min) + 1.0;
+    const auto union_distinct_count =
+        width * (1.0 - (1.0 - bin.distinct_count / width) * (1.0 - other_distinct_count / width));
+    return static_cast<HistogramCountType>(std::max({union_distinct_count, double{bin.distinct_count},
+                                                     double{other_distinct_count}}));
+  } else {
+    return bin.distinct_count + other_distinct_count;
+  }
+}
+
+// Merges the histograms of two disjoint sets of rows. Both histograms are split at the union of their bin bounds, so
+// that their bins are either equal or do not overlap. The distinct counts of equal bins are combined with
+// union_distinct_count(). The merged bins are then combined into about max_bin_count bins with similar
+// distinct counts.
+template <typename T>
+std::shared_ptr<AbstractHistogram<T>> merge_histograms(const AbstractHistogram<T>& lhs, const AbstractHistogram<T>& rhs,
+                                                       const BinID max_bin_count) {
+  const auto lhs_split = lhs.split_at_bin_bounds(rhs.bin_bounds());
+  const auto rhs_split = rhs.split_at_bin_bounds(lhs.bin_bounds());
+
+  auto merged_bins = std::vector<HistogramBin<T>>{};
+  merged_bins.reserve(lhs_split->bin_count() + rhs_split->bin_count());
+  auto lhs_bin_id = BinID{0};
+  auto rhs_bin_id = BinID{0};
+  while (lhs_bin_id < lhs_split->bin_count() || rhs_bin_id < rhs_split->bin_count()) {
+    if (rhs_bin_id == rhs_split->bin_count() ||
+        (lhs_bin_id < lhs_split->bin_count() &&
+         lhs_split->bin_minimum(lhs_bin_id) < rhs_split->bin_minimum(rhs_bin_id))) {
+      merged_bins.emplace_back(lhs_split->bin(lhs_bin_id++));
+    } else if (lhs_bin_id == lhs_split->bin_count() ||
+               rhs_split->bin_minimum(rhs_bin_id) < lhs_split->bin_minimum(lhs_bin_id)) {
+      merged_bins.emplace_back(rhs_split->bin(rhs_bin_id++));
+    } else {
+      auto bin = lhs_split->bin(lhs_bin_id++);
+      const auto rhs_bin = rhs_split->bin(rhs_bin_id++);
+      DebugAssert(bin.max == rhs_bin.max, "Split histograms should have equal bins");
+      bin.height += rhs_bin.height;
+      bin.distinct_count = union_distinct_count(bin, rhs_bin.distinct_count);
+      merged_bins.emplace_back(std::move(bin));
+    }
+  }
+
+  if (merged_bins.empty()) return nullptr;
+
+  const auto total_distinct_count =
+      std::accumulate(merged_bins.cbegin(), merged_bins.cend(), HistogramCountType{0},
+                      [](const auto sum, const auto& bin) { return sum + bin.distinct_count; });
+  const auto distinct_count_per_bin = total_distinct_count / static_cast<HistogramCountType>(max_bin_count);
+
+  auto builder = GenericHistogramBuilder<T>{max_bin_count, lhs.domain()};
+  auto combined_bin = merged_bins.front();
+  for (auto bin_idx = size_t{1}; bin_idx < merged_bins.size(); ++bin_idx) {
+    const auto& bin = merged_bins[bin_idx];
+    if (combined_bin.distinct_count + bin.distinct_count > distinct_count_per_bin) {
+      builder.add_bin(combined_bin.min, combined_bin.max, combined_bin.height, combined_bin.distinct_count);
+      combined_bin = bin;
+    } else {
+      combined_bin.max = bin.max;
+      combined_bin.height += bin.height;
+      combined_bin.distinct_count += bin.distinct_count;
+    }
+  }
+  builder.add_bin(combined_bin.min, combined_bin.max, combined_bin.height, combined_bin.distinct_count);
+
+  return builder.build();
+}
+
+// Number of rows that the sample has to contain so that the share of the rows in any value range deviates by at most
+// sampling_error from the sampled share with a probability of SAMPLING_CONFIDENCE (Dvoretzky-Kiefer-Wolfowitz).
+double sampling_ratio(const size_t row_count, const std::optional<float> sampling_error) {
+  if (!sampling_error || row_count == 0) return 1.0;
+
+  Assert(*sampling_error > 0.0f && *sampling_error < 1.0f, "Sampling error must be in (0, 1)");
+  const auto sample_size = std::ceil(std::log(2.0 / (1.0 - TableStatistics::SAMPLING_CONFIDENCE)) /
+                                     (2.0 * *sampling_error * *sampling_error));
+  return std::min(1.0, sample_size / static_cast<double>(row_count));
+}
+
+}  // namespace
+
 namespace opossum {
 
-std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
-  std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
+std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table,
+                                                             const std::optional<float> sampling_error) {
+  return _generate(table, nullptr, ChunkID{0}, sampling_error);
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::from_appended_chunks(const Table& table,
+                                                                       const TableStatistics& previous_statistics,
+                                                                       const ChunkID first_appended_chunk_id,
+                                                                       const std::optional<float> sampling_error) {
+  Assert(previous_statistics.column_statistics.size() == static_cast<size_t>(table.column_count()),
+         "Previous statistics do not match the table");
+  return _generate(table, &previous_statistics, first_appended_chunk_id, sampling_error);
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::_generate(const Table& table,
+                                                            const TableStatistics* previous_statistics,
+                                                            const ChunkID first_appended_chunk_id,
+                                                            const std::optional<float> sampling_error) {
+  const auto column_count = table.column_count();
+  const auto chunk_count = table.chunk_count();
+  Assert(first_appended_chunk_id <= chunk_count, "Appended chunks are out of the table's bounds");
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
 
   /**
    * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
@@ -20,57 +266,148 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
    */
   const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
 
-  auto next_column_id = std::atomic<size_t>{0u};
-  auto threads = std::vector<std::thread>{};
+  /**
+   * Immutable chunks cannot change while they are scanned, so their rows are covered by the statistics exactly. Thus,
+   * only the run of immutable chunks that starts at first_appended_chunk_id is scanned, and the next rebuild continues
+   * with the first mutable chunk (see first_unscanned_chunk_id). Tables without previous statistics that start with a
+   * mutable chunk are scanned completely instead, as their histograms would be empty otherwise.
+   */
+  auto end_chunk_id = first_appended_chunk_id;
+  for (; end_chunk_id < chunk_count; ++end_chunk_id) {
+    const auto chunk = table.get_chunk(end_chunk_id);
+    if (chunk && chunk->is_mutable()) break;
+  }
+  const auto scan_mutable_chunks = !previous_statistics && end_chunk_id == first_appended_chunk_id;
+  if (scan_mutable_chunks) end_chunk_id = chunk_count;
+
+  auto previous_row_count = size_t{0};
+  auto appended_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < end_chunk_id; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    if (chunk_id < first_appended_chunk_id) {
+      previous_row_count += chunk->size();
+    } else {
+      appended_row_count += chunk->size();
+    }
+  }
 
   /**
-   * Parallely create statistics objects for the Table's columns
+   * The values of each column are counted in ranges of chunks, so that there are enough jobs to keep all workers busy
+   * even for tables with few columns. Once all ranges are counted, a second set of jobs merges the ranges of each
+   * column and builds its statistics.
    */
-  for (auto thread_id = 0u;
-       thread_id < std::min(static_cast<uint>(table.column_count()), std::thread::hardware_concurrency() + 1);
-       ++thread_id) {
-    threads.emplace_back([&] {
-      while (true) {
-        auto my_column_id = ColumnID{static_cast<ColumnID::base_type>(next_column_id++)};
-        if (static_cast<ColumnCount>(my_column_id) >= table.column_count()) return;
-
-        const auto column_data_type = table.column_data_type(my_column_id);
-
-        resolve_data_type(column_data_type, [&](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
-
-          const auto histogram =
-              EqualDistinctCountHistogram<ColumnDataType>::from_column(table, my_column_id, histogram_bin_count);
-
-          if (histogram) {
-            output_column_statistics->set_statistics_object(histogram);
-
-            // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio
-            // property
-            const auto null_value_ratio =
-                table.row_count() == 0 ? 0.0f
-                                       : 1.0f - (static_cast<float>(histogram->total_count()) / table.row_count());
-            output_column_statistics->set_statistics_object(
-                std::make_shared<NullValueRatioStatistics>(null_value_ratio));
-          } else {
-            // Failure to generate a histogram currently only stems from all-null segments.
-            // TODO(anybody) this is a slippery assumption. But the alternative would be a full segment scan...
-            output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
-          }
+  const auto worker_count = Hyrise::get().scheduler()->active() ? Hyrise::get().topology.num_cpus() : size_t{1};
+  const auto max_range_count = std::max(2 * worker_count / std::max(size_t{column_count}, size_t{1}), size_t{1});
+
+  auto count_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto build_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
 
-          column_statistics[my_column_id] = output_column_statistics;
-        });
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // Histograms of string columns cannot be split, so they are rebuilt from all chunks
+      auto previous_column_statistics = std::shared_ptr<AttributeStatistics<ColumnDataType>>{};
+      auto begin_chunk_id = ChunkID{0};
+      auto counted_row_count = previous_row_count + appended_row_count;
+      if constexpr (!std::is_same_v<ColumnDataType, pmr_string>) {
+        if (previous_statistics) {
+          previous_column_statistics = std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>(
+              previous_statistics->column_statistics[column_id]);
+          Assert(previous_column_statistics, "Previous statistics have a different data type");
+          begin_chunk_id = first_appended_chunk_id;
+          counted_row_count = appended_row_count;
+        }
       }
+
+      const auto column_sampling_ratio = sampling_ratio(counted_row_count, sampling_error);
+      const auto range_count =
+          std::max(std::min({size_t{max_range_count}, size_t{end_chunk_id - begin_chunk_id},
+                             static_cast<size_t>(counted_row_count * column_sampling_ratio) / MIN_ROWS_PER_JOB}),
+                   size_t{1});
+      const auto distributions = std::make_shared<std::vector<ValueDistribution<ColumnDataType>>>(range_count);
+
+      for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+        const auto appended_chunk_count = size_t{end_chunk_id - begin_chunk_id};
+        const auto range_begin_chunk_id =
+            ChunkID{static_cast<ChunkID::base_type>(begin_chunk_id + range_idx * appended_chunk_count / range_count)};
+        const auto range_end_chunk_id = ChunkID{
+            static_cast<ChunkID::base_type>(begin_chunk_id + (range_idx + 1) * appended_chunk_count / range_count)};
+        count_jobs.emplace_back(std::make_shared<JobTask>([&, distributions, range_idx, column_id, range_begin_chunk_id,
+                                                           range_end_chunk_id, column_sampling_ratio]() {
+          count_chunks((*distributions)[range_idx], table, column_id, range_begin_chunk_id, range_end_chunk_id,
+                       column_sampling_ratio);
+        }));
+      }
+
+      build_jobs.emplace_back(std::make_shared<JobTask>([&, distributions, previous_column_statistics, column_id,
+                                                         column_sampling_ratio]() {
+        auto& distribution = distributions->front();
+        for (auto range_idx = size_t{1}; range_idx < distributions->size(); ++range_idx) {
+          distribution.merge(std::move((*distributions)[range_idx]));
+        }
+
+        auto value_counts = sorted_value_counts(distribution);
+        auto histogram = std::shared_ptr<AbstractHistogram<ColumnDataType>>{};
+        if (column_sampling_ratio < 1.0) {
+          histogram = histogram_from_sample(std::move(value_counts), histogram_bin_count, column_sampling_ratio);
+        } else {
+          histogram = EqualDistinctCountHistogram<ColumnDataType>::from_distribution(std::move(value_counts),
+                                                                                     histogram_bin_count);
+        }
+
+        auto null_value_ratio = distribution.row_count == 0
+                                    ? 0.0f
+                                    : static_cast<float>(distribution.null_count) / distribution.row_count;
+
+        if (previous_column_statistics) {
+          const auto& previous_histogram = previous_column_statistics->histogram;
+          if (previous_histogram && histogram) {
+            histogram = merge_histograms(*previous_histogram, *histogram, histogram_bin_count);
+          } else if (previous_histogram) {
+            histogram = previous_histogram;
+          }
+
+          // The row count and the NULL value ratios of stored tables' statistics are updated when rows are inserted or
+          // deleted, but their histograms are not. Thus, the NULLs of the previous chunks are derived from the
+          // previous histogram.
+          const auto previous_null_count =
+              previous_histogram ? std::max(static_cast<float>(previous_row_count) -
+                                                static_cast<float>(previous_histogram->total_count()),
+                                            0.0f)
+                                 : static_cast<float>(previous_row_count);
+          const auto row_count = previous_row_count + appended_row_count;
+          null_value_ratio =
+              row_count == 0
+                  ? 0.0f
+                  : (previous_null_count + null_value_ratio * static_cast<float>(appended_row_count)) / row_count;
+        }
+
+        const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+        if (histogram) {
+          output_column_statistics->set_statistics_object(histogram);
+        } else {
+          // Without a histogram, the column is assumed to contain only NULLs. This happens for all-null columns and
+          // for empty tables.
+          null_value_ratio = 1.0f;
+        }
+        output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+
+        column_statistics[column_id] = output_column_statistics;
+      }));
     });
   }
 
-  for (auto& thread : threads) {
-    thread.join();
-  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(count_jobs);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(build_jobs);
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  const auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  if (!scan_mutable_chunks) {
+    table_statistics->first_unscanned_chunk_id = end_chunk_id;
+  }
+  return table_statistics;
 }
 
 TableStatistics::TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
@@ -23,8 +23,34 @@ class TableStatistics {
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
    * which statistics objects are created.
+   *
+   * The values of each column are counted by JobTasks for ranges of chunks. Then, the counts of a column's chunk
+   * ranges are merged and its histogram is built. If the table starts with immutable chunks, mutable chunks after them
+   * are not scanned (see first_unscanned_chunk_id).
+   *
+   * If @param sampling_error is set, histograms of large tables are built from a uniform random sample of the rows.
+   * The sample size is chosen so that, with a probability of SAMPLING_CONFIDENCE, the share of the rows in any value
+   * range deviates by at most sampling_error from the share estimated from the sample (Dvoretzky-Kiefer-Wolfowitz
+   * inequality). Bin heights are extrapolated from the sample. Distinct counts are estimated with the GEE estimator
+   * (Charikar et al., "Towards Estimation Error Guarantees for Distinct Values", PODS 2000), whose ratio error is
+   * bounded by sqrt(row count / sample size).
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::shared_ptr<TableStatistics> from_table(const Table& table,
+                                                     const std::optional<float> sampling_error = std::nullopt);
+
+  /**
+   * Creates statistics for @param table after chunks were appended to it. @param previous_statistics describe the
+   * chunks before @param first_appended_chunk_id. Only the appended chunks up to the first mutable one are scanned and
+   * their histograms are merged into the previous ones. As the bins of string histograms cannot be split, string
+   * columns are scanned from the first chunk on.
+   * The chunks before @param first_appended_chunk_id must not have changed since the previous statistics were built.
+   * Stored tables use this when their statistics are rebuilt (see update_table_statistics.hpp).
+   */
+  static std::shared_ptr<TableStatistics> from_appended_chunks(
+      const Table& table, const TableStatistics& previous_statistics, const ChunkID first_appended_chunk_id,
+      const std::optional<float> sampling_error = std::nullopt);
+
+  static constexpr auto SAMPLING_CONFIDENCE = 0.99;
 
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
@@ -36,6 +62,20 @@ class TableStatistics {
 
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
+
+  // For stored tables: Number of rows inserted or deleted since the histograms were built and whether a job to
+  // rebuild them has been scheduled (see update_table_statistics.hpp)
+  size_t modified_row_count{0};
+  bool rebuild_scheduled{false};
+
+  // The histograms were built from the chunks before this ChunkID, which were immutable at that time. A rebuild only
+  // has to scan the chunks from here on (see from_appended_chunks). Not set if mutable chunks were scanned.
+  std::optional<ChunkID> first_unscanned_chunk_id;
+
+ private:
+  static std::shared_ptr<TableStatistics> _generate(const Table& table, const TableStatistics* previous_statistics,
+                                                    const ChunkID first_appended_chunk_id,
+                                                    const std::optional<float> sampling_error);
 };
 
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics);
@@ -0,0 +1,187 @@
+#include "update_table_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename ColumnDataType>
+float null_count(const TableStatistics& table_statistics, const ColumnID column_id) {
+  const auto& column_statistics =
+      static_cast<const AttributeStatistics<ColumnDataType>&>(*table_statistics.column_statistics[column_id]);
+  return column_statistics.null_value_ratio ? column_statistics.null_value_ratio->ratio * table_statistics.row_count
+                                            : 0.0f;
+}
+
+// Applies the rows that were inserted or deleted while @param rebuilt_statistics were built to them. These rows are
+// the difference between @param previous_statistics, which were read when the rebuild started, and
+// @param current_statistics, which the rebuilt statistics replace.
+void apply_concurrent_modifications(const Table& table, TableStatistics& rebuilt_statistics,
+                                    const TableStatistics& previous_statistics,
+                                    const TableStatistics& current_statistics) {
+  const auto rebuilt_row_count = rebuilt_statistics.row_count;
+  const auto row_count = std::max(rebuilt_row_count + current_statistics.row_count - previous_statistics.row_count,
+                                  Cardinality{0});
+
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto& column_statistics =
+          static_cast<AttributeStatistics<ColumnDataType>&>(*rebuilt_statistics.column_statistics[column_id]);
+      if (!column_statistics.null_value_ratio || row_count == 0) return;
+
+      const auto rebuilt_null_count = column_statistics.null_value_ratio->ratio * rebuilt_row_count;
+      const auto modified_null_count =
+          null_count<ColumnDataType>(current_statistics, column_id) -
+          null_count<ColumnDataType>(previous_statistics, column_id);
+      column_statistics.null_value_ratio = std::make_shared<NullValueRatioStatistics>(
+          std::clamp((rebuilt_null_count + modified_null_count) / row_count, 0.0f, 1.0f));
+    });
+  }
+
+  rebuilt_statistics.row_count = row_count;
+  // These rows count towards the next rebuild
+  const auto previous_modified_row_count =
+      std::min(previous_statistics.modified_row_count, current_statistics.modified_row_count);
+  rebuilt_statistics.modified_row_count = current_statistics.modified_row_count - previous_modified_row_count;
+}
+
+void schedule_rebuild(const std::shared_ptr<const Table>& table) {
+  const auto weak_table = std::weak_ptr<const Table>{table};
+  const auto job = std::make_shared<JobTask>([weak_table]() {
+    const auto table = weak_table.lock();
+    if (!table) return;
+
+    const auto previous_statistics = table->table_statistics();
+
+    // Deleted rows and rows of rolled back inserts are still stored in the table, but they are not counted by the
+    // statistics that are maintained under DML. The row count is determined together with the previous statistics,
+    // as the rows modified from now on are applied when the rebuilt statistics are installed.
+    auto row_count = static_cast<Cardinality>(table->row_count());
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk) row_count -= static_cast<Cardinality>(chunk->invalid_row_count());
+    }
+    row_count = std::max(row_count, Cardinality{0});
+
+    // Only the chunks that were not scanned for the previous histograms (i.e., the ones that were mutable or not yet
+    // appended) are scanned. Chunks that were physically deleted in the meantime (see MvccDeletePlugin) would still be
+    // part of the previous histograms, so the statistics are rebuilt from scratch then.
+    auto first_unscanned_chunk_id = previous_statistics ? previous_statistics->first_unscanned_chunk_id : std::nullopt;
+    for (auto chunk_id = ChunkID{0}; first_unscanned_chunk_id && chunk_id < *first_unscanned_chunk_id; ++chunk_id) {
+      if (!table->get_chunk(chunk_id)) first_unscanned_chunk_id = std::nullopt;
+    }
+
+    const auto table_statistics =
+        first_unscanned_chunk_id
+            ? TableStatistics::from_appended_chunks(*table, *previous_statistics, *first_unscanned_chunk_id,
+                                                    REBUILD_SAMPLING_ERROR)
+            : TableStatistics::from_table(*table, REBUILD_SAMPLING_ERROR);
+
+    table_statistics->row_count = row_count;
+
+    // Rows that were inserted or deleted during the rebuild were only applied to the statistics that are replaced now
+    table->update_table_statistics([&](const std::shared_ptr<TableStatistics>& current_statistics) {
+      if (previous_statistics && current_statistics) {
+        apply_concurrent_modifications(*table, *table_statistics, *previous_statistics, *current_statistics);
+      }
+      return table_statistics;
+    });
+  });
+  job->schedule();
+}
+
+// Applies the modified rows to the statistics. @param sign is 1 for inserted and -1 for deleted rows.
+void update_table_statistics(const std::shared_ptr<const Table>& table, const ModifiedRows& modified_rows,
+                             const float sign) {
+  if (modified_rows.row_count == 0) return;
+
+  const auto column_count = table->column_count();
+  DebugAssert(modified_rows.null_counts.size() == static_cast<size_t>(column_count),
+              "Expected a NULL count per column");
+
+  auto rebuild = false;
+  table->update_table_statistics([&](const std::shared_ptr<TableStatistics>& table_statistics) {
+    // Tables without statistics (e.g., tables that are not stored in the StorageManager) are not maintained
+    if (!table_statistics) return table_statistics;
+
+    const auto previous_row_count = table_statistics->row_count;
+    const auto row_count =
+        std::max(previous_row_count + sign * static_cast<Cardinality>(modified_rows.row_count), Cardinality{0});
+
+    auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        const auto& previous_column_statistics =
+            static_cast<const AttributeStatistics<ColumnDataType>&>(*table_statistics->column_statistics[column_id]);
+        const auto previous_null_value_ratio =
+            previous_column_statistics.null_value_ratio ? previous_column_statistics.null_value_ratio->ratio : 0.0f;
+
+        auto null_value_ratio = previous_null_value_ratio;
+        if (row_count > 0) {
+          const auto null_count = previous_null_value_ratio * previous_row_count +
+                                  sign * static_cast<float>(modified_rows.null_counts[column_id]);
+          null_value_ratio = std::clamp(null_count / row_count, 0.0f, 1.0f);
+        }
+
+        // The other statistics objects are shared with the previous statistics
+        const auto output_column_statistics =
+            std::make_shared<AttributeStatistics<ColumnDataType>>(previous_column_statistics);
+        output_column_statistics->null_value_ratio = std::make_shared<NullValueRatioStatistics>(null_value_ratio);
+        column_statistics[column_id] = output_column_statistics;
+      });
+    }
+
+    const auto updated_table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+    updated_table_statistics->modified_row_count = table_statistics->modified_row_count + modified_rows.row_count;
+    updated_table_statistics->rebuild_scheduled = table_statistics->rebuild_scheduled;
+    updated_table_statistics->first_unscanned_chunk_id = table_statistics->first_unscanned_chunk_id;
+
+    const auto stale_row_count =
+        std::max(static_cast<size_t>(STALE_STATISTICS_RATIO * row_count), size_t{MIN_STALE_ROW_COUNT});
+    if (!table_statistics->rebuild_scheduled && updated_table_statistics->modified_row_count > stale_row_count) {
+      updated_table_statistics->rebuild_scheduled = true;
+      rebuild = true;
+    }
+
+    return updated_table_statistics;
+  });
+
+  // Schedule the rebuild only after the statistics were replaced. Otherwise, a scheduler that executes the job
+  // immediately would try to acquire the table's statistics mutex that update_table_statistics() still holds.
+  if (rebuild) {
+    schedule_rebuild(table);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+void update_table_statistics_for_inserted_rows(const std::shared_ptr<const Table>& table,
+                                               const ModifiedRows& inserted_rows) {
+  update_table_statistics(table, inserted_rows, 1.0f);
+}
+
+void update_table_statistics_for_deleted_rows(const std::shared_ptr<const Table>& table,
+                                              const ModifiedRows& deleted_rows) {
+  update_table_statistics(table, deleted_rows, -1.0f);
+}
+
+}  // namespace opossum
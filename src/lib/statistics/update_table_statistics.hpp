@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * The statistics of stored tables are generated once, when the table is added to the StorageManager. To keep the
+ * cardinality estimates from drifting, the Insert and Delete operators (and thus Update) apply the rows they modified
+ * to the table statistics when they commit:
+ *  - The row count and the NULL value ratios are updated exactly.
+ *  - The histograms are not updated. Instead, the modified rows are counted. Once they exceed
+ *    STALE_STATISTICS_RATIO of the table's rows (and at least MIN_STALE_ROW_COUNT rows), a JobTask rebuilds the
+ *    statistics in the background. Only the chunks that were mutable or not yet appended when the histograms were
+ *    built are scanned (see TableStatistics::from_appended_chunks).
+ *
+ * The statistics are replaced rather than modified, as the optimizer might concurrently read them. Changes that are
+ * committed while the statistics are rebuilt are applied to the statistics that are replaced. When the rebuilt
+ * statistics are installed, the difference in row count and NULL counts is applied to them as well.
+ */
+constexpr auto STALE_STATISTICS_RATIO = 0.1f;
+constexpr auto MIN_STALE_ROW_COUNT = size_t{1'000};
+
+// Histograms that are rebuilt in the background are built from a sample of the rows (see TableStatistics::from_table)
+constexpr auto REBUILD_SAMPLING_ERROR = 0.01f;
+
+// Number of rows that were inserted into or deleted from a table and the number of NULLs among them per column
+struct ModifiedRows {
+  size_t row_count{0};
+  std::vector<size_t> null_counts;
+};
+
+void update_table_statistics_for_inserted_rows(const std::shared_ptr<const Table>& table,
+                                               const ModifiedRows& inserted_rows);
+
+void update_table_statistics_for_deleted_rows(const std::shared_ptr<const Table>& table,
+                                              const ModifiedRows& deleted_rows);
+
+}  // namespace opossum
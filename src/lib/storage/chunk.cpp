@@ -99,10 +99,15 @@ void Chunk::finalize() {
   if (has_mvcc_data()) {
     const auto chunk_size = size();
     Assert(chunk_size > 0, "finalize() should not be called on an empty chunk");
-    _mvcc_data->max_begin_cid = CommitID{0};
+    auto min_begin_cid = MvccData::MAX_COMMIT_ID;
+    auto max_begin_cid = CommitID{0};
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      _mvcc_data->max_begin_cid = std::max(*_mvcc_data->max_begin_cid, _mvcc_data->get_begin_cid(chunk_offset));
+      const auto begin_cid = _mvcc_data->get_begin_cid(chunk_offset);
+      min_begin_cid = std::min(min_begin_cid, begin_cid);
+      max_begin_cid = std::max(max_begin_cid, begin_cid);
     }
+    _mvcc_data->min_begin_cid = min_begin_cid;
+    _mvcc_data->max_begin_cid = max_begin_cid;
 
     Assert(_mvcc_data->max_begin_cid != MvccData::MAX_COMMIT_ID,
            "max_begin_cid should not be MAX_COMMIT_ID when finalizing a chunk. This probably means the chunk was "
@@ -163,9 +163,9 @@ class Chunk : private Noncopyable {
 
   /**
    * Chunks with few visible entries can be cleaned up periodically by the MvccDeletePlugin in a two-step process.
-   * Within the first step (clean up transaction), the plugin deletes rows from this chunk and re-inserts them at the
-   * end of the table. Thus, future transactions will find the still valid rows at the end of the table and do not
-   * have to look at this chunk anymore.
+   * Within the first step (clean up transaction), the plugin deletes rows from this chunk and copies them into a new,
+   * compacted chunk at the end of the table. Thus, future transactions will find the still valid rows at the end of
+   * the table and do not have to look at this chunk anymore.
    * The cleanup commit id represents the snapshot commit id at which transactions can ignore this chunk.
    */
   std::optional<CommitID> get_cleanup_commit_id() const;
@@ -0,0 +1,192 @@
+#include "primary_key_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PrimaryKeyIndex::PrimaryKeyIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types)
+    : _column_ids(column_ids), _data_types(data_types) {
+  Assert(!_column_ids.empty(), "PrimaryKeyIndex requires at least one column");
+  Assert(_column_ids.size() == _data_types.size(), "Expected one DataType per indexed column");
+  DebugAssert(std::is_sorted(_column_ids.begin(), _column_ids.end()), "Expected sorted ColumnIDs");
+}
+
+void PrimaryKeyIndex::insert(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                             const ChunkOffset end_chunk_offset) {
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Cannot index a physically deleted chunk");
+  DebugAssert(begin_chunk_offset <= end_chunk_offset && end_chunk_offset <= chunk->size(), "Invalid row range");
+
+  auto chunk_offsets = std::vector<ChunkOffset>(end_chunk_offset - begin_chunk_offset);
+  std::iota(chunk_offsets.begin(), chunk_offsets.end(), begin_chunk_offset);
+  auto keys = _materialize_keys(*chunk, chunk_offsets);
+
+  for (auto row_index = size_t{0}; row_index < chunk_offsets.size(); ++row_index) {
+    auto& shard = _shard(KeyHash{}(keys[row_index]));
+    const auto lock = std::unique_lock{shard.mutex};
+    shard.entries.emplace(std::move(keys[row_index]), RowID{chunk_id, chunk_offsets[row_index]});
+  }
+}
+
+void PrimaryKeyIndex::remove_chunk(const ChunkID chunk_id) {
+  for (auto& shard : _shards) {
+    const auto lock = std::unique_lock{shard.mutex};
+    for (auto iter = shard.entries.begin(); iter != shard.entries.end();) {
+      if (iter->second.chunk_id == chunk_id) {
+        iter = shard.entries.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+}
+
+size_t PrimaryKeyIndex::remove_invalidated_rows(const Table& table, const CommitID lowest_snapshot_commit_id) {
+  const auto removed_row_counts_lock = std::lock_guard<std::mutex>{_removed_row_counts_mutex};
+  const auto chunk_count = table.chunk_count();
+  _removed_row_counts.resize(chunk_count, ChunkOffset{0});
+
+  auto removed_entry_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->invalid_row_count() <= _removed_row_counts[chunk_id]) continue;
+
+    // Rows are invalidated by setting their end commit id. Rows that have been invalidated after the lowest snapshot
+    // are still visible to some transactions.
+    const auto& mvcc_data = chunk->mvcc_data();
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_end_cid(chunk_offset) <= lowest_snapshot_commit_id) chunk_offsets.emplace_back(chunk_offset);
+    }
+    if (chunk_offsets.size() <= _removed_row_counts[chunk_id]) continue;
+
+    // The entries of some of the rows might have been removed before, these are skipped
+    const auto keys = _materialize_keys(*chunk, chunk_offsets);
+    for (auto row_index = size_t{0}; row_index < chunk_offsets.size(); ++row_index) {
+      const auto row_id = RowID{chunk_id, chunk_offsets[row_index]};
+      auto& shard = _shard(KeyHash{}(keys[row_index]));
+      const auto lock = std::unique_lock{shard.mutex};
+      const auto [begin, end] = shard.entries.equal_range(keys[row_index]);
+      const auto iter = std::find_if(begin, end, [&](const auto& entry) { return entry.second == row_id; });
+      if (iter == end) continue;
+
+      shard.entries.erase(iter);
+      ++removed_entry_count;
+    }
+    _removed_row_counts[chunk_id] = static_cast<ChunkOffset>(chunk_offsets.size());
+  }
+
+  return removed_entry_count;
+}
+
+RowIDPosList PrimaryKeyIndex::lookup(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == _column_ids.size(), "Expected one value per indexed column");
+
+  auto key = Key(values.size());
+  for (auto key_index = size_t{0}; key_index < values.size(); ++key_index) {
+    if (data_type_from_all_type_variant(values[key_index]) == _data_types[key_index]) {
+      key[key_index] = values[key_index];
+      continue;
+    }
+
+    // For example, the SQL translator might use a long value for an integer column. If the value cannot be converted
+    // to the type of the column (e.g., 1.5 for an integer column or NULL), no row can hold the key.
+    auto converted_value = lossless_variant_cast(values[key_index], _data_types[key_index]);
+    if (!converted_value) return RowIDPosList{};
+    key[key_index] = std::move(*converted_value);
+  }
+
+  const auto& shard = _shard(KeyHash{}(key));
+  auto matches = RowIDPosList{};
+  {
+    const auto lock = std::shared_lock{shard.mutex};
+    const auto [begin, end] = shard.entries.equal_range(key);
+    for (auto iter = begin; iter != end; ++iter) {
+      matches.emplace_back(iter->second);
+    }
+  }
+
+  // Different versions of the same row are added in the order of their insertion. Sorting them keeps the accesses to
+  // the table sequential.
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+const std::vector<ColumnID>& PrimaryKeyIndex::column_ids() const { return _column_ids; }
+
+size_t PrimaryKeyIndex::memory_usage() const {
+  // Approximation, as the nodes of the hash map and the memory used by strings cannot be accessed
+  auto bytes = sizeof(*this);
+  for (const auto& shard : _shards) {
+    const auto lock = std::shared_lock{shard.mutex};
+    bytes += shard.entries.bucket_count() * sizeof(void*);
+    bytes += shard.entries.size() * (sizeof(void*) + sizeof(Key) + sizeof(RowID) +
+                                      _column_ids.size() * sizeof(AllTypeVariant));
+  }
+  return bytes;
+}
+
+size_t PrimaryKeyIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+std::vector<PrimaryKeyIndex::Key> PrimaryKeyIndex::_materialize_keys(
+    const Chunk& chunk, const std::vector<ChunkOffset>& chunk_offsets) const {
+  // Materialize the keys of all rows first, so that each segment is only resolved once
+  const auto row_count = chunk_offsets.size();
+  auto keys = std::vector<Key>(row_count, Key(_column_ids.size()));
+
+  for (auto key_index = size_t{0}; key_index < _column_ids.size(); ++key_index) {
+    const auto& segment = chunk.get_segment(_column_ids[key_index]);
+
+    resolve_data_type(_data_types[key_index], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      // Rows added by the Insert operator are always stored in ValueSegments, which can be read directly. Other
+      // segments are only indexed when the index is created for a table that already holds data or when invalidated
+      // rows are removed.
+      if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+        const auto& values = value_segment->values();
+        for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+          keys[row_index][key_index] = values[chunk_offsets[row_index]];
+        }
+        return;
+      }
+
+      segment_with_iterators<ColumnDataType>(*segment, [&](const auto begin, const auto /* end */) {
+        for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+          const auto position = *(begin + chunk_offsets[row_index]);
+          DebugAssert(!position.is_null(), "Primary key columns must not contain NULL values");
+          keys[row_index][key_index] = position.value();
+        }
+      });
+    });
+  }
+
+  return keys;
+}
+
+PrimaryKeyIndex::Shard& PrimaryKeyIndex::_shard(const size_t hash) { return _shards[hash % SHARD_COUNT]; }
+
+const PrimaryKeyIndex::Shard& PrimaryKeyIndex::_shard(const size_t hash) const { return _shards[hash % SHARD_COUNT]; }
+
+}  // namespace opossum
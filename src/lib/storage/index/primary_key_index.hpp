@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Hash index on the primary key columns of a table (see Table::add_soft_unique_constraint and
+ * Table::create_primary_key_index). Unlike the indexes derived from AbstractIndex, which are built for a single
+ * immutable chunk, it covers all chunks of the table - including the mutable ones - and maps each key to the RowIDs of
+ * the rows that hold it. This makes point lookups on the primary key independent of the number of chunks.
+ *
+ * The index is not aware of MVCC: Rows are added when they are inserted (i.e., before the inserting transaction
+ * commits) and are kept when they are deleted, as older transactions might still see them. Thus, a key can map to
+ * multiple RowIDs (e.g., the old and new version of an updated row) and the lookup results still need to be
+ * validated. Entries are removed once their chunk is physically removed from the table or once no transaction can see
+ * their row anymore (see remove_invalidated_rows, called by the MvccDeletePlugin).
+ *
+ * Inserts and lookups may happen concurrently. For this, the entries are distributed over a fixed number of shards,
+ * each of which is protected by its own reader-writer lock.
+ */
+class PrimaryKeyIndex : private Noncopyable {
+ public:
+  using Key = std::vector<AllTypeVariant>;
+
+  PrimaryKeyIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types);
+
+  // Adds the rows [begin_chunk_offset, end_chunk_offset) of the given chunk of `table` to the index
+  void insert(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+              const ChunkOffset end_chunk_offset);
+
+  // Removes all entries that reference the given chunk
+  void remove_chunk(const ChunkID chunk_id);
+
+  // Removes the entries of rows of `table` that were invalidated (i.e., deleted or rolled back) at or before the given
+  // commit id, which must not be newer than the snapshot of any active transaction. Only chunks with invalidated rows
+  // whose entries have not been removed yet are checked. Returns the number of removed entries.
+  size_t remove_invalidated_rows(const Table& table, const CommitID lowest_snapshot_commit_id);
+
+  // Returns the RowIDs of all rows that hold the given key, whose values are ordered as in column_ids(). Values of a
+  // different type than the indexed column are converted if this is possible without loss of precision, NULLs never
+  // match.
+  RowIDPosList lookup(const std::vector<AllTypeVariant>& values) const;
+
+  // The indexed columns, sorted by their ColumnID
+  const std::vector<ColumnID>& column_ids() const;
+
+  size_t memory_usage() const;
+
+ protected:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_multimap<Key, RowID, KeyHash> entries;
+  };
+
+  static constexpr auto SHARD_COUNT = size_t{64};
+
+  Shard& _shard(const size_t hash);
+  const Shard& _shard(const size_t hash) const;
+
+  // Returns the keys of the rows at the given offsets of the chunk
+  std::vector<Key> _materialize_keys(const Chunk& chunk, const std::vector<ChunkOffset>& chunk_offsets) const;
+
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<DataType> _data_types;
+
+  std::array<Shard, SHARD_COUNT> _shards;
+
+  // Number of rows per chunk whose entries were removed by remove_invalidated_rows
+  std::mutex _removed_row_counts_mutex;
+  std::vector<ChunkOffset> _removed_row_counts;
+};
+
+}  // namespace opossum
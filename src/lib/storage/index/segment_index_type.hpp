@@ -10,7 +10,9 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class SegmentIndexType : uint8_t { Invalid, GroupKey, CompositeGroupKey, AdaptiveRadixTree, BTree };
+// PrimaryKey denotes the table-wide PrimaryKeyIndex (see Table::create_primary_key_index), all other types are indexes
+// on the segments of a single chunk.
+enum class SegmentIndexType : uint8_t { Invalid, GroupKey, CompositeGroupKey, AdaptiveRadixTree, BTree, PrimaryKey };
 
 class GroupKeyIndex;
 class CompositeGroupKeyIndex;
@@ -1,5 +1,13 @@
 #include "mvcc_data.hpp"
 
+#if defined(__AVX512F__)
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -47,8 +55,15 @@ CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
 void MvccData::set_end_cid(const ChunkOffset offset, const CommitID commit_id) {
   DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   _end_cids[offset] = commit_id;
+
+  // Multiple transactions may invalidate rows of the same chunk concurrently, so we only ever raise the maximum.
+  auto max_end_cid = _max_end_cid.load();
+  while (max_end_cid < commit_id && !_max_end_cid.compare_exchange_weak(max_end_cid, commit_id)) {
+  }
 }
 
+CommitID MvccData::max_end_cid() const { return _max_end_cid.load(); }
+
 TransactionID MvccData::get_tid(const ChunkOffset offset) const {
   DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   return _tids[offset];
@@ -68,6 +83,49 @@ bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expe
   return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
 }
 
+void MvccData::remove_invisible_committed_rows(std::vector<uint64_t>& words, const CommitID snapshot_commit_id) const {
+  constexpr auto BITS_PER_WORD = size_t{64};
+  const auto row_count = std::min(words.size() * BITS_PER_WORD, _begin_cids.size());
+  const auto* const begin_cids = _begin_cids.data();
+  const auto* const end_cids = _end_cids.data();
+
+  const auto word_count = words.size();
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    if (words[word_index] == 0) continue;
+
+    const auto first_offset = word_index * BITS_PER_WORD;
+    auto visible_bits = uint64_t{0};
+    if (first_offset + BITS_PER_WORD <= row_count) {
+#if defined(__AVX512F__)
+      // Compare 16 commit ids per instruction. The comparison masks directly hold the visibility bits.
+      static_assert(std::is_same_v<CommitID, uint32_t>, "Kernel expects 32-bit commit ids");
+      constexpr auto CIDS_PER_REGISTER = sizeof(__m512i) / sizeof(CommitID);
+      const auto snapshot = _mm512_set1_epi32(static_cast<int32_t>(snapshot_commit_id));
+      for (auto register_index = size_t{0}; register_index < BITS_PER_WORD / CIDS_PER_REGISTER; ++register_index) {
+        const auto offset = first_offset + register_index * CIDS_PER_REGISTER;
+        const auto begin = _mm512_loadu_si512(reinterpret_cast<const void*>(begin_cids + offset));
+        const auto end = _mm512_loadu_si512(reinterpret_cast<const void*>(end_cids + offset));
+        const auto visible = _mm512_mask_cmplt_epu32_mask(_mm512_cmple_epu32_mask(begin, snapshot), snapshot, end);
+        visible_bits |= static_cast<uint64_t>(visible) << (register_index * CIDS_PER_REGISTER);
+      }
+#else
+      // Fixed trip count and no branches in the loop body, which allows the compiler to vectorize the comparisons
+      for (auto bit = size_t{0}; bit < BITS_PER_WORD; ++bit) {
+        const auto visible = (begin_cids[first_offset + bit] <= snapshot_commit_id) &
+                             (snapshot_commit_id < end_cids[first_offset + bit]);
+        visible_bits |= static_cast<uint64_t>(visible) << bit;
+      }
+#endif
+    } else {
+      for (auto offset = first_offset; offset < row_count; ++offset) {
+        const auto visible = (begin_cids[offset] <= snapshot_commit_id) & (snapshot_commit_id < end_cids[offset]);
+        visible_bits |= static_cast<uint64_t>(visible) << (offset - first_offset);
+      }
+    }
+    words[word_index] &= visible_bits;
+  }
+}
+
 size_t MvccData::memory_usage() const {
   auto bytes = size_t{0};
   bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
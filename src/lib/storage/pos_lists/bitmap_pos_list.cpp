@@ -0,0 +1,101 @@
+#include "bitmap_pos_list.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+BitmapPosList::BitmapPosList(const ChunkID common_chunk_id, const ChunkOffset chunk_size, std::vector<Word>&& words)
+    : _common_chunk_id(common_chunk_id), _chunk_size(chunk_size), _words(std::move(words)) {
+  DebugAssert(_common_chunk_id != INVALID_CHUNK_ID, "BitmapPosList requires a valid chunk id");
+  Assert(_words.size() == (static_cast<size_t>(_chunk_size) + BITS_PER_WORD - 1) / BITS_PER_WORD,
+         "Number of words does not match the chunk size");
+  DebugAssert(_chunk_size % BITS_PER_WORD == 0 || _words.back() >> (_chunk_size % BITS_PER_WORD) == 0,
+              "Bits beyond the chunk size must not be set");
+
+  _word_ranks.resize(_words.size() + 1);
+  auto rank = ChunkOffset{0};
+  for (auto word_index = size_t{0}; word_index < _words.size(); ++word_index) {
+    _word_ranks[word_index] = rank;
+    rank += __builtin_popcountll(_words[word_index]);
+  }
+  _word_ranks.back() = rank;
+}
+
+std::shared_ptr<BitmapPosList> BitmapPosList::from_pos_list(const RowIDPosList& pos_list,
+                                                            const ChunkOffset chunk_size) {
+  if (pos_list.empty() || pos_list[0].chunk_id == INVALID_CHUNK_ID) return nullptr;
+
+  const auto chunk_id = pos_list[0].chunk_id;
+
+  auto words = std::vector<Word>((static_cast<size_t>(chunk_size) + BITS_PER_WORD - 1) / BITS_PER_WORD);
+  auto previous_chunk_offset = std::optional<ChunkOffset>{};
+  for (const auto& row_id : pos_list) {
+    if (row_id.chunk_id != chunk_id || (previous_chunk_offset && row_id.chunk_offset <= *previous_chunk_offset)) {
+      return nullptr;
+    }
+    DebugAssert(row_id.chunk_offset < chunk_size, "PosList references rows beyond the given chunk size");
+
+    words[row_id.chunk_offset / BITS_PER_WORD] |= Word{1} << (row_id.chunk_offset % BITS_PER_WORD);
+    previous_chunk_offset = row_id.chunk_offset;
+  }
+
+  return std::make_shared<BitmapPosList>(chunk_id, chunk_size, std::move(words));
+}
+
+std::shared_ptr<BitmapPosList> BitmapPosList::bitwise_and(const BitmapPosList& lhs, const BitmapPosList& rhs) {
+  Assert(lhs._common_chunk_id == rhs._common_chunk_id, "BitmapPosLists reference different chunks");
+
+  // If rows were added to the chunk in between creating the two BitmapPosLists, they might cover a different number of
+  // rows. Rows that are only covered by one of the bitmaps are not contained in the result.
+  const auto chunk_size = std::min(lhs._chunk_size, rhs._chunk_size);
+  auto words = std::vector<Word>((static_cast<size_t>(chunk_size) + BITS_PER_WORD - 1) / BITS_PER_WORD);
+  for (auto word_index = size_t{0}; word_index < words.size(); ++word_index) {
+    words[word_index] = lhs._words[word_index] & rhs._words[word_index];
+  }
+
+  return std::make_shared<BitmapPosList>(lhs._common_chunk_id, chunk_size, std::move(words));
+}
+
+std::shared_ptr<BitmapPosList> BitmapPosList::bitwise_or(const BitmapPosList& lhs, const BitmapPosList& rhs) {
+  Assert(lhs._common_chunk_id == rhs._common_chunk_id, "BitmapPosLists reference different chunks");
+
+  const auto& longer = lhs._chunk_size >= rhs._chunk_size ? lhs : rhs;
+  const auto& shorter = lhs._chunk_size >= rhs._chunk_size ? rhs : lhs;
+
+  auto words = longer._words;
+  for (auto word_index = size_t{0}; word_index < shorter._words.size(); ++word_index) {
+    words[word_index] |= shorter._words[word_index];
+  }
+
+  return std::make_shared<BitmapPosList>(lhs._common_chunk_id, longer._chunk_size, std::move(words));
+}
+
+bool BitmapPosList::references_single_chunk() const { return true; }
+
+ChunkID BitmapPosList::common_chunk_id() const { return _common_chunk_id; }
+
+bool BitmapPosList::empty() const { return size() == 0; }
+
+size_t BitmapPosList::size() const { return _word_ranks.back(); }
+
+size_t BitmapPosList::memory_usage(const MemoryUsageCalculationMode) const {
+  return sizeof *this + _words.capacity() * sizeof(Word) + _word_ranks.capacity() * sizeof(ChunkOffset);
+}
+
+ChunkOffset BitmapPosList::chunk_size() const { return _chunk_size; }
+
+const std::vector<BitmapPosList::Word>& BitmapPosList::words() const { return _words; }
+
+BitmapPosList::Iterator BitmapPosList::begin() const { return Iterator(this, 0); }
+
+BitmapPosList::Iterator BitmapPosList::end() const { return Iterator(this, size()); }
+
+BitmapPosList::Iterator BitmapPosList::cbegin() const { return begin(); }
+
+BitmapPosList::Iterator BitmapPosList::cend() const { return end(); }
+
+}  // namespace opossum
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+#include "rowid_pos_list.hpp"
+
+namespace opossum {
+
+/**
+ * A PosList that references a single chunk and stores one bit per row of that chunk. If a large fraction of a chunk
+ * is referenced (e.g., by a TableScan with a high selectivity or by Validate), this is much smaller than a
+ * RowIDPosList, which needs eight bytes per referenced row. As the positions are stored as a bitmap, they are always
+ * sorted by their ChunkOffset.
+ *
+ * For random access (operator[]), the number of set bits before each word (i.e., their rank) is stored next to the
+ * bitmap. The sequential iterator does not need these ranks: It walks the set bits of the current word and skips
+ * words without set bits altogether.
+ */
+class BitmapPosList final : public AbstractPosList {
+ public:
+  using Word = uint64_t;
+  static constexpr auto BITS_PER_WORD = ChunkOffset{64};
+
+  // Operators switch from RowIDPosLists to BitmapPosLists if at least this fraction of the rows of a chunk is
+  // referenced. Below, iterating the sparse bitmap gets more expensive than reading the RowIDs.
+  static constexpr auto MIN_SELECTIVITY = 0.3f;
+
+  class Iterator : public boost::iterator_facade<Iterator, RowID, boost::random_access_traversal_tag, RowID> {
+   public:
+    Iterator(const BitmapPosList* pos_list, const size_t index) : _pos_list(pos_list) { _seek(index); }
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_index;
+      _remaining_bits &= _remaining_bits - 1;
+
+      const auto word_count = _pos_list->_words.size();
+      while (_remaining_bits == 0 && _word_index + 1 < word_count) {
+        ++_word_index;
+        _remaining_bits = _pos_list->_words[_word_index];
+      }
+    }
+
+    void decrement() { _seek(_index - 1); }
+
+    void advance(std::ptrdiff_t n) {
+      // Long or backward jumps use the ranks. Short forward jumps skip entire words based on their popcount, which
+      // is cheaper than the binary search on the ranks.
+      if (n < 0 || n > static_cast<std::ptrdiff_t>(BITS_PER_WORD) || _index + n >= _pos_list->size()) {
+        _seek(_index + n);
+        return;
+      }
+
+      _index += n;
+      auto remaining_steps = static_cast<size_t>(n);
+      while (remaining_steps >= static_cast<size_t>(__builtin_popcountll(_remaining_bits))) {
+        remaining_steps -= __builtin_popcountll(_remaining_bits);
+        ++_word_index;
+        _remaining_bits = _pos_list->_words[_word_index];
+      }
+      for (; remaining_steps > 0; --remaining_steps) {
+        _remaining_bits &= _remaining_bits - 1;
+      }
+    }
+
+    bool equal(const Iterator& other) const {
+      DebugAssert(_pos_list == other._pos_list, "Iterator compared to iterator on different BitmapPosList instance");
+      return _index == other._index;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    RowID dereference() const {
+      DebugAssert(_remaining_bits != 0, "past-the-end BitmapPosList::Iterator dereferenced");
+      return RowID{_pos_list->_common_chunk_id,
+                   static_cast<ChunkOffset>(_word_index * BITS_PER_WORD + __builtin_ctzll(_remaining_bits))};
+    }
+
+    void _seek(const size_t index) {
+      _index = index;
+      if (index >= _pos_list->size()) {
+        _word_index = _pos_list->_words.size();
+        _remaining_bits = 0;
+        return;
+      }
+
+      std::tie(_word_index, _remaining_bits) = _pos_list->_select(index);
+    }
+
+    const BitmapPosList* _pos_list;
+
+    // Number of positions before the current one
+    size_t _index{};
+
+    // Word that holds the current position and its bits starting at the current position (lower bits are cleared)
+    size_t _word_index{};
+    Word _remaining_bits{};
+  };
+
+  // Creates a BitmapPosList for the first `chunk_size` rows of the chunk. `words` holds one bit per row, bits beyond
+  // `chunk_size` must not be set.
+  BitmapPosList(const ChunkID common_chunk_id, const ChunkOffset chunk_size, std::vector<Word>&& words);
+
+  // Creates a BitmapPosList with the positions of `pos_list`, which has to reference the first `chunk_size` rows of a
+  // single chunk. As a bitmap cannot represent the order of the positions, nullptr is returned if the positions are
+  // not strictly increasing. nullptr is also returned for empty PosLists and PosLists containing NULL values.
+  static std::shared_ptr<BitmapPosList> from_pos_list(const RowIDPosList& pos_list, const ChunkOffset chunk_size);
+
+  // Return the positions contained in both (bitwise_and) or any (bitwise_or) of the two BitmapPosLists, which have to
+  // reference the same chunk
+  static std::shared_ptr<BitmapPosList> bitwise_and(const BitmapPosList& lhs, const BitmapPosList& rhs);
+  static std::shared_ptr<BitmapPosList> bitwise_or(const BitmapPosList& lhs, const BitmapPosList& rhs);
+
+  BitmapPosList& operator=(BitmapPosList&& other) = default;
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  RowID operator[](const size_t index) const final {
+    DebugAssert(index < size(), "operator[] called with index out of range");
+    const auto [word_index, bits] = _select(index);
+    return RowID{_common_chunk_id, static_cast<ChunkOffset>(word_index * BITS_PER_WORD + __builtin_ctzll(bits))};
+  }
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  // Number of rows of the referenced chunk that are covered by the bitmap
+  ChunkOffset chunk_size() const;
+
+  const std::vector<Word>& words() const;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ private:
+  // Returns the index of the word that holds the index-th set bit and the bits of that word, starting at that bit
+  std::pair<size_t, Word> _select(const size_t index) const {
+    // _word_ranks is sorted, the word we are looking for is the last one with a rank not greater than index
+    const auto upper_bound = std::upper_bound(_word_ranks.cbegin(), _word_ranks.cend(), index);
+    const auto word_index = static_cast<size_t>(std::distance(_word_ranks.cbegin(), upper_bound)) - 1;
+
+    auto bits = _words[word_index];
+    for (auto skipped_bits = index - _word_ranks[word_index]; skipped_bits > 0; --skipped_bits) {
+      bits &= bits - 1;
+    }
+    return {word_index, bits};
+  }
+
+  ChunkID _common_chunk_id;
+  ChunkOffset _chunk_size;
+  std::vector<Word> _words;
+
+  // Number of set bits in all words before a word, with an additional entry for the total number of set bits
+  std::vector<ChunkOffset> _word_ranks;
+};
+
+}  // namespace opossum
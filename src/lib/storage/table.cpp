@@ -11,7 +11,9 @@
 #include "concurrency/transaction_manager.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -29,6 +31,7 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _target_chunk_size(type == TableType::Data ? target_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
+      _table_statistics_mutex(std::make_unique<std::mutex>()),
       _append_mutex(std::make_unique<std::mutex>()) {
   DebugAssert(target_chunk_size <= Chunk::MAX_SIZE, "Chunk size exceeds maximum");
   DebugAssert(type == TableType::Data || !target_chunk_size, "Must not set target_chunk_size for reference tables");
@@ -120,9 +123,10 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 void Table::append(const std::vector<AllTypeVariant>& values) {
   auto last_chunk = !_chunks.empty() ? get_chunk(ChunkID{chunk_count() - 1}) : nullptr;
   if (!last_chunk || last_chunk->size() >= _target_chunk_size || !last_chunk->is_mutable()) {
-    // One chunk reached its capacity and was not finalized before.
+    // One chunk reached its capacity and was not finalized before. Like all finalized chunks, it can be pruned.
     if (last_chunk && last_chunk->is_mutable()) {
       last_chunk->finalize();
+      generate_chunk_pruning_statistics(last_chunk);
     }
 
     append_mutable_chunk();
@@ -130,6 +134,10 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   last_chunk->append(values);
+
+  if (_primary_key_index) {
+    _primary_key_index->insert(*this, ChunkID{chunk_count() - 1}, last_chunk->size() - 1, last_chunk->size());
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -221,6 +229,9 @@ void Table::remove_chunk(ChunkID chunk_id) {
               }()),
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   Assert(_type == TableType::Data, "Removing chunks from other tables than data tables is not intended yet.");
+  if (_primary_key_index) {
+    _primary_key_index->remove_chunk(chunk_id);
+  }
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
 }
 
@@ -244,7 +255,13 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
   // making sure that an uninitialized entry compares equal to nullptr and (2) insert the desired chunk atomically.
 
   auto new_chunk_iter = _chunks.push_back(nullptr);
-  std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(segments, mvcc_data, alloc));
+  const auto new_chunk = std::make_shared<Chunk>(segments, mvcc_data, alloc);
+  std::atomic_store(&*new_chunk_iter, new_chunk);
+
+  if (_primary_key_index && new_chunk->size() > 0) {
+    const auto new_chunk_id = static_cast<ChunkID>(std::distance(_chunks.begin(), new_chunk_iter));
+    _primary_key_index->insert(*this, new_chunk_id, 0, new_chunk->size());
+  }
 }
 
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
@@ -303,10 +320,17 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::shared_ptr<TableStatistics> Table::table_statistics() const { return _table_statistics; }
+std::shared_ptr<TableStatistics> Table::table_statistics() const { return std::atomic_load(&_table_statistics); }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  const auto lock = std::lock_guard<std::mutex>{*_table_statistics_mutex};
+  std::atomic_store(&_table_statistics, table_statistics);
+}
+
+void Table::update_table_statistics(
+    const std::function<std::shared_ptr<TableStatistics>(const std::shared_ptr<TableStatistics>&)>& update) const {
+  const auto lock = std::lock_guard<std::mutex>{*_table_statistics_mutex};
+  std::atomic_store(&_table_statistics, update(std::atomic_load(&_table_statistics)));
 }
 
 std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
@@ -345,6 +369,37 @@ void Table::add_soft_unique_constraint(const std::vector<ColumnID>& column_ids,
   }
 }
 
+void Table::create_primary_key_index() {
+  Assert(_type == TableType::Data, "PrimaryKeyIndex can only be created for data tables");
+  Assert(!_primary_key_index, "PrimaryKeyIndex already exists");
+
+  const auto primary_key_constraint =
+      std::find_if(_constraint_definitions.begin(), _constraint_definitions.end(),
+                   [](const auto& constraint) { return constraint.is_primary_key == IsPrimaryKey::Yes; });
+  Assert(primary_key_constraint != _constraint_definitions.end(), "PrimaryKeyIndex requires a primary key constraint");
+
+  const auto& column_ids = primary_key_constraint->columns;
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    data_types.emplace_back(column_data_type(column_id));
+  }
+
+  auto primary_key_index = std::make_shared<PrimaryKeyIndex>(column_ids, data_types);
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    primary_key_index->insert(*this, chunk_id, 0, chunk->size());
+  }
+
+  _primary_key_index = std::move(primary_key_index);
+  _indexes.emplace_back(IndexStatistics{column_ids, "primary_key", SegmentIndexType::PrimaryKey});
+}
+
+const std::shared_ptr<PrimaryKeyIndex>& Table::primary_key_index() const { return _primary_key_index; }
+
 size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -360,6 +415,10 @@ size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
     bytes += column_definition.name.size();
   }
 
+  if (_primary_key_index) {
+    bytes += _primary_key_index->memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indexes missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
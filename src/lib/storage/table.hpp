@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -18,6 +19,7 @@
 
 namespace opossum {
 
+class PrimaryKeyIndex;
 class TableStatistics;
 
 /**
@@ -177,6 +179,15 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> table_statistics() const;
 
   void set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics);
+
+  /**
+   * Replaces the table statistics with the result of @param update, which is called with the current statistics.
+   * Concurrent updates are serialized, so that the Insert and Delete operators can apply their changes to the
+   * statistics when they commit (see update_table_statistics.hpp). Readers are not blocked.
+   * (The function is marked as const, as otherwise it could not be called by the Delete operator.)
+   */
+  void update_table_statistics(
+      const std::function<std::shared_ptr<TableStatistics>(const std::shared_ptr<TableStatistics>&)>& update) const;
   /** @} */
 
   std::vector<IndexStatistics> indexes_statistics() const;
@@ -205,6 +216,16 @@ class Table : private Noncopyable {
   void add_soft_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key);
   const std::vector<TableConstraintDefinition>& get_soft_unique_constraints() const;
 
+  /**
+   * Creates a PrimaryKeyIndex on the columns of the primary key constraint and adds all rows that are already stored
+   * in the table. From then on, the index is maintained when rows are added (by the Insert operator, append_chunk, or
+   * append) and when chunks are removed. Like create_index, this must not be called while the table is modified.
+   */
+  void create_primary_key_index();
+
+  // Returns nullptr if no PrimaryKeyIndex was created
+  const std::shared_ptr<PrimaryKeyIndex>& primary_key_index() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -229,9 +250,12 @@ class Table : private Noncopyable {
 
   std::vector<TableConstraintDefinition> _constraint_definitions;
 
-  std::shared_ptr<TableStatistics> _table_statistics;
+  // Accessed atomically, as the statistics are replaced by committing transactions while the optimizer reads them
+  mutable std::shared_ptr<TableStatistics> _table_statistics;
+  std::unique_ptr<std::mutex> _table_statistics_mutex;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
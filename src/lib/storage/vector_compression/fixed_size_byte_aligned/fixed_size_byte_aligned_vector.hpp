@@ -9,6 +9,7 @@
 #include "fixed_size_byte_aligned_decompressor.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -18,6 +19,9 @@ namespace hana = boost::hana;
  * @brief Stores values as either uint32_t, uint16_t, or uint8_t
  *
  * This is simplest vector compression scheme. It matches the old FittedAttributeVector
+ *
+ * Usually, the vector owns its values. It can also refer to values that are owned by someone else, e.g., to a
+ * memory-mapped file (see BinaryParser). In this case, a shared pointer to the owner keeps the memory alive.
  */
 template <typename UnsignedIntType>
 class FixedSizeByteAlignedVector : public CompressedVector<FixedSizeByteAlignedVector<UnsignedIntType>> {
@@ -26,31 +30,48 @@ class FixedSizeByteAlignedVector : public CompressedVector<FixedSizeByteAlignedV
 
  public:
   explicit FixedSizeByteAlignedVector(pmr_vector<UnsignedIntType> data) : _data{std::move(data)} {}
+
+  // Creates a vector of size values that starts at external_data. The vector does not copy the values, but keeps
+  // external_data_owner alive as long as it exists. external_data must be aligned for UnsignedIntType.
+  FixedSizeByteAlignedVector(const UnsignedIntType* external_data, const size_t size,
+                             std::shared_ptr<const void> external_data_owner)
+      : _external_data{external_data}, _external_size{size}, _external_data_owner{std::move(external_data_owner)} {
+    Assert(_external_data_owner, "Owner of external data must be set");
+    Assert(reinterpret_cast<uintptr_t>(external_data) % alignof(UnsignedIntType) == 0, "External data is misaligned");
+  }
+
   ~FixedSizeByteAlignedVector() = default;
 
-  const pmr_vector<UnsignedIntType>& data() const { return _data; }
+  const UnsignedIntType* data() const { return _external_data_owner ? _external_data : _data.data(); }
+
+  // Returns true if the values are owned by someone else, see constructor
+  bool refers_to_external_data() const { return static_cast<bool>(_external_data_owner); }
 
  public:
-  size_t on_size() const { return _data.size(); }
-  size_t on_data_size() const { return sizeof(UnsignedIntType) * _data.size(); }
+  size_t on_size() const { return _external_data_owner ? _external_size : _data.size(); }
+  size_t on_data_size() const { return sizeof(UnsignedIntType) * on_size(); }
 
   auto on_create_base_decompressor() const {
-    return std::make_unique<FixedSizeByteAlignedDecompressor<UnsignedIntType>>(_data);
+    return std::make_unique<FixedSizeByteAlignedDecompressor<UnsignedIntType>>(data(), on_size());
   }
 
-  auto on_create_decompressor() const { return FixedSizeByteAlignedDecompressor<UnsignedIntType>(_data); }
+  auto on_create_decompressor() const { return FixedSizeByteAlignedDecompressor<UnsignedIntType>(data(), on_size()); }
 
-  auto on_begin() const { return _data.cbegin(); }
+  auto on_begin() const { return data(); }
 
-  auto on_end() const { return _data.cend(); }
+  auto on_end() const { return data() + on_size(); }
 
   std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
-    auto data_copy = pmr_vector<UnsignedIntType>{_data, alloc};
+    auto data_copy = pmr_vector<UnsignedIntType>{data(), data() + on_size(), alloc};
     return std::make_unique<FixedSizeByteAlignedVector<UnsignedIntType>>(std::move(data_copy));
   }
 
  private:
   const pmr_vector<UnsignedIntType> _data;
+
+  const UnsignedIntType* const _external_data{nullptr};
+  const size_t _external_size{0};
+  const std::shared_ptr<const void> _external_data_owner;
 };
 
 }  // namespace opossum
@@ -5,7 +5,7 @@
 namespace opossum {
 
 SimdBp128Decompressor::SimdBp128Decompressor(const SimdBp128Vector& vector)
-    : _data{&vector._data},
+    : _data{vector.data()},
       _size{vector._size},
       _cached_meta_info_offset{0u},
       _cached_meta_block_first_index{std::numeric_limits<size_t>::max()},
@@ -62,7 +62,7 @@ SimdBp128Decompressor& SimdBp128Decompressor::operator=(SimdBp128Decompressor&&
 }
 
 void SimdBp128Decompressor::_read_meta_info(const size_t meta_info_offset) {
-  Packing::read_meta_info(_data->data() + meta_info_offset, _cached_meta_info.data());
+  Packing::read_meta_info(_data + meta_info_offset, _cached_meta_info.data());
 }
 
 void SimdBp128Decompressor::_unpack_block(const size_t block_index) {
@@ -75,7 +75,7 @@ void SimdBp128Decompressor::_unpack_block(const size_t block_index) {
   // Absolute data offset within compressed vector
   const auto data_offset = _cached_meta_info_offset + relative_data_offset;
 
-  const auto compressed_data_in = _data->data() + data_offset;
+  const auto compressed_data_in = _data + data_offset;
   auto decompressed_data_out = _cached_block->data();
   const auto bit_size = _cached_meta_info[block_index];
 
@@ -142,7 +142,7 @@ class SimdBp128Decompressor : public BaseVectorDecompressor {
   void _unpack_block(const size_t block_index);
 
  private:
-  const pmr_vector<uint128_t>* _data;
+  const uint128_t* _data;
   size_t _size;
 
   // Cached meta info’s offset into the compressed vector
@@ -1,13 +1,35 @@
 #include "simd_bp128_vector.hpp"
 
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
 namespace opossum {
 
 SimdBp128Vector::SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size) : _data{std::move(vector)}, _size{size} {}
 
-const pmr_vector<uint128_t>& SimdBp128Vector::data() const { return _data; }
+SimdBp128Vector::SimdBp128Vector(const uint128_t* external_data, size_t data_block_count, size_t size,
+                                 std::shared_ptr<const void> external_data_owner)
+    : _size{size},
+      _external_data{external_data},
+      _external_data_block_count{data_block_count},
+      _external_data_owner{std::move(external_data_owner)} {
+  Assert(_external_data_owner, "Owner of external data must be set");
+  // The packing uses aligned SIMD loads
+  Assert(reinterpret_cast<uintptr_t>(external_data) % alignof(uint128_t) == 0, "External data is misaligned");
+}
+
+const uint128_t* SimdBp128Vector::data() const { return _external_data_owner ? _external_data : _data.data(); }
+
+size_t SimdBp128Vector::data_block_count() const {
+  return _external_data_owner ? _external_data_block_count : _data.size();
+}
+
+bool SimdBp128Vector::refers_to_external_data() const { return static_cast<bool>(_external_data_owner); }
 
 size_t SimdBp128Vector::on_size() const { return _size; }
-size_t SimdBp128Vector::on_data_size() const { return sizeof(uint128_t) * _data.size(); }
+size_t SimdBp128Vector::on_data_size() const { return sizeof(uint128_t) * data_block_count(); }
 
 std::unique_ptr<BaseVectorDecompressor> SimdBp128Vector::on_create_base_decompressor() const {
   return std::make_unique<SimdBp128Decompressor>(*this);
@@ -21,7 +43,7 @@ SimdBp128Iterator SimdBp128Vector::on_end() const { return SimdBp128Iterator{on_
 
 std::unique_ptr<const BaseCompressedVector> SimdBp128Vector::on_copy_using_allocator(
     const PolymorphicAllocator<size_t>& alloc) const {
-  auto data_copy = pmr_vector<uint128_t>{_data, alloc};
+  auto data_copy = pmr_vector<uint128_t>{data(), data() + data_block_count(), alloc};
   return std::make_unique<SimdBp128Vector>(std::move(data_copy), _size);
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
 #include "oversized_types.hpp"
@@ -19,14 +21,28 @@ namespace opossum {
  * form a meta block of 2048 values. Bit-length information are stored per meta block in 128 bit (8 bit for each bit
  * length) in front of the sixteen compressed blocks.
  *
+ * As FixedSizeByteAlignedVector, the vector can refer to compressed data that is owned by someone else.
+ *
  * @see SimdBp128Packing for more information
  */
 class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
  public:
   explicit SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size);
+
+  // Creates a vector of size values whose data_block_count compressed 128-bit blocks start at external_data. The data
+  // is not copied, but external_data_owner is kept alive as long as the vector exists. external_data must be 16-byte
+  // aligned.
+  SimdBp128Vector(const uint128_t* external_data, size_t data_block_count, size_t size,
+                  std::shared_ptr<const void> external_data_owner);
+
   ~SimdBp128Vector() = default;
 
-  const pmr_vector<uint128_t>& data() const;
+  const uint128_t* data() const;
+
+  // Number of compressed 128-bit blocks starting at data()
+  size_t data_block_count() const;
+
+  bool refers_to_external_data() const;
 
   size_t on_size() const;
   size_t on_data_size() const;
@@ -44,5 +60,9 @@ class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
 
   const pmr_vector<uint128_t> _data;
   const size_t _size;
+
+  const uint128_t* const _external_data{nullptr};
+  const size_t _external_data_block_count{0};
+  const std::shared_ptr<const void> _external_data_owner;
 };
 }  // namespace opossum
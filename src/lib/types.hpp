@@ -216,6 +216,11 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 
+// In the materializing mode, operators are executed one after another, each producing its entire output. In the
+// pipelined mode, chains of operators that process their input chunk by chunk are executed morsel-wise, i.e., each
+// input chunk is pushed through the entire chain before the next one (see OperatorPipeline).
+enum class ExecutionMode { Materializing, Pipelined };
+
 enum class MemoryUsageCalculationMode { Sampled, Full };
 
 enum class EraseReferencedSegmentType : bool { Yes = true, No = false };
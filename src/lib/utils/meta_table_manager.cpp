@@ -1,5 +1,6 @@
 #include "meta_table_manager.hpp"
 
+#include "utils/assert.hpp"
 #include "utils/meta_tables/meta_chunk_sort_orders_table.hpp"
 #include "utils/meta_tables/meta_chunks_table.hpp"
 #include "utils/meta_tables/meta_columns_table.hpp"
@@ -37,6 +38,18 @@ bool MetaTableManager::has_table(const std::string& table_name) const {
   return _meta_tables.count(_trim_table_name(table_name));
 }
 
+void MetaTableManager::add_table(const std::shared_ptr<AbstractMetaTable>& table) {
+  Assert(!_meta_tables.count(table->name()), "Meta table " + table->name() + " already exists");
+  _add(table);
+}
+
+void MetaTableManager::remove_table(const std::string& table_name) {
+  const auto trimmed_table_name = _trim_table_name(table_name);
+  Assert(_meta_tables.count(trimmed_table_name), "Meta table " + trimmed_table_name + " does not exist");
+  _meta_tables.erase(trimmed_table_name);
+  _table_names.erase(std::find(_table_names.begin(), _table_names.end(), trimmed_table_name));
+}
+
 std::shared_ptr<Table> MetaTableManager::generate_table(const std::string& table_name) const {
   return (_meta_tables.at(_trim_table_name(table_name)))->_generate();
 }
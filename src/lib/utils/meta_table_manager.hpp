@@ -21,6 +21,10 @@ class MetaTableManager : public Noncopyable {
 
   bool has_table(const std::string& table_name) const;
 
+  // Adds and removes meta tables that are not built into Hyrise, e.g., meta tables provided by plugins
+  void add_table(const std::shared_ptr<AbstractMetaTable>& table);
+  void remove_table(const std::string& table_name);
+
   // Generates the meta table specified by table_name (which can include the prefix)
   std::shared_ptr<Table> generate_table(const std::string& table_name) const;
 
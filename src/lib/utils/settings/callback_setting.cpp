@@ -0,0 +1,44 @@
+#include "callback_setting.hpp"
+
+#include <charconv>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CallbackSetting::CallbackSetting(const std::string& init_name, const std::string& description,
+                                 const std::string& init_value, const std::function<void(const std::string&)>& apply)
+    : AbstractSetting(init_name), _description(description), _value(init_value), _apply(apply) {}
+
+const std::string& CallbackSetting::description() const { return _description; }
+
+const std::string& CallbackSetting::get() { return _value; }
+
+void CallbackSetting::set(const std::string& value) {
+  _apply(value);
+  _value = value;
+}
+
+uint64_t parse_unsigned_setting(const std::string& name, const std::string& value) {
+  auto parsed_value = uint64_t{0};
+  const auto value_end = value.data() + value.size();
+  const auto [parse_end, error] = std::from_chars(value.data(), value_end, parsed_value);
+  Assert(!value.empty() && error == std::errc{} && parse_end == value_end,
+         "Setting " + name + " expects a non-negative integer, got '" + value + "'");
+  return parsed_value;
+}
+
+double parse_ratio_setting(const std::string& name, const std::string& value) {
+  auto parsed_length = size_t{0};
+  auto parsed_value = -1.0;
+  try {
+    parsed_value = std::stod(value, &parsed_length);
+  } catch (const std::exception&) {
+    parsed_length = 0;
+  }
+  Assert(parsed_length > 0 && parsed_length == value.size() && parsed_value >= 0.0 && parsed_value <= 1.0,
+         "Setting " + name + " expects a number between 0 and 1, got '" + value + "'");
+  return parsed_value;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "abstract_setting.hpp"
+
+namespace opossum {
+
+/**
+ * Setting whose changed values are passed to a callback, which applies them or throws if they are invalid. In the
+ * latter case, the setting keeps its previous value. Used by components (e.g., plugins) that apply their settings to
+ * their own members.
+ */
+class CallbackSetting : public AbstractSetting {
+ public:
+  CallbackSetting(const std::string& init_name, const std::string& description, const std::string& init_value,
+                  const std::function<void(const std::string&)>& apply);
+
+  const std::string& description() const final;
+
+  const std::string& get() final;
+
+  void set(const std::string& value) final;
+
+ private:
+  const std::string _description;
+  std::string _value;
+  const std::function<void(const std::string&)> _apply;
+};
+
+// std::stoul and std::stod accept values with trailing characters (and std::stoul accepts negative values), so the
+// following functions parse the values of settings strictly. They throw if the value of the setting `name` is invalid.
+uint64_t parse_unsigned_setting(const std::string& name, const std::string& value);
+
+// Parses a number between 0 and 1
+double parse_ratio_setting(const std::string& name, const std::string& value);
+
+}  // namespace opossum
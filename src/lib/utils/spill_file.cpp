@@ -0,0 +1,121 @@
+#include "spill_file.hpp"
+
+#include <lz4.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+
+namespace opossum {
+
+SpillFile::SpillFile(const bool compressed) : _compressed(compressed) {
+  // mkstemp creates the file with a unique name, which we then open as a stream
+  auto path_template = (std::filesystem::temp_directory_path() / "hyrise_spill_XXXXXX").string();
+  const auto file_descriptor = mkstemp(path_template.data());
+  Assert(file_descriptor >= 0, "Could not create spill file in '" +
+                                   std::filesystem::temp_directory_path().string() + "'");
+  close(file_descriptor);
+  _path = path_template;
+
+  _stream.exceptions(std::fstream::failbit | std::fstream::badbit);
+  _stream.open(_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+}
+
+SpillFile::~SpillFile() {
+  // Do not throw from the destructor, the file is removed anyway
+  _stream.exceptions(std::fstream::goodbit);
+  _stream.close();
+  std::filesystem::remove(_path);
+}
+
+void SpillFile::finish_writing() {
+  Assert(_is_writable, "finish_writing() was already called");
+  _is_writable = false;
+  _stream.flush();
+  _stream.seekg(0);
+}
+
+size_t SpillFile::size() const { return _size; }
+
+size_t SpillFile::uncompressed_size() const { return _uncompressed_size; }
+
+bool SpillFile::is_compressed() const { return _compressed; }
+
+const std::string& SpillFile::path() const { return _path; }
+
+void SpillFile::_write_bytes(const char* data, const size_t size) {
+  DebugAssert(_is_writable, "Cannot write to a spill file after finish_writing() was called");
+  _uncompressed_size += size;
+
+  if (_is_in_block) {
+    _block_buffer.insert(_block_buffer.end(), data, data + size);
+  } else {
+    _write_to_stream(data, size);
+  }
+}
+
+void SpillFile::_read_bytes(char* data, const size_t size) {
+  DebugAssert(!_is_writable, "finish_writing() has to be called before reading from a spill file");
+
+  if (_block_read_offset < _block_buffer.size()) {
+    DebugAssert(_block_read_offset + size <= _block_buffer.size(), "Read exceeds the decompressed block");
+    std::copy_n(_block_buffer.data() + _block_read_offset, size, data);
+    _block_read_offset += size;
+  } else {
+    _stream.read(data, static_cast<std::streamsize>(size));
+  }
+}
+
+void SpillFile::_write_to_stream(const char* data, const size_t size) {
+  _stream.write(data, static_cast<std::streamsize>(size));
+  _size += size;
+}
+
+void SpillFile::_begin_block() {
+  if (!_compressed) return;
+
+  DebugAssert(!_is_in_block, "Blocks cannot be nested");
+  _is_in_block = true;
+  _block_buffer.clear();
+}
+
+void SpillFile::_end_block() {
+  if (!_compressed) return;
+
+  _is_in_block = false;
+  Assert(_block_buffer.size() <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE), "Block is too large for LZ4 compression");
+
+  // Each block is stored as its uncompressed size, its compressed size, and the compressed data
+  auto block_sizes = std::array<size_t, 2>{_block_buffer.size(), 0};
+  auto compressed_block = std::vector<char>(LZ4_compressBound(static_cast<int>(block_sizes[0])));
+  const auto compressed_block_size =
+      LZ4_compress_default(_block_buffer.data(), compressed_block.data(), static_cast<int>(block_sizes[0]),
+                           static_cast<int>(compressed_block.size()));
+  Assert(compressed_block_size > 0, "LZ4 compression of spill block failed");
+  block_sizes[1] = static_cast<size_t>(compressed_block_size);
+
+  _write_to_stream(reinterpret_cast<const char*>(block_sizes.data()), sizeof(block_sizes));
+  _write_to_stream(compressed_block.data(), block_sizes[1]);
+  _block_buffer.clear();
+}
+
+void SpillFile::_read_block() {
+  if (!_compressed) return;
+
+  DebugAssert(_block_read_offset == _block_buffer.size(), "Previous block was not read completely");
+  auto block_sizes = std::array<size_t, 2>{};
+  _stream.read(reinterpret_cast<char*>(block_sizes.data()), sizeof(block_sizes));
+  auto compressed_block = std::vector<char>(block_sizes[1]);
+  _stream.read(compressed_block.data(), static_cast<std::streamsize>(block_sizes[1]));
+
+  _block_buffer.resize(block_sizes[0]);
+  _block_read_offset = 0;
+  const auto decompressed_size =
+      LZ4_decompress_safe(compressed_block.data(), _block_buffer.data(), static_cast<int>(block_sizes[1]),
+                          static_cast<int>(block_sizes[0]));
+  Assert(decompressed_size == static_cast<int>(block_sizes[0]), "LZ4 decompression of spill block failed");
+}
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Temporary file to which operators write intermediate data that does not fit into their memory budget (see
+ * AbstractOperator::set_memory_budget_recursively). The file is created in the system's temporary directory (which can
+ * be changed via the TMPDIR environment variable) and removed when the SpillFile is destroyed.
+ *
+ * Data is first written and, after calling finish_writing(), read back in the same order. Vectors are stored with a
+ * length prefix so that they can be read without knowing their size in advance. If the file is compressed, each vector
+ * is compressed as a separate LZ4 block, which trades CPU time for less I/O.
+ */
+class SpillFile : private Noncopyable {
+ public:
+  explicit SpillFile(const bool compressed = false);
+  ~SpillFile();
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+    _write_bytes(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T, typename Alloc>
+  void write(const std::vector<T, Alloc>& values) {
+    _begin_block();
+    write(values.size());
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      // First the lengths of the strings, then their concatenated characters
+      auto string_lengths = std::vector<size_t>(values.size());
+      for (auto index = size_t{0}; index < values.size(); ++index) {
+        string_lengths[index] = values[index].size();
+      }
+      _write_bytes(reinterpret_cast<const char*>(string_lengths.data()), string_lengths.size() * sizeof(size_t));
+      for (const auto& value : values) {
+        _write_bytes(value.data(), value.size());
+      }
+    } else if constexpr (std::is_same_v<T, bool>) {
+      const auto chars = std::vector<char>(values.begin(), values.end());
+      _write_bytes(chars.data(), chars.size());
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Unsupported value type");
+      _write_bytes(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+    _end_block();
+  }
+
+  // Flushes the written data and rewinds the file for reading. Afterwards, no more data can be written.
+  void finish_writing();
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read directly");
+    auto value = T{};
+    _read_bytes(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+
+  template <typename T, typename Alloc>
+  void read(std::vector<T, Alloc>& values) {
+    _read_block();
+    const auto size = read<size_t>();
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      auto string_lengths = std::vector<size_t>(size);
+      _read_bytes(reinterpret_cast<char*>(string_lengths.data()), size * sizeof(size_t));
+      values.resize(size);
+      for (auto index = size_t{0}; index < size; ++index) {
+        values[index].resize(string_lengths[index]);
+        _read_bytes(values[index].data(), string_lengths[index]);
+      }
+    } else if constexpr (std::is_same_v<T, bool>) {
+      auto chars = std::vector<char>(size);
+      _read_bytes(chars.data(), size);
+      values.assign(chars.begin(), chars.end());
+    } else {
+      values.resize(size);
+      _read_bytes(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+    }
+  }
+
+  // Number of bytes written to the file, i.e., after compression
+  size_t size() const;
+
+  // Number of bytes passed to write()
+  size_t uncompressed_size() const;
+
+  bool is_compressed() const;
+
+  const std::string& path() const;
+
+ private:
+  void _write_bytes(const char* data, const size_t size);
+  void _read_bytes(char* data, const size_t size);
+  void _write_to_stream(const char* data, const size_t size);
+
+  // For compressed files, the bytes written between _begin_block() and _end_block() are buffered and compressed as one
+  // block. _read_block() decompresses the next block, from which the following reads are served.
+  void _begin_block();
+  void _end_block();
+  void _read_block();
+
+  std::string _path;
+  std::fstream _stream;
+  size_t _size{0};
+  size_t _uncompressed_size{0};
+  bool _is_writable{true};
+
+  const bool _compressed;
+  bool _is_in_block{false};
+  std::vector<char> _block_buffer;
+  size_t _block_read_offset{0};
+};
+
+}  // namespace opossum
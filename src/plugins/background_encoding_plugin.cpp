@@ -0,0 +1,263 @@
+#include "background_encoding_plugin.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "constant_mappings.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto SETTING_PREFIX = std::string{"BackgroundEncodingPlugin."};
+
+std::string chunk_encoding_spec_to_string(const ChunkEncodingSpec& chunk_encoding_spec) {
+  auto stream = std::stringstream{};
+  for (auto column_id = size_t{0}; column_id < chunk_encoding_spec.size(); ++column_id) {
+    if (column_id > 0) stream << ", ";
+    stream << chunk_encoding_spec[column_id];
+  }
+  return stream.str();
+}
+
+}  // namespace
+
+namespace opossum {
+
+const std::string BackgroundEncodingPlugin::description() const { return "Background encoding plugin"; }
+
+void BackgroundEncodingPlugin::start() {
+  _settings = {
+      std::make_shared<CallbackSetting>(
+          SETTING_PREFIX + "idle_delay_ms", "Time in milliseconds to sleep between two runs",
+          std::to_string(DEFAULT_IDLE_DELAY.count()),
+          [&](const std::string& value) {
+            const auto idle_delay =
+                std::chrono::milliseconds{parse_unsigned_setting(SETTING_PREFIX + "idle_delay_ms", value)};
+            _loop_thread->set_loop_sleep_time(idle_delay);
+          }),
+      std::make_shared<CallbackSetting>(
+          SETTING_PREFIX + "max_chunks_per_run", "Maximum number of chunks that are encoded per run",
+          std::to_string(DEFAULT_MAX_CHUNKS_PER_RUN),
+          [&](const std::string& value) {
+            _max_chunks_per_run = parse_unsigned_setting(SETTING_PREFIX + "max_chunks_per_run", value);
+          }),
+      std::make_shared<CallbackSetting>(
+          SETTING_PREFIX + "default_encoding", "Encoding type used for tables that have no encoded chunks",
+          encoding_type_to_string.left.at(DEFAULT_ENCODING_TYPE), [&](const std::string& value) {
+            const auto iter = encoding_type_to_string.right.find(value);
+            Assert(iter != encoding_type_to_string.right.end(), "Unknown encoding type '" + value + "'");
+            _default_encoding_type = iter->second;
+          })};
+  for (const auto& setting : _settings) {
+    setting->register_at_settings_manager();
+  }
+
+  _meta_table = std::make_shared<MetaBackgroundEncodingTable>(*this);
+  Hyrise::get().meta_table_manager.add_table(_meta_table);
+
+  _loop_thread = std::make_unique<PausableLoopThread>(DEFAULT_IDLE_DELAY, [&](size_t) { _run(); });
+}
+
+void BackgroundEncodingPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+
+  for (const auto& setting : _settings) {
+    setting->unregister_at_settings_manager();
+  }
+  _settings.clear();
+
+  Hyrise::get().meta_table_manager.remove_table(_meta_table->name());
+  _meta_table.reset();
+
+  _finalized_chunks.clear();
+}
+
+std::map<std::string, BackgroundEncodingPlugin::TableEncodingStatus> BackgroundEncodingPlugin::table_encoding_status()
+    const {
+  const auto lock = std::lock_guard<std::mutex>{_table_encoding_status_mutex};
+  return _table_encoding_status;
+}
+
+size_t BackgroundEncodingPlugin::_run() {
+  auto waiting_chunk_counts = std::map<std::string, size_t>{};
+
+  // Finalize chunks that do not receive further rows (i.e., full chunks and chunks before the last chunk) once all of
+  // their inserts are finished
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    // Chunks of tables without MVCC data are not filled by the Insert operator
+    if (table->uses_mvcc() != UseMvcc::Yes) continue;
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || !chunk->is_mutable() || chunk->size() == 0) continue;
+      if (chunk_id == chunk_count - 1 && chunk->size() < table->target_chunk_size()) continue;
+
+      if (!_inserts_are_finished(*chunk)) {
+        ++waiting_chunk_counts[table_name];
+        continue;
+      }
+
+      {
+        // The Insert operator checks whether the last chunk is mutable while holding the append mutex
+        const auto append_lock = table->acquire_append_mutex();
+        if (!chunk->is_mutable()) continue;
+        chunk->finalize();
+      }
+
+      // Generate the pruning statistics right away, so that the chunk can be pruned while it waits for its encoding
+      generate_chunk_pruning_statistics(chunk);
+      _finalized_chunks.emplace_back(FinalizedChunk{table_name, table, chunk});
+    }
+  }
+
+  // Encode the finalized chunks. The number of chunks encoded per run is limited so that the plugin does not take
+  // away too many resources from query processing when many chunks become full at once.
+  const auto max_chunks_per_run = _max_chunks_per_run.load();
+  auto encoded_chunk_count = size_t{0};
+  auto encodings = std::map<std::string, std::string>{};
+  auto encoded_chunk_counts = std::map<std::string, size_t>{};
+  while (!_finalized_chunks.empty() && encoded_chunk_count < max_chunks_per_run) {
+    const auto finalized_chunk = _finalized_chunks.front();
+    const auto table = finalized_chunk.table.lock();
+    const auto chunk = finalized_chunk.chunk.lock();
+
+    // The table might have been dropped or the chunk might have been removed (e.g., by the MvccDeletePlugin)
+    if (table && chunk && !chunk->get_cleanup_commit_id()) {
+      const auto chunk_encoding_spec = _configured_encoding_spec(*table);
+      _encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec);
+
+      encodings[finalized_chunk.table_name] = chunk_encoding_spec_to_string(chunk_encoding_spec);
+      ++encoded_chunk_counts[finalized_chunk.table_name];
+      ++encoded_chunk_count;
+    }
+
+    _finalized_chunks.pop_front();
+  }
+
+  for (const auto& finalized_chunk : _finalized_chunks) {
+    ++waiting_chunk_counts[finalized_chunk.table_name];
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_table_encoding_status_mutex};
+  for (auto& [table_name, status] : _table_encoding_status) {
+    status.pending_chunk_count = 0;
+  }
+  for (const auto& [table_name, waiting_chunk_count] : waiting_chunk_counts) {
+    _table_encoding_status[table_name].pending_chunk_count = waiting_chunk_count;
+  }
+  for (const auto& [table_name, table_encoded_chunk_count] : encoded_chunk_counts) {
+    auto& status = _table_encoding_status[table_name];
+    status.encoded_chunk_count += table_encoded_chunk_count;
+    status.encoding = encodings[table_name];
+  }
+
+  return encoded_chunk_count;
+}
+
+bool BackgroundEncodingPlugin::_inserts_are_finished(const Chunk& chunk) {
+  const auto mvcc_data = chunk.mvcc_data();
+  if (!mvcc_data) return false;
+
+  // The begin commit ID is set when an insert is committed and reset to zero when it is rolled back. Until then, it
+  // is MAX_COMMIT_ID, even if the row has been allocated by an Insert operator.
+  const auto chunk_size = chunk.size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
+  }
+  return true;
+}
+
+ChunkEncodingSpec BackgroundEncodingPlugin::_configured_encoding_spec(const Table& table) const {
+  const auto column_count = table.column_count();
+
+  // Use the encoding of the most recent immutable chunk that was not finalized by the plugin and still waits for its
+  // encoding. Chunks that were encoded by the plugin have the configured encoding as well.
+  for (auto chunk_id = static_cast<int64_t>(table.chunk_count()) - 1; chunk_id >= 0; --chunk_id) {
+    const auto chunk = table.get_chunk(ChunkID{static_cast<ChunkID::base_type>(chunk_id)});
+    if (!chunk || chunk->is_mutable()) continue;
+
+    const auto is_finalized_chunk = std::any_of(_finalized_chunks.cbegin(), _finalized_chunks.cend(),
+                                                [&](const auto& finalized_chunk) {
+                                                  return finalized_chunk.chunk.lock() == chunk;
+                                                });
+    if (is_finalized_chunk) continue;
+
+    auto chunk_encoding_spec = ChunkEncodingSpec{};
+    chunk_encoding_spec.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      chunk_encoding_spec.emplace_back(get_segment_encoding_spec(chunk->get_segment(column_id)));
+    }
+    return chunk_encoding_spec;
+  }
+
+  // Fall back to the default encoding. Columns whose data type is not supported by it are dictionary-encoded.
+  const auto default_encoding_type = _default_encoding_type.load();
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (encoding_supports_data_type(default_encoding_type, table.column_data_type(column_id))) {
+      chunk_encoding_spec.emplace_back(default_encoding_type);
+    } else {
+      chunk_encoding_spec.emplace_back(EncodingType::Dictionary);
+    }
+  }
+  return chunk_encoding_spec;
+}
+
+void BackgroundEncodingPlugin::_encode_chunk(const std::shared_ptr<Chunk>& chunk,
+                                             const std::vector<DataType>& column_data_types,
+                                             const ChunkEncodingSpec& chunk_encoding_spec) {
+  DebugAssert(!chunk->is_mutable(), "Only immutable chunks can be encoded");
+
+  // Encode all segments before replacing them, so that the chunk is replaced as a whole as far as possible
+  const auto column_count = chunk->column_count();
+  auto encoded_segments = Segments{};
+  encoded_segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    encoded_segments.emplace_back(ChunkEncoder::encode_segment(chunk->get_segment(column_id),
+                                                               column_data_types[column_id],
+                                                               chunk_encoding_spec[column_id]));
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    chunk->replace_segment(column_id, encoded_segments[column_id]);
+  }
+
+  generate_chunk_pruning_statistics(chunk);
+}
+
+MetaBackgroundEncodingTable::MetaBackgroundEncodingTable(const BackgroundEncodingPlugin& plugin)
+    : AbstractMetaTable(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                               {"encoded_chunk_count", DataType::Long, false},
+                                               {"pending_chunk_count", DataType::Long, false},
+                                               {"encoding", DataType::String, false}}),
+      _plugin(plugin) {}
+
+const std::string& MetaBackgroundEncodingTable::name() const {
+  static const auto name = std::string{"background_encoding"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaBackgroundEncodingTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, status] : _plugin.table_encoding_status()) {
+    output_table->append({pmr_string{table_name}, static_cast<int64_t>(status.encoded_chunk_count),
+                          static_cast<int64_t>(status.pending_chunk_count), pmr_string{status.encoding}});
+  }
+
+  return output_table;
+}
+
+EXPORT_PLUGIN(BackgroundEncodingPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/meta_tables/abstract_meta_table.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/callback_setting.hpp"
+
+namespace opossum {
+
+/**
+ * Chunks that are filled by the Insert operator are not finalized once they are full, so that they keep their
+ * ValueSegments. Scans over unencoded chunks are slower and the chunks use more memory than encoded ones.
+ *
+ * This plugin periodically looks for full, mutable chunks whose inserts have all been committed or rolled back. The
+ * same applies to partially filled chunks that are not the last chunk of their table anymore (e.g., because the
+ * MvccDeletePlugin appended a compacted chunk), as the Insert operator only appends rows to the last chunk. The plugin
+ * finalizes these chunks and generates their pruning statistics. Then, it encodes them and replaces their segments.
+ * Chunks are encoded with the table's configured encoding, i.e., the encoding of its most recent immutable chunk that
+ * was not finalized by the plugin. If a table has no such chunk, the default encoding (see settings) is used.
+ *
+ * The segments of a chunk are only replaced once all of them have been encoded. As segments are replaced atomically
+ * and the encoded segments hold the same values as the replaced ones, operators that are concurrently reading a chunk
+ * are not affected.
+ *
+ * The plugin is configured via the following settings (see the settings meta table), which are prefixed with
+ * "BackgroundEncodingPlugin.":
+ *  - idle_delay_ms: Time to sleep between two runs
+ *  - max_chunks_per_run: Maximum number of chunks encoded per run, which throttles the plugin
+ *  - default_encoding: Encoding type for tables without configured encoding (e.g., "Dictionary")
+ *
+ * The meta table "background_encoding" lists the tables with chunks encoded or pending to be encoded by the plugin.
+ */
+class BackgroundEncodingPlugin : public AbstractPlugin {
+  friend class BackgroundEncodingPluginTest;
+
+ public:
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  constexpr static auto DEFAULT_IDLE_DELAY = std::chrono::milliseconds{1000};
+  constexpr static auto DEFAULT_MAX_CHUNKS_PER_RUN = size_t{4};
+  constexpr static auto DEFAULT_ENCODING_TYPE = EncodingType::Dictionary;
+
+  struct TableEncodingStatus {
+    // Chunks encoded by the plugin since it was started
+    size_t encoded_chunk_count{0};
+
+    // Full chunks that wait for their inserts to finish or that were finalized but not yet encoded
+    size_t pending_chunk_count{0};
+
+    // Encoding specification used for the last encoded chunk
+    std::string encoding;
+  };
+
+  std::map<std::string, TableEncodingStatus> table_encoding_status() const;
+
+ private:
+  // Finalizes completely inserted chunks and encodes up to _max_chunks_per_run of them. Returns the number of encoded
+  // chunks.
+  size_t _run();
+
+  // Returns true if all rows of the chunk have been inserted and their transactions are committed or rolled back
+  static bool _inserts_are_finished(const Chunk& chunk);
+
+  ChunkEncodingSpec _configured_encoding_spec(const Table& table) const;
+
+  static void _encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
+                            const ChunkEncodingSpec& chunk_encoding_spec);
+
+  struct FinalizedChunk {
+    std::string table_name;
+    std::weak_ptr<Table> table;
+    std::weak_ptr<Chunk> chunk;
+  };
+
+  std::atomic<size_t> _max_chunks_per_run{DEFAULT_MAX_CHUNKS_PER_RUN};
+  std::atomic<EncodingType> _default_encoding_type{DEFAULT_ENCODING_TYPE};
+
+  // Chunks finalized by the plugin that still have to be encoded, in the order in which they were finalized
+  std::deque<FinalizedChunk> _finalized_chunks;
+
+  mutable std::mutex _table_encoding_status_mutex;
+  std::map<std::string, TableEncodingStatus> _table_encoding_status;
+
+  std::vector<std::shared_ptr<AbstractSetting>> _settings;
+  std::shared_ptr<AbstractMetaTable> _meta_table;
+
+  // Declared last so that the thread is stopped before the other members are destroyed
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+/**
+ * Lists the encoding status of all tables in which the BackgroundEncodingPlugin encoded chunks or found chunks to
+ * encode.
+ */
+class MetaBackgroundEncodingTable : public AbstractMetaTable {
+ public:
+  explicit MetaBackgroundEncodingTable(const BackgroundEncodingPlugin& plugin);
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+
+  const BackgroundEncodingPlugin& _plugin;
+};
+
+}  // namespace opossum
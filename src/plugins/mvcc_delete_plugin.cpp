@@ -1,18 +1,165 @@
 #include "mvcc_delete_plugin.hpp"
 
-#include "operators/get_table.hpp"
+#include <limits>
+#include <mutex>
+#include <string>
+
+#include "operators/abstract_read_write_operator.hpp"
+#include "operators/delete.hpp"
 #include "operators/table_wrapper.hpp"
-#include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key_index.hpp"
 #include "storage/pos_lists/rowid_pos_list.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto SETTING_PREFIX = std::string{"MvccDeletePlugin."};
+
+/**
+ * Appends a chunk with the given segments to the table, whose rows become visible when the transaction commits. The
+ * chunk is finalized on commit or rollback. Until then, the operator holds the append mutex of the table, as the
+ * Insert operator would append rows to the chunk otherwise. The mutex is released in commit_records(), i.e., before
+ * the transaction waits for its log entry to be flushed. The previous last chunk is left as it is: Once the new chunk
+ * is finalized, the Insert operator appends rows to a fresh chunk.
+ */
+class InsertCompactedChunk : public AbstractReadWriteOperator {
+ public:
+  InsertCompactedChunk(const std::string& table_name, const std::shared_ptr<Table>& table, const Segments& segments)
+      : AbstractReadWriteOperator(OperatorType::Insert), _table_name(table_name), _table(table), _segments(segments) {}
+
+  const std::string& name() const override {
+    static const auto name = std::string{"InsertCompactedChunk"};
+    return name;
+  }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override {
+    // Mark the rows as being inserted by the current transaction, so that they are invisible to other transactions
+    const auto row_count = _segments.front()->size();
+    const auto mvcc_data = std::make_shared<MvccData>(row_count, MvccData::MAX_COMMIT_ID);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      mvcc_data->set_tid(chunk_offset, context->transaction_id(), std::memory_order_relaxed);
+    }
+
+    _append_lock = _table->acquire_append_mutex();
+    _table->append_chunk(_segments, mvcc_data);
+    _chunk_id = static_cast<ChunkID>(_table->chunk_count() - 1);
+    _chunk = _table->get_chunk(_chunk_id);
+    generate_chunk_pruning_statistics(_chunk);
+
+    return nullptr;
+  }
+
+  void _on_commit_records(const CommitID commit_id) override {
+    const auto& mvcc_data = _chunk->mvcc_data();
+    const auto chunk_size = _chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, commit_id);
+      mvcc_data->set_tid(chunk_offset, 0u, std::memory_order_relaxed);
+    }
+
+    // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
+    std::atomic_thread_fence(std::memory_order_release);
+
+    _chunk->finalize();
+    _append_lock.unlock();
+  }
+
+  void _on_rollback_records() override {
+    if (!_chunk) return;
+
+    // As for the Insert operator, the end_cids have to be set before the begin_cids (see Insert::_on_rollback_records)
+    const auto& mvcc_data = _chunk->mvcc_data();
+    const auto chunk_size = _chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_end_cid(chunk_offset, 0u);
+    }
+    _chunk->increase_invalid_row_count(chunk_size);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, 0u);
+      mvcc_data->set_tid(chunk_offset, 0u, std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    _chunk->finalize();
+    _append_lock.unlock();
+  }
+
+  void _on_log_records(LogEntryWriter& log_entry) const override {
+    log_entry.insert(_table_name, *_table, _chunk_id, ChunkOffset{0}, _chunk->size());
+  }
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override {
+    return std::make_shared<InsertCompactedChunk>(_table_name, _table, _segments);
+  }
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override {}
+
+ private:
+  const std::string _table_name;
+  const std::shared_ptr<Table> _table;
+  const Segments _segments;
+
+  ChunkID _chunk_id{INVALID_CHUNK_ID};
+  std::shared_ptr<Chunk> _chunk;
+  std::unique_lock<std::mutex> _append_lock;
+};
+
+}  // namespace
 
 namespace opossum {
 
 const std::string MvccDeletePlugin::description() const { return "Physical MVCC delete plugin"; }
 
 void MvccDeletePlugin::start() {
+  _settings = {
+      std::make_shared<CallbackSetting>(
+          SETTING_PREFIX + "idle_delay_ms",
+          "Time in milliseconds to sleep between two runs of the logical and the physical delete",
+          std::to_string(IDLE_DELAY_LOGICAL_DELETE.count()),
+          [&](const std::string& value) {
+            const auto idle_delay =
+                std::chrono::milliseconds{parse_unsigned_setting(SETTING_PREFIX + "idle_delay_ms", value)};
+            _loop_thread_logical_delete->set_loop_sleep_time(idle_delay);
+            _loop_thread_physical_delete->set_loop_sleep_time(idle_delay);
+          }),
+      std::make_shared<CallbackSetting>(
+          SETTING_PREFIX + "invalidated_rows_threshold",
+          "Share of invalidated rows (between 0 and 1) from which on a chunk is compacted",
+          std::to_string(DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS),
+          [&](const std::string& value) {
+            _invalidated_rows_threshold = parse_ratio_setting(SETTING_PREFIX + "invalidated_rows_threshold", value);
+          }),
+      std::make_shared<CallbackSetting>(
+          SETTING_PREFIX + "min_commits_since_invalidation",
+          "Number of commits that must have passed since the last invalidation of a chunk before it is compacted",
+          std::to_string(DELETE_THRESHOLD_LAST_COMMIT),
+          [&](const std::string& value) {
+            const auto min_commits = parse_unsigned_setting(SETTING_PREFIX + "min_commits_since_invalidation", value);
+            Assert(min_commits <= std::numeric_limits<CommitID>::max(),
+                   "Setting " + SETTING_PREFIX + "min_commits_since_invalidation is out of range");
+            _min_commits_since_invalidation = static_cast<CommitID>(min_commits);
+          })};
+  for (const auto& setting : _settings) {
+    setting->register_at_settings_manager();
+  }
+
   _loop_thread_logical_delete =
       std::make_unique<PausableLoopThread>(IDLE_DELAY_LOGICAL_DELETE, [&](size_t) { _logical_delete_loop(); });
 
@@ -26,6 +173,11 @@ void MvccDeletePlugin::stop() {
   _loop_thread_physical_delete.reset();
   std::queue<TableAndChunkID> empty;
   std::swap(_physical_delete_queue, empty);
+
+  for (const auto& setting : _settings) {
+    setting->unregister_at_settings_manager();
+  }
+  _settings.clear();
 }
 
 /**
@@ -34,128 +186,263 @@ void MvccDeletePlugin::stop() {
  */
 void MvccDeletePlugin::_logical_delete_loop() {
   // Check all tables
-  for (auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
     if (table->empty() || table->uses_mvcc() != UseMvcc::Yes) continue;
 
-    // Check all chunks, except for the last one, which is currently used for insertions
-    const auto max_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
-    for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; chunk_id++) {
-      const auto& chunk = table->get_chunk(chunk_id);
-      if (chunk && !chunk->get_cleanup_commit_id()) {
-        // Calculate metric 1 – Chunk invalidation level
-        const double invalidated_rows_ratio = static_cast<double>(chunk->invalid_row_count()) / chunk->size();
-        const bool criterion1 = (DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS <= invalidated_rows_ratio);
-
-        if (!criterion1) {
-          continue;
-        }
+    _remove_invalidated_rows_from_primary_key_index(*table);
 
-        // Calculate metric 2 – Chunk Hotness
-        CommitID highest_end_commit_id = CommitID{0};
-        const auto chunk_size = chunk->size();
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-          const auto commit_id = chunk->mvcc_data()->get_end_cid(chunk_offset);
-          if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_end_commit_id) {
-            highest_end_commit_id = commit_id;
-          }
-        }
+    const auto deleted_chunk_ids = _logical_delete(table_name, table);
 
-        const bool criterion2 =
-            highest_end_commit_id + DELETE_THRESHOLD_LAST_COMMIT <= Hyrise::get().transaction_manager.last_commit_id();
+    std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
+    for (const auto chunk_id : deleted_chunk_ids) {
+      DebugAssert(table->get_chunk(chunk_id)->get_cleanup_commit_id(),
+                  "Chunk needs to be deleted logically before deleting it physically.");
+      _physical_delete_queue.emplace(table, chunk_id);
+    }
+  }
+}
 
-        if (!criterion2) {
-          continue;
-        }
+std::vector<ChunkID> MvccDeletePlugin::_logical_delete(const std::string& table_name,
+                                                       const std::shared_ptr<Table>& table) const {
+  const auto invalidated_rows_threshold = _invalidated_rows_threshold.load();
+  const auto min_commits_since_invalidation = _min_commits_since_invalidation.load();
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
 
-        auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
-        const bool success = _try_logical_delete(table_name, chunk_id, transaction_context);
+  auto deleted_chunk_ids = std::vector<ChunkID>{};
 
-        if (success) {
-          DebugAssert(table->get_chunk(chunk_id)->get_cleanup_commit_id(),
-                      "Chunk needs to be deleted logically before deleting it physically.");
+  // Run of neighbouring chunks that are compacted into a single chunk
+  auto run_chunk_ids = std::vector<ChunkID>{};
+  auto run_row_count = size_t{0};
 
-          std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
-          _physical_delete_queue.emplace(table, chunk_id);
-        }
+  const auto compact_run = [&]() {
+    if (run_chunk_ids.empty()) return;
+
+    auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    if (_try_compact_chunks(table_name, run_chunk_ids, transaction_context)) {
+      deleted_chunk_ids.insert(deleted_chunk_ids.end(), run_chunk_ids.begin(), run_chunk_ids.end());
+    }
+
+    run_chunk_ids.clear();
+    run_row_count = 0;
+  };
+
+  // Check all chunks, except for the last one, which is currently used for insertions
+  const auto max_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; chunk_id++) {
+    const auto& chunk = table->get_chunk(chunk_id);
+
+    // Chunks that have already been deleted do not separate their neighbours
+    if (!chunk || chunk->get_cleanup_commit_id()) continue;
+
+    // Calculate metric 1 – Chunk invalidation level
+    const auto chunk_size = chunk->size();
+    const auto invalid_row_count = chunk->invalid_row_count();
+    const double invalidated_rows_ratio = static_cast<double>(invalid_row_count) / chunk_size;
+    const bool criterion1 = chunk_size > 0 && invalidated_rows_threshold <= invalidated_rows_ratio;
+
+    if (!criterion1) {
+      compact_run();
+      continue;
+    }
+
+    // Calculate metric 2 – Chunk Hotness. Chunks with rows whose insert has not yet been committed are hot, too.
+    CommitID highest_end_commit_id = CommitID{0};
+    auto inserts_are_finished = true;
+    const auto& mvcc_data = chunk->mvcc_data();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) {
+        inserts_are_finished = false;
+        break;
+      }
+
+      const auto commit_id = mvcc_data->get_end_cid(chunk_offset);
+      if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_end_commit_id) {
+        highest_end_commit_id = commit_id;
       }
     }
+
+    const bool criterion2 =
+        inserts_are_finished && highest_end_commit_id + min_commits_since_invalidation <= last_commit_id;
+
+    if (!criterion2) {
+      compact_run();
+      continue;
+    }
+
+    if (invalid_row_count == chunk_size) {
+      // No row has to be copied. Transactions whose snapshot is not older than the last invalidation do not see any
+      // row of the chunk. As a cleanup commit id of zero means that it is not set, we use one instead.
+      chunk->set_cleanup_commit_id(std::max(highest_end_commit_id, CommitID{1}));
+      deleted_chunk_ids.emplace_back(chunk_id);
+      continue;
+    }
+
+    // The valid rows of a run have to fit into a single chunk
+    const auto valid_row_count = static_cast<size_t>(chunk_size - invalid_row_count);
+    if (run_row_count + valid_row_count > table->target_chunk_size()) {
+      compact_run();
+    }
+
+    run_chunk_ids.emplace_back(chunk_id);
+    run_row_count += valid_row_count;
   }
+
+  compact_run();
+
+  return deleted_chunk_ids;
 }
 
 /**
- * This function processes the physical-delete-queue until its empty.
+ * This function processes the physical-delete-queue until its empty or the front chunk might still be used.
  */
 void MvccDeletePlugin::_physical_delete_loop() {
   std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
 
-  if (_physical_delete_queue.size()) {
-    TableAndChunkID table_and_chunk_id = _physical_delete_queue.front();
-    const auto& table = table_and_chunk_id.first;
-    const auto& chunk = table->get_chunk(table_and_chunk_id.second);
+  while (!_physical_delete_queue.empty()) {
+    const auto& [table, chunk_id] = _physical_delete_queue.front();
+    const auto& chunk = table->get_chunk(chunk_id);
 
     DebugAssert(chunk != nullptr, "Chunk does not exist. Physical Delete can not be applied.");
+    DebugAssert(chunk->get_cleanup_commit_id(), "Chunk needs to be deleted logically before deleting it physically.");
 
-    if (chunk->get_cleanup_commit_id().has_value()) {
-      // Check whether there are still active transactions that might use the chunk
-      bool conflicting_transactions = false;
-      auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
-
-      if (lowest_snapshot_commit_id.has_value()) {
-        conflicting_transactions = chunk->get_cleanup_commit_id().value() > lowest_snapshot_commit_id.value();
-      }
+    // Check whether there are still active transactions that might use the chunk
+    bool conflicting_transactions = false;
+    auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
 
-      if (!conflicting_transactions) {
-        _delete_chunk_physically(table, table_and_chunk_id.second);
-        _physical_delete_queue.pop();
-      }
+    if (lowest_snapshot_commit_id.has_value()) {
+      conflicting_transactions = chunk->get_cleanup_commit_id().value() > lowest_snapshot_commit_id.value();
     }
+
+    if (conflicting_transactions) break;
+
+    _delete_chunk_physically(table, chunk_id);
+    _physical_delete_queue.pop();
   }
 }
 
-bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const ChunkID chunk_id,
+bool MvccDeletePlugin::_try_compact_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
                                            std::shared_ptr<TransactionContext> transaction_context) {
   const auto& table = Hyrise::get().storage_manager.get_table(table_name);
-  const auto& chunk = table->get_chunk(chunk_id);
+  const auto transaction_id = transaction_context->transaction_id();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  Assert(!chunk_ids.empty(), "Expected at least one chunk to compact");
+
+  // Collect the rows that are visible to the transaction. Rows that are not, but that have not been invalidated
+  // either (i.e., rows inserted by transactions that committed after the snapshot), would be lost.
+  auto pos_list = std::make_shared<RowIDPosList>();
+  for (const auto chunk_id : chunk_ids) {
+    const auto& chunk = table->get_chunk(chunk_id);
+
+    Assert(chunk != nullptr, "Chunk does not exist. Logical Delete can not be applied.");
+    Assert(chunk_id < (table->chunk_count() - 1),
+           "MVCC Logical Delete should not be applied on the last/current mutable chunk.");
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto end_cid = mvcc_data->get_end_cid(chunk_offset);
+      if (Validate::is_row_visible(transaction_id, snapshot_commit_id, mvcc_data->get_tid(chunk_offset),
+                                   mvcc_data->get_begin_cid(chunk_offset), end_cid)) {
+        pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+      } else if (end_cid == MvccData::MAX_COMMIT_ID) {
+        transaction_context->rollback();
+        return false;
+      }
+    }
+  }
+
+  // All rows have been invalidated in the meantime. The next run of the logical delete removes the chunks without
+  // copying anything.
+  if (pos_list->empty()) {
+    transaction_context->rollback();
+    return false;
+  }
 
-  Assert(chunk != nullptr, "Chunk does not exist. Logical Delete can not be applied.");
-  Assert(chunk_id < (table->chunk_count() - 1),
-         "MVCC Logical Delete should not be applied on the last/current mutable chunk.");
-
-  // Create temporary referencing table that contains the given chunk only
-  //   Include all ChunksIDs of current table except chunk_id for pruning in GetTable
-  std::vector<ChunkID> excluded_chunk_ids(table->chunk_count() - 1);
-  std::iota(excluded_chunk_ids.begin(), excluded_chunk_ids.begin() + chunk_id, 0);
-  std::iota(excluded_chunk_ids.begin() + chunk_id, excluded_chunk_ids.end(), chunk_id + 1);
-
-  auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>());
-  get_table->set_transaction_context(transaction_context);
-  get_table->execute();
-
-  // Validate temporary table
-  auto validate = std::make_shared<Validate>(get_table);
-  validate->set_transaction_context(transaction_context);
-  validate->execute();
-
-  // Use Update operator to delete and re-insert valid records in chunk
-  // Pass validate into Update operator twice since data will not be changed.
-  auto update = std::make_shared<Update>(table_name, validate, validate);
-  update->set_transaction_context(transaction_context);
-  update->execute();
-
-  // Check for success
-  if (update->execute_failed()) {
-    // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed Update directly, that is
+  // Invalidate the collected rows. This fails if another transaction is invalidating one of them as well.
+  const auto column_count = table->column_count();
+  auto reference_segments = Segments{};
+  reference_segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    reference_segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+  auto reference_chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>(reference_segments)};
+  const auto reference_table =
+      std::make_shared<Table>(table->column_definitions(), TableType::References, std::move(reference_chunks));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto delete_op = std::make_shared<Delete>(table_name, table_wrapper);
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+
+  if (delete_op->execute_failed()) {
+    // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed Delete directly, that is
     // our job.
     transaction_context->rollback();
     return false;
   }
 
+  // Copy the rows into new segments, which use the encoding of the first compacted chunk
+  const auto& first_chunk = table->get_chunk(chunk_ids.front());
+  const auto row_count = pos_list->size();
+  auto segments = Segments{};
+  segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto data_type = table->column_data_type(column_id);
+    const auto nullable = table->column_is_nullable(column_id);
+
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_vector<bool>(nullable ? row_count : 0);
+
+      auto chunk_offset = ChunkOffset{0};
+      segment_iterate<ColumnDataType>(*reference_segments[column_id], [&](const auto& position) {
+        if (position.is_null()) {
+          null_values[chunk_offset] = true;
+        } else {
+          values[chunk_offset] = position.value();
+        }
+        ++chunk_offset;
+      });
+
+      auto value_segment = nullable ? std::make_shared<ValueSegment<ColumnDataType>>(std::move(values),
+                                                                                      std::move(null_values))
+                                    : std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+      segments.emplace_back(ChunkEncoder::encode_segment(
+          value_segment, data_type, get_segment_encoding_spec(first_chunk->get_segment(column_id))));
+    });
+  }
+
+  // The new chunk becomes the last chunk of the table. Rows that are still being inserted into the previous last chunk
+  // are not affected. Once all of them are finished, the BackgroundEncodingPlugin finalizes that chunk.
+  auto insert = std::make_shared<InsertCompactedChunk>(table_name, table, segments);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
   transaction_context->commit();
-  // Mark chunk as logically deleted
-  chunk->set_cleanup_commit_id(transaction_context->commit_id());
+
+  // Mark chunks as logically deleted
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  }
   return true;
 }
 
+void MvccDeletePlugin::_remove_invalidated_rows_from_primary_key_index(const Table& table) {
+  const auto& primary_key_index = table.primary_key_index();
+  if (!primary_key_index) return;
+
+  // Transactions that start after the last commit id has been read do not see rows invalidated up to it. Thus, it is
+  // read before the snapshots of the active transactions are checked.
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+  primary_key_index->remove_invalidated_rows(table, std::min(lowest_snapshot_commit_id.value_or(last_commit_id),
+                                                             last_commit_id));
+}
+
 void MvccDeletePlugin::_delete_chunk_physically(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
   const auto& chunk = table->get_chunk(chunk_id);
 
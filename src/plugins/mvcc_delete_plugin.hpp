@@ -1,16 +1,19 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <numeric>
 #include <queue>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest_prod.h"
 #include "hyrise.hpp"
 #include "storage/chunk.hpp"
 #include "utils/abstract_plugin.hpp"
 #include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/callback_setting.hpp"
 #include "utils/singleton.hpp"
 
 namespace opossum {
@@ -18,14 +21,25 @@ namespace opossum {
 /*
  * One disadvantage of insert-only databases like Hyrise is the accumulation of invalidated
  * rows, which have to be removed from the final result for every transaction.
- * This plugin deletes chunks with large numbers of invalidated rows and reinserts them at
- * the end of the table. These rows are either visible at their original position (for old
- * transactions) or their new position (for new transactions). Thus, it keeps the
+ * This plugin compacts chunks with large numbers of invalidated rows. Thus, it keeps the
  * execution time per transaction low and the database maintains its original performance.
  * The plugin is split into two main functions. The logical delete is responsible for
- * recognizing chunks with high numbers of invalidated rows and fully invalidates them.
- * The physical delete checks if chunks are not visible anymore for other transactions and
- * removes the chunk from the table completely.
+ * recognizing chunks with high numbers of invalidated rows and fully invalidates them:
+ *  - Chunks whose rows are all invalidated are not touched, they only get their cleanup commit id.
+ *  - Runs of neighbouring sparse chunks are merged. Within a single transaction, the still valid rows of the run are
+ *    invalidated and copied into one new, encoded chunk that is appended to the table. As the new rows become visible
+ *    with the same commit id that invalidates the old ones, each transaction sees either the old or the new chunks.
+ *    The valid rows of a run have to fit into a single chunk of the table's target chunk size.
+ * The physical delete checks if chunks are not visible anymore for other transactions, i.e., no
+ * active snapshot is older than the cleanup commit id, and removes the chunk from the table completely.
+ * Before the logical delete of a table, rows that are not visible to any transaction anymore are removed from its
+ * PrimaryKeyIndex, which otherwise keeps them until their chunk is physically deleted.
+ *
+ * The plugin is configured via the following settings (see the settings meta table), which are prefixed with
+ * "MvccDeletePlugin.":
+ *  - idle_delay_ms: Time to sleep between two runs of the logical and the physical delete
+ *  - invalidated_rows_threshold: Share of invalidated rows from which on a chunk is compacted
+ *  - min_commits_since_invalidation: Number of commits that must have passed since a chunk was last modified
  */
 class MvccDeletePlugin : public AbstractPlugin {
   friend class MvccDeletePluginTest;
@@ -39,6 +53,7 @@ class MvccDeletePlugin : public AbstractPlugin {
   void stop() final;
 
   /**
+   * Default values of the settings:
    * DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS: the percentage of invalidated rows
    * in chunk to be deleted logically by the plugin.
    * DELETE_THRESHOLD_LAST_COMMIT: the number of commits that must have passed since
@@ -52,19 +67,33 @@ class MvccDeletePlugin : public AbstractPlugin {
   constexpr static std::chrono::milliseconds IDLE_DELAY_PHYSICAL_DELETE = std::chrono::milliseconds(1000);
 
  private:
-  using TableAndChunkID = std::pair<const std::shared_ptr<Table>&, ChunkID>;
+  using TableAndChunkID = std::pair<std::shared_ptr<Table>, ChunkID>;
 
   void _logical_delete_loop();
   void _physical_delete_loop();
 
-  static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
+  // Returns the ChunkIDs of the chunks that were deleted logically
+  std::vector<ChunkID> _logical_delete(const std::string& table_name, const std::shared_ptr<Table>& table) const;
+
+  // Merges the valid rows of the given chunks into a new chunk and sets the cleanup commit id of the chunks. Returns
+  // false and rolls back the transaction if it conflicts with another transaction.
+  static bool _try_compact_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
                                   std::shared_ptr<TransactionContext> transaction_context);
   static void _delete_chunk_physically(const std::shared_ptr<Table>& table, ChunkID chunk_id);
 
-  std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete;
+  // Removes rows that no transaction can see anymore from the table's PrimaryKeyIndex
+  static void _remove_invalidated_rows_from_primary_key_index(const Table& table);
+
+  std::atomic<double> _invalidated_rows_threshold{DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS};
+  std::atomic<CommitID> _min_commits_since_invalidation{DELETE_THRESHOLD_LAST_COMMIT};
+
+  std::vector<std::shared_ptr<AbstractSetting>> _settings;
 
   std::mutex _mutex_physical_delete_queue;
   std::queue<TableAndChunkID> _physical_delete_queue;
+
+  // Declared last so that the threads are stopped before the other members are destroyed
+  std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete;
 };
 
 }  // namespace opossum
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -6,6 +9,7 @@
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
 #include "cache/random_cache.hpp"
+#include "cache/sharded_clock_cache.hpp"
 
 namespace opossum {
 
@@ -234,6 +238,84 @@ TEST_F(CachePolicyTest, RandomCacheTest) {
   ASSERT_EQ(53, cache.get(6));  // Hit.
 }
 
+// CLOCK Strategy
+TEST_F(CachePolicyTest, ShardedClockCacheTest) {
+  ShardedClockCache<int, int> cache(2);
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_FALSE(cache.has(3));
+
+  cache.set(1, 2);  // Miss, insert.
+  cache.set(2, 4);  // Miss, insert.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_FALSE(cache.has(3));
+
+  ASSERT_EQ(2, cache.get(1));  // Hit, 1 survives the next sweep.
+
+  cache.set(3, 6);  // Miss, evict 2.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(cache.try_get(2), std::nullopt);
+
+  cache.set(4, 8);  // Miss, evict 1, which was not accessed since the last sweep.
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_TRUE(cache.has(4));
+  ASSERT_EQ(cache.try_get(4), 8);  // Hit.
+}
+
+TEST_F(CachePolicyTest, ShardedClockCacheShards) {
+  const auto capacity = 4 * ShardedClockCache<int, int>::MIN_SHARD_CAPACITY;
+  ShardedClockCache<int, int> cache(capacity);
+
+  // Entries that are accessed frequently are kept, while others are evicted
+  for (auto key = 0; key < 10; ++key) {
+    cache.set(key, key);
+  }
+  for (auto key = 10; key < 10 * static_cast<int>(capacity); ++key) {
+    cache.set(key, key);
+    ASSERT_EQ(cache.try_get(key % 10), key % 10);
+  }
+
+  ASSERT_LE(cache.size(), capacity);
+  for (auto key = 0; key < 10; ++key) {
+    ASSERT_EQ(cache.try_get(key), key);
+  }
+
+  auto element_count = size_t{0};
+  for (auto it = cache.begin(); it != cache.end(); ++it) {
+    ASSERT_EQ(it->first, it->second);
+    ++element_count;
+  }
+  ASSERT_EQ(element_count, cache.size());
+}
+
+TEST_F(CachePolicyTest, ShardedClockCacheConcurrentAccess) {
+  Cache<int, int> cache;
+  cache.replace_cache_impl<ShardedClockCache<int, int>>(256);
+
+  const auto thread_count = 8;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto key = 0; key < 1'000; ++key) {
+        if (key % thread_count == thread_id) cache.set(key, 2 * key);
+        const auto value = cache.try_get(key);
+        if (value) ASSERT_EQ(*value, 2 * key);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  ASSERT_LE(cache.size(), 256u);
+}
+
 // Test the default cache (uses GDFS).
 TEST_F(CachePolicyTest, Iterators) {
   Cache<int, int> cache(2);
@@ -262,7 +344,7 @@ class CacheTest : public BaseTest {};
 
 // Here, all cache types are defined.
 using CacheTypes = ::testing::Types<LRUCache<int, int>, LRUKCache<2, int, int>, GDSCache<int, int>, GDFSCache<int, int>,
-                                    RandomCache<int, int>>;
+                                    RandomCache<int, int>, ShardedClockCache<int, int>>;
 TYPED_TEST_SUITE(CacheTest, CacheTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(CacheTest, Size) {
@@ -0,0 +1,114 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
+
+namespace opossum {
+
+class BitmapPosListTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Positions in the first, third, and fifth word. The second and fourth word are empty.
+    _row_ids = RowIDPosList{RowID{ChunkID{3}, 0},   RowID{ChunkID{3}, 5},   RowID{ChunkID{3}, 63},
+                            RowID{ChunkID{3}, 128}, RowID{ChunkID{3}, 130}, RowID{ChunkID{3}, 191},
+                            RowID{ChunkID{3}, 256}, RowID{ChunkID{3}, 299}};
+    _bitmap_pos_list = BitmapPosList::from_pos_list(_row_ids, ChunkOffset{300});
+  }
+
+  RowIDPosList _row_ids;
+  std::shared_ptr<BitmapPosList> _bitmap_pos_list;
+};
+
+TEST_F(BitmapPosListTest, FromPosList) {
+  ASSERT_TRUE(_bitmap_pos_list);
+  EXPECT_TRUE(_bitmap_pos_list->references_single_chunk());
+  EXPECT_EQ(_bitmap_pos_list->common_chunk_id(), ChunkID{3});
+  EXPECT_EQ(_bitmap_pos_list->chunk_size(), 300);
+  EXPECT_EQ(_bitmap_pos_list->words().size(), 5);
+  EXPECT_EQ(_bitmap_pos_list->size(), _row_ids.size());
+  EXPECT_FALSE(_bitmap_pos_list->empty());
+
+  // Positions that are not strictly increasing or reference multiple chunks cannot be stored in a bitmap
+  EXPECT_FALSE(BitmapPosList::from_pos_list(RowIDPosList{RowID{ChunkID{3}, 5}, RowID{ChunkID{3}, 4}}, 10));
+  EXPECT_FALSE(BitmapPosList::from_pos_list(RowIDPosList{RowID{ChunkID{3}, 5}, RowID{ChunkID{3}, 5}}, 10));
+  EXPECT_FALSE(BitmapPosList::from_pos_list(RowIDPosList{RowID{ChunkID{3}, 5}, RowID{ChunkID{4}, 6}}, 10));
+  EXPECT_FALSE(BitmapPosList::from_pos_list(RowIDPosList{NULL_ROW_ID}, 10));
+  EXPECT_FALSE(BitmapPosList::from_pos_list(RowIDPosList{}, 10));
+}
+
+TEST_F(BitmapPosListTest, RandomAccess) {
+  for (auto index = size_t{0}; index < _row_ids.size(); ++index) {
+    EXPECT_EQ((*_bitmap_pos_list)[index], _row_ids[index]);
+  }
+
+  // Access through the unresolved AbstractPosList
+  const auto& abstract_pos_list = static_cast<const AbstractPosList&>(*_bitmap_pos_list);
+  EXPECT_EQ(abstract_pos_list, _row_ids);
+}
+
+TEST_F(BitmapPosListTest, Iterator) {
+  EXPECT_EQ(std::distance(_bitmap_pos_list->cbegin(), _bitmap_pos_list->cend()), _row_ids.size());
+  EXPECT_TRUE(std::equal(_bitmap_pos_list->cbegin(), _bitmap_pos_list->cend(), _row_ids.cbegin(), _row_ids.cend()));
+
+  // Forward and backward jumps of different lengths
+  for (auto from = size_t{0}; from <= _row_ids.size(); ++from) {
+    for (auto to = size_t{0}; to <= _row_ids.size(); ++to) {
+      auto it = _bitmap_pos_list->cbegin() + from;
+      it += static_cast<std::ptrdiff_t>(to) - static_cast<std::ptrdiff_t>(from);
+      EXPECT_EQ(it - _bitmap_pos_list->cbegin(), to);
+      if (to < _row_ids.size()) {
+        EXPECT_EQ(*it, _row_ids[to]);
+        EXPECT_EQ(it->chunk_offset, _row_ids[to].chunk_offset);
+      } else {
+        EXPECT_EQ(it, _bitmap_pos_list->cend());
+      }
+    }
+  }
+
+  auto it = _bitmap_pos_list->cend();
+  --it;
+  EXPECT_EQ(*it, _row_ids.back());
+}
+
+TEST_F(BitmapPosListTest, EmptyBitmap) {
+  const auto empty_pos_list = BitmapPosList{ChunkID{1}, ChunkOffset{100}, std::vector<BitmapPosList::Word>(2)};
+  EXPECT_TRUE(empty_pos_list.empty());
+  EXPECT_EQ(empty_pos_list.size(), 0);
+  EXPECT_EQ(empty_pos_list.cbegin(), empty_pos_list.cend());
+}
+
+TEST_F(BitmapPosListTest, BitwiseAndOr) {
+  // The second bitmap covers fewer rows, e.g., because rows were added to the chunk in the meantime
+  const auto other_row_ids = RowIDPosList{RowID{ChunkID{3}, 5}, RowID{ChunkID{3}, 64}, RowID{ChunkID{3}, 191}};
+  const auto other_pos_list = BitmapPosList::from_pos_list(other_row_ids, ChunkOffset{200});
+
+  const auto intersection = BitmapPosList::bitwise_and(*_bitmap_pos_list, *other_pos_list);
+  EXPECT_EQ(intersection->chunk_size(), 200);
+  EXPECT_EQ(*intersection, (RowIDPosList{RowID{ChunkID{3}, 5}, RowID{ChunkID{3}, 191}}));
+
+  const auto union_pos_list = BitmapPosList::bitwise_or(*other_pos_list, *_bitmap_pos_list);
+  EXPECT_EQ(union_pos_list->chunk_size(), 300);
+  EXPECT_EQ(*union_pos_list, (RowIDPosList{RowID{ChunkID{3}, 0}, RowID{ChunkID{3}, 5}, RowID{ChunkID{3}, 63},
+                                           RowID{ChunkID{3}, 64}, RowID{ChunkID{3}, 128}, RowID{ChunkID{3}, 130},
+                                           RowID{ChunkID{3}, 191}, RowID{ChunkID{3}, 256}, RowID{ChunkID{3}, 299}}));
+
+  const auto other_chunk_pos_list = BitmapPosList::from_pos_list(RowIDPosList{RowID{ChunkID{4}, 5}}, ChunkOffset{10});
+  EXPECT_THROW(BitmapPosList::bitwise_and(*_bitmap_pos_list, *other_chunk_pos_list), std::logic_error);
+}
+
+TEST_F(BitmapPosListTest, MemoryUsage) {
+  // A bitmap for a full chunk is much smaller than the RowIDs
+  auto row_ids = RowIDPosList{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < Chunk::DEFAULT_SIZE; chunk_offset += 2) {
+    row_ids.emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  const auto bitmap_pos_list = BitmapPosList::from_pos_list(row_ids, Chunk::DEFAULT_SIZE);
+  EXPECT_LT(bitmap_pos_list->memory_usage(MemoryUsageCalculationMode::Full) * 10,
+            row_ids.memory_usage(MemoryUsageCalculationMode::Full));
+}
+
+}  // namespace opossum
@@ -1,3 +1,5 @@
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -6,8 +8,10 @@
 
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
 namespace opossum {
 
@@ -384,4 +388,94 @@ TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   EXPECT_TABLE_EQ_ORDERED(table, expected_table);
 }
 
+TEST_P(BinaryParserMultiEncodingTest, MemoryMapped) {
+  const auto expected_table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", 3);
+  const auto table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", 3);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{GetParam()});
+
+  const auto filename = test_data_path + "memory_mapped.bin";
+  BinaryWriter::write(*table, filename);
+
+  const auto mapped_table = BinaryParser::parse(filename, BinaryParser::LoadMode::MemoryMapped);
+  EXPECT_TABLE_EQ_ORDERED(mapped_table, expected_table);
+
+  // The mapping remains valid after the file was deleted
+  std::filesystem::remove(filename);
+  EXPECT_TABLE_EQ_ORDERED(mapped_table, expected_table);
+
+  // Segments that refer to the mapped file can be written again
+  const auto rewritten_filename = test_data_path + "memory_mapped_rewritten.bin";
+  BinaryWriter::write(*mapped_table, rewritten_filename);
+  EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(rewritten_filename), expected_table);
+}
+
+TEST_F(BinaryParserTest, MemoryMappedAttributeVectors) {
+  // Attribute vectors of different widths are interleaved, so that they are only aligned because of the padding
+  const auto dictionary = std::make_shared<pmr_vector<int32_t>>(pmr_vector<int32_t>{1, 2, 3});
+  const auto fixed_string_dictionary = std::make_shared<FixedStringVector>(pmr_vector<char>{'a', 'b', 'c'}, 1);
+  const auto segments = Segments{
+      std::make_shared<DictionarySegment<int32_t>>(
+          dictionary, std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(pmr_vector<uint8_t>{0, 1, 2})),
+      std::make_shared<DictionarySegment<int32_t>>(
+          dictionary, std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(pmr_vector<uint16_t>{2, 1, 0})),
+      std::make_shared<FixedStringDictionarySegment<pmr_string>>(
+          fixed_string_dictionary, std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(pmr_vector<uint8_t>{1, 1, 1})),
+      std::make_shared<DictionarySegment<int32_t>>(
+          dictionary, std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(pmr_vector<uint32_t>{0, 2, 1})),
+      std::make_shared<FixedStringDictionarySegment<pmr_string>>(
+          fixed_string_dictionary,
+          std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(pmr_vector<uint16_t>{2, 0, 1}))};
+
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false},
+                             {"b", DataType::Int, false},
+                             {"c", DataType::String, false},
+                             {"d", DataType::Int, false},
+                             {"e", DataType::String, false}},
+      TableType::Data);
+  table->append_chunk(segments);
+
+  const auto filename = test_data_path + "memory_mapped_attribute_vectors.bin";
+  BinaryWriter::write(*table, filename);
+
+  const auto refers_to_external_data = [](const std::shared_ptr<Table>& parsed_table, const ColumnID column_id) {
+    const auto segment = parsed_table->get_chunk(ChunkID{0})->get_segment(column_id);
+    const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+    EXPECT_TRUE(dictionary_segment);
+
+    const auto attribute_vector = dictionary_segment->attribute_vector();
+    if (const auto vector = std::dynamic_pointer_cast<const FixedSizeByteAlignedVector<uint8_t>>(attribute_vector)) {
+      return vector->refers_to_external_data();
+    }
+    if (const auto vector = std::dynamic_pointer_cast<const FixedSizeByteAlignedVector<uint16_t>>(attribute_vector)) {
+      return vector->refers_to_external_data();
+    }
+    const auto vector = std::dynamic_pointer_cast<const FixedSizeByteAlignedVector<uint32_t>>(attribute_vector);
+    EXPECT_TRUE(vector);
+    return vector->refers_to_external_data();
+  };
+
+  const auto copied_table = BinaryParser::parse(filename);
+  const auto mapped_table = BinaryParser::parse(filename, BinaryParser::LoadMode::MemoryMapped);
+  EXPECT_TABLE_EQ_ORDERED(copied_table, table);
+  EXPECT_TABLE_EQ_ORDERED(mapped_table, table);
+
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    EXPECT_FALSE(refers_to_external_data(copied_table, column_id));
+    EXPECT_TRUE(refers_to_external_data(mapped_table, column_id));
+  }
+}
+
+TEST_F(BinaryParserTest, UnsupportedFormatVersion) {
+  // Files of other versions are rejected instead of being misinterpreted
+  const auto filename = test_data_path + "unsupported_format_version.bin";
+  {
+    auto ofstream = std::ofstream{filename, std::ios::binary};
+    const auto format_version = uint32_t{BinaryParser::FORMAT_VERSION + 1};
+    ofstream.write(reinterpret_cast<const char*>(&format_version), sizeof(format_version));
+  }
+
+  EXPECT_THROW(BinaryParser::parse(filename), std::logic_error);
+}
+
 }  // namespace opossum
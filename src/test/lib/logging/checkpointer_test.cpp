@@ -0,0 +1,170 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "logging/checkpointer.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "utils/list_directory.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class CheckpointerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(directory);
+
+    // The last chunk is kept mutable so that rows can be inserted into it
+    table = load_table("resources/test_data/tbl/int_float.tbl", 2, FinalizeLastChunk::No);
+    ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table("t", table);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory); }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql,
+                                              const std::shared_ptr<TransactionContext>& context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (context) builder.with_transaction_context(context);
+    auto pipeline = builder.create_pipeline();
+    const auto [status, result_table] = pipeline.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return result_table;
+  }
+
+  size_t data_file_count() const {
+    auto count = size_t{0};
+    for (const auto& path : list_directory(directory)) {
+      if (path.extension() == ".chunk") ++count;
+    }
+    return count;
+  }
+
+  const std::string directory = test_data_path + "checkpointer_test";
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(CheckpointerTest, RestoreCheckpoint) {
+  execute("DELETE FROM t WHERE a = 123");
+  execute("INSERT INTO t VALUES (1, 1.5)");
+  const auto expected_table = execute("SELECT * FROM t");
+
+  auto checkpointer = Checkpointer{directory};
+  EXPECT_FALSE(checkpointer.has_checkpoint());
+  const auto result = checkpointer.checkpoint();
+  EXPECT_TRUE(checkpointer.has_checkpoint());
+  EXPECT_EQ(result.written_chunk_count, 2);
+  EXPECT_EQ(result.unchanged_chunk_count, 0);
+
+  Hyrise::reset();
+
+  auto restoring_checkpointer = Checkpointer{directory};
+  EXPECT_EQ(restoring_checkpointer.restore(), 1);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+
+  // Encodings and invalidated rows are restored, all chunks are immutable
+  const auto restored_table = Hyrise::get().storage_manager.get_table("t");
+  ASSERT_EQ(restored_table->chunk_count(), 2);
+  const auto first_chunk = restored_table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(first_chunk->get_segment(ColumnID{0})));
+  EXPECT_EQ(first_chunk->invalid_row_count(), 1);
+  EXPECT_FALSE(restored_table->get_chunk(ChunkID{1})->is_mutable());
+
+  // Restored chunks are not written again
+  const auto result_after_restore = restoring_checkpointer.checkpoint();
+  EXPECT_EQ(result_after_restore.written_chunk_count, 0);
+  EXPECT_EQ(result_after_restore.unchanged_chunk_count, 2);
+
+  // New rows are written to a new chunk
+  execute("INSERT INTO t VALUES (2, 2.5)");
+  const auto result_after_insert = restoring_checkpointer.checkpoint();
+  EXPECT_EQ(result_after_insert.written_chunk_count, 1);
+  EXPECT_EQ(result_after_insert.unchanged_chunk_count, 2);
+}
+
+TEST_F(CheckpointerTest, IncrementalCheckpoints) {
+  auto checkpointer = Checkpointer{directory};
+
+  const auto first_result = checkpointer.checkpoint();
+  EXPECT_EQ(first_result.written_chunk_count, 2);
+  EXPECT_EQ(first_result.unchanged_chunk_count, 0);
+
+  const auto unchanged_result = checkpointer.checkpoint();
+  EXPECT_EQ(unchanged_result.written_chunk_count, 0);
+  EXPECT_EQ(unchanged_result.unchanged_chunk_count, 2);
+
+  // Only the invalidated rows of the first chunk have to be written
+  execute("DELETE FROM t WHERE a = 12345");
+  const auto delete_result = checkpointer.checkpoint();
+  EXPECT_EQ(delete_result.written_chunk_count, 0);
+  EXPECT_EQ(delete_result.unchanged_chunk_count, 2);
+
+  // The mutable chunk grew
+  execute("INSERT INTO t VALUES (1, 1.5)");
+  const auto insert_result = checkpointer.checkpoint();
+  EXPECT_EQ(insert_result.written_chunk_count, 1);
+  EXPECT_EQ(insert_result.unchanged_chunk_count, 1);
+
+  // The segments of the first chunk were replaced
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::RunLength});
+  const auto encode_result = checkpointer.checkpoint();
+  EXPECT_EQ(encode_result.written_chunk_count, 1);
+  EXPECT_EQ(encode_result.unchanged_chunk_count, 1);
+
+  // Files of previous checkpoints were removed
+  EXPECT_EQ(data_file_count(), 2);
+
+  const auto expected_table = execute("SELECT * FROM t");
+  Hyrise::reset();
+
+  Checkpointer{directory}.restore();
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+  const auto restored_table = Hyrise::get().storage_manager.get_table("t");
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(
+      restored_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+}
+
+TEST_F(CheckpointerTest, UncommittedChangesAreNotCheckpointed) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO t VALUES (1, 1.5)", transaction_context);
+  execute("DELETE FROM t WHERE a = 123", transaction_context);
+
+  auto checkpointer = Checkpointer{directory};
+  checkpointer.checkpoint();
+  transaction_context->commit();
+
+  Hyrise::reset();
+  Checkpointer{directory}.restore();
+
+  const auto result_table = execute("SELECT a FROM t ORDER BY a");
+  ASSERT_EQ(result_table->row_count(), 3);
+  EXPECT_EQ(result_table->get_value<int32_t>(ColumnID{0}, 0), 123);
+}
+
+TEST_F(CheckpointerTest, RowsCommittedAfterCheckpointAreWrittenAgain) {
+  // The inserted row is written as a default value by the first checkpoint, as it is not yet committed. The second
+  // checkpoint has to write it, even though the chunk's segments and size did not change.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO t VALUES (1, 1.5)", transaction_context);
+  ASSERT_EQ(table->chunk_count(), 2);
+
+  auto checkpointer = Checkpointer{directory};
+  checkpointer.checkpoint();
+  transaction_context->commit();
+
+  const auto result = checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 1);
+  EXPECT_EQ(result.unchanged_chunk_count, 1);
+
+  const auto expected_table = execute("SELECT * FROM t");
+  Hyrise::reset();
+
+  Checkpointer{directory}.restore();
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+}
+
+}  // namespace opossum
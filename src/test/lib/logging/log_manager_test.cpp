@@ -0,0 +1,197 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "logging/log_manager.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class LogManagerTest : public BaseTest {
+ protected:
+  void SetUp() override { std::remove(filename.c_str()); }
+
+  void TearDown() override {
+    Hyrise::get().log_manager.disable();
+    std::remove(filename.c_str());
+  }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql,
+                                              const std::shared_ptr<TransactionContext>& context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (context) builder.with_transaction_context(context);
+    auto pipeline = builder.create_pipeline();
+    const auto [status, table] = pipeline.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  // Simulates a restart: the in-memory state is lost and only the log remains
+  static void restart() {
+    Hyrise::get().log_manager.disable();
+    Hyrise::reset();
+  }
+
+  const std::string filename = test_data_path + "log_manager_test.wal";
+};
+
+TEST_F(LogManagerTest, RecoverCommittedChanges) {
+  auto& log_manager = Hyrise::get().log_manager;
+  log_manager.enable(filename);
+  EXPECT_TRUE(log_manager.is_enabled());
+
+  execute("CREATE TABLE t (a INTEGER, b VARCHAR(10) NULL, c DOUBLE)");
+  execute("INSERT INTO t VALUES (1, 'one', 1.5), (2, NULL, 2.5), (3, 'three', 3.5)");
+  execute("INSERT INTO t VALUES (4, 'four', 4.5)");
+  execute("UPDATE t SET b = 'two' WHERE a = 2");
+  execute("DELETE FROM t WHERE a = 3");
+  execute("CREATE TABLE dropped (a INTEGER)");
+  execute("DROP TABLE dropped");
+
+  // CREATE TABLE with its (empty) insert, two INSERTs, UPDATE, DELETE, CREATE TABLE, DROP TABLE
+  EXPECT_EQ(log_manager.written_entry_count(), 7);
+  EXPECT_GE(log_manager.sync_count(), 1);
+
+  const auto expected_table = execute("SELECT * FROM t");
+
+  restart();
+  EXPECT_FALSE(Hyrise::get().storage_manager.has_table("t"));
+
+  EXPECT_EQ(Hyrise::get().log_manager.recover(filename), 7);
+  EXPECT_TRUE(Hyrise::get().storage_manager.has_table("t"));
+  EXPECT_FALSE(Hyrise::get().storage_manager.has_table("dropped"));
+
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("t")->table_statistics()->row_count, 5.0f);
+
+  // Changes after recovery are appended to the same log
+  Hyrise::get().log_manager.enable(filename);
+  execute("INSERT INTO t VALUES (5, 'five', 5.5)");
+  const auto expected_table_after_insert = execute("SELECT * FROM t");
+
+  restart();
+  EXPECT_EQ(Hyrise::get().log_manager.recover(filename), 8);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table_after_insert);
+}
+
+TEST_F(LogManagerTest, RecoverDeleteFromPrunedChunks) {
+  // Each of the three rows is stored in its own chunk. The predicate prunes the first two chunks, so that the deleted
+  // row is in the first chunk of GetTable's output, but in the third chunk of the stored table. The table is not
+  // created through the log, so it is loaded again after the restart.
+  const auto add_table = []() {
+    Hyrise::get().storage_manager.add_table("t", load_table("resources/test_data/tbl/int_float.tbl", 1));
+  };
+  add_table();
+
+  Hyrise::get().log_manager.enable(filename);
+  execute("DELETE FROM t WHERE a = 1234");
+
+  const auto expected_table = execute("SELECT * FROM t");
+  EXPECT_EQ(expected_table->row_count(), 2);
+
+  restart();
+  add_table();
+  EXPECT_EQ(Hyrise::get().log_manager.recover(filename), 1);
+
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+}
+
+TEST_F(LogManagerTest, RolledBackTransactionsAreNotReplayed) {
+  Hyrise::get().log_manager.enable(filename);
+
+  execute("CREATE TABLE t (a INTEGER)");
+  execute("INSERT INTO t VALUES (1)");
+
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO t VALUES (2)", context);
+  execute("DELETE FROM t WHERE a = 1", context);
+  context->rollback();
+
+  // This row is written after the row allocated by the rolled back transaction
+  execute("INSERT INTO t VALUES (3)");
+  EXPECT_EQ(Hyrise::get().log_manager.written_entry_count(), 3);
+
+  restart();
+  Hyrise::get().log_manager.recover(filename);
+
+  const auto table = execute("SELECT a FROM t ORDER BY a");
+  ASSERT_EQ(table->row_count(), 2);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 0), 1);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 1), 3);
+
+  // The row of the rolled back transaction is invalidated
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("t")->get_chunk(ChunkID{0})->invalid_row_count(), 1);
+}
+
+TEST_F(LogManagerTest, IncompleteEntriesAreDiscarded) {
+  Hyrise::get().log_manager.enable(filename);
+  execute("CREATE TABLE t (a INTEGER)");
+  execute("INSERT INTO t VALUES (1)");
+  execute("INSERT INTO t VALUES (2)");
+  Hyrise::get().log_manager.disable();
+
+  // Simulate a crash while the last entry was written by cutting it off
+  const auto valid_size = std::filesystem::file_size(filename);
+  Hyrise::get().log_manager.enable(filename);
+  execute("INSERT INTO t VALUES (3)");
+  Hyrise::get().log_manager.disable();
+  std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 3);
+
+  // Random bytes after the last complete entry are ignored as well
+  {
+    auto file = std::ofstream{filename, std::ios::binary | std::ios::app};
+    file << "garbage";
+  }
+
+  restart();
+  EXPECT_EQ(Hyrise::get().log_manager.recover(filename), 3);
+  EXPECT_EQ(std::filesystem::file_size(filename), valid_size);
+
+  const auto table = execute("SELECT a FROM t");
+  EXPECT_EQ(table->row_count(), 2);
+}
+
+TEST_F(LogManagerTest, GroupCommit) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  auto& log_manager = Hyrise::get().log_manager;
+  log_manager.enable(filename);
+  execute("CREATE TABLE t (a INTEGER)");
+
+  const auto thread_count = 20;
+  const auto inserts_per_thread = 10;
+
+  auto thread_futures = std::vector<std::future<void>>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    thread_futures.emplace_back(std::async(std::launch::async, [&, thread_id]() {
+      for (auto insert_id = 0; insert_id < inserts_per_thread; ++insert_id) {
+        execute("INSERT INTO t VALUES (" + std::to_string(thread_id * inserts_per_thread + insert_id) + ")");
+      }
+    }));
+  }
+  for (auto& thread_future : thread_futures) {
+    thread_future.get();
+  }
+
+  // Each commit wrote exactly one entry, but entries of concurrently committing transactions may share a sync
+  const auto entry_count = size_t{1 + thread_count * inserts_per_thread};
+  EXPECT_EQ(log_manager.written_entry_count(), entry_count);
+  EXPECT_LE(log_manager.sync_count(), entry_count);
+
+  restart();
+  EXPECT_EQ(Hyrise::get().log_manager.recover(filename), entry_count);
+
+  const auto table = execute("SELECT COUNT(*), SUM(a) FROM t");
+  const auto row_count = thread_count * inserts_per_thread;
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{0}, 0), row_count);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{1}, 0), int64_t{row_count} * (row_count - 1) / 2);
+}
+
+}  // namespace opossum
@@ -9,18 +9,23 @@ namespace opossum {
 
 class DeleteNodeTest : public BaseTest {
  protected:
-  void SetUp() override { _delete_node = DeleteNode::make(); }
+  void SetUp() override { _delete_node = DeleteNode::make("table_a"); }
 
   std::shared_ptr<DeleteNode> _delete_node;
 };
 
-TEST_F(DeleteNodeTest, Description) { EXPECT_EQ(_delete_node->description(), "[Delete]"); }
+TEST_F(DeleteNodeTest, Description) { EXPECT_EQ(_delete_node->description(), "[Delete] Table: 'table_a'"); }
+
+TEST_F(DeleteNodeTest, TableName) { EXPECT_EQ(_delete_node->table_name, "table_a"); }
 
 TEST_F(DeleteNodeTest, HashingAndEqualityCheck) {
-  const auto another_delete_node = DeleteNode::make();
+  const auto another_delete_node = DeleteNode::make("table_a");
   EXPECT_EQ(*_delete_node, *another_delete_node);
-
   EXPECT_EQ(_delete_node->hash(), another_delete_node->hash());
+
+  const auto other_table_delete_node = DeleteNode::make("table_b");
+  EXPECT_NE(*_delete_node, *other_table_delete_node);
+  EXPECT_NE(_delete_node->hash(), other_table_delete_node->hash());
 }
 
 TEST_F(DeleteNodeTest, NodeExpressions) { EXPECT_TRUE(_delete_node->node_expressions.empty()); }
@@ -50,6 +50,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -371,6 +372,76 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitOverSortToTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 10
+   */
+  const auto order_by_modes = std::vector<OrderByMode>({OrderByMode::Descending, OrderByMode::Ascending});
+
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(static_cast<int64_t>(10)),
+    SortNode::make(expression_vector(int_float_b, int_float_a), order_by_modes,
+      int_float_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<const TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(top_k->k(), 10);
+
+  ASSERT_EQ(top_k->sort_definitions().size(), 2);
+  EXPECT_EQ(top_k->sort_definitions().at(0).column, ColumnID{1});
+  EXPECT_EQ(top_k->sort_definitions().at(0).order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(top_k->sort_definitions().at(1).column, ColumnID{0});
+  EXPECT_EQ(top_k->sort_definitions().at(1).order_by_mode, OrderByMode::Ascending);
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->input_left());
+  ASSERT_TRUE(get_table);
+}
+
+TEST_F(LQPTranslatorTest, LimitOverSortNotFusedIfNotApplicable) {
+  const auto order_by_modes = std::vector<OrderByMode>({OrderByMode::Ascending});
+
+  // A placeholder as row count is only known when the plan is executed
+  {
+    // clang-format off
+    const auto lqp =
+    LimitNode::make(placeholder_(ParameterID{0}),
+      SortNode::make(expression_vector(int_float_a), order_by_modes,
+        int_float_node));
+    // clang-format on
+
+    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    ASSERT_TRUE(std::dynamic_pointer_cast<const Limit>(pqp));
+    EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(pqp->input_left()));
+  }
+
+  // If the sorted result is consumed by other nodes as well, the Sort has to be kept
+  {
+    const auto sort_node = SortNode::make(expression_vector(int_float_a), order_by_modes, int_float_node);
+
+    // clang-format off
+    const auto lqp =
+    UnionNode::make(UnionMode::All,
+      LimitNode::make(value_(static_cast<int64_t>(2)), sort_node),
+      sort_node);
+    // clang-format on
+
+    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    const auto limit = std::dynamic_pointer_cast<const Limit>(pqp->input_left());
+    ASSERT_TRUE(limit);
+    EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(limit->input_left()));
+  }
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -205,7 +205,7 @@ TEST_F(LQPUtilsTest, LQPFindModifiedTables) {
   EXPECT_EQ(insert_tables.size(), 1);
   EXPECT_NE(insert_tables.find("insert_table_name"), insert_tables.end());
 
-  const auto delete_lqp = DeleteNode::make(node_a);
+  const auto delete_lqp = DeleteNode::make("node_a", node_a);
   const auto delete_tables = lqp_find_modified_tables(delete_lqp);
 
   EXPECT_EQ(delete_tables.size(), 1);
@@ -887,4 +887,80 @@ TYPED_TEST(OperatorsAggregateTest, StringVariations) {
   EXPECT_EQ(values_sorted, result_values_sorted);
 }
 
+class OperatorsAggregateHashTest : public BaseTest {
+ public:
+  static void SetUpTestCase() {
+    // Large enough to be pre-aggregated by multiple jobs (see AggregateHash::MIN_ROWS_PER_PREAGGREGATION_JOB)
+    const auto row_count = 4 * AggregateHash::MIN_ROWS_PER_PREAGGREGATION_JOB;
+
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true},
+                                                           {"b", DataType::String, false},
+                                                           {"c", DataType::Int, true},
+                                                           {"d", DataType::Double, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      const auto a =
+          row_id % 97 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<int32_t>(row_id % 1'000)};
+      const auto c =
+          row_id % 13 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<int32_t>(row_id % 89)};
+      table->append({a, pmr_string{row_id % 3 == 0 ? "short" : "a longer string"}, c, static_cast<double>(row_id) / 7});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+ protected:
+  // AggregateSort does not pre-aggregate in parallel, so it is used as a reference
+  void test_against_aggregate_sort(const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                                   const std::vector<ColumnID>& groupby_column_ids) {
+    const auto aggregate_hash = std::make_shared<AggregateHash>(_table_wrapper, aggregates, groupby_column_ids);
+    aggregate_hash->execute();
+
+    const auto aggregate_sort = std::make_shared<AggregateSort>(_table_wrapper, aggregates, groupby_column_ids);
+    aggregate_sort->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate_hash->get_output(), aggregate_sort->get_output());
+  }
+
+  std::vector<std::shared_ptr<AggregateExpression>> all_aggregates(const ColumnID column_id) const {
+    const auto& table = *_table_wrapper->get_output();
+    const auto column = pqp_column_(column_id, table.column_data_type(column_id), table.column_is_nullable(column_id),
+                                    table.column_name(column_id));
+    auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+    for (const auto function :
+         {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum, AggregateFunction::Avg,
+          AggregateFunction::Count, AggregateFunction::CountDistinct, AggregateFunction::StandardDeviationSample}) {
+      aggregates.emplace_back(std::make_shared<AggregateExpression>(function, column));
+    }
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(
+        AggregateFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
+    return aggregates;
+  }
+
+  inline static std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateHashTest, ParallelOneGroupby) {
+  test_against_aggregate_sort(all_aggregates(ColumnID{2}), {ColumnID{0}});
+  test_against_aggregate_sort(all_aggregates(ColumnID{3}), {ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateHashTest, ParallelTwoGroupby) {
+  test_against_aggregate_sort(all_aggregates(ColumnID{2}), {ColumnID{0}, ColumnID{1}});
+}
+
+TEST_F(OperatorsAggregateHashTest, ParallelThreeGroupby) {
+  test_against_aggregate_sort(all_aggregates(ColumnID{3}), {ColumnID{0}, ColumnID{1}, ColumnID{2}});
+}
+
+TEST_F(OperatorsAggregateHashTest, ParallelWithoutGroupby) {
+  test_against_aggregate_sort(all_aggregates(ColumnID{2}), {});
+  test_against_aggregate_sort(all_aggregates(ColumnID{3}), {});
+}
+
+TEST_F(OperatorsAggregateHashTest, ParallelDistinct) {
+  test_against_aggregate_sort({}, {ColumnID{0}, ColumnID{1}});
+}
+
 }  // namespace opossum
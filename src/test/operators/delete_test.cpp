@@ -51,7 +51,7 @@ void OperatorsDeleteTest::helper(bool commit) {
   auto table_scan = create_table_scan(gt, ColumnID{1}, PredicateCondition::GreaterThan, 456.7f);
   table_scan->execute();
 
-  auto delete_op = std::make_shared<Delete>(table_scan);
+  auto delete_op = std::make_shared<Delete>(_table_name, table_scan);
   delete_op->set_transaction_context(transaction_context);
 
   delete_op->execute();
@@ -102,10 +102,10 @@ TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   EXPECT_EQ(table_scan1->get_output()->chunk_count(), 1u);
   EXPECT_EQ(table_scan1->get_output()->get_chunk(ChunkID{0})->column_count(), 2u);
 
-  auto delete_op1 = std::make_shared<Delete>(table_scan1);
+  auto delete_op1 = std::make_shared<Delete>(_table_name, table_scan1);
   delete_op1->set_transaction_context(t1_context);
 
-  auto delete_op2 = std::make_shared<Delete>(table_scan2);
+  auto delete_op2 = std::make_shared<Delete>(_table_name, table_scan2);
   delete_op2->set_transaction_context(t2_context);
 
   delete_op1->execute();
@@ -158,7 +158,7 @@ TEST_F(OperatorsDeleteTest, EmptyDelete) {
 
   EXPECT_EQ(table_scan->get_output()->chunk_count(), 0u);
 
-  auto delete_op = std::make_shared<Delete>(table_scan);
+  auto delete_op = std::make_shared<Delete>(_table_name, table_scan);
   delete_op->set_transaction_context(tx_context_modification);
 
   delete_op->execute();
@@ -198,7 +198,7 @@ TEST_F(OperatorsDeleteTest, UpdateAfterDeleteFails) {
   validate1->execute();
   validate2->execute();
 
-  auto delete_op = std::make_shared<Delete>(validate1);
+  auto delete_op = std::make_shared<Delete>(_table_name, validate1);
   delete_op->set_transaction_context(t1_context);
 
   delete_op->execute();
@@ -248,7 +248,7 @@ TEST_F(OperatorsDeleteTest, DeleteOwnInsert) {
     table_scan1->execute();
     EXPECT_EQ(table_scan1->get_output()->row_count(), 2);
 
-    auto delete_op = std::make_shared<Delete>(table_scan1);
+    auto delete_op = std::make_shared<Delete>(_table_name, table_scan1);
     delete_op->set_transaction_context(context);
     delete_op->execute();
 
@@ -302,13 +302,13 @@ TEST_F(OperatorsDeleteTest, UseTransactionContextAfterCommit) {
   validate1->set_transaction_context(t1_context);
   validate1->execute();
 
-  auto delete_op = std::make_shared<Delete>(validate1);
+  auto delete_op = std::make_shared<Delete>(_table_name, validate1);
   delete_op->set_transaction_context(t1_context);
   delete_op->execute();
 
   t1_context->commit();
 
-  auto delete_op2 = std::make_shared<Delete>(validate1);
+  auto delete_op2 = std::make_shared<Delete>(_table_name, validate1);
   delete_op->set_transaction_context(t1_context);
 
   EXPECT_THROW(delete_op->execute(), std::logic_error);
@@ -324,14 +324,14 @@ TEST_F(OperatorsDeleteTest, RunOnUnvalidatedTable) {
   table_scan->execute();
 
   auto t1_context = Hyrise::get().transaction_manager.new_transaction_context();
-  auto delete_op1 = std::make_shared<Delete>(table_scan);
+  auto delete_op1 = std::make_shared<Delete>(_table_name, table_scan);
   delete_op1->set_transaction_context(t1_context);
   // This one works and deletes some rows
   delete_op1->execute();
   t1_context->commit();
 
   auto t2_context = Hyrise::get().transaction_manager.new_transaction_context();
-  auto delete_op2 = std::make_shared<Delete>(table_scan);
+  auto delete_op2 = std::make_shared<Delete>(_table_name, table_scan);
   delete_op2->set_transaction_context(t2_context);
   // This one should fail because the rows should have been filtered out by a validate and should not be visible
   // to the delete operator in the first place.
@@ -352,7 +352,7 @@ TEST_F(OperatorsDeleteTest, PrunedInputTable) {
   const auto table_scan = create_table_scan(get_table_op, ColumnID{0}, PredicateCondition::LessThan, 5);
   table_scan->execute();
 
-  const auto delete_op = std::make_shared<Delete>(table_scan);
+  const auto delete_op = std::make_shared<Delete>(_table2_name, table_scan);
   delete_op->set_transaction_context(transaction_context);
   delete_op->execute();
   EXPECT_FALSE(delete_op->execute_failed());
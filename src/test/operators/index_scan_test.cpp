@@ -308,4 +308,69 @@ TYPED_TEST(OperatorsIndexScanTest, AddedChunk) {
                             load_table("resources/test_data/tbl/int_int_shuffled_appended_and_filtered.tbl", 10));
 }
 
+class OperatorsIndexScanPrimaryKeyTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto table = load_table("resources/test_data/tbl/int_int_int.tbl", 2);
+    table->add_soft_unique_constraint({ColumnID{0}, ColumnID{2}}, IsPrimaryKey::Yes);
+    table->create_primary_key_index();
+    Hyrise::get().storage_manager.add_table("pk_table", table);
+  }
+};
+
+TEST_F(OperatorsIndexScanPrimaryKeyTest, Lookup) {
+  // The RowIDs of the index refer to the stored table and have to be mapped to the chunks and columns of GetTable
+  const auto get_table =
+      std::make_shared<GetTable>("pk_table", std::vector<ChunkID>{ChunkID{0}}, std::vector<ColumnID>{ColumnID{1}});
+  get_table->execute();
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  const auto scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::PrimaryKey, column_ids,
+                                                PredicateCondition::Equals, std::vector<AllTypeVariant>{9, 9});
+  scan->execute();
+
+  const auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"c", DataType::Int, false}}, TableType::Data);
+  expected_result->append({9, 9});
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+
+  // The row is in a pruned chunk
+  const auto scan_pruned = std::make_shared<IndexScan>(get_table, SegmentIndexType::PrimaryKey, column_ids,
+                                                       PredicateCondition::Equals, std::vector<AllTypeVariant>{10, 10});
+  scan_pruned->execute();
+  EXPECT_EQ(scan_pruned->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorsIndexScanPrimaryKeyTest, RequiresGetTableInput) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(Hyrise::get().storage_manager.get_table("pk_table"));
+  table_wrapper->execute();
+
+  const auto scan = std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::PrimaryKey,
+                                                std::vector<ColumnID>{ColumnID{0}, ColumnID{2}},
+                                                PredicateCondition::Equals, std::vector<AllTypeVariant>{9, 9});
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsIndexScanPrimaryKeyTest, LQPTranslation) {
+  const auto stored_table_node = StoredTableNode::make("pk_table");
+  const auto a = stored_table_node->get_column("a");
+  const auto c = stored_table_node->get_column("c");
+  const auto predicate_node = PredicateNode::make(and_(equals_(a, 11), equals_(c, 11)), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+  const auto index_scan = std::dynamic_pointer_cast<IndexScan>(pqp);
+  ASSERT_TRUE(index_scan);
+  ASSERT_TRUE(std::dynamic_pointer_cast<const GetTable>(index_scan->input_left()));
+
+  index_scan->mutable_input_left()->execute();
+  index_scan->execute();
+
+  const auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, false}},
+      TableType::Data);
+  expected_result->append({11, 10, 11});
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), expected_result);
+}
+
 }  // namespace opossum
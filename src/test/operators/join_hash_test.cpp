@@ -117,4 +117,62 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
                                                   std::numeric_limits<size_t>::max()) > 0ul);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillingWithMemoryBudget) {
+  // With a memory budget far below the estimated size of the hash table, both inputs are partitioned and spilled to
+  // disk. The result has to match the one of the in-memory join.
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto memory_budget = size_t{4'096};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+
+    const auto in_memory_join =
+        std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, mode, primary_predicate);
+    in_memory_join->execute();
+
+    const auto spilling_join =
+        std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, mode, primary_predicate);
+    spilling_join->set_memory_budget_recursively(memory_budget);
+    EXPECT_EQ(spilling_join->memory_budget(), memory_budget);
+    spilling_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), in_memory_join->get_output());
+
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(spilling_join->performance_data());
+    EXPECT_GT(performance_data.spilled_bytes, 0);
+    EXPECT_GT(performance_data.spilled_partition_count, 0);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, SpillingWithNullValues) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::AntiNullAsTrue, JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+
+    const auto in_memory_join =
+        std::make_shared<JoinHash>(_table_with_nulls, _table_with_nulls, mode, primary_predicate);
+    in_memory_join->execute();
+
+    const auto spilling_join = std::make_shared<JoinHash>(_table_with_nulls, _table_with_nulls, mode, primary_predicate);
+    spilling_join->set_memory_budget_recursively(size_t{1});
+    spilling_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), in_memory_join->get_output());
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, NoSpillingWithinMemoryBudget) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join =
+      std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, JoinMode::Inner, primary_predicate);
+  join->set_memory_budget_recursively(std::numeric_limits<size_t>::max());
+  join->execute();
+
+  const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.spilled_bytes, 0);
+  EXPECT_EQ(performance_data.spilled_partition_count, 0);
+}
+
 }  // namespace opossum
@@ -7,7 +7,10 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
 #include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -643,4 +646,59 @@ TYPED_TEST(JoinIndexTest, LeftJoinPruneInputIsEmptyRefIndexInputIsDataIndexSideI
       std::logic_error);
 }
 
+class JoinIndexPrimaryKeyTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    table->add_soft_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    table->create_primary_key_index();
+    Hyrise::get().storage_manager.add_table("pk_table", table);
+
+    _probe_input = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float2.tbl", 2));
+    _probe_input->execute();
+  }
+
+  // Compares the output of the JoinIndex, which looks up the probe values in the PrimaryKeyIndex of the stored table,
+  // with the output of the JoinNestedLoop
+  void test_join_output(const JoinMode mode) {
+    const auto get_table = std::make_shared<GetTable>("pk_table");
+    get_table->execute();
+
+    const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+    const auto join = std::make_shared<JoinIndex>(_probe_input, get_table, mode, primary_predicate);
+    join->execute();
+
+    const auto reference_join = std::make_shared<JoinNestedLoop>(_probe_input, get_table, mode, primary_predicate);
+    reference_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), reference_join->get_output());
+
+    const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join->performance_data());
+    EXPECT_EQ(performance_data.chunks_scanned_with_index, static_cast<size_t>(get_table->get_output()->chunk_count()));
+    EXPECT_EQ(performance_data.chunks_scanned_without_index, 0);
+  }
+
+ protected:
+  std::shared_ptr<TableWrapper> _probe_input;
+};
+
+TEST_F(JoinIndexPrimaryKeyTest, InnerJoin) { test_join_output(JoinMode::Inner); }
+
+TEST_F(JoinIndexPrimaryKeyTest, LeftJoin) { test_join_output(JoinMode::Left); }
+
+TEST_F(JoinIndexPrimaryKeyTest, SemiJoin) { test_join_output(JoinMode::Semi); }
+
+TEST_F(JoinIndexPrimaryKeyTest, PrunedChunk) {
+  // Rows of pruned chunks are found in the index, but must not be part of the output
+  const auto get_table =
+      std::make_shared<GetTable>("pk_table", std::vector<ChunkID>{ChunkID{0}}, std::vector<ColumnID>{});
+  get_table->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join = std::make_shared<JoinIndex>(_probe_input, get_table, JoinMode::Inner, primary_predicate);
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), 0);
+}
+
 }  // namespace opossum
@@ -0,0 +1,249 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_runtime_filter.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinRuntimeFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The probe table holds the values 0 to 29 in three chunks, the build table holds 3, 5, 25, and NULL
+    const auto probe_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}},
+                                                     TableType::Data, ChunkOffset{10});
+    for (auto value = int32_t{0}; value < 30; ++value) {
+      probe_table->append({value});
+    }
+    probe_table->last_chunk()->finalize();
+    generate_chunk_pruning_statistics(probe_table);
+
+    const auto build_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, true}}, TableType::Data, ChunkOffset{10});
+    build_table->append({25});
+    build_table->append({NullValue{}});
+    build_table->append({3});
+    build_table->append({5});
+
+    _probe_input = std::make_shared<TableWrapper>(probe_table);
+    _probe_input->execute();
+    _build_input = std::make_shared<TableWrapper>(build_table);
+    _build_input->execute();
+
+    _column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  }
+
+  std::shared_ptr<JoinHash> make_join(const std::shared_ptr<AbstractOperator>& probe_operator,
+                                      const JoinMode mode = JoinMode::Inner) {
+    return std::make_shared<JoinHash>(
+        probe_operator, _build_input, mode,
+        OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+  }
+
+  std::shared_ptr<TableWrapper> _probe_input, _build_input;
+  std::shared_ptr<AbstractExpression> _column_a;
+};
+
+TEST_F(JoinRuntimeFilterTest, PruneAndFilter) {
+  auto runtime_filter = JoinRuntimeFilter{_build_input, ColumnID{0}, ColumnID{0}};
+  ASSERT_TRUE(runtime_filter.build(30, DataType::Int));
+
+  const auto& probe_table = *_probe_input->get_output();
+
+  // Only the second chunk (10 to 19) does not overlap the range of the build side
+  EXPECT_FALSE(runtime_filter.can_prune(*probe_table.get_chunk(ChunkID{0})));
+  EXPECT_TRUE(runtime_filter.can_prune(*probe_table.get_chunk(ChunkID{1})));
+  EXPECT_FALSE(runtime_filter.can_prune(*probe_table.get_chunk(ChunkID{2})));
+
+  // The Bloom filter might have false positives, but keeps all values of the build side and removes those outside of
+  // its range
+  const auto chunk_id = ChunkID{0};
+  auto matches = std::make_shared<RowIDPosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10; ++chunk_offset) {
+    matches->push_back(RowID{chunk_id, chunk_offset});
+  }
+  const auto filtered_matches = runtime_filter.filter(*probe_table.get_chunk(chunk_id), matches);
+
+  EXPECT_NE(std::find(filtered_matches->begin(), filtered_matches->end(), RowID{chunk_id, ChunkOffset{3}}),
+            filtered_matches->end());
+  EXPECT_NE(std::find(filtered_matches->begin(), filtered_matches->end(), RowID{chunk_id, ChunkOffset{5}}),
+            filtered_matches->end());
+  for (const auto& row_id : *filtered_matches) {
+    EXPECT_GE(row_id.chunk_offset, 3);
+  }
+  EXPECT_LT(filtered_matches->size(), 7);
+}
+
+TEST_F(JoinRuntimeFilterTest, BuildSideWithoutKeys) {
+  const auto build_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, true}}, TableType::Data, ChunkOffset{10});
+  build_table->append({NullValue{}});
+  const auto build_input = std::make_shared<TableWrapper>(build_table);
+  build_input->execute();
+
+  auto runtime_filter = JoinRuntimeFilter{build_input, ColumnID{0}, ColumnID{0}};
+  ASSERT_TRUE(runtime_filter.build(30, DataType::Int));
+
+  const auto& chunk = *_probe_input->get_output()->get_chunk(ChunkID{0});
+  EXPECT_TRUE(runtime_filter.can_prune(chunk));
+
+  const auto matches = std::make_shared<RowIDPosList>(RowIDPosList{RowID{ChunkID{0}, ChunkOffset{3}}});
+  EXPECT_TRUE(runtime_filter.filter(chunk, matches)->empty());
+}
+
+TEST_F(JoinRuntimeFilterTest, NotApplicable) {
+  // The build operator has not been executed
+  auto unexecuted_filter =
+      JoinRuntimeFilter{std::make_shared<TableWrapper>(_build_input->get_output()), ColumnID{0}, ColumnID{0}};
+  EXPECT_FALSE(unexecuted_filter.build(30, DataType::Int));
+
+  // The build side is larger than the probe side
+  auto large_build_side_filter = JoinRuntimeFilter{_build_input, ColumnID{0}, ColumnID{0}};
+  EXPECT_FALSE(large_build_side_filter.build(2, DataType::Int));
+
+  // The data types differ
+  auto type_mismatch_filter = JoinRuntimeFilter{_build_input, ColumnID{0}, ColumnID{0}};
+  EXPECT_FALSE(type_mismatch_filter.build(30, DataType::Long));
+}
+
+TEST_F(JoinRuntimeFilterTest, TableScanAppliesFilter) {
+  const auto scan = std::make_shared<TableScan>(_probe_input, greater_than_equals_(_column_a, 4));
+  scan->runtime_filters.emplace_back(std::make_shared<JoinRuntimeFilter>(_build_input, ColumnID{0}, ColumnID{0}));
+  scan->execute();
+
+  // 5 and 25 are kept, 0 to 4 are removed by the range, 10 to 19 are pruned
+  const auto& output = *scan->get_output();
+  EXPECT_GE(output.row_count(), 2);
+  EXPECT_LE(output.row_count(), 10);
+  EXPECT_EQ(output.chunk_count(), 2);
+
+  // The join result is not affected
+  const auto unfiltered_scan = std::make_shared<TableScan>(_probe_input, greater_than_equals_(_column_a, 4));
+  unfiltered_scan->execute();
+  const auto expected_join = make_join(unfiltered_scan);
+  expected_join->execute();
+
+  const auto join = make_join(scan);
+  join->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+  EXPECT_EQ(join->get_output()->row_count(), 2);
+}
+
+TEST_F(JoinRuntimeFilterTest, AddToLowestTableScan) {
+  const auto lower_scan = std::make_shared<TableScan>(_probe_input, greater_than_equals_(_column_a, 4));
+  const auto upper_scan = std::make_shared<TableScan>(lower_scan, less_than_(_column_a, 20));
+  const auto join = make_join(upper_scan);
+
+  add_join_runtime_filters(join);
+
+  EXPECT_TRUE(upper_scan->runtime_filters.empty());
+  ASSERT_EQ(lower_scan->runtime_filters.size(), 1);
+  EXPECT_EQ(lower_scan->runtime_filters[0]->build_operator(), _build_input);
+  EXPECT_EQ(lower_scan->runtime_filters[0]->probe_column_id(), ColumnID{0});
+  EXPECT_EQ(lower_scan->runtime_filters[0]->build_column_id(), ColumnID{0});
+}
+
+TEST_F(JoinRuntimeFilterTest, NotAddedForOtherJoinModes) {
+  const auto scan = std::make_shared<TableScan>(_probe_input, greater_than_equals_(_column_a, 4));
+  add_join_runtime_filters(make_join(scan, JoinMode::Left));
+  EXPECT_TRUE(scan->runtime_filters.empty());
+
+  add_join_runtime_filters(make_join(scan, JoinMode::AntiNullAsTrue));
+  EXPECT_TRUE(scan->runtime_filters.empty());
+
+  add_join_runtime_filters(make_join(scan, JoinMode::Semi));
+  EXPECT_EQ(scan->runtime_filters.size(), 1);
+}
+
+TEST_F(JoinRuntimeFilterTest, NotAddedForScansWithOtherConsumers) {
+  // The scan's output is also used by the build side of the join, so it must not be filtered
+  const auto scan = std::make_shared<TableScan>(_probe_input, greater_than_equals_(_column_a, 4));
+  const auto join = std::make_shared<JoinHash>(
+      scan, scan, JoinMode::Inner,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+  add_join_runtime_filters(join);
+  EXPECT_TRUE(scan->runtime_filters.empty());
+}
+
+TEST_F(JoinRuntimeFilterTest, TableScanTaskDependsOnBuildTask) {
+  const auto build_scan = std::make_shared<TableScan>(_build_input, greater_than_(_column_a, 0));
+  const auto probe_scan = std::make_shared<TableScan>(_probe_input, greater_than_equals_(_column_a, 4));
+  const auto join = std::make_shared<JoinHash>(
+      probe_scan, build_scan, JoinMode::Inner,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+  add_join_runtime_filters(join);
+  ASSERT_EQ(probe_scan->runtime_filters.size(), 1);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join);
+  auto build_task = std::shared_ptr<AbstractTask>{};
+  auto probe_task = std::shared_ptr<AbstractTask>{};
+  for (const auto& task : tasks) {
+    const auto& op = std::static_pointer_cast<OperatorTask>(task)->get_operator();
+    if (op == build_scan) build_task = task;
+    if (op == probe_scan) probe_task = task;
+  }
+  ASSERT_TRUE(build_task && probe_task);
+
+  const auto& successors = build_task->successors();
+  EXPECT_NE(std::find(successors.begin(), successors.end(), probe_task), successors.end());
+
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  // The build side holds 3, 5, and 25
+  EXPECT_EQ(join->get_output()->row_count(), 2);
+}
+
+TEST_F(JoinRuntimeFilterTest, PipelinedTableScanAppliesFilter) {
+  // The build side holds 5, 25, and 13 NULLs, so it is larger than a chunk but smaller than the probe side
+  const auto build_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, true}}, TableType::Data, ChunkOffset{10});
+  build_table->append({5});
+  build_table->append({25});
+  for (auto row = size_t{0}; row < 13; ++row) {
+    build_table->append({NullValue{}});
+  }
+  const auto build_input = std::make_shared<TableWrapper>(build_table);
+  build_input->execute();
+
+  const auto lower_scan = std::make_shared<TableScan>(_probe_input, greater_than_equals_(_column_a, 4));
+  const auto upper_scan = std::make_shared<TableScan>(lower_scan, less_than_(_column_a, 30));
+  const auto join = std::make_shared<JoinHash>(
+      upper_scan, build_input, JoinMode::Inner,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+  add_join_runtime_filters(join);
+  ASSERT_EQ(lower_scan->runtime_filters.size(), 1);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join, ExecutionMode::Pipelined);
+  auto pipeline_count = size_t{0};
+  for (const auto& task : tasks) {
+    if (std::static_pointer_cast<OperatorTask>(task)->get_pipeline()) ++pipeline_count;
+  }
+  ASSERT_EQ(pipeline_count, 1);
+
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  // Without the filter, the scans would emit the 26 values from 4 to 29
+  EXPECT_GE(lower_scan->performance_data().output_row_count, 2);
+  EXPECT_LE(lower_scan->performance_data().output_row_count, 10);
+  EXPECT_EQ(join->get_output()->row_count(), 2);
+}
+
+}  // namespace opossum
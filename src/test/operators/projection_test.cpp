@@ -7,12 +7,14 @@
 
 #include "expression/expression_functional.hpp"
 #include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/delete.hpp"
 #include "operators/print.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -53,21 +55,63 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, ExecutedOnAllChunksWithScheduler) {
+  // Chunks are projected in parallel. Both expressions share the subexpression a + b, which the ExpressionEvaluator
+  // of each chunk only computes once.
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}},
+                                       TableType::Data, 100);
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"(a + b) * 2", DataType::Int, true}, {"(a + b) - a", DataType::Int, true}},
+      TableType::Data);
+  for (auto row = int32_t{0}; row < 1'000; ++row) {
+    if (row % 7 == 0) {
+      table->append({row, NULL_VALUE});
+      expected_table->append({NULL_VALUE, NULL_VALUE});
+    } else {
+      table->append({row, row % 13});
+      expected_table->append({(row + row % 13) * 2, row % 13});
+    }
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto b = PQPColumnExpression::from_table(*table, "b");
+
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto projection =
+      std::make_shared<Projection>(table_wrapper, expression_vector(mul_(add_(a, b), 2), sub_(add_(a, b), a)));
+  projection->execute();
+
+  const auto& output_table = projection->get_output();
+  EXPECT_EQ(output_table->chunk_count(), 10);
+  EXPECT_TRUE(output_table->column_is_nullable(ColumnID{0}));
+  EXPECT_TRUE(output_table->column_is_nullable(ColumnID{1}));
+  EXPECT_TABLE_EQ_ORDERED(output_table, expected_table);
+}
+
 TEST_F(OperatorsProjectionTest, PassThroughInvalidRowCount) {
+  // Delete works with the StorageManager, so the deleted table must be known to it
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  Hyrise::get().storage_manager.add_table("int_float", table);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
   auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
 
-  auto table_scan = create_table_scan(table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThan, 123);
+  auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 123);
   table_scan->execute();
 
   const auto rows_to_delete = table_scan->get_output()->row_count();
 
-  auto delete_op = std::make_shared<Delete>(table_scan);
+  auto delete_op = std::make_shared<Delete>("int_float", table_scan);
   delete_op->set_transaction_context(transaction_context);
   delete_op->execute();
 
   transaction_context->commit();
 
-  const auto projection = std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(a_a, a_b));
+  const auto projection = std::make_shared<opossum::Projection>(table_wrapper, expression_vector(a_a, a_b));
 
   projection->execute();
   const auto result_table = projection->get_output();
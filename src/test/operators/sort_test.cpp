@@ -11,6 +11,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -256,4 +257,181 @@ TEST_P(OperatorsSortTest, SortAfterOuterJoin) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+class OperatorsSortModeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true},
+                                                            {"b", DataType::Float, true},
+                                                            {"c", DataType::String, true},
+                                                            {"d", DataType::Long, false},
+                                                            {"row", DataType::Int, false}},
+                                     TableType::Data, 3);
+
+    const auto long_prefix = std::string(40, 'x');
+    const auto values = std::vector<std::vector<AllTypeVariant>>{
+        {1, 2.5f, pmr_string{"b"}, int64_t{7}},
+        {NULL_VALUE, -0.0f, pmr_string{"a"}, int64_t{-3}},
+        {-1, 0.0f, NULL_VALUE, int64_t{7}},
+        {1, NULL_VALUE, pmr_string{"b"}, int64_t{-3}},
+        {1, 2.5f, pmr_string{"a\0b", 3}, int64_t{1}},
+        {-1, -2.5f, pmr_string{""}, int64_t{-9}},
+        {NULL_VALUE, 1.0f, pmr_string{"a"}, int64_t{2}},
+        {1, 2.5f, pmr_string{"b"}, int64_t{7}},
+        {-1, 0.0f, pmr_string{"a"}, int64_t{0}},
+        {1, 2.5f, pmr_string{"a"}, int64_t{1}}};
+
+    auto row = int32_t{0};
+    for (const auto& row_values : values) {
+      auto row_with_id = row_values;
+      row_with_id.emplace_back(row++);
+      _table->append(row_with_id);
+    }
+
+    for (const auto& suffix : {"c", "a", "b", "a"}) {
+      _table->append({2, 1.0f, pmr_string{long_prefix + suffix}, int64_t{1}, row++});
+    }
+  }
+
+  // Sorts the input with both SortModes and expects the same order. As both modes sort stably, the "row" column
+  // guarantees that the results are comparable.
+  void expect_same_order(const std::shared_ptr<const Table>& table,
+                         const std::vector<SortColumnDefinition>& sort_definitions) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto iterative_sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 4u, SortMode::Iterative);
+    iterative_sort->execute();
+
+    const auto normalized_key_sort =
+        std::make_shared<Sort>(table_wrapper, sort_definitions, 4u, SortMode::NormalizedKey);
+    normalized_key_sort->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(normalized_key_sort->get_output(), iterative_sort->get_output());
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsSortModeTest, AllOrderByModes) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    for (auto column_id = ColumnID{0}; column_id < 4; ++column_id) {
+      expect_same_order(_table, {SortColumnDefinition{column_id, order_by_mode}});
+    }
+  }
+}
+
+TEST_F(OperatorsSortModeTest, MultipleColumnsMixedOrder) {
+  expect_same_order(_table, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending},
+                             SortColumnDefinition{ColumnID{1}, OrderByMode::AscendingNullsLast},
+                             SortColumnDefinition{ColumnID{3}, OrderByMode::Descending}});
+  expect_same_order(_table, {SortColumnDefinition{ColumnID{3}, OrderByMode::Ascending},
+                             SortColumnDefinition{ColumnID{0}, OrderByMode::DescendingNullsLast}});
+}
+
+TEST_F(OperatorsSortModeTest, StringsThatDoNotFitIntoTheKey) {
+  // Both the long strings and the string containing '\0' require the comparison-based fallback, which also has to
+  // order the columns following the string column.
+  expect_same_order(_table, {SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending},
+                             SortColumnDefinition{ColumnID{3}, OrderByMode::Descending},
+                             SortColumnDefinition{ColumnID{1}, OrderByMode::DescendingNullsLast}});
+  expect_same_order(_table, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                             SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}});
+}
+
+TEST_F(OperatorsSortModeTest, ReferenceSegments) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  auto scan = create_table_scan(table_wrapper, ColumnID{3}, PredicateCondition::GreaterThan, int64_t{-5});
+  scan->execute();
+
+  expect_same_order(scan->get_output(), {SortColumnDefinition{ColumnID{2}, OrderByMode::Descending},
+                                         SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}});
+}
+
+TEST_F(OperatorsSortModeTest, ExternalSort) {
+  // With a memory budget of one byte, every input chunk becomes a sorted run, and the runs are merged pairwise in
+  // multiple passes.
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  for (const auto sort_mode : {SortMode::Iterative, SortMode::NormalizedKey}) {
+    for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                     OrderByMode::DescendingNullsLast}) {
+      const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{2}, order_by_mode},
+                                                                      SortColumnDefinition{ColumnID{0}, order_by_mode}};
+
+      const auto in_memory_sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 4u, SortMode::Iterative);
+      in_memory_sort->execute();
+
+      const auto external_sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 4u, sort_mode);
+      external_sort->set_memory_budget_recursively(size_t{1});
+      external_sort->execute();
+
+      EXPECT_TABLE_EQ_ORDERED(external_sort->get_output(), in_memory_sort->get_output());
+      EXPECT_EQ(external_sort->get_output()->get_chunk(ChunkID{0})->size(), 4);
+
+      const auto& performance_data = static_cast<const Sort::PerformanceData&>(external_sort->performance_data());
+      EXPECT_GT(performance_data.spilled_bytes, 0);
+      EXPECT_EQ(performance_data.run_count, static_cast<size_t>(_table->chunk_count()));
+      EXPECT_GT(performance_data.merge_pass_count, 1);
+    }
+  }
+}
+
+TEST_F(OperatorsSortModeTest, ExternalSortOfReferenceSegments) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  auto scan = create_table_scan(table_wrapper, ColumnID{3}, PredicateCondition::GreaterThan, int64_t{-5});
+  scan->execute();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}, SortColumnDefinition{ColumnID{3}}};
+
+  const auto in_memory_sort = std::make_shared<Sort>(scan, sort_definitions, 4u);
+  in_memory_sort->execute();
+
+  const auto external_sort = std::make_shared<Sort>(scan, sort_definitions, 4u);
+  external_sort->set_memory_budget_recursively(size_t{200});
+  external_sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(external_sort->get_output(), in_memory_sort->get_output());
+  EXPECT_GT(static_cast<const Sort::PerformanceData&>(external_sort->performance_data()).spilled_bytes, 0);
+}
+
+TEST_F(OperatorsSortModeTest, NoExternalSortWithinMemoryBudget) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  const auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{
+                                                              SortColumnDefinition{ColumnID{0}}});
+  sort->set_memory_budget_recursively(std::numeric_limits<size_t>::max());
+  sort->execute();
+
+  const auto& performance_data = static_cast<const Sort::PerformanceData&>(sort->performance_data());
+  EXPECT_EQ(performance_data.spilled_bytes, 0);
+  EXPECT_EQ(performance_data.run_count, 0);
+}
+
+TEST_F(OperatorsSortModeTest, LargeInputWithScheduler) {
+  // More rows than one job partitions in the first radix sort pass, so that the parallel code paths are used
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true},
+                                                              {"b", DataType::String, false},
+                                                              {"row", DataType::Int, false}},
+                                       TableType::Data, 10'000);
+  for (auto row = int32_t{0}; row < 150'000; ++row) {
+    const auto a = row % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{(row * 7919) % 1'000 - 500};
+    table->append({a, pmr_string{std::to_string(row % 13)}, row});
+  }
+
+  expect_same_order(table, {SortColumnDefinition{ColumnID{0}, OrderByMode::DescendingNullsLast},
+                            SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}});
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
@@ -0,0 +1,106 @@
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/table_scan/attribute_vector_scan_kernels.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+
+namespace opossum {
+
+using AttributeVectorScanKernelsTestParam = std::tuple<VectorCompressionType, ValueID::base_type /* null_value_id */>;
+
+class AttributeVectorScanKernelsTest : public BaseTest,
+                                       public ::testing::WithParamInterface<AttributeVectorScanKernelsTestParam> {
+ protected:
+  void SetUp() override {
+    const auto [vector_compression_type, null_value_id] = GetParam();
+    _null_value_id = null_value_id;
+
+    // The size is not a multiple of any SIMD register or SIMD-BP128 block size so that the remainder is scanned, too.
+    // The first value IDs are small so that SIMD-BP128 packs them into blocks with few bits, for which all or none of
+    // the rows might match.
+    _value_ids = pmr_vector<uint32_t>(10'037);
+    auto random_engine = std::mt19937{17};
+    auto small_value_id_distribution = std::uniform_int_distribution<uint32_t>{0, 3};
+    auto value_id_distribution = std::uniform_int_distribution<uint32_t>{0, _null_value_id};
+    for (auto index = size_t{0}; index < _value_ids.size(); ++index) {
+      auto& distribution = index < 2048 ? small_value_id_distribution : value_id_distribution;
+      _value_ids[index] = distribution(random_engine);
+    }
+
+    _attribute_vector = compress_vector(_value_ids, vector_compression_type, _value_ids.get_allocator(),
+                                        UncompressedVectorInfo{_null_value_id});
+  }
+
+  void _test_predicate(const ValueIDRangePredicate& predicate) {
+    SCOPED_TRACE(std::to_string(predicate.lower_bound) + " - " + std::to_string(predicate.upper_bound) +
+                 (predicate.inverted ? " (inverted)" : ""));
+
+    // Existing matches must be kept
+    auto expected_matches = RowIDPosList{RowID{ChunkID{1}, ChunkOffset{42}}};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _value_ids.size(); ++chunk_offset) {
+      if (predicate.matches(_value_ids[chunk_offset])) expected_matches.emplace_back(RowID{ChunkID{2}, chunk_offset});
+    }
+
+    auto matches = RowIDPosList{RowID{ChunkID{1}, ChunkOffset{42}}};
+    resolve_compressed_vector_type(*_attribute_vector, [&](const auto& attribute_vector) {
+      scan_attribute_vector(attribute_vector, predicate, ChunkID{2}, matches);
+    });
+
+    ASSERT_EQ(matches.size(), expected_matches.size());
+    for (auto index = size_t{0}; index < matches.size(); ++index) {
+      ASSERT_EQ(matches[index], expected_matches[index]);
+    }
+  }
+
+  ValueID::base_type _null_value_id{};
+  pmr_vector<uint32_t> _value_ids;
+  std::unique_ptr<const BaseCompressedVector> _attribute_vector;
+};
+
+TEST_P(AttributeVectorScanKernelsTest, ValueIDRanges) {
+  const auto middle = _null_value_id / 2;
+
+  // Equals
+  _test_predicate({0, 1, false, _null_value_id});
+  _test_predicate({middle, middle + 1, false, _null_value_id});
+  _test_predicate({_null_value_id - 1, _null_value_id, false, _null_value_id});
+
+  // LessThan(Equals)
+  _test_predicate({0, 2, false, _null_value_id});
+  _test_predicate({0, middle, false, _null_value_id});
+  _test_predicate({0, _null_value_id, false, _null_value_id});
+
+  // GreaterThan(Equals)
+  _test_predicate({1, _null_value_id, false, _null_value_id});
+  _test_predicate({middle, _null_value_id, false, _null_value_id});
+  _test_predicate({_null_value_id - 1, _null_value_id, false, _null_value_id});
+
+  // Empty range
+  _test_predicate({middle, middle, false, _null_value_id});
+}
+
+TEST_P(AttributeVectorScanKernelsTest, InvertedValueIDRanges) {
+  const auto middle = _null_value_id / 2;
+
+  // NotEquals
+  _test_predicate({0, 1, true, _null_value_id});
+  _test_predicate({2, 3, true, _null_value_id});
+  _test_predicate({middle, middle + 1, true, _null_value_id});
+  _test_predicate({_null_value_id - 1, _null_value_id, true, _null_value_id});
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AttributeVectorScanKernelsTestInstances, AttributeVectorScanKernelsTest,
+    ::testing::Values(AttributeVectorScanKernelsTestParam{VectorCompressionType::FixedSizeByteAligned, 200},
+                      AttributeVectorScanKernelsTestParam{VectorCompressionType::FixedSizeByteAligned, 255},
+                      AttributeVectorScanKernelsTestParam{VectorCompressionType::FixedSizeByteAligned, 5'000},
+                      AttributeVectorScanKernelsTestParam{VectorCompressionType::FixedSizeByteAligned, 100'000},
+                      AttributeVectorScanKernelsTestParam{VectorCompressionType::SimdBp128, 200},
+                      AttributeVectorScanKernelsTestParam{VectorCompressionType::SimdBp128, 100'000}));
+
+}  // namespace opossum
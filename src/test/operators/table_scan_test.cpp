@@ -24,6 +24,7 @@
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -1072,4 +1073,43 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, BitmapPosListForHighSelectivity) {
+  // Scans that keep a large fraction of a chunk store their matches in a BitmapPosList instead of a RowIDPosList
+  const auto data_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                  TableType::Data, ChunkOffset{100});
+  for (auto value = int32_t{0}; value < 200; ++value) {
+    data_table->append({value});
+  }
+  data_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{_encoding_type});
+
+  const auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto get_pos_list = [](const std::shared_ptr<const Table>& table, const ChunkID chunk_id) {
+    const auto segment = table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    return std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  };
+
+  // 100% of the first and 10% of the second chunk match
+  const auto scan_a = create_table_scan(data_table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 110);
+  scan_a->execute();
+  ASSERT_EQ(scan_a->get_output()->chunk_count(), 2);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(scan_a->get_output(), ChunkID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(get_pos_list(scan_a->get_output(), ChunkID{1})));
+
+  // Scanning the reference table resolves the positions in the BitmapPosList. 50% of the first chunk still match.
+  const auto scan_b = create_table_scan(scan_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 50);
+  scan_b->execute();
+  const auto& table = scan_b->get_output();
+  ASSERT_EQ(table->chunk_count(), 2);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(table, ChunkID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(get_pos_list(table, ChunkID{1})));
+
+  ASSERT_EQ(table->row_count(), 60);
+  for (auto row = 0; row < 60; ++row) {
+    EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, row), 50 + row);
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,118 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/chunk_encoder.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+    _table_wrapper->execute();
+
+    _table_wrapper_null =
+        std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float_with_null.tbl", 1));
+    _table_wrapper_null->execute();
+  }
+
+  // TopK has to return the same rows in the same order as a (stable) Sort followed by a Limit
+  void expect_equal_to_sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                      const std::vector<SortColumnDefinition>& sort_definitions, const size_t k) {
+    const auto top_k = std::make_shared<TopK>(input, sort_definitions, k);
+    top_k->execute();
+
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    const auto limit = std::make_shared<Limit>(sort, to_expression(static_cast<int64_t>(k)));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_null;
+};
+
+TEST_F(OperatorsTopKTest, OperatorName) {
+  const auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, 3);
+  EXPECT_EQ(top_k->name(), "TopK");
+  EXPECT_EQ(top_k->description(DescriptionMode::SingleLine), "TopK k: 3");
+  EXPECT_EQ(top_k->k(), 3);
+}
+
+TEST_F(OperatorsTopKTest, SingleColumn) {
+  for (const auto k : {size_t{0}, size_t{1}, size_t{3}, size_t{7}, size_t{100}}) {
+    expect_equal_to_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, k);
+    expect_equal_to_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}}, k);
+  }
+}
+
+TEST_F(OperatorsTopKTest, TiesKeepInputOrder) {
+  // Column a contains duplicates, so the order of rows with equal values is determined by their position in the input
+  for (const auto k : {size_t{1}, size_t{2}, size_t{4}, size_t{5}}) {
+    expect_equal_to_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, k);
+  }
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumns) {
+  expect_equal_to_sort_and_limit(_table_wrapper,
+                                 {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                  SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+                                 4);
+}
+
+TEST_F(OperatorsTopKTest, NullValues) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    for (const auto k : {size_t{1}, size_t{2}, size_t{4}}) {
+      expect_equal_to_sort_and_limit(_table_wrapper_null, {SortColumnDefinition{ColumnID{0}, order_by_mode}}, k);
+      expect_equal_to_sort_and_limit(_table_wrapper_null, {SortColumnDefinition{ColumnID{1}, order_by_mode}}, k);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceSegmentsAndEncodedInput) {
+  auto table = load_table("resources/test_data/tbl/int_float_double_string.tbl", 3);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  scan->execute();
+
+  expect_equal_to_sort_and_limit(scan, {SortColumnDefinition{ColumnID{3}, OrderByMode::Descending}}, 3);
+  expect_equal_to_sort_and_limit(scan, {SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending}}, 2);
+}
+
+TEST_F(OperatorsTopKTest, OutputIsSortedDataTable) {
+  const auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}}, 2);
+  top_k->execute();
+
+  const auto& output = top_k->get_output();
+  EXPECT_EQ(output->type(), TableType::Data);
+  ASSERT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->ordered_by(), std::make_pair(ColumnID{1}, OrderByMode::Ascending));
+}
+
+TEST_F(OperatorsTopKTest, DeepCopy) {
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}};
+  const auto top_k = std::make_shared<TopK>(_table_wrapper, sort_definitions, 2);
+  const auto copy = std::dynamic_pointer_cast<TopK>(top_k->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->k(), 2);
+  EXPECT_EQ(copy->sort_definitions().at(0).column, ColumnID{1});
+  EXPECT_EQ(copy->sort_definitions().at(0).order_by_mode, OrderByMode::Descending);
+}
+
+}  // namespace opossum
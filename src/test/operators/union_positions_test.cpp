@@ -11,6 +11,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
@@ -295,4 +296,24 @@ TEST_F(UnionPositionsTest, MultipleShuffledPosList) {
                             load_table("resources/test_data/tbl/union_positions_multiple_shuffled_pos_list.tbl"));
 }
 
+TEST_F(UnionPositionsTest, BitmapPosLists) {
+  // If both inputs consist of BitmapPosLists, they are combined with a bitwise OR
+  const auto table = load_table("resources/test_data/tbl/10_ints.tbl", 10);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+
+  // The scans match the rows 0, 1, and 3-7 and the rows 1-4, 8, and 9, so all rows are part of the union
+  auto table_scan_a_op = std::make_shared<TableScan>(table_wrapper, less_than_(_int_column_0_non_nullable, 30));
+  auto table_scan_b_op = std::make_shared<TableScan>(table_wrapper, greater_than_(_int_column_0_non_nullable, 20));
+  auto union_unique_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+
+  execute_all({table_wrapper, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  const auto& output = union_unique_op->get_output();
+  EXPECT_TABLE_EQ_UNORDERED(output, table);
+  ASSERT_EQ(output->chunk_count(), 1);
+  const auto segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(
+      std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list()));
+}
+
 }  // namespace opossum
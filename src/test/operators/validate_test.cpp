@@ -14,6 +14,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -55,6 +57,12 @@ class OperatorsValidateTest : public BaseTest {
                                               const CommitID snapshot_commit_id) {
     return validate->_is_entire_chunk_visible(chunk, snapshot_commit_id);
   }
+
+  static bool forward_is_entire_chunk_invisible(std::shared_ptr<Validate> validate,
+                                                const std::shared_ptr<const Chunk>& chunk,
+                                                const CommitID snapshot_commit_id) {
+    return validate->_is_entire_chunk_invisible(chunk, snapshot_commit_id);
+  }
 };
 
 void OperatorsValidateTest::set_all_records_visible(Table& table) {
@@ -123,7 +131,7 @@ TEST_F(OperatorsValidateTest, ValidateAfterDelete) {
   auto table_scan = create_table_scan(_gt, ColumnID{0}, PredicateCondition::Equals, "13");
   table_scan->execute();
 
-  auto delete_op = std::make_shared<Delete>(table_scan);
+  auto delete_op = std::make_shared<Delete>(_table2_name, table_scan);
   delete_op->set_transaction_context(t2_context);
   delete_op->execute();
 
@@ -202,6 +210,89 @@ TEST_F(OperatorsValidateTest, ChunkEntirelyVisible) {
   EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
 }
 
+TEST_F(OperatorsValidateTest, ChunkEntirelyInvisibleWithHigherMinBeginCid) {
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>();
+  vs_int->append(4);
+  vs_int->append(5);
+  auto mvcc_data = std::make_shared<MvccData>(2, CommitID{3});
+  mvcc_data->set_begin_cid(1, CommitID{4});
+  auto chunk = std::make_shared<Chunk>(Segments{vs_int}, mvcc_data);
+  chunk->finalize();
+
+  auto validate = std::make_shared<Validate>(nullptr);
+
+  EXPECT_TRUE(forward_is_entire_chunk_invisible(validate, chunk, CommitID{2}));
+  EXPECT_FALSE(forward_is_entire_chunk_invisible(validate, chunk, CommitID{3}));
+}
+
+TEST_F(OperatorsValidateTest, ChunkEntirelyInvisibleWithInvalidatedRows) {
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>();
+  vs_int->append(4);
+  vs_int->append(5);
+  auto chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(2, CommitID{0}));
+  chunk->finalize();
+
+  auto validate = std::make_shared<Validate>(nullptr);
+
+  chunk->mvcc_data()->set_end_cid(0, CommitID{2});
+  chunk->increase_invalid_row_count(1);
+  EXPECT_FALSE(forward_is_entire_chunk_invisible(validate, chunk, CommitID{5}));
+
+  chunk->mvcc_data()->set_end_cid(1, CommitID{4});
+  chunk->increase_invalid_row_count(1);
+  EXPECT_EQ(chunk->mvcc_data()->max_end_cid(), CommitID{4});
+  EXPECT_FALSE(forward_is_entire_chunk_invisible(validate, chunk, CommitID{3}));
+  EXPECT_TRUE(forward_is_entire_chunk_invisible(validate, chunk, CommitID{4}));
+}
+
+TEST_F(OperatorsValidateTest, ChunkNotEntirelyInvisibleWithoutMinBeginCid) {
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>();
+  vs_int->append(4);
+  auto chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(1, CommitID{3}));
+  // We explicitly do not finalize the chunk, more rows could be added to it
+
+  auto validate = std::make_shared<Validate>(nullptr);
+
+  EXPECT_FALSE(forward_is_entire_chunk_invisible(validate, chunk, CommitID{2}));
+}
+
+TEST_F(OperatorsValidateTest, ValidateForwardsUnfilteredReferenceSegments) {
+  // If all positions of a reference segment are visible, neither the PosList nor the segments are rewritten
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  const auto pos_list = std::make_shared<RowIDPosList>(
+      std::initializer_list<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{1}, ChunkOffset{1}}});
+
+  Segments segments;
+  for (ColumnID column_id{0}; column_id < _test_table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(_test_table, column_id, pos_list));
+  }
+
+  auto reference_table = std::make_shared<Table>(_test_table->column_definitions(), TableType::References);
+  reference_table->append_chunk(segments);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto& output = validate->get_output();
+  ASSERT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), segments[0]);
+
+  // Once a position is invisible, a new PosList is created
+  pos_list->emplace_back(RowID{ChunkID{1}, ChunkOffset{0}});
+  auto validate_filtering = std::make_shared<Validate>(table_wrapper);
+  validate_filtering->set_transaction_context(context);
+  validate_filtering->execute();
+
+  const auto& filtered_output = validate_filtering->get_output();
+  ASSERT_EQ(filtered_output->row_count(), 2);
+  EXPECT_NE(filtered_output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), segments[0]);
+}
+
 TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   // If Validate has a reference table as input, it can usually optimize the evaluation of the MVCC data.
   // This optimization is possible, if a PosList of a reference segment references only one chunk.
@@ -238,4 +329,36 @@ TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateBitmapPosList) {
+  // Positions in a BitmapPosList are validated by clearing the bits of the invisible rows
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  const auto pos_list =
+      std::make_shared<BitmapPosList>(ChunkID{1}, ChunkOffset{2}, std::vector<BitmapPosList::Word>{0b11});
+
+  Segments segments;
+  for (ColumnID column_id{0}; column_id < _test_table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(_test_table, column_id, pos_list));
+  }
+
+  auto reference_table = std::make_shared<Table>(_test_table->column_definitions(), TableType::References);
+  reference_table->append_chunk(segments);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto& output = validate->get_output();
+  ASSERT_EQ(output->row_count(), 1);
+  const auto segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto pos_list_out = std::dynamic_pointer_cast<const BitmapPosList>(
+      std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list());
+  ASSERT_TRUE(pos_list_out);
+  EXPECT_EQ((*pos_list_out)[0], (RowID{ChunkID{1}, ChunkOffset{1}}));
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, 0), 11);
+}
+
 }  // namespace opossum
@@ -546,7 +546,7 @@ TEST_F(ColumnPruningRuleTest, DoNotPruneDeleteInputs) {
 
   // clang-format off
   const auto lqp =
-  DeleteNode::make(
+  DeleteNode::make("a",
     PredicateNode::make(greater_than_(a, 5),
       node_a));
   // clang-format on
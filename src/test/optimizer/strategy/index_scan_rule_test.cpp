@@ -177,4 +177,47 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanForPrimaryKeyLookup) {
+  table->add_soft_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes);
+  table->create_primary_key_index();
+
+  // The predicates on the primary key columns are merged into a single PredicateNode directly above the table,
+  // independently of the statistics
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(5, b),
+    PredicateNode::make(greater_than_(c, 3),
+      PredicateNode::make(equals_(a, 4),
+        stored_table_node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+
+  ASSERT_EQ(actual_lqp->type, LQPNodeType::Predicate);
+  EXPECT_EQ(*std::static_pointer_cast<PredicateNode>(actual_lqp)->predicate(), *greater_than_(c, 3));
+
+  const auto index_scan_node = std::dynamic_pointer_cast<PredicateNode>(actual_lqp->left_input());
+  ASSERT_TRUE(index_scan_node);
+  EXPECT_EQ(index_scan_node->scan_type, ScanType::IndexScan);
+  EXPECT_EQ(*index_scan_node->predicate(), *and_(equals_(a, 4), equals_(b, 5)));
+  EXPECT_EQ(index_scan_node->left_input(), stored_table_node);
+}
+
+TEST_F(IndexScanRuleTest, NoIndexScanForPartialPrimaryKey) {
+  table->add_soft_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes);
+  table->create_primary_key_index();
+
+  auto predicate_node_0 = PredicateNode::make(equals_(a, 4));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(less_than_(b, 5));
+  predicate_node_1->set_left_input(predicate_node_0);
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(actual_lqp, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->left_input(), predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
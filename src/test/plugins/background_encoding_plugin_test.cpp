@@ -0,0 +1,257 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "../../plugins/background_encoding_plugin.hpp"
+#include "../utils/plugin_test_utils.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class BackgroundEncodingPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  // Inserts the rows (i, "i") for i in [begin, end) into the test table and returns the transaction context, which
+  // is not yet committed
+  std::shared_ptr<TransactionContext> _insert_rows(const int32_t begin, const int32_t end) {
+    auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+    for (auto value = begin; value < end; ++value) {
+      values->append({value, pmr_string{std::to_string(value)}});
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return transaction_context;
+  }
+
+  static size_t _run(BackgroundEncodingPlugin& plugin) { return plugin._run(); }
+
+  static size_t _max_chunks_per_run(const BackgroundEncodingPlugin& plugin) { return plugin._max_chunks_per_run; }
+
+  static void _set_max_chunks_per_run(BackgroundEncodingPlugin& plugin, const size_t max_chunks_per_run) {
+    plugin._max_chunks_per_run = max_chunks_per_run;
+  }
+
+  static EncodingType _default_encoding_type(const BackgroundEncodingPlugin& plugin) {
+    return plugin._default_encoding_type;
+  }
+
+  static void _set_default_encoding_type(BackgroundEncodingPlugin& plugin, const EncodingType encoding_type) {
+    plugin._default_encoding_type = encoding_type;
+  }
+
+  void _expect_values(const ChunkID chunk_id, const int32_t first_value) const {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto value = first_value + static_cast<int32_t>(chunk_offset);
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{value});
+      EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{pmr_string{std::to_string(value)}});
+    }
+  }
+
+  void _expect_encoding(const ChunkID chunk_id, const EncodingType encoding_type) const {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(column_id)).encoding_type, encoding_type);
+    }
+  }
+
+  const std::string _table_name{"background_encoding_table"};
+  const TableColumnDefinitions _column_definitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+  static constexpr auto _chunk_size = ChunkOffset{4};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(BackgroundEncodingPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libBackgroundEncodingPlugin"));
+
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("BackgroundEncodingPlugin.idle_delay_ms"));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("BackgroundEncodingPlugin.max_chunks_per_run"));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("BackgroundEncodingPlugin.default_encoding"));
+  EXPECT_TRUE(Hyrise::get().meta_table_manager.has_table("meta_background_encoding"));
+  EXPECT_EQ(Hyrise::get().meta_table_manager.generate_table("meta_background_encoding")->column_count(), 4);
+
+  pm.unload_plugin("BackgroundEncodingPlugin");
+
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("BackgroundEncodingPlugin.idle_delay_ms"));
+  EXPECT_FALSE(Hyrise::get().meta_table_manager.has_table("meta_background_encoding"));
+}
+
+TEST_F(BackgroundEncodingPluginTest, EncodesFullChunks) {
+  _insert_rows(0, 10)->commit();
+  ASSERT_EQ(_table->chunk_count(), 3);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+
+  auto plugin = BackgroundEncodingPlugin{};
+  EXPECT_EQ(_run(plugin), 2);
+
+  // The full chunks are finalized and encoded, the last chunk is still filled by inserts
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  _expect_encoding(ChunkID{0}, EncodingType::Dictionary);
+  _expect_encoding(ChunkID{1}, EncodingType::Dictionary);
+  _expect_encoding(ChunkID{2}, EncodingType::Unencoded);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->pruning_statistics());
+  _expect_values(ChunkID{0}, 0);
+  _expect_values(ChunkID{1}, 4);
+
+  const auto status = plugin.table_encoding_status().at(_table_name);
+  EXPECT_EQ(status.encoded_chunk_count, 2);
+  EXPECT_EQ(status.pending_chunk_count, 0);
+
+  // Nothing left to do
+  EXPECT_EQ(_run(plugin), 0);
+
+  // Further inserts fill the last chunk, which is encoded once it is full
+  _insert_rows(10, 12)->commit();
+  EXPECT_EQ(_run(plugin), 1);
+  _expect_encoding(ChunkID{2}, EncodingType::Dictionary);
+  _expect_values(ChunkID{2}, 8);
+  EXPECT_EQ(plugin.table_encoding_status().at(_table_name).encoded_chunk_count, 3);
+}
+
+TEST_F(BackgroundEncodingPluginTest, EncodesPartialChunksBeforeLastChunk) {
+  const auto transaction_context = _insert_rows(0, 2);
+
+  // Append an immutable chunk (e.g., a chunk compacted by the MvccDeletePlugin). Thus, no rows are appended to the
+  // partially filled first chunk anymore.
+  auto segments = Segments{std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{2}),
+                           std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{pmr_string{"2"}})};
+  _table->append_chunk(segments, std::make_shared<MvccData>(1, CommitID{0}));
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_chunks(_table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  // The chunk waits for its inserts to finish
+  auto plugin = BackgroundEncodingPlugin{};
+  EXPECT_EQ(_run(plugin), 0);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_mutable());
+
+  transaction_context->commit();
+  EXPECT_EQ(_run(plugin), 1);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+  _expect_encoding(ChunkID{0}, EncodingType::Dictionary);
+  _expect_values(ChunkID{0}, 0);
+}
+
+TEST_F(BackgroundEncodingPluginTest, UncommittedInsertsDelayEncoding) {
+  const auto transaction_context = _insert_rows(0, 8);
+  ASSERT_EQ(_table->chunk_count(), 2);
+
+  auto plugin = BackgroundEncodingPlugin{};
+  EXPECT_EQ(_run(plugin), 0);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_EQ(plugin.table_encoding_status().at(_table_name).pending_chunk_count, 2);
+
+  // Rolled back rows do not have to be encoded, but they do not block the encoding either
+  transaction_context->rollback();
+  EXPECT_EQ(_run(plugin), 2);
+  _expect_encoding(ChunkID{0}, EncodingType::Dictionary);
+  EXPECT_EQ(plugin.table_encoding_status().at(_table_name).pending_chunk_count, 0);
+}
+
+TEST_F(BackgroundEncodingPluginTest, UsesEncodingOfExistingChunks) {
+  // The first chunk is finalized when the fifth row is appended
+  for (auto value = int32_t{0}; value < 5; ++value) {
+    _table->append({value, pmr_string{std::to_string(value)}});
+  }
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::RunLength});
+  for (auto value = int32_t{5}; value < 8; ++value) {
+    _table->append({value, pmr_string{std::to_string(value)}});
+  }
+
+  auto plugin = BackgroundEncodingPlugin{};
+  EXPECT_EQ(_run(plugin), 1);
+  _expect_encoding(ChunkID{1}, EncodingType::RunLength);
+  _expect_values(ChunkID{1}, 4);
+}
+
+TEST_F(BackgroundEncodingPluginTest, MaxChunksPerRun) {
+  _insert_rows(0, 12)->commit();
+
+  auto plugin = BackgroundEncodingPlugin{};
+  _set_max_chunks_per_run(plugin, 1);
+
+  // All full chunks are finalized right away, but only one of them is encoded per run. The pruning statistics are
+  // generated when a chunk is finalized.
+  EXPECT_EQ(_run(plugin), 1);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->pruning_statistics());
+  _expect_encoding(ChunkID{0}, EncodingType::Dictionary);
+  _expect_encoding(ChunkID{1}, EncodingType::Unencoded);
+  EXPECT_EQ(plugin.table_encoding_status().at(_table_name).pending_chunk_count, 2);
+
+  // Chunks that were finalized by the plugin are not mistaken for the table's configured encoding
+  EXPECT_EQ(_run(plugin), 1);
+  _expect_encoding(ChunkID{1}, EncodingType::Dictionary);
+  EXPECT_EQ(_run(plugin), 1);
+  _expect_encoding(ChunkID{2}, EncodingType::Dictionary);
+  EXPECT_EQ(_run(plugin), 0);
+  EXPECT_EQ(plugin.table_encoding_status().at(_table_name).encoded_chunk_count, 3);
+}
+
+TEST_F(BackgroundEncodingPluginTest, Settings) {
+  auto plugin = BackgroundEncodingPlugin{};
+  plugin.start();
+
+  auto& settings_manager = Hyrise::get().settings_manager;
+  settings_manager.get_setting("BackgroundEncodingPlugin.max_chunks_per_run")->set("7");
+  EXPECT_EQ(_max_chunks_per_run(plugin), 7);
+  EXPECT_THROW(settings_manager.get_setting("BackgroundEncodingPlugin.max_chunks_per_run")->set("-1"),
+               std::logic_error);
+  EXPECT_THROW(settings_manager.get_setting("BackgroundEncodingPlugin.max_chunks_per_run")->set("3x"),
+               std::logic_error);
+  EXPECT_EQ(_max_chunks_per_run(plugin), 7);
+
+  settings_manager.get_setting("BackgroundEncodingPlugin.default_encoding")->set("LZ4");
+  EXPECT_EQ(_default_encoding_type(plugin), EncodingType::LZ4);
+  EXPECT_THROW(settings_manager.get_setting("BackgroundEncodingPlugin.default_encoding")->set("Unknown"),
+               std::logic_error);
+  EXPECT_EQ(settings_manager.get_setting("BackgroundEncodingPlugin.default_encoding")->get(), "LZ4");
+
+  settings_manager.get_setting("BackgroundEncodingPlugin.idle_delay_ms")->set("10");
+  EXPECT_EQ(settings_manager.get_setting("BackgroundEncodingPlugin.idle_delay_ms")->get(), "10");
+  EXPECT_THROW(settings_manager.get_setting("BackgroundEncodingPlugin.idle_delay_ms")->set(""), std::logic_error);
+  EXPECT_EQ(settings_manager.get_setting("BackgroundEncodingPlugin.idle_delay_ms")->get(), "10");
+
+  plugin.stop();
+}
+
+TEST_F(BackgroundEncodingPluginTest, DefaultEncoding) {
+  _insert_rows(0, 4)->commit();
+
+  auto plugin = BackgroundEncodingPlugin{};
+  _set_default_encoding_type(plugin, EncodingType::FrameOfReference);
+  EXPECT_EQ(_run(plugin), 1);
+
+  // FrameOfReference does not support strings, so the string column is dictionary-encoded
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{0})).encoding_type, EncodingType::FrameOfReference);
+  EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{1})).encoding_type, EncodingType::Dictionary);
+  _expect_values(ChunkID{0}, 0);
+}
+
+}  // namespace opossum
@@ -182,7 +182,7 @@ TEST_F(MvccDeletePluginSystemTest, CheckPlugin) {
   // (6) Verify the correctness of the logical delete operation.
   {
     // Updates started from row 220 on. So chunk 2 contained 20 rows still valid before its logical deletion.
-    // These rows must have been invalidated and reinserted to the table during the logical delete operation
+    // These rows must have been invalidated and copied into a new chunk during the logical delete operation
     // by the MvccDeletePlugin.
     validate_table();
   }
@@ -15,6 +15,9 @@
 #include "operators/table_scan.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
@@ -56,17 +59,26 @@ class MvccDeletePluginTest : public BaseTest {
 
     transaction_context->commit();
   }
-  static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id) {
+  static bool _try_compact_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids) {
     auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
-    return MvccDeletePlugin::_try_logical_delete(table_name, chunk_id, transaction_context);
+    return MvccDeletePlugin::_try_compact_chunks(table_name, chunk_ids, transaction_context);
   }
-  static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
+  static bool _try_compact_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
                                   std::shared_ptr<TransactionContext> transaction_context) {
-    return MvccDeletePlugin::_try_logical_delete(table_name, chunk_id, transaction_context);
+    return MvccDeletePlugin::_try_compact_chunks(table_name, chunk_ids, transaction_context);
+  }
+  static std::vector<ChunkID> _logical_delete(MvccDeletePlugin& plugin, const std::string& table_name,
+                                              const CommitID min_commits_since_invalidation) {
+    plugin._min_commits_since_invalidation = min_commits_since_invalidation;
+    return plugin._logical_delete(table_name, Hyrise::get().storage_manager.get_table(table_name));
   }
   static void _delete_chunk_physically(const std::string& table_name, ChunkID chunk_id) {
     MvccDeletePlugin::_delete_chunk_physically(Hyrise::get().storage_manager.get_table(table_name), chunk_id);
   }
+  static void _remove_invalidated_rows_from_primary_key_index(const std::string& table_name) {
+    MvccDeletePlugin::_remove_invalidated_rows_from_primary_key_index(
+        *Hyrise::get().storage_manager.get_table(table_name));
+  }
 
   static int _get_int_value_from_table(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
                                        const ColumnID column_id, const ChunkOffset chunk_offset) {
@@ -87,15 +99,14 @@ TEST_F(MvccDeletePluginTest, LoadUnloadPlugin) {
 }
 
 /**
- * This test checks the logical delete. All values in the table are incremented to
- * generate three invalidated rows and create a second chunk. Before the logical delete
- * is performed, the first chunk contains a mix of valid and invalidated lines. After
- * the logical delete, all its rows are invalidated and a cleanup_commit_id was set,
- * which is used for the physical delete. All values are now located in the
- * second chunk. When fetching the table, the fully invalidated chunk is not
- * visible anymore for transactions.
+ * This test checks the compaction of a single chunk. All values in the table are incremented to
+ * generate three invalidated rows and create a second chunk. Before the compaction is performed,
+ * the second chunk contains a mix of valid and invalidated lines. After the compaction, all its
+ * rows are invalidated and a cleanup_commit_id was set, which is used for the physical delete.
+ * The valid row has been copied into a new, immutable chunk at the end of the table. The previous last chunk is
+ * finalized, so that no mutable chunk is left behind.
  */
-TEST_F(MvccDeletePluginTest, LogicalDelete) {
+TEST_F(MvccDeletePluginTest, CompactChunk) {
   const auto table = Hyrise::get().storage_manager.get_table(_table_name);
 
   // Prepare test
@@ -104,19 +115,9 @@ TEST_F(MvccDeletePluginTest, LogicalDelete) {
   // --- Chunk 0 is already immutable due to load_table()
   EXPECT_EQ(table->chunk_count(), 1);
   EXPECT_EQ(table->row_count(), 3);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{0}, ColumnID{0}, ChunkOffset{0}), 1);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{0}, ColumnID{0}, ChunkOffset{1}), 2);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{0}, ColumnID{0}, ChunkOffset{2}), 3);
 
   // --- Invalidate records – so that chunk 0 is completely invalidated
   _increment_all_values_by_one();
-  // --- Check table structure (underscores represent invalidated records)
-  // --- Expected: _, _, _ | 2, 3, 4
-  EXPECT_EQ(table->chunk_count(), 2);
-  EXPECT_EQ(table->row_count(), 6);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{1}, ColumnID{0}, ChunkOffset{0}), 2);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{1}, ColumnID{0}, ChunkOffset{1}), 3);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{1}, ColumnID{0}, ChunkOffset{2}), 4);
 
   // --- Invalidate records - so that chunk 1 is completely invalidated except for one record
   _increment_all_values_by_one();
@@ -124,39 +125,181 @@ TEST_F(MvccDeletePluginTest, LogicalDelete) {
   EXPECT_EQ(table->chunk_count(), 3);
   EXPECT_EQ(table->row_count(), 9);
   EXPECT_EQ(_get_int_value_from_table(table, ChunkID{1}, ColumnID{0}, ChunkOffset{3}), 3);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{2}, ColumnID{0}, ChunkOffset{0}), 4);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{2}, ColumnID{0}, ChunkOffset{1}), 5);
 
   // There should be no cleanup-commit-id set yet
-  EXPECT_FALSE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
   EXPECT_FALSE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
-  EXPECT_FALSE(table->get_chunk(ChunkID{2})->get_cleanup_commit_id());
-
-  // Delete chunk 0 logically
-  EXPECT_TRUE(_try_logical_delete(_table_name, ChunkID{0}));
-  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
 
-  // Delete chunk 1 logically
-  EXPECT_TRUE(_try_logical_delete(_table_name, ChunkID{1}));
+  // Compact chunk 1
+  EXPECT_TRUE(_try_compact_chunks(_table_name, {ChunkID{1}}));
   EXPECT_TRUE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
-  // The logical delete of chunk 1 should have changed the table structure
-  // --- Expected: _, _, _ | _, _, _, _ | 4, 5, 3
-  EXPECT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->invalid_row_count(), 4);
+
+  // The compaction should have appended a new chunk
+  // --- Expected: _, _, _ | _, _, _, _ | 4, 5 | 3
+  EXPECT_EQ(table->chunk_count(), 4);
   EXPECT_EQ(table->row_count(), 10);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{2}, ColumnID{0}, ChunkOffset{0}), 4);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{2}, ColumnID{0}, ChunkOffset{1}), 5);
-  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{2}, ColumnID{0}, ChunkOffset{2}), 3);
-
-  // --- Check whether GetTable filters out logically deleted chunks
-  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
-  auto get_table = std::make_shared<GetTable>(_table_name);
-  get_table->set_transaction_context(transaction_context);
-  get_table->execute();
-  EXPECT_EQ(get_table->get_output()->chunk_count(), 1);
-  EXPECT_EQ(get_table->get_output()->row_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->size(), 1);
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->is_mutable());
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{3}, ColumnID{0}, ChunkOffset{0}), 3);
+
+  // The previous last chunk is not touched by the compaction (see BackgroundEncodingPlugin)
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->is_mutable());
+
+  // --- Check whether new transactions see each valid row exactly once
+  auto pipeline = SQLPipelineBuilder{"SELECT a FROM " + _table_name + " ORDER BY a"}.create_pipeline();
+  const auto [status, result_table] = pipeline.get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  ASSERT_EQ(result_table->row_count(), 3);
+  EXPECT_EQ(result_table->get_value<int32_t>(ColumnID{0}, 0), 3);
+  EXPECT_EQ(result_table->get_value<int32_t>(ColumnID{0}, 2), 5);
+
+  // --- Rows inserted later are neither appended to the compacted chunk nor to the previous last chunk
+  SQLPipelineBuilder{"INSERT INTO " + _table_name + " VALUES (6)"}.create_pipeline().get_result_table();
+  ASSERT_EQ(table->chunk_count(), 5);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 2);
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->size(), 1);
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->is_mutable());
+  EXPECT_EQ(table->get_chunk(ChunkID{4})->size(), 1);
+  EXPECT_TRUE(table->get_chunk(ChunkID{4})->is_mutable());
+}
+
+/**
+ * Rows that are being inserted into the last chunk do not block the compaction. They are committed to the previous
+ * last chunk, while later inserts go to a new chunk.
+ */
+TEST_F(MvccDeletePluginTest, CompactChunkDoesNotWaitForInsertsIntoLastChunk) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  _increment_all_values_by_one();
+  _increment_all_values_by_one();
+  ASSERT_EQ(table->chunk_count(), 3);
+
+  const auto insert_transaction_context =
+      Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  SQLPipelineBuilder{"INSERT INTO " + _table_name + " VALUES (6)"}
+      .with_transaction_context(insert_transaction_context)
+      .create_pipeline()
+      .get_result_table();
+
+  EXPECT_TRUE(_try_compact_chunks(_table_name, {ChunkID{1}}));
+  ASSERT_EQ(table->chunk_count(), 4);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 3);
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->is_mutable());
+
+  insert_transaction_context->commit();
+  SQLPipelineBuilder{"INSERT INTO " + _table_name + " VALUES (7)"}.create_pipeline().get_result_table();
+  ASSERT_EQ(table->chunk_count(), 5);
+  EXPECT_EQ(table->get_chunk(ChunkID{4})->size(), 1);
+
+  auto pipeline = SQLPipelineBuilder{"SELECT a FROM " + _table_name}.create_pipeline();
+  EXPECT_EQ(pipeline.get_result_table().second->row_count(), 5);
+}
+
+TEST_F(MvccDeletePluginTest, Settings) {
+  auto plugin = MvccDeletePlugin{};
+  plugin.start();
+
+  auto& settings_manager = Hyrise::get().settings_manager;
+  const auto threshold_setting = settings_manager.get_setting("MvccDeletePlugin.invalidated_rows_threshold");
+  threshold_setting->set("0.5");
+  EXPECT_EQ(threshold_setting->get(), "0.5");
+  EXPECT_THROW(threshold_setting->set("1.5"), std::logic_error);
+  EXPECT_THROW(threshold_setting->set("0.5x"), std::logic_error);
+  EXPECT_THROW(threshold_setting->set("half"), std::logic_error);
+  EXPECT_EQ(threshold_setting->get(), "0.5");
+
+  const auto min_commits_setting = settings_manager.get_setting("MvccDeletePlugin.min_commits_since_invalidation");
+  min_commits_setting->set("3");
+  EXPECT_EQ(min_commits_setting->get(), "3");
+  EXPECT_THROW(min_commits_setting->set("-1"), std::logic_error);
+  EXPECT_THROW(min_commits_setting->set(""), std::logic_error);
+  EXPECT_THROW(min_commits_setting->set("99999999999"), std::logic_error);
+
+  const auto idle_delay_setting = settings_manager.get_setting("MvccDeletePlugin.idle_delay_ms");
+  idle_delay_setting->set("10");
+  EXPECT_THROW(idle_delay_setting->set("10ms"), std::logic_error);
+  EXPECT_EQ(idle_delay_setting->get(), "10");
+
+  plugin.stop();
+}
+
+/**
+ * The compaction is atomic: Transactions that started before it see the old rows, transactions that started
+ * afterwards see the copied rows.
+ */
+TEST_F(MvccDeletePluginTest, CompactChunkIsAtomic) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  _increment_all_values_by_one();
+  _increment_all_values_by_one();
+
+  const auto old_transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  EXPECT_TRUE(_try_compact_chunks(_table_name, {ChunkID{1}}));
+
+  const auto count_visible_rows = [&](const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  // GetTable skips logically deleted chunks only for transactions that started after the cleanup commit
+  EXPECT_EQ(count_visible_rows(old_transaction_context), 3);
+  EXPECT_EQ(count_visible_rows(Hyrise::get().transaction_manager.new_transaction_context()), 3);
+}
+
+/**
+ * Neighbouring sparse chunks are merged into a single encoded chunk, fully invalidated chunks are only marked for the
+ * physical delete.
+ */
+TEST_F(MvccDeletePluginTest, LogicalDeleteMergesNeighbouringChunks) {
+  const auto table_name = std::string{"mergeTestTable"};
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             _chunk_size, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 20; ++value) {
+    table->append({value});
+  }
+  // The last chunk is still mutable
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}},
+                              SegmentEncodingSpec{EncodingType::RunLength});
+  Hyrise::get().storage_manager.add_table(table_name, table);
+
+  // --- Expected: _, 1, _, _ | _, 5, _, _ | _, _, _, _ | 12, 13, 14, 15 | 16, 17, 18, 19
+  SQLPipelineBuilder{"DELETE FROM " + table_name + " WHERE (a < 12 AND a <> 1 AND a <> 5) OR a > 16"}
+      .create_pipeline()
+      .get_result_table();
+
+  auto plugin = MvccDeletePlugin{};
+
+  // The chunks were modified by the most recent commit, so they are still too hot to be compacted
+  EXPECT_TRUE(_logical_delete(plugin, table_name, MvccDeletePlugin::DELETE_THRESHOLD_LAST_COMMIT).empty());
+  EXPECT_EQ(table->chunk_count(), 5);
+
+  const auto deleted_chunk_ids = _logical_delete(plugin, table_name, CommitID{0});
+  EXPECT_EQ(deleted_chunk_ids, (std::vector<ChunkID>{ChunkID{2}, ChunkID{0}, ChunkID{1}}));
+  for (const auto chunk_id : deleted_chunk_ids) {
+    EXPECT_TRUE(table->get_chunk(chunk_id)->get_cleanup_commit_id());
+  }
+
+  // Chunk 3 is not sparse and chunk 4 is the last chunk, so they are not compacted. Chunk 4 is left as it is.
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->get_cleanup_commit_id());
+  EXPECT_FALSE(table->get_chunk(ChunkID{4})->get_cleanup_commit_id());
+  EXPECT_TRUE(table->get_chunk(ChunkID{4})->is_mutable());
+
+  // --- Expected: ... | 1, 5
+  ASSERT_EQ(table->chunk_count(), 6);
+  const auto compacted_chunk = table->get_chunk(ChunkID{5});
+  EXPECT_EQ(compacted_chunk->size(), 2);
+  EXPECT_FALSE(compacted_chunk->is_mutable());
+  EXPECT_EQ(get_segment_encoding_spec(compacted_chunk->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::RunLength);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{5}, ColumnID{0}, ChunkOffset{0}), 1);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{5}, ColumnID{0}, ChunkOffset{1}), 5);
 }
 
-TEST_F(MvccDeletePluginTest, LogicalDeleteConflicts) {
+TEST_F(MvccDeletePluginTest, CompactChunksConflicts) {
   const auto table = Hyrise::get().storage_manager.get_table(_table_name);
 
   // Prepare test
@@ -175,31 +318,33 @@ TEST_F(MvccDeletePluginTest, LogicalDeleteConflicts) {
     (void)conflicting_sql_pipeline.get_result_table();
   }
 
-  EXPECT_FALSE(_try_logical_delete(_table_name, ChunkID{1}, transaction_context));
+  EXPECT_FALSE(_try_compact_chunks(_table_name, {ChunkID{1}}, transaction_context));
   EXPECT_EQ(transaction_context->phase(), TransactionPhase::RolledBack);
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_EQ(table->chunk_count(), 3);
 }
 
 /**
  * This test checks the physical delete of the MvccDeletePlugin. At first,
- * the logical delete is performed as described in the former test. Afterwards,
- * the first chunk has a cleanup_commit_id and can be deleted physically. After
+ * the compaction is performed as described in the former test. Afterwards,
+ * the second chunk has a cleanup_commit_id and can be deleted physically. After
  * the physical delete, the table returns a nullptr when getting the chunk.
  */
 TEST_F(MvccDeletePluginTest, PhysicalDelete) {
   const auto table = Hyrise::get().storage_manager.get_table(_table_name);
 
   // Prepare the test
-  ChunkID chunk_to_delete_id{0};
-  const auto& chunk = table->get_chunk(chunk_to_delete_id);
+  ChunkID chunk_to_delete_id{1};
   // --- invalidate records
   _increment_all_values_by_one();
+  _increment_all_values_by_one();
   // --- delete chunk logically
-  EXPECT_FALSE(chunk->get_cleanup_commit_id());
-  EXPECT_TRUE(_try_logical_delete(_table_name, chunk_to_delete_id));
+  EXPECT_FALSE(table->get_chunk(chunk_to_delete_id)->get_cleanup_commit_id());
+  EXPECT_TRUE(_try_compact_chunks(_table_name, {chunk_to_delete_id}));
 
   // Run the test
   // --- check pre-conditions
-  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(table->get_chunk(chunk_to_delete_id)->get_cleanup_commit_id());
 
   // --- run physical delete
   _delete_chunk_physically(_table_name, chunk_to_delete_id);
@@ -208,4 +353,31 @@ TEST_F(MvccDeletePluginTest, PhysicalDelete) {
   EXPECT_TRUE(table->get_chunk(chunk_to_delete_id) == nullptr);
 }
 
+/**
+ * Invalidated rows are removed from the PrimaryKeyIndex once no active transaction can see them anymore.
+ */
+TEST_F(MvccDeletePluginTest, RemoveInvalidatedRowsFromPrimaryKeyIndex) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  table->add_soft_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table->create_primary_key_index();
+  const auto& primary_key_index = table->primary_key_index();
+
+  // --- Expected: 1, 2, 3 | 2, 3, 4 with the first three rows invalidated
+  auto old_transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  _increment_all_values_by_one();
+  EXPECT_EQ(primary_key_index->lookup({1}).size(), 1);
+  EXPECT_EQ(primary_key_index->lookup({2}).size(), 2);
+
+  // The old transaction still sees the invalidated rows
+  _remove_invalidated_rows_from_primary_key_index(_table_name);
+  EXPECT_EQ(primary_key_index->lookup({1}).size(), 1);
+  EXPECT_EQ(primary_key_index->lookup({2}).size(), 2);
+
+  old_transaction_context = nullptr;
+  _remove_invalidated_rows_from_primary_key_index(_table_name);
+  EXPECT_TRUE(primary_key_index->lookup({1}).empty());
+  EXPECT_EQ(primary_key_index->lookup({2}).size(), 1);
+  EXPECT_EQ(primary_key_index->lookup({4}).size(), 1);
+}
+
 }  // namespace opossum
@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/operator_pipeline.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 20; ++value) {
+      // Only some of the chunks contain NULL values
+      _table->append({value, value % 4 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value * 0.5f}});
+    }
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+
+    // Invalidate a row so that Validate has something to do
+    SQLPipelineBuilder{"DELETE FROM table_a WHERE a = 7"}.create_pipeline().get_result_table();
+  }
+
+  // Returns the chain GetTable -> Validate -> TableScan -> Projection
+  std::vector<std::shared_ptr<AbstractOperator>> _create_operators() {
+    const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    const auto b = pqp_column_(ColumnID{1}, DataType::Float, true, "b");
+
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan = std::make_shared<TableScan>(validate, greater_than_equals_(a, 5));
+    const auto projection = std::make_shared<Projection>(table_scan, expression_vector(add_(a, 1), b));
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    projection->set_transaction_context_recursively(transaction_context);
+    _transaction_contexts.emplace_back(transaction_context);
+
+    return {get_table, validate, table_scan, projection};
+  }
+
+  std::shared_ptr<Table> _table;
+  std::vector<std::shared_ptr<TransactionContext>> _transaction_contexts;
+};
+
+TEST_F(OperatorPipelineTest, IsPipelineable) {
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto get_table = std::make_shared<GetTable>("table_a");
+
+  EXPECT_FALSE(OperatorPipeline::is_pipelineable(*get_table));
+  EXPECT_TRUE(OperatorPipeline::is_pipelineable(Validate{get_table}));
+  EXPECT_TRUE(OperatorPipeline::is_pipelineable(TableScan{get_table, equals_(a, 1)}));
+  EXPECT_TRUE(OperatorPipeline::is_pipelineable(Projection{get_table, expression_vector(a)}));
+  EXPECT_FALSE(OperatorPipeline::is_pipelineable(AggregateHash{get_table, {sum_(a)}, {ColumnID{0}}}));
+
+  // The left input of a JoinHash is probed morsel-wise, unless it might be the build side or spilled to disk
+  const auto join_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  EXPECT_TRUE(OperatorPipeline::is_pipelineable(JoinHash{get_table, get_table, JoinMode::Inner, join_predicate}));
+  EXPECT_TRUE(OperatorPipeline::is_pipelineable(JoinHash{get_table, get_table, JoinMode::Semi, join_predicate}));
+  EXPECT_FALSE(OperatorPipeline::is_pipelineable(JoinHash{get_table, get_table, JoinMode::Right, join_predicate}));
+  auto join_hash_with_memory_budget = JoinHash{get_table, get_table, JoinMode::Inner, join_predicate};
+  join_hash_with_memory_budget.set_memory_budget_recursively(1'000'000);
+  EXPECT_FALSE(OperatorPipeline::is_pipelineable(join_hash_with_memory_budget));
+
+  // Excluded chunks would refer to the wrong chunks of the morsels
+  auto table_scan_with_excluded_chunks = TableScan{get_table, equals_(a, 1)};
+  table_scan_with_excluded_chunks.excluded_chunk_ids = {ChunkID{0}};
+  EXPECT_FALSE(OperatorPipeline::is_pipelineable(table_scan_with_excluded_chunks));
+
+  // Subqueries would be executed for every morsel
+  const auto subquery = pqp_subquery_(std::make_shared<GetTable>("table_a"), DataType::Int, false);
+  EXPECT_FALSE(OperatorPipeline::is_pipelineable(TableScan{get_table, equals_(a, subquery)}));
+  EXPECT_FALSE(OperatorPipeline::is_pipelineable(Projection{get_table, expression_vector(add_(a, subquery))}));
+}
+
+TEST_F(OperatorPipelineTest, RequiresChainOfPipelineableOperators) {
+  const auto operators = _create_operators();
+  EXPECT_THROW(OperatorPipeline{{}}, std::logic_error);
+  EXPECT_THROW((OperatorPipeline{{operators[0], operators[1]}}), std::logic_error);
+  EXPECT_THROW((OperatorPipeline{{operators[1], operators[3]}}), std::logic_error);
+}
+
+TEST_F(OperatorPipelineTest, ExecuteMorselWise) {
+  const auto materialized_operators = _create_operators();
+  for (const auto& op : materialized_operators) {
+    op->execute();
+  }
+  const auto expected_table = materialized_operators.back()->get_output();
+
+  const auto operators = _create_operators();
+  operators[0]->execute();
+  auto pipeline = OperatorPipeline{{operators[1], operators[2], operators[3]}};
+  pipeline.execute();
+
+  const auto& result_table = operators[3]->get_output();
+  ASSERT_TRUE(result_table);
+  EXPECT_TABLE_EQ_ORDERED(result_table, expected_table);
+  EXPECT_EQ(result_table->row_count(), 14);
+  EXPECT_TRUE(result_table->column_is_nullable(ColumnID{1}));
+
+  // Only the output of the last operator is materialized, but all operators report their performance data
+  EXPECT_FALSE(operators[1]->get_output());
+  EXPECT_FALSE(operators[2]->get_output());
+  for (auto operator_index = size_t{1}; operator_index < operators.size(); ++operator_index) {
+    const auto& performance_data = operators[operator_index]->performance_data();
+    EXPECT_TRUE(performance_data.executed);
+    EXPECT_EQ(performance_data.has_output, operator_index + 1 == operators.size());
+    EXPECT_EQ(performance_data.output_row_count,
+              materialized_operators[operator_index]->performance_data().output_row_count);
+  }
+}
+
+TEST_F(OperatorPipelineTest, OutputReferencesInputTable) {
+  // The outputs of Validate -> TableScan pipelines are consumed by operators that take the referenced table from the
+  // first chunk of their input and use it for all chunks (e.g., JoinHash and UnionPositions). Thus, all chunks of the
+  // pipeline's output have to reference the input table with its ChunkIDs.
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  const auto execute_operators = [&](const bool pipelined) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+
+    auto table_scans = std::vector<std::shared_ptr<AbstractOperator>>{};
+    for (const auto& predicate : {greater_than_equals_(a, 5), less_than_(a, 15)}) {
+      const auto validate = std::make_shared<Validate>(get_table);
+      const auto table_scan = std::make_shared<TableScan>(validate, predicate);
+
+      const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+      table_scan->set_transaction_context_recursively(transaction_context);
+      _transaction_contexts.emplace_back(transaction_context);
+
+      if (pipelined) {
+        OperatorPipeline{{validate, table_scan}}.execute();
+
+        const auto& output = *table_scan->get_output();
+        EXPECT_GT(output.chunk_count(), 1);
+        for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+          const auto segment = output.get_chunk(chunk_id)->get_segment(ColumnID{0});
+          EXPECT_EQ(static_cast<const ReferenceSegment&>(*segment).referenced_table(), get_table->get_output());
+        }
+      } else {
+        validate->execute();
+        table_scan->execute();
+      }
+      table_scans.emplace_back(table_scan);
+    }
+
+    const auto join_hash =
+        std::make_shared<JoinHash>(table_scans[0], table_scans[1], JoinMode::Inner,
+                                   OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+    join_hash->execute();
+
+    const auto union_positions = std::make_shared<UnionPositions>(table_scans[0], table_scans[1]);
+    union_positions->execute();
+
+    return std::make_pair(join_hash->get_output(), union_positions->get_output());
+  };
+
+  const auto [expected_join_table, expected_union_table] = execute_operators(false);
+  const auto [join_table, union_table] = execute_operators(true);
+
+  // The rows 5 to 14, except for the deleted row 7, are in both inputs
+  EXPECT_EQ(join_table->row_count(), 9);
+  EXPECT_TABLE_EQ_UNORDERED(join_table, expected_join_table);
+  EXPECT_EQ(union_table->row_count(), 19);
+  EXPECT_TABLE_EQ_UNORDERED(union_table, expected_union_table);
+}
+
+TEST_F(OperatorPipelineTest, ExecuteJoinMorselWise) {
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+
+    const auto execute_operators = [&](const bool pipelined) {
+      // The build side holds the values from 0 to 9 (including the deleted row), the probe side those from 5 to 19
+      const auto build_get_table = std::make_shared<GetTable>("table_a");
+      const auto build_table_scan = std::make_shared<TableScan>(build_get_table, less_than_(a, 10));
+      build_get_table->execute();
+      build_table_scan->execute();
+
+      const auto get_table = std::make_shared<GetTable>("table_a");
+      const auto validate = std::make_shared<Validate>(get_table);
+      const auto table_scan = std::make_shared<TableScan>(validate, greater_than_equals_(a, 5));
+      const auto join_hash = std::make_shared<JoinHash>(
+          table_scan, build_table_scan, mode,
+          OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+
+      const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+      join_hash->set_transaction_context_recursively(transaction_context);
+      _transaction_contexts.emplace_back(transaction_context);
+
+      get_table->execute();
+      if (pipelined) {
+        OperatorPipeline{{validate, table_scan, join_hash}}.execute();
+        EXPECT_FALSE(table_scan->get_output());
+      } else {
+        validate->execute();
+        table_scan->execute();
+        join_hash->execute();
+      }
+      return join_hash->get_output();
+    };
+
+    const auto expected_table = execute_operators(false);
+    const auto result_table = execute_operators(true);
+    ASSERT_TRUE(result_table);
+    EXPECT_TABLE_EQ_UNORDERED(result_table, expected_table);
+  }
+}
+
+TEST_F(OperatorPipelineTest, ExecuteSingleChunk) {
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto get_table = std::make_shared<GetTable>("table_a", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2},
+                                                                                    ChunkID{3}, ChunkID{4}, ChunkID{5}},
+                                                    std::vector<ColumnID>{});
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_(a, 19));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(add_(a, 1)));
+  get_table->execute();
+  ASSERT_EQ(get_table->get_output()->chunk_count(), 1);
+
+  auto pipeline = OperatorPipeline{{table_scan, projection}};
+  pipeline.execute();
+
+  // A single chunk is not worth pipelining, the operators are executed as usual
+  EXPECT_FALSE(table_scan->get_output());
+  ASSERT_TRUE(projection->get_output());
+  EXPECT_EQ(projection->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorPipelineTest, TasksFromOperator) {
+  const auto operators = _create_operators();
+  const auto tasks = OperatorTask::make_tasks_from_operator(operators.back(), ExecutionMode::Pipelined);
+
+  ASSERT_EQ(tasks.size(), 2);
+  EXPECT_EQ(tasks[0]->get_operator(), operators[0]);
+  EXPECT_FALSE(tasks[0]->get_pipeline());
+  EXPECT_EQ(tasks[1]->get_operator(), operators[3]);
+  ASSERT_TRUE(tasks[1]->get_pipeline());
+  EXPECT_EQ(tasks[1]->get_pipeline()->operators(),
+            (std::vector<std::shared_ptr<AbstractOperator>>{operators[1], operators[2], operators[3]}));
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(operators.back()->get_output()->row_count(), 14);
+  EXPECT_FALSE(operators[0]->get_output());
+}
+
+TEST_F(OperatorPipelineTest, TasksFromOperatorWithJoin) {
+  const auto operators = _create_operators();
+  const auto build_get_table = std::make_shared<GetTable>("table_a");
+  const auto join_hash =
+      std::make_shared<JoinHash>(operators[2], build_get_table, JoinMode::Semi,
+                                 OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+  join_hash->set_transaction_context_recursively(_transaction_contexts.back());
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join_hash, ExecutionMode::Pipelined);
+
+  // The pipeline probes the join and depends on the task of its build side
+  ASSERT_EQ(tasks.size(), 3);
+  const auto& pipeline_task = tasks.back();
+  ASSERT_TRUE(pipeline_task->get_pipeline());
+  EXPECT_EQ(pipeline_task->get_pipeline()->operators(),
+            (std::vector<std::shared_ptr<AbstractOperator>>{operators[1], operators[2], join_hash}));
+  for (const auto& task : tasks) {
+    if (task->get_operator() != build_get_table) continue;
+    const auto& successors = task->successors();
+    EXPECT_NE(std::find(successors.begin(), successors.end(), pipeline_task), successors.end());
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(join_hash->get_output()->row_count(), 14);
+}
+
+TEST_F(OperatorPipelineTest, SQLPipeline) {
+  const auto sql = std::string{"SELECT a + 1, b FROM table_a WHERE a >= 5"};
+  auto materializing_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  const auto expected_table = materializing_pipeline.get_result_table().second;
+
+  auto pipeline_statement =
+      SQLPipelineBuilder{sql}.with_execution_mode(ExecutionMode::Pipelined).create_pipeline_statement();
+  const auto& tasks = pipeline_statement.get_tasks();
+  EXPECT_TRUE(std::any_of(tasks.begin(), tasks.end(), [](const auto& task) { return task->get_pipeline(); }));
+
+  const auto [status, result_table] = pipeline_statement.get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_UNORDERED(result_table, expected_table);
+}
+
+}  // namespace opossum
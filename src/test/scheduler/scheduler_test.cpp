@@ -1,4 +1,7 @@
+#include <array>
 #include <memory>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -13,6 +16,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/task_deque.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -257,4 +261,140 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, TaskDequeOrder) {
+  // Use a small initial capacity so that the deque has to grow
+  auto deque = TaskDeque{NodeID{0}, 2};
+  EXPECT_TRUE(deque.empty());
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0; task_index < 5; ++task_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    deque.push(tasks.back());
+  }
+  EXPECT_FALSE(deque.empty());
+
+  // Tasks can only be enqueued once
+  deque.push(tasks.front());
+
+  // The owner pops in LIFO order, thieves steal in FIFO order
+  EXPECT_EQ(deque.pop(), tasks[4]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(SchedulerTest, TaskDequeConcurrentSteal) {
+  constexpr auto TASK_COUNT = size_t{10'000};
+  constexpr auto THIEF_COUNT = 3;
+
+  auto deque = TaskDeque{NodeID{0}, 4};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto task_indexes = std::unordered_map<const AbstractTask*, size_t>{};
+  for (auto task_index = size_t{0}; task_index < TASK_COUNT; ++task_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    task_indexes.emplace(tasks.back().get(), task_index);
+  }
+
+  // Each task has to be removed exactly once, either by the owner or by one of the thieves
+  auto removal_counts = std::vector<std::atomic_uint>(TASK_COUNT);
+  const auto count_removal = [&](const std::shared_ptr<AbstractTask>& task) {
+    ++removal_counts[task_indexes.at(task.get())];
+  };
+
+  auto owner_done = std::atomic_bool{false};
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_index = 0; thief_index < THIEF_COUNT; ++thief_index) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) {
+        if (const auto task = deque.steal()) count_removal(task);
+      }
+    });
+  }
+
+  for (auto task_index = size_t{0}; task_index < TASK_COUNT; ++task_index) {
+    deque.push(tasks[task_index]);
+    if (task_index % 3 == 0) {
+      if (const auto task = deque.pop()) count_removal(task);
+    }
+  }
+  while (const auto task = deque.pop()) count_removal(task);
+  owner_done = true;
+
+  for (auto& thief : thieves) thief.join();
+
+  for (const auto& removal_count : removal_counts) {
+    EXPECT_EQ(removal_count, 1u);
+  }
+}
+
+TEST_F(SchedulerTest, WorkStealingDequesWithScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(TaskQueueMode::WorkStealingDeques));
+
+  auto counter = std::atomic_uint{0};
+  auto dependency_counters = std::array<std::atomic_uint, 3>{};
+
+  increment_counter_in_subtasks(counter);
+  stress_linear_dependencies(dependency_counters[0]);
+  stress_multiple_dependencies(dependency_counters[1]);
+  stress_diamond_dependencies(dependency_counters[2]);
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(counter, 30u);
+  EXPECT_EQ(dependency_counters[0], 3u);
+  EXPECT_EQ(dependency_counters[1], 4u);
+  EXPECT_EQ(dependency_counters[2], 7u);
+}
+
+TEST_F(SchedulerTest, WorkStealingDequesManyNestedJobs) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(TaskQueueMode::WorkStealingDeques));
+
+  // Jobs spawning jobs, similar to operators parallelizing their work per chunk
+  auto counter = std::atomic_uint{0};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_index = 0; job_index < 100; ++job_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      auto subjobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto subjob_index = 0; subjob_index < 100; ++subjob_index) {
+        subjobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(subjobs);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  EXPECT_EQ(counter, 10'000u);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, WorkStealingDequesMultipleOperators) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(TaskQueueMode::WorkStealingDeques));
+
+  auto test_table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  Hyrise::get().storage_manager.add_table("table", test_table);
+
+  auto gt = std::make_shared<GetTable>("table");
+  auto a = PQPColumnExpression::from_table(*test_table, ColumnID{0});
+  auto ts = std::make_shared<TableScan>(gt, greater_than_equals_(a, 1234));
+
+  auto gt_task = std::make_shared<OperatorTask>(gt);
+  auto ts_task = std::make_shared<OperatorTask>(ts);
+  gt_task->set_as_predecessor_of(ts_task);
+
+  gt_task->schedule();
+  ts_task->schedule();
+
+  Hyrise::get().scheduler()->finish();
+
+  auto expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 1);
+  EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
+}
+
 }  // namespace opossum
@@ -249,6 +249,29 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  EXPECT_EQ(statement_information.result_format_codes, std::vector<FormatCode>{FormatCode::Text});
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadBindPacketWithBinaryResultFormat) {
+  const std::string portal = "test_portal";
+  const std::string statement_name = "test_statement";
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x2a'});
+  _mocked_socket->write(portal);
+  _mocked_socket->write(std::string{"\0", 1});
+  _mocked_socket->write(statement_name);
+  _mocked_socket->write(std::string{"\0", 1});
+  // No parameter format codes and no parameters
+  _mocked_socket->write(std::string{"\0", 2});
+  _mocked_socket->write(std::string{"\0", 2});
+  // Two result columns, the first one in text format (0), the second one in binary format (1)
+  _mocked_socket->write(std::string{'\0', '\x02'});
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x01'});
+
+  const auto& statement_information = _protocol_handler->read_bind_packet();
+  EXPECT_EQ(statement_information.portal, portal);
+  EXPECT_EQ(statement_information.result_format_codes,
+            std::vector<FormatCode>({FormatCode::Text, FormatCode::Binary}));
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
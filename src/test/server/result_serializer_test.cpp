@@ -1,6 +1,9 @@
+#include <boost/endian/conversion.hpp>
+
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 
+#include "lossy_cast.hpp"
 #include "server/postgres_protocol_handler.hpp"
 #include "server/result_serializer.hpp"
 
@@ -17,6 +20,42 @@ class ResultSerializerTest : public BaseTest {
         std::make_shared<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>(_mocked_socket->get_socket());
   }
 
+  // Splits the DataRow messages into their fields. NULL values are returned as std::nullopt.
+  static std::vector<std::vector<std::optional<std::string>>> parse_data_rows(const std::string& content) {
+    auto rows = std::vector<std::vector<std::optional<std::string>>>{};
+    auto position = content.cbegin();
+    while (position != content.cend()) {
+      EXPECT_EQ(static_cast<PostgresMessageType>(*position), PostgresMessageType::DataRow);
+      const auto message_end = position + 1 + NetworkConversionHelper::get_message_length(position + 1);
+      position += 1 + sizeof(uint32_t);
+
+      const auto field_count = NetworkConversionHelper::get_small_int(position);
+      position += sizeof(uint16_t);
+
+      auto& row = rows.emplace_back();
+      for (auto field_id = uint16_t{0}; field_id < field_count; ++field_id) {
+        const auto field_length = static_cast<int32_t>(NetworkConversionHelper::get_message_length(position));
+        position += sizeof(uint32_t);
+        if (field_length == -1) {
+          row.emplace_back(std::nullopt);
+        } else {
+          row.emplace_back(std::string(position, position + field_length));
+          position += field_length;
+        }
+      }
+      EXPECT_EQ(position, message_end);
+    }
+    return rows;
+  }
+
+  template <typename T>
+  static T from_binary_field(const std::string& field) {
+    EXPECT_EQ(field.size(), sizeof(T));
+    auto value = T{};
+    std::copy_n(field.begin(), sizeof(T), reinterpret_cast<char*>(&value));
+    return boost::endian::big_to_native(value);
+  }
+
   std::shared_ptr<Table> _test_table;
   std::shared_ptr<MockSocket> _mocked_socket;
   std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>> _protocol_handler;
@@ -43,6 +82,105 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, TextFormat) {
+  ResultSerializer::send_query_response(_test_table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const auto rows = parse_data_rows(_mocked_socket->read());
+
+  // The values are converted to the same strings as by lossy_variant_cast
+  ASSERT_EQ(rows.size(), _test_table->row_count());
+  for (auto row_id = size_t{0}; row_id < rows.size(); ++row_id) {
+    const auto expected_row = _test_table->get_row(row_id);
+    ASSERT_EQ(rows[row_id].size(), expected_row.size());
+    for (auto column_id = size_t{0}; column_id < expected_row.size(); ++column_id) {
+      const auto expected_value = lossy_variant_cast<pmr_string>(expected_row[column_id]);
+      ASSERT_EQ(rows[row_id][column_id].has_value(), expected_value.has_value());
+      if (expected_value) {
+        EXPECT_EQ(*rows[row_id][column_id], std::string(expected_value->data(), expected_value->size()));
+      }
+    }
+  }
+}
+
+TEST_F(ResultSerializerTest, BinaryFormat) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"i", DataType::Int, false},
+                                                                    {"l", DataType::Long, false},
+                                                                    {"f", DataType::Float, true},
+                                                                    {"d", DataType::Double, false},
+                                                                    {"s", DataType::String, false}},
+                                             TableType::Data, 2);
+  table->append({-17, int64_t{5'000'000'000}, 1.5f, 0.1, "abc"});
+  table->append({42, int64_t{-1}, NULL_VALUE, -2.25, ""});
+  table->append({0, int64_t{0}, -0.5f, 1e300, "hyrise"});
+
+  ResultSerializer::send_query_response(table, _protocol_handler, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const auto rows = parse_data_rows(_mocked_socket->read());
+
+  ASSERT_EQ(rows.size(), 3);
+  EXPECT_EQ(from_binary_field<int32_t>(*rows[0][0]), -17);
+  EXPECT_EQ(from_binary_field<int64_t>(*rows[0][1]), 5'000'000'000);
+  EXPECT_EQ(from_binary_field<uint32_t>(*rows[0][2]), 0x3FC00000u);  // 1.5f
+  EXPECT_EQ(from_binary_field<uint64_t>(*rows[0][3]), 0x3FB999999999999Au);  // 0.1
+  EXPECT_EQ(*rows[0][4], "abc");
+
+  EXPECT_EQ(from_binary_field<int32_t>(*rows[1][0]), 42);
+  EXPECT_EQ(from_binary_field<int64_t>(*rows[1][1]), -1);
+  EXPECT_FALSE(rows[1][2]);
+  EXPECT_EQ(from_binary_field<uint64_t>(*rows[1][3]), 0xC002000000000000u);  // -2.25
+  EXPECT_EQ(*rows[1][4], "");
+
+  EXPECT_EQ(from_binary_field<uint32_t>(*rows[2][2]), 0xBF000000u);  // -0.5f
+  EXPECT_EQ(*rows[2][4], "hyrise");
+}
+
+TEST_F(ResultSerializerTest, FormatPerColumn) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data);
+  table->append({1, 2});
+
+  ResultSerializer::send_query_response(table, _protocol_handler, {FormatCode::Text, FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const auto rows = parse_data_rows(_mocked_socket->read());
+
+  ASSERT_EQ(rows.size(), 1);
+  EXPECT_EQ(*rows[0][0], "1");
+  EXPECT_EQ(from_binary_field<int32_t>(*rows[0][1]), 2);
+
+  EXPECT_THROW(ResultSerializer::send_query_response(
+                   table, _protocol_handler, {FormatCode::Text, FormatCode::Binary, FormatCode::Binary}),
+               InvalidInputException);
+}
+
+TEST_F(ResultSerializerTest, BinaryRowDescription) {
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  ResultSerializer::send_table_description(table, _protocol_handler, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // The format code is the last field of the column description
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cend() - sizeof(uint16_t)), 1);
+}
+
+TEST_F(ResultSerializerTest, LargeQueryResponse) {
+  // Results that exceed the size of a batch are sent in multiple batches
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data);
+  const auto value = pmr_string(1000, 'x');
+  for (auto row_id = 0; row_id < 1000; ++row_id) {
+    table->append({value});
+  }
+
+  ResultSerializer::send_query_response(table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const auto rows = parse_data_rows(_mocked_socket->read());
+
+  ASSERT_EQ(rows.size(), 1000);
+  for (const auto& row : rows) {
+    EXPECT_EQ(*row[0], std::string(value.data(), value.size()));
+  }
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
@@ -334,6 +334,25 @@ TEST_F(ServerTestRunner, TestParallelConnections) {
   }
 }
 
+TEST_F(ServerTestRunner, TestManyIdleConnections) {
+  // Sessions do not have a thread of their own, but wait on the io_service until a request arrives. Open a number of
+  // connections first (kept low so that the test does not run out of file descriptors) and use them afterwards.
+  const auto connection_count = 200u;
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  connections.reserve(connection_count);
+  for (auto connection_id = 0u; connection_id < connection_count; ++connection_id) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  for (auto round = 0u; round < 2u; ++round) {
+    for (auto& connection : connections) {
+      pqxx::nontransaction transaction{*connection};
+      const auto result = transaction.exec("SELECT * FROM table_a;");
+      EXPECT_EQ(result.size(), _table_a->row_count());
+    }
+  }
+}
+
 TEST_F(ServerTestRunner, TestTransactionConflicts) {
   // Similar to TestParallelConnections, but this time we modify the table, expecting some conflicts on the way
   // Also similar to StressTest.TestTransactionConflicts, only that we go through the server
@@ -74,4 +74,22 @@ TEST_F(WriteBufferTest, WriteLargeString) {
   EXPECT_EQ(_mocked_socket->read(), original_content);
 }
 
+TEST_F(WriteBufferTest, WriteBytes) {
+  // Blocks that fit into the remaining space are buffered, larger ones are written directly after flushing the buffer
+  const auto small_block = std::string{"small"};
+  const auto large_block = std::string(3 * SERVER_BUFFER_SIZE, 'a');
+
+  _write_buffer->put_string("head", HasNullTerminator::No);
+  _write_buffer->put_bytes(small_block.data(), small_block.size());
+  EXPECT_TRUE(_mocked_socket->empty());
+
+  _write_buffer->put_bytes(large_block.data(), large_block.size());
+  EXPECT_EQ(_write_buffer->size(), 0);
+  EXPECT_EQ(_mocked_socket->read(), "head" + small_block + large_block);
+
+  _write_buffer->put_bytes(small_block.data(), small_block.size());
+  _write_buffer->flush();
+  EXPECT_EQ(_mocked_socket->read(), "head" + small_block + large_block + small_block);
+}
+
 }  // namespace opossum
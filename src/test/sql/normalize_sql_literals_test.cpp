@@ -0,0 +1,58 @@
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "sql/normalize_sql_literals.hpp"
+
+namespace opossum {
+
+class NormalizeSQLLiteralsTest : public BaseTest {};
+
+TEST_F(NormalizeSQLLiteralsTest, ReplacesLiterals) {
+  const auto normalized_sql =
+      normalize_sql_literals("SELECT a, 'x' FROM t1 WHERE a = 5 AND b > 3000000000 AND c < 1.5 AND d LIKE 'b%';");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT a, ? FROM t1 WHERE a = ? AND b > ? AND c < ? AND d LIKE ?;");
+  const auto expected_literals = std::vector<AllTypeVariant>{pmr_string{"x"}, int32_t{5}, int64_t{3'000'000'000},
+                                                             double{1.5}, pmr_string{"b%"}};
+  ASSERT_EQ(normalized_sql->literals.size(), expected_literals.size());
+  for (auto literal_idx = size_t{0}; literal_idx < expected_literals.size(); ++literal_idx) {
+    EXPECT_EQ(normalized_sql->literals[literal_idx].type(), expected_literals[literal_idx].type());
+    EXPECT_EQ(normalized_sql->literals[literal_idx], expected_literals[literal_idx]);
+  }
+}
+
+TEST_F(NormalizeSQLLiteralsTest, SameShapeSameSQL) {
+  const auto normalized_sql_a = normalize_sql_literals("SELECT * FROM t WHERE a = 1 AND b = 'x'");
+  const auto normalized_sql_b = normalize_sql_literals("SELECT * FROM t WHERE a = 42 AND b = 'yz'");
+  ASSERT_TRUE(normalized_sql_a && normalized_sql_b);
+  EXPECT_EQ(normalized_sql_a->sql, normalized_sql_b->sql);
+}
+
+TEST_F(NormalizeSQLLiteralsTest, KeepsIdentifiersAndComments) {
+  const auto sql = std::string{"SELECT \"col 1\", t2.b3 FROM t2 -- 17\n/* 'x' */"};
+  const auto normalized_sql = normalize_sql_literals(sql);
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, sql);
+  EXPECT_TRUE(normalized_sql->literals.empty());
+}
+
+TEST_F(NormalizeSQLLiteralsTest, NegativeNumbers) {
+  // The minus is kept as an operator, as the SQLTranslator does with unary minus
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE a > -5");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a > -?");
+  ASSERT_EQ(normalized_sql->literals.size(), 1u);
+  EXPECT_EQ(normalized_sql->literals[0], AllTypeVariant{int32_t{5}});
+}
+
+TEST_F(NormalizeSQLLiteralsTest, NotNormalized) {
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = ?"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE b = 'it''s'"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE b = 'unterminated"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a > 1e5"));
+}
+
+}  // namespace opossum
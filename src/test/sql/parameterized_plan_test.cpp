@@ -0,0 +1,134 @@
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "sql/normalize_sql_literals.hpp"
+#include "sql/parameterized_plan.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ParameterizedPlanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Table t holds the values 0 to 999 in column a and their last digit in column b, in chunks of 100 rows
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data,
+        ChunkOffset{100}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 1'000; ++value) {
+      table->append({value, value % 10});
+    }
+    table->last_chunk()->finalize();
+    Hyrise::get().storage_manager.add_table("t", table);
+
+    _cache = std::make_shared<SQLParameterizedPlanCache>();
+  }
+
+  // Executes the query with the parameterized plan cache and compares its result to the uncached execution
+  std::shared_ptr<const Table> execute(const std::string& sql, const bool expect_cache_hit) {
+    auto statement = SQLPipelineBuilder{sql}.with_parameterized_plan_cache(_cache).create_pipeline_statement();
+    const auto [status, result_table] = statement.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    EXPECT_EQ(statement.metrics()->parameterized_plan_cache_hit, expect_cache_hit) << sql;
+
+    auto uncached_statement =
+        SQLPipelineBuilder{sql}.with_parameterized_plan_cache(nullptr).create_pipeline_statement();
+    const auto table_difference_message =
+        check_table_equal(result_table, uncached_statement.get_result_table().second, OrderSensitivity::No,
+                          TypeCmpMode::Strict, FloatComparisonMode::AbsoluteDifference, IgnoreNullable::No);
+    EXPECT_FALSE(table_difference_message) << sql << ": " << table_difference_message.value_or("");
+
+    return result_table;
+  }
+
+  std::shared_ptr<ParameterizedPlan> cached_plan(const std::string& sql) {
+    const auto normalized_sql = normalize_sql_literals(sql);
+    return _cache->get_entry(ParameterizedPlan::cache_key(*normalized_sql, UseMvcc::Yes));
+  }
+
+  std::shared_ptr<SQLParameterizedPlanCache> _cache;
+};
+
+TEST_F(ParameterizedPlanTest, ReuseForDifferentLiterals) {
+  EXPECT_EQ(execute("SELECT b FROM t WHERE a = 17", false)->row_count(), 1);
+  EXPECT_EQ(execute("SELECT b FROM t WHERE a = 42", true)->row_count(), 1);
+  EXPECT_EQ(execute("SELECT b FROM t WHERE a = 1000", true)->row_count(), 0);
+
+  EXPECT_EQ(_cache->size(), 1);
+  EXPECT_EQ(cached_plan("SELECT b FROM t WHERE a = 17")->variant_count(), 1);
+}
+
+TEST_F(ParameterizedPlanTest, VariantPerSelectivityBucket) {
+  // The selectivities of 0.3% and 0.5% are in the same bucket, the one of 80% is not
+  execute("SELECT a FROM t WHERE a < 3 AND b = 1", false);
+  execute("SELECT a FROM t WHERE a < 800 AND b = 1", false);
+  execute("SELECT a FROM t WHERE a < 5 AND b = 1", true);
+  execute("SELECT a FROM t WHERE a < 700 AND b = 1", true);
+
+  EXPECT_EQ(cached_plan("SELECT a FROM t WHERE a < 3 AND b = 1")->variant_count(), 2);
+}
+
+TEST_F(ParameterizedPlanTest, BetweenAndSubqueries) {
+  execute("SELECT a FROM t WHERE a BETWEEN 10 AND 19 AND b IN (SELECT b FROM t WHERE a < 13)", false);
+  const auto result_table =
+      execute("SELECT a FROM t WHERE a BETWEEN 20 AND 29 AND b IN (SELECT b FROM t WHERE a < 12)", true);
+  EXPECT_EQ(result_table->row_count(), 2);
+}
+
+TEST_F(ParameterizedPlanTest, NonParameterizedLiteralsHaveToMatch) {
+  EXPECT_EQ(execute("SELECT a FROM t WHERE a < 10 LIMIT 2", false)->row_count(), 2);
+  EXPECT_EQ(execute("SELECT a FROM t WHERE a < 10 LIMIT 3", false)->row_count(), 3);
+  EXPECT_EQ(execute("SELECT a FROM t WHERE a < 20 LIMIT 2", true)->row_count(), 2);
+  EXPECT_EQ(execute("SELECT a + 1 FROM t WHERE a < 20", false)->row_count(), 20);
+  EXPECT_EQ(execute("SELECT a + 2 FROM t WHERE a < 20", false)->row_count(), 20);
+}
+
+TEST_F(ParameterizedPlanTest, DifferentDataTypes) {
+  execute("SELECT a FROM t WHERE a < 10", false);
+  execute("SELECT a FROM t WHERE a < 10.5", false);
+  EXPECT_EQ(_cache->size(), 2);
+}
+
+TEST_F(ParameterizedPlanTest, ChunksArePrunedForLiterals) {
+  execute("SELECT a FROM t WHERE a < 50", false);
+
+  auto statement = SQLPipelineBuilder{"SELECT a FROM t WHERE a > 950"}
+                       .with_parameterized_plan_cache(_cache)
+                       .create_pipeline_statement();
+  const auto lqp = statement.get_optimized_logical_plan();
+  EXPECT_TRUE(statement.metrics()->parameterized_plan_cache_hit);
+
+  auto pruned_chunk_count = std::optional<size_t>{};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      pruned_chunk_count = static_cast<const StoredTableNode&>(*node).pruned_chunk_ids().size();
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_EQ(pruned_chunk_count, 9);
+}
+
+TEST_F(ParameterizedPlanTest, NotParameterizable) {
+  const auto insert = std::string{"INSERT INTO t VALUES (1000, 0)"};
+  auto statement = SQLPipelineBuilder{insert}.with_parameterized_plan_cache(_cache).create_pipeline_statement();
+  EXPECT_EQ(statement.get_result_table().first, SQLPipelineStatus::Success);
+  EXPECT_FALSE(statement.metrics()->parameterized_plan_cache_hit);
+
+  // The statement is remembered as not parameterizable, so that it is not parsed twice the next time
+  ASSERT_TRUE(cached_plan(insert));
+  EXPECT_FALSE(cached_plan(insert)->is_parameterizable());
+
+  // Statements without literals are not cached
+  execute("SELECT a FROM t", false);
+  EXPECT_EQ(_cache->size(), 1);
+}
+
+}  // namespace opossum
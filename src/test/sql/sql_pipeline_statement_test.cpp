@@ -12,6 +12,7 @@
 #include "logical_query_plan/join_node.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/validate.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -641,6 +642,27 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   EXPECT_TRUE(_lqp_cache->has(_select_query_a));
 }
 
+TEST_F(SQLPipelineStatementTest, CachedQueryPlanHasNoRuntimeFilters) {
+  auto has_runtime_filter = [](const std::shared_ptr<const AbstractOperator>& node) {
+    const auto table_scan = std::dynamic_pointer_cast<const TableScan>(node);
+    return table_scan && !table_scan->runtime_filters.empty();
+  };
+
+  auto first_sql_pipeline = SQLPipelineBuilder{_join_query}.with_pqp_cache(_pqp_cache).create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(first_sql_pipeline.get_result_table().second, _join_result);
+
+  // Runtime filters are only added to the executed copy of the plan
+  const auto cached_plan = _pqp_cache->try_get(_join_query);
+  ASSERT_TRUE(cached_plan);
+  EXPECT_NE(*cached_plan, first_sql_pipeline.get_physical_plan());
+  EXPECT_FALSE(contained_in_query_plan(*cached_plan, has_runtime_filter));
+
+  auto second_sql_pipeline = SQLPipelineBuilder{_join_query}.with_pqp_cache(_pqp_cache).create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(second_sql_pipeline.get_result_table().second, _join_result);
+  EXPECT_TRUE(second_sql_pipeline.metrics()->query_plan_cache_hit);
+  EXPECT_FALSE(contained_in_query_plan(*cached_plan, has_runtime_filter));
+}
+
 TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   const auto subquery_query = "SELECT * FROM table_int WHERE a = (SELECT MAX(b) FROM table_int)";
 
@@ -2046,7 +2046,7 @@ TEST_F(SQLTranslatorTest, DeleteSimple) {
 
   // clang-format off
   const auto expected_lqp =
-  DeleteNode::make(
+  DeleteNode::make("int_float",
     ValidateNode::make(
       StoredTableNode::make("int_float")));
   // clang-format on
@@ -2059,7 +2059,7 @@ TEST_F(SQLTranslatorTest, DeleteConditional) {
 
   // clang-format off
   const auto expected_lqp =
-  DeleteNode::make(
+  DeleteNode::make("int_float",
     PredicateNode::make(greater_than_(int_float_a, 5),
       ValidateNode::make(
         stored_table_node_int_float)));
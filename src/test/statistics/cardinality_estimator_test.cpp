@@ -671,6 +671,25 @@ TEST_F(CardinalityEstimatorTest, PredicateWithValuePlaceholder) {
   EXPECT_FLOAT_EQ(estimator.estimate_cardinality(lqp_e), 25.0f);
 }
 
+TEST_F(CardinalityEstimatorTest, PredicateWithKnownPlaceholderValues) {
+  // Placeholders with known values are estimated like the values themselves
+  estimator.placeholder_values.emplace(ParameterID{0}, 20);
+  estimator.placeholder_values.emplace(ParameterID{1}, 30);
+
+  const auto lqp_a = PredicateNode::make(less_than_(d_a, placeholder_(ParameterID{0})), node_d);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(lqp_a),
+                  estimator.estimate_cardinality(PredicateNode::make(less_than_(d_a, 20), node_d)));
+
+  const auto lqp_b =
+      PredicateNode::make(between_inclusive_(d_a, placeholder_(ParameterID{0}), placeholder_(ParameterID{1})), node_d);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(lqp_b),
+                  estimator.estimate_cardinality(PredicateNode::make(between_inclusive_(d_a, 20, 30), node_d)));
+
+  // Placeholders without a value are still estimated with the default selectivities
+  const auto lqp_c = PredicateNode::make(less_than_(d_a, placeholder_(ParameterID{2})), node_d);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(lqp_c), 50.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, PredicateMultipleWithCorrelatedParameter) {
   // clang-format off
   const auto input_lqp =
@@ -904,7 +923,7 @@ TEST_F(CardinalityEstimatorTest, NonQueryNodes) {
   const auto insert_lqp = InsertNode::make("t", node_a);
   EXPECT_EQ(estimator.estimate_cardinality(insert_lqp), 0.0f);
 
-  EXPECT_EQ(estimator.estimate_cardinality(DeleteNode::make(node_a)), 0.0f);
+  EXPECT_EQ(estimator.estimate_cardinality(DeleteNode::make("t", node_a)), 0.0f);
   EXPECT_EQ(estimator.estimate_cardinality(DropViewNode::make("v", false)), 0.0f);
   EXPECT_EQ(estimator.estimate_cardinality(DropTableNode::make("t", false)), 0.0f);
   EXPECT_EQ(estimator.estimate_cardinality(DummyTableNode::make()), 0.0f);
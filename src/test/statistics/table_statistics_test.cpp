@@ -1,5 +1,9 @@
+#include <cmath>
+
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
@@ -41,4 +45,124 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableWithScheduler) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20);
+  const auto table_statistics = TableStatistics::from_table(*table);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics_a && column_statistics_a->histogram);
+  EXPECT_FLOAT_EQ(column_statistics_a->histogram->total_count(), 200 - 27);
+  EXPECT_FLOAT_EQ(column_statistics_a->histogram->total_distinct_count(), 10);
+  EXPECT_FLOAT_EQ(column_statistics_a->null_value_ratio->ratio, 27.0f / 200);
+
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(1));
+  ASSERT_TRUE(column_statistics_b && column_statistics_b->histogram);
+  EXPECT_FLOAT_EQ(column_statistics_b->histogram->total_count(), 200 - 9);
+  EXPECT_FLOAT_EQ(column_statistics_b->histogram->total_distinct_count(), 190);
+  EXPECT_FLOAT_EQ(column_statistics_b->null_value_ratio->ratio, 9.0f / 200);
+}
+
+TEST_F(TableStatisticsTest, FromTableSampled) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // 200,000 rows with the values 0 to 999, every seventh row is NULL
+  const auto row_count = 200'000;
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 10'000);
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    table->append({row % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row % 1'000}});
+  }
+
+  const auto sampling_error = 0.05f;
+  const auto table_statistics = TableStatistics::from_table(*table, sampling_error);
+  EXPECT_EQ(table_statistics->row_count, row_count);
+
+  const auto column_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics && column_statistics->histogram);
+  const auto& histogram = *column_statistics->histogram;
+
+  // The share of the rows in a value range is estimated with an error of at most sampling_error
+  const auto non_null_row_count = row_count * 6.0f / 7;
+  EXPECT_NEAR(histogram.total_count(), non_null_row_count, sampling_error * row_count);
+  EXPECT_NEAR(histogram.estimate_cardinality(PredicateCondition::LessThan, int32_t{500}), non_null_row_count / 2,
+              sampling_error * row_count);
+  EXPECT_NEAR(column_statistics->null_value_ratio->ratio, 1.0f / 7, sampling_error);
+
+  // The ratio error of the distinct count is bounded by sqrt(row_count / sample size)
+  const auto sample_size = std::ceil(std::log(2.0 / (1.0 - TableStatistics::SAMPLING_CONFIDENCE)) /
+                                     (2.0 * sampling_error * sampling_error));
+  const auto max_ratio_error = static_cast<float>(std::sqrt(row_count / sample_size));
+  EXPECT_GE(histogram.total_distinct_count(), 1'000 / max_ratio_error);
+  EXPECT_LE(histogram.total_distinct_count(), 1'000 * max_ratio_error);
+}
+
+TEST_F(TableStatisticsTest, FromAppendedChunks) {
+  const auto full_table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20);
+  const auto full_table_statistics = TableStatistics::from_table(*full_table);
+
+  // Build the statistics for the first five chunks and update them after appending the other five. Only the chunks
+  // before the first mutable one are scanned each time.
+  const auto append_chunks = [&](Table& table, const ChunkID begin_chunk_id, const ChunkID end_chunk_id) {
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      const auto chunk = full_table->get_chunk(chunk_id);
+      table.append_chunk({chunk->get_segment(ColumnID{0}), chunk->get_segment(ColumnID{1})});
+    }
+  };
+  const auto finalize_chunks = [](Table& table, const ChunkID begin_chunk_id, const ChunkID end_chunk_id) {
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      table.get_chunk(chunk_id)->finalize();
+    }
+  };
+
+  auto table = std::make_shared<Table>(full_table->column_definitions(), TableType::Data, 20);
+  append_chunks(*table, ChunkID{0}, ChunkID{5});
+  finalize_chunks(*table, ChunkID{0}, ChunkID{4});
+  const auto previous_statistics = TableStatistics::from_table(*table);
+  EXPECT_EQ(previous_statistics->first_unscanned_chunk_id, ChunkID{4});
+
+  finalize_chunks(*table, ChunkID{4}, ChunkID{5});
+  append_chunks(*table, ChunkID{5}, ChunkID{10});
+  finalize_chunks(*table, ChunkID{5}, ChunkID{9});
+  const auto intermediate_statistics = TableStatistics::from_appended_chunks(*table, *previous_statistics, ChunkID{4});
+  EXPECT_EQ(intermediate_statistics->first_unscanned_chunk_id, ChunkID{9});
+  EXPECT_EQ(intermediate_statistics->row_count, 200u);
+  EXPECT_THROW(TableStatistics::from_appended_chunks(*table, *previous_statistics, ChunkID{11}), std::logic_error);
+
+  finalize_chunks(*table, ChunkID{9}, ChunkID{10});
+  const auto table_statistics = TableStatistics::from_appended_chunks(*table, *intermediate_statistics, ChunkID{9});
+  EXPECT_EQ(table_statistics->first_unscanned_chunk_id, ChunkID{10});
+
+  // Tables that start with a mutable chunk are scanned completely, so the next statistics have to scan them again
+  auto mutable_table = std::make_shared<Table>(full_table->column_definitions(), TableType::Data, 20);
+  append_chunks(*mutable_table, ChunkID{0}, ChunkID{10});
+  const auto mutable_table_statistics = TableStatistics::from_table(*mutable_table);
+  EXPECT_FALSE(mutable_table_statistics->first_unscanned_chunk_id);
+  const auto& mutable_b_statistics =
+      static_cast<const AttributeStatistics<int32_t>&>(*mutable_table_statistics->column_statistics.at(ColumnID{1}));
+  const auto& full_b_statistics =
+      static_cast<const AttributeStatistics<int32_t>&>(*full_table_statistics->column_statistics.at(ColumnID{1}));
+  EXPECT_FLOAT_EQ(mutable_b_statistics.histogram->total_count(), full_b_statistics.histogram->total_count());
+
+  for (auto column_id = ColumnID{0}; column_id < 2; ++column_id) {
+    const auto column_statistics =
+        std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(column_id));
+    const auto full_column_statistics =
+        std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(full_table_statistics->column_statistics.at(column_id));
+    ASSERT_TRUE(column_statistics && column_statistics->histogram);
+
+    // Row and NULL counts are exact, distinct counts are estimated
+    EXPECT_NEAR(column_statistics->histogram->total_count(), full_column_statistics->histogram->total_count(), 0.01f);
+    EXPECT_NEAR(column_statistics->null_value_ratio->ratio, full_column_statistics->null_value_ratio->ratio, 0.0001f);
+    EXPECT_EQ(column_statistics->histogram->bin_minimum(BinID{0}),
+              full_column_statistics->histogram->bin_minimum(BinID{0}));
+    const auto distinct_count = full_column_statistics->histogram->total_distinct_count();
+    EXPECT_GE(column_statistics->histogram->total_distinct_count(), distinct_count / 2);
+    EXPECT_LE(column_statistics->histogram->total_distinct_count(), distinct_count * 2);
+  }
+}
+
 }  // namespace opossum
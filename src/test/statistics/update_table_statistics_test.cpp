@@ -0,0 +1,115 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+#include "statistics/update_table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class UpdateTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Table t holds the values 0 to 99 in column b. Column a holds the same values, except for every tenth row, where
+    // it is NULL.
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, ChunkOffset{32}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      _table->append({value % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}, value});
+    }
+    _table->last_chunk()->finalize();
+    Hyrise::get().storage_manager.add_table("t", _table);
+  }
+
+  static void execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    ASSERT_EQ(pipeline.get_result_table().first, SQLPipelineStatus::Success) << sql;
+  }
+
+  float null_value_ratio(const ColumnID column_id) const {
+    const auto& column_statistics = static_cast<const AttributeStatistics<int32_t>&>(
+        *_table->table_statistics()->column_statistics.at(column_id));
+    return column_statistics.null_value_ratio->ratio;
+  }
+
+  const TableColumnDefinitions _column_definitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(UpdateTableStatisticsTest, InsertDeleteUpdate) {
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 100.0f);
+  EXPECT_FLOAT_EQ(null_value_ratio(ColumnID{0}), 0.1f);
+
+  execute("INSERT INTO t VALUES (NULL, 100)");
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 101.0f);
+  EXPECT_FLOAT_EQ(null_value_ratio(ColumnID{0}), 11.0f / 101);
+  EXPECT_FLOAT_EQ(null_value_ratio(ColumnID{1}), 0.0f);
+
+  execute("DELETE FROM t WHERE a IS NULL");
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 90.0f);
+  EXPECT_NEAR(null_value_ratio(ColumnID{0}), 0.0f, 0.0001f);
+
+  // An update deletes and re-inserts the rows 1 to 4
+  execute("UPDATE t SET a = NULL WHERE b < 5");
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 90.0f);
+  EXPECT_NEAR(null_value_ratio(ColumnID{0}), 4.0f / 90, 0.0001f);
+
+  // The histograms are not rebuilt for few modified rows
+  EXPECT_EQ(_table->table_statistics()->modified_row_count, 1 + 11 + 8);
+  EXPECT_FALSE(_table->table_statistics()->rebuild_scheduled);
+}
+
+TEST_F(UpdateTableStatisticsTest, RolledBackInsert) {
+  const auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+  values->append({NULL_VALUE, 100});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto insert = std::make_shared<Insert>("t", table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  transaction_context->rollback();
+
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 100.0f);
+  EXPECT_FLOAT_EQ(null_value_ratio(ColumnID{0}), 0.1f);
+  EXPECT_EQ(_table->table_statistics()->modified_row_count, 0);
+}
+
+TEST_F(UpdateTableStatisticsTest, RebuildStaleStatistics) {
+  // Insert enough rows with values beyond the histogram's bounds to make the statistics stale. The rebuild job is
+  // executed right away by the ImmediateExecutionScheduler. As all chunks of the table were immutable when the
+  // statistics were built, the rebuild only scans the chunks appended by the inserts, except for the last, mutable
+  // one.
+  EXPECT_EQ(_table->table_statistics()->first_unscanned_chunk_id, ChunkID{4});
+  for (auto insert_idx = size_t{0}; insert_idx * 100 <= MIN_STALE_ROW_COUNT; ++insert_idx) {
+    execute("INSERT INTO t SELECT b + 1000, b + 1000 FROM t WHERE b < 100");
+  }
+  execute("DELETE FROM t WHERE b < 50");
+
+  const auto table_statistics = _table->table_statistics();
+  EXPECT_EQ(table_statistics->modified_row_count, 50);
+  EXPECT_FALSE(table_statistics->rebuild_scheduled);
+  EXPECT_FLOAT_EQ(table_statistics->row_count, _table->row_count() - 50);
+
+  const auto& column_statistics =
+      static_cast<const AttributeStatistics<int32_t>&>(*table_statistics->column_statistics.at(1));
+  ASSERT_TRUE(column_statistics.histogram);
+  EXPECT_EQ(column_statistics.histogram->bin_maximum(column_statistics.histogram->bin_count() - 1), 1099);
+  EXPECT_EQ(column_statistics.histogram->bin_minimum(BinID{0}), 0);
+
+  // The last chunk is still mutable, so the next rebuild continues with it
+  const auto last_chunk_id = ChunkID{_table->chunk_count() - 1};
+  EXPECT_TRUE(_table->get_chunk(last_chunk_id)->is_mutable());
+  EXPECT_EQ(table_statistics->first_unscanned_chunk_id, last_chunk_id);
+}
+
+}  // namespace opossum
@@ -90,6 +90,30 @@ TEST_F(StorageChunkTest, FinalizeSetsMaxBeginCid) {
   EXPECT_EQ(mvcc_data_chunk->max_begin_cid, 3);
 }
 
+TEST_F(StorageChunkTest, FinalizeSetsMinBeginCid) {
+  auto mvcc_data = std::make_shared<MvccData>(3, 0);
+  mvcc_data->set_begin_cid(0, 2);
+  mvcc_data->set_begin_cid(1, 1);
+  mvcc_data->set_begin_cid(2, 3);
+
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}), mvcc_data);
+  chunk->finalize();
+
+  EXPECT_EQ(chunk->mvcc_data()->min_begin_cid, 1);
+}
+
+TEST_F(StorageChunkTest, RemoveInvisibleCommittedRows) {
+  // Rows 0 and 2 were inserted before/with the snapshot, row 1 afterwards. Row 2 was invalidated before the snapshot.
+  auto mvcc_data = std::make_shared<MvccData>(70, 0);
+  mvcc_data->set_begin_cid(1, 3);
+  mvcc_data->set_end_cid(2, 2);
+  mvcc_data->set_end_cid(65, 1);
+
+  auto words = std::vector<uint64_t>{0b1111, 0b11};
+  mvcc_data->remove_invisible_committed_rows(words, CommitID{2});
+  EXPECT_EQ(words, (std::vector<uint64_t>{0b1001, 0b01}));
+}
+
 TEST_F(StorageChunkTest, AddIndexByColumnID) {
   chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
   auto index_int = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
@@ -0,0 +1,171 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key_index.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class PrimaryKeyIndexTest : public BaseTest {
+ public:
+  void SetUp() override {
+    column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, false}, {"c", DataType::Float, true}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    table->append({1, "x", 1.5f});
+    table->append({2, "x", NULL_VALUE});
+    table->append({1, "y", 2.5f});
+
+    // The first chunk is dictionary-encoded, the second one is still mutable
+    table->get_chunk(ChunkID{0})->finalize();
+    ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+
+    // Column IDs are sorted when the constraint is added
+    table->add_soft_unique_constraint({ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
+    Hyrise::get().storage_manager.add_table("pk_table", table);
+  }
+
+  TableColumnDefinitions column_definitions;
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(PrimaryKeyIndexTest, RequiresPrimaryKeyConstraint) {
+  const auto other_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  other_table->add_soft_unique_constraint({ColumnID{0}}, IsPrimaryKey::No);
+  EXPECT_THROW(other_table->create_primary_key_index(), std::logic_error);
+
+  table->create_primary_key_index();
+  EXPECT_THROW(table->create_primary_key_index(), std::logic_error);
+}
+
+TEST_F(PrimaryKeyIndexTest, Lookup) {
+  EXPECT_FALSE(table->primary_key_index());
+  table->create_primary_key_index();
+
+  const auto& primary_key_index = table->primary_key_index();
+  ASSERT_TRUE(primary_key_index);
+  EXPECT_EQ(primary_key_index->column_ids(), std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_GT(primary_key_index->memory_usage(), 0);
+
+  const auto indexes_statistics = table->indexes_statistics();
+  ASSERT_EQ(indexes_statistics.size(), 1);
+  EXPECT_EQ(indexes_statistics[0].type, SegmentIndexType::PrimaryKey);
+
+  EXPECT_EQ(primary_key_index->lookup({1, "x"}), (RowIDPosList{RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(primary_key_index->lookup({2, "x"}), (RowIDPosList{RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(primary_key_index->lookup({1, "y"}), (RowIDPosList{RowID{ChunkID{1}, 0}}));
+  EXPECT_TRUE(primary_key_index->lookup({2, "y"}).empty());
+
+  // Values are converted to the column type if this is possible without loss
+  EXPECT_EQ(primary_key_index->lookup({int64_t{1}, "y"}), (RowIDPosList{RowID{ChunkID{1}, 0}}));
+  EXPECT_TRUE(primary_key_index->lookup({1.5, "y"}).empty());
+  EXPECT_TRUE(primary_key_index->lookup({NULL_VALUE, "y"}).empty());
+  EXPECT_THROW(primary_key_index->lookup({1}), std::logic_error);
+}
+
+TEST_F(PrimaryKeyIndexTest, MaintainedByTable) {
+  table->create_primary_key_index();
+  const auto& primary_key_index = table->primary_key_index();
+
+  table->append({3, "y", 1.0f});
+  EXPECT_EQ(primary_key_index->lookup({3, "y"}), (RowIDPosList{RowID{ChunkID{1}, 1}}));
+
+  const auto value_segment_a = std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{4});
+  const auto value_segment_b = std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{"z"});
+  const auto value_segment_c = std::make_shared<ValueSegment<float>>(pmr_vector<float>{1.0f});
+  table->append_chunk({value_segment_a, value_segment_b, value_segment_c}, std::make_shared<MvccData>(1, CommitID{0}));
+  EXPECT_EQ(primary_key_index->lookup({4, "z"}), (RowIDPosList{RowID{ChunkID{2}, 0}}));
+
+  // Entries are removed when their chunk is physically deleted
+  const auto chunk = table->get_chunk(ChunkID{0});
+  chunk->increase_invalid_row_count(chunk->size());
+  table->remove_chunk(ChunkID{0});
+  EXPECT_TRUE(primary_key_index->lookup({1, "x"}).empty());
+  EXPECT_EQ(primary_key_index->lookup({1, "y"}), (RowIDPosList{RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(PrimaryKeyIndexTest, MaintainedByInsertAndUpdate) {
+  table->create_primary_key_index();
+  const auto& primary_key_index = table->primary_key_index();
+
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({5, "x", 1.0f});
+  values_to_insert->append({6, "x", NULL_VALUE});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto insert = std::make_shared<Insert>("pk_table", table_wrapper);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+
+  // Rows are indexed before they are committed
+  EXPECT_EQ(primary_key_index->lookup({5, "x"}), (RowIDPosList{RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(primary_key_index->lookup({6, "x"}), (RowIDPosList{RowID{ChunkID{2}, 0}}));
+  insert_context->commit();
+
+  // An update adds the new version of the row, the old version remains in the index
+  const auto get_table = std::make_shared<GetTable>("pk_table");
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::String, false, "b");
+  const auto where_scan = std::make_shared<TableScan>(get_table, equals_(column_a, 2));
+  const auto updated_values = std::make_shared<Projection>(where_scan, expression_vector(column_a, column_b, 7.5f));
+
+  const auto update_context = Hyrise::get().transaction_manager.new_transaction_context();
+  get_table->set_transaction_context(update_context);
+  get_table->execute();
+  where_scan->execute();
+  updated_values->execute();
+
+  const auto update = std::make_shared<Update>("pk_table", where_scan, updated_values);
+  update->set_transaction_context(update_context);
+  update->execute();
+  update_context->commit();
+
+  EXPECT_EQ(primary_key_index->lookup({2, "x"}), (RowIDPosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{2}, 1}}));
+}
+
+TEST_F(PrimaryKeyIndexTest, RemoveInvalidatedRows) {
+  table->create_primary_key_index();
+  const auto& primary_key_index = table->primary_key_index();
+
+  // Invalidate {2, "x"} with commit id 2 and {1, "y"} with commit id 4
+  const auto invalidate_row = [&](const RowID row_id, const CommitID commit_id) {
+    const auto chunk = table->get_chunk(row_id.chunk_id);
+    chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
+    chunk->increase_invalid_row_count(1);
+  };
+  invalidate_row(RowID{ChunkID{0}, 1}, CommitID{2});
+  invalidate_row(RowID{ChunkID{1}, 0}, CommitID{4});
+
+  // Transactions with a snapshot older than the invalidation still see the rows
+  EXPECT_EQ(primary_key_index->remove_invalidated_rows(*table, CommitID{1}), 0);
+  EXPECT_EQ(primary_key_index->lookup({2, "x"}).size(), 1);
+
+  EXPECT_EQ(primary_key_index->remove_invalidated_rows(*table, CommitID{3}), 1);
+  EXPECT_TRUE(primary_key_index->lookup({2, "x"}).empty());
+  EXPECT_EQ(primary_key_index->lookup({1, "y"}).size(), 1);
+  EXPECT_EQ(primary_key_index->lookup({1, "x"}).size(), 1);
+
+  // Entries are only removed once
+  EXPECT_EQ(primary_key_index->remove_invalidated_rows(*table, CommitID{4}), 1);
+  EXPECT_EQ(primary_key_index->remove_invalidated_rows(*table, CommitID{5}), 0);
+  EXPECT_TRUE(primary_key_index->lookup({1, "y"}).empty());
+  EXPECT_EQ(primary_key_index->lookup({1, "x"}), (RowIDPosList{RowID{ChunkID{0}, 0}}));
+}
+
+}  // namespace opossum
@@ -17,8 +17,8 @@ namespace {
 
 // Used for debugging purposes
 [[maybe_unused]] void print_compressed_vector(const SimdBp128Vector& vector) {
-  for (auto _128_bit : vector.data()) {
-    for (auto _32_bit : _128_bit.data) {
+  for (auto block_index = size_t{0}; block_index < vector.data_block_count(); ++block_index) {
+    for (auto _32_bit : vector.data()[block_index].data) {
       std::cout << std::bitset<32>{_32_bit} << "|";
     }
     std::cout << std::endl;
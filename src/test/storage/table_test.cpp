@@ -140,6 +140,10 @@ TEST_F(StorageTableTest, FillingUpAChunkFinalizesIt) {
 
   EXPECT_EQ(*mvcc_data->max_begin_cid, 0);
   EXPECT_FALSE(c->is_mutable());
+
+  // Finalized chunks can be pruned right away
+  EXPECT_TRUE(c->pruning_statistics());
+  EXPECT_FALSE(t->get_chunk(ChunkID{1})->pruning_statistics());
 }
 
 TEST_F(StorageTableTest, AppendsMutableChunkIfLastChunkImmutableOnAppend) {
@@ -1,6 +1,8 @@
 #include "base_test.hpp"
 
+#include "benchmark_config.hpp"
 #include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/load_table.hpp"
 
@@ -51,6 +53,37 @@ TEST_F(TPCHTableGeneratorTest, SmallScaleFactor) {
   EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("region").table, load_table(dir_002 + "region.tbl", chunk_size));
 }
 
+TEST_F(TPCHTableGeneratorTest, ParallelGenerationMatchesSerialGeneration) {
+  // With a chunk size of 100, the customer, orders, and part tables are split into row ranges for four processes
+  const auto chunk_size = 100;
+  const auto serial_table_info_by_name = TPCHTableGenerator(0.01f, chunk_size, 1).generate();
+  const auto parallel_table_info_by_name = TPCHTableGenerator(0.01f, chunk_size, 4).generate();
+
+  for (const auto& [table_name, table_info] : serial_table_info_by_name) {
+    EXPECT_TABLE_EQ_ORDERED(parallel_table_info_by_name.at(table_name).table, table_info.table);
+  }
+}
+
+TEST_F(TPCHTableGeneratorTest, ParallelGenerationIsOptIn) {
+  auto benchmark_config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+  benchmark_config->chunk_size = 100;
+  const auto serial_table_info_by_name = TPCHTableGenerator(0.01f, benchmark_config).generate();
+
+  // The workers of the scheduler are stopped while the tables are generated in forked processes
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  benchmark_config->parallel_table_generation = true;
+  benchmark_config->cores = 4;
+  const auto parallel_table_info_by_name = TPCHTableGenerator(0.01f, benchmark_config).generate();
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler()));
+  EXPECT_TRUE(Hyrise::get().scheduler()->active());
+
+  for (const auto& [table_name, table_info] : serial_table_info_by_name) {
+    EXPECT_TABLE_EQ_ORDERED(parallel_table_info_by_name.at(table_name).table, table_info.table);
+  }
+}
+
 TEST_F(TPCHTableGeneratorTest, RowCountsMediumScaleFactor) {
   /**
    * Mostly intended to generate coverage and trigger potential leaks in third_party/tpch_dbgen
@@ -0,0 +1,88 @@
+#include <filesystem>
+
+#include "../base_test.hpp"
+
+#include "utils/spill_file.hpp"
+
+namespace opossum {
+
+class SpillFileTest : public BaseTest {};
+
+TEST_F(SpillFileTest, WriteAndReadBack) {
+  auto spill_file = SpillFile{};
+
+  const auto row_ids = std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{3}, ChunkOffset{2}}};
+  const auto strings = pmr_vector<pmr_string>{"", "a", "a string that is longer than the small string buffer"};
+  const auto null_values = pmr_vector<bool>{true, false, true};
+
+  spill_file.write(size_t{17});
+  spill_file.write(row_ids);
+  spill_file.write(strings);
+  spill_file.write(null_values);
+  spill_file.write(std::vector<int32_t>{});
+  spill_file.finish_writing();
+
+  EXPECT_GT(spill_file.size(), 0);
+
+  EXPECT_EQ(spill_file.read<size_t>(), 17);
+
+  auto read_row_ids = std::vector<RowID>{};
+  spill_file.read(read_row_ids);
+  EXPECT_EQ(read_row_ids, row_ids);
+
+  auto read_strings = pmr_vector<pmr_string>{};
+  spill_file.read(read_strings);
+  EXPECT_EQ(read_strings, strings);
+
+  auto read_null_values = pmr_vector<bool>{};
+  spill_file.read(read_null_values);
+  EXPECT_EQ(read_null_values, null_values);
+
+  auto read_ints = std::vector<int32_t>{1, 2};
+  spill_file.read(read_ints);
+  EXPECT_TRUE(read_ints.empty());
+}
+
+TEST_F(SpillFileTest, CompressedWriteAndReadBack) {
+  auto spill_file = SpillFile{true};
+  EXPECT_TRUE(spill_file.is_compressed());
+
+  const auto values = std::vector<int64_t>(10'000, 42);
+  const auto strings = pmr_vector<pmr_string>{"abc", "", "abc"};
+
+  spill_file.write(values);
+  spill_file.write(int32_t{-1});
+  spill_file.write(strings);
+  spill_file.finish_writing();
+
+  // Repeated values compress well
+  EXPECT_LT(spill_file.size(), spill_file.uncompressed_size() / 10);
+
+  auto read_values = std::vector<int64_t>{};
+  spill_file.read(read_values);
+  EXPECT_EQ(read_values, values);
+
+  EXPECT_EQ(spill_file.read<int32_t>(), -1);
+
+  auto read_strings = pmr_vector<pmr_string>{};
+  spill_file.read(read_strings);
+  EXPECT_EQ(read_strings, strings);
+}
+
+TEST_F(SpillFileTest, FileIsRemovedOnDestruction) {
+  auto path = std::string{};
+  {
+    auto spill_file = SpillFile{};
+    path = spill_file.path();
+    EXPECT_TRUE(std::filesystem::exists(path));
+  }
+  EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST_F(SpillFileTest, NoWritesAfterFinishing) {
+  auto spill_file = SpillFile{};
+  spill_file.finish_writing();
+  EXPECT_THROW(spill_file.finish_writing(), std::logic_error);
+}
+
+}  // namespace opossum